@@ -307,6 +307,137 @@ def kvcache_command(model, model_config, **kwargs):
     click.echo(tabulate(data, headers=labels, floatfmt=".6f"))
 
 
+@cli.command("layout")
+@common_args
+@nixl_bench_args
+@cli_args
+@click.option(
+    "--page_sizes",
+    type=str,
+    default="16,32,64,128",
+    help="Comma-separated page sizes (tokens) to sweep (default: 16,32,64,128)",
+)
+@click.option(
+    "--layer_groups",
+    type=str,
+    default="1,2,4,8",
+    help="Comma-separated layer group sizes to sweep (default: 1,2,4,8)",
+)
+@click.option(
+    "--emit_descs",
+    type=int,
+    default=0,
+    help="Print the first N descriptors of each layout (default: 0, off)",
+)
+@click.option(
+    "--run/--no-run",
+    default=False,
+    help="Run nixlbench per sweep point instead of printing its command",
+)
+@click.option(
+    "--format",
+    default="text",
+    type=str,
+    help="Output format of the sweep report [text, json, csv] (default: text)",
+)
+def layout_command(
+    model, model_config, page_sizes, layer_groups, emit_descs, run, format, **kwargs
+):
+    """Sweep KV page size x layer grouping over model-derived block layouts"""
+    from models.kv_layout import build_layout
+
+    if not model or not model_config:
+        click.echo("Error: --model and --model_config are required")
+        return
+
+    model_arch = BaseModelArch.from_yaml(model, None)
+    model_configuration = ModelConfig.from_yaml(model_config)
+    override_yaml_args(model_configuration, type("Args", (), kwargs)())
+    model_arch.set_model_config(model_configuration)
+
+    filtered_args = {
+        k: v for k, v in kwargs.items() if k in NIXLBench.defaults() and v is not None
+    }
+
+    rows = []
+    for page_size in [int(x) for x in page_sizes.split(",")]:
+        for layer_group in [int(x) for x in layer_groups.split(",")]:
+            model_configuration.system.page_size = page_size
+            try:
+                kv_layout = build_layout(
+                    model_arch, model_configuration, page_size, layer_group
+                )
+            except ValueError:
+                # Grouping doesn't divide the local layer count; skip
+                continue
+
+            # One nixlbench block per descriptor, one batch per request
+            # sweep: the measured bandwidth is the effective bandwidth of
+            # this layout's exact descriptor shape
+            nixl_bench = NIXLBench(model_arch, model_configuration, **filtered_args)
+            nixl_bench.set_io_size(kv_layout.desc_size)
+            nixl_bench.set_batch_size(kv_layout.total_descs)
+            nixl_bench.configure_buffer_size()
+            nixl_bench.configure_scheme(direction="isl")
+            nixl_bench.configure_segment_type(
+                kwargs.get("backend"), kwargs.get("source"), kwargs.get("destination")
+            )
+
+            row = kv_layout.to_dict()
+            rows.append(row)
+
+            if emit_descs > 0:
+                click.echo(
+                    f"# page_size={page_size} layer_group={layer_group} "
+                    f"descriptors (addr, len, devId):"
+                )
+                for i, desc in enumerate(kv_layout.descs()):
+                    if i >= emit_descs:
+                        break
+                    click.echo(f"  {desc}")
+
+            if run:
+                separator = "=" * 80
+                click.echo(separator)
+                click.echo(
+                    f"Running: page_size={page_size} layer_group={layer_group} "
+                    f"io_size={kv_layout.desc_size} batch={kv_layout.total_descs}"
+                )
+                click.echo(separator)
+                nixl_bench.profile()
+            elif format == "text":
+                row["nixlbench_command"] = nixl_bench.plan(format="text")
+
+    if format == "json":
+        click.echo(json.dumps(rows, indent=2))
+    elif format == "csv":
+        fieldnames = set()
+        for row in rows:
+            fieldnames.update(row.keys())
+        output = io.StringIO()
+        writer = csv.DictWriter(output, fieldnames=sorted(fieldnames))
+        writer.writeheader()
+        for row in rows:
+            writer.writerow(row)
+        click.echo(output.getvalue())
+    else:
+        commands = [row.pop("nixlbench_command", None) for row in rows]
+        if rows:
+            click.echo(
+                tabulate([list(row.values()) for row in rows], headers=list(rows[0]))
+            )
+        if not run:
+            for row, command in zip(rows, commands):
+                if command is None:
+                    continue
+                click.echo()
+                click.echo(
+                    f"# page_size={row['page_size']} "
+                    f"layer_group={row['layer_group']}"
+                )
+                click.echo(command)
+
+
 @cli.command("sequential-ct-perftest")
 @click.argument("config_file", type=click.Path(exists=True))
 @click.option(
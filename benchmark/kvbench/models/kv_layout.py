@@ -0,0 +1,193 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import math
+from dataclasses import dataclass
+from typing import Iterator, List, Tuple
+
+from models.model_config import ModelConfig
+from models.models import BaseModelArch
+
+
+@dataclass
+class KVBlockLayout:
+    """
+    Descriptor-level view of a paged-attention KV cache on one GPU.
+
+    Models the layout a paged-attention allocator produces: layers resident
+    on this GPU (after the pipeline-parallel split) are partitioned into
+    groups of `layer_group` consecutive layers; each group owns a pool in
+    which the KV blocks of its layers are contiguous per page and strided
+    per page. Transferring one request therefore takes one descriptor per
+    (page, layer group) pair, of `layer_group` per-layer blocks each, which
+    is exactly the nixl_xfer_dlist_t shape the transfer path sees.
+
+    All sizes are per GPU, i.e. after the tensor-parallel split.
+    """
+
+    page_size: int  # tokens per KV page
+    layer_group: int  # consecutive layers contiguous per page
+    num_local_layers: int  # layers resident on this GPU (after PP split)
+    page_bytes: int  # one layer's K+V for one page on this GPU
+    pages_per_request: int
+    num_requests: int
+
+    @property
+    def desc_size(self) -> int:
+        """Bytes covered by a single descriptor (one page, one layer group)."""
+        return self.page_bytes * self.layer_group
+
+    @property
+    def num_groups(self) -> int:
+        return self.num_local_layers // self.layer_group
+
+    @property
+    def descs_per_request(self) -> int:
+        return self.pages_per_request * self.num_groups
+
+    @property
+    def total_descs(self) -> int:
+        return self.descs_per_request * self.num_requests
+
+    @property
+    def bytes_per_request(self) -> int:
+        return self.descs_per_request * self.desc_size
+
+    @property
+    def pool_bytes(self) -> int:
+        """Bytes of one layer group's pool over all allocated pages."""
+        return self.pages_per_request * self.num_requests * self.desc_size
+
+    def descs(
+        self, request: int = 0, base_addr: int = 0, dev_id: int = 0
+    ) -> Iterator[Tuple[int, int, int]]:
+        """
+        Yield the (addr, len, devId) descriptors for one request, in the
+        order the transfer path builds them: page-major, layer groups
+        inner. Pages of a request are taken as consecutive block indices;
+        a real allocator scatters them, which changes addresses but not
+        the descriptor count, sizes, or strides this generator models.
+
+        Args:
+            request (int): Request index into the allocated page range.
+            base_addr (int): Base address/offset of the KV pool region.
+            dev_id (int): Device ID stamped into every descriptor.
+
+        Yields:
+            Tuple[int, int, int]: (addr, len, devId) of one descriptor.
+        """
+        first_page = request * self.pages_per_request
+        for page in range(first_page, first_page + self.pages_per_request):
+            for group in range(self.num_groups):
+                addr = (
+                    base_addr
+                    + group * self.pool_bytes
+                    + page * self.desc_size
+                )
+                yield (addr, self.desc_size, dev_id)
+
+    def to_dict(self) -> dict:
+        """Flat summary of the layout, one row of a sweep report."""
+        return {
+            "page_size": self.page_size,
+            "layer_group": self.layer_group,
+            "num_local_layers": self.num_local_layers,
+            "page_bytes": self.page_bytes,
+            "desc_size": self.desc_size,
+            "pages_per_request": self.pages_per_request,
+            "descs_per_request": self.descs_per_request,
+            "total_descs": self.total_descs,
+            "bytes_per_request": self.bytes_per_request,
+        }
+
+
+def build_layout(
+    model: BaseModelArch,
+    model_config: ModelConfig,
+    page_size: int,
+    layer_group: int,
+) -> KVBlockLayout:
+    """
+    Build the KV block layout a paged-attention allocator produces for
+    the given model spec and parallelism settings.
+
+    Args:
+        model (BaseModelArch): Model architecture (layers, heads, dtype).
+        model_config (ModelConfig): Parallelism and runtime configuration.
+        page_size (int): Tokens per KV page.
+        layer_group (int): Consecutive layers stored contiguously per page.
+            Must divide the number of layers resident on one GPU.
+
+    Returns:
+        KVBlockLayout: The resulting descriptor layout.
+
+    Raises:
+        ValueError: If layer_group does not divide the local layer count.
+    """
+    num_layers = model.num_layers
+    num_local_layers = num_layers // model_config.model.pp_size
+    if (layer_group <= 0) or (num_local_layers % layer_group != 0):
+        raise ValueError(
+            f"layer_group {layer_group} must divide the "
+            f"{num_local_layers} layers resident per GPU"
+        )
+
+    # Per-token, per-layer KV bytes on one GPU: both K and V, after the
+    # tensor-parallel split, same derivation as the models' get_io_size
+    kv_token_layer = int(
+        model.get_kv_size_per_token() / num_layers / model_config.model.tp_size
+    )
+    if kv_token_layer <= 0:
+        raise ValueError("Invalid KV Size: 0")
+
+    return KVBlockLayout(
+        page_size=page_size,
+        layer_group=layer_group,
+        num_local_layers=num_local_layers,
+        page_bytes=kv_token_layer * page_size,
+        pages_per_request=math.ceil(model_config.runtime.isl / page_size),
+        num_requests=model_config.runtime.num_requests,
+    )
+
+
+def sweep_layouts(
+    model: BaseModelArch,
+    model_config: ModelConfig,
+    page_sizes: List[int],
+    layer_groups: List[int],
+) -> List[KVBlockLayout]:
+    """
+    Build layouts over the page size x layer grouping grid, skipping
+    groupings that do not divide the local layer count.
+
+    Args:
+        model (BaseModelArch): Model architecture specification.
+        model_config (ModelConfig): Parallelism and runtime configuration.
+        page_sizes (List[int]): Page sizes (tokens) to sweep.
+        layer_groups (List[int]): Layer group sizes to sweep.
+
+    Returns:
+        List[KVBlockLayout]: One layout per valid sweep point.
+    """
+    layouts = []
+    for page_size in page_sizes:
+        for layer_group in layer_groups:
+            try:
+                layouts.append(
+                    build_layout(model, model_config, page_size, layer_group)
+                )
+            except ValueError:
+                continue
+    return layouts
@@ -154,6 +154,8 @@ static int processBatchSizes(xferBenchWorker &worker,
 
             xferBenchUtils::printStats(
                 false, block_size, batch_size, std::get<xferBenchStats>(result));
+            xferBenchUtils::printLatencyStats(
+                block_size, batch_size, std::get<xferBenchStats>(result));
         }
     }
 
@@ -189,7 +191,12 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
 
-    int num_threads = xferBenchConfig::num_threads;
+    // Either a single run with num_threads, or each step of the sweep; all
+    // sweep steps share the same nixlAgent and differ only in posting threads
+    std::vector<int> thread_counts = {xferBenchConfig::num_threads};
+    if (!xferBenchConfig::num_threads_sweep.empty()) {
+        thread_counts = xferBenchConfig::num_threads_sweep;
+    }
 
     // Create the appropriate worker based on worker configuration
     std::unique_ptr<xferBenchWorker> worker_ptr = createWorker(&argc, &argv);
@@ -206,29 +213,113 @@ int main(int argc, char *argv[]) {
         return EXIT_FAILURE;
     }
 
-    std::vector<std::vector<xferBenchIOV>> iov_lists = worker_ptr->allocateMemory(num_threads);
-    auto mem_guard = make_scope_guard ([&] {
-        worker_ptr->deallocateMemory(iov_lists);
-    });
+    if (worker_ptr->isInitiator() && worker_ptr->isMasterRank()) {
+        xferBenchConfig::printConfig();
+    }
 
-    ret = worker_ptr->exchangeMetadata();
-    if (0 != ret) {
-        return EXIT_FAILURE;
+    // Trace replay mode skips the block size sweep and replays the captured
+    // operations against the full per-device buffers
+    if (!xferBenchConfig::trace_file.empty()) {
+        std::vector<xferBenchTraceEntry> trace = xferBenchUtils::loadTrace();
+        if (trace.empty()) {
+            return EXIT_FAILURE;
+        }
+
+        std::vector<std::vector<xferBenchIOV>> iov_lists = worker_ptr->allocateMemory(1);
+        auto mem_guard = make_scope_guard ([&] {
+            worker_ptr->deallocateMemory(iov_lists);
+        });
+
+        ret = worker_ptr->exchangeMetadata();
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+
+        std::vector<std::vector<xferBenchIOV>> remote_iov_lists(
+            worker_ptr->exchangeIOV(iov_lists, xferBenchConfig::max_block_size));
+
+        // loadFromFlags only allows trace mode with the nixl worker
+        auto *nixl_worker = dynamic_cast<xferBenchNixlWorker *>(worker_ptr.get());
+        ret = nixl_worker->replayTrace(trace, iov_lists, remote_iov_lists);
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+
+        ret = worker_ptr->synchronize(); // Make sure environment is not used anymore
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+
+        gflags::ShutDownCommandLineFlags();
+
+        return worker_ptr->signaled() ? EXIT_FAILURE : EXIT_SUCCESS;
     }
 
-    if (worker_ptr->isInitiator() && worker_ptr->isMasterRank()) {
-        xferBenchConfig::printConfig();
-        xferBenchUtils::printStatsHeader();
+    // Storage sweep mode replaces the regular sweep: same block size and
+    // batch bounds, run once per configured file-offset alignment
+    if (xferBenchConfig::storage_sweep) {
+        std::vector<std::vector<xferBenchIOV>> iov_lists = worker_ptr->allocateMemory(1);
+        auto mem_guard = make_scope_guard ([&] {
+            worker_ptr->deallocateMemory(iov_lists);
+        });
+
+        ret = worker_ptr->exchangeMetadata();
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+
+        // loadFromFlags only allows the storage sweep with the nixl worker
+        auto *nixl_worker = dynamic_cast<xferBenchNixlWorker *>(worker_ptr.get());
+        ret = nixl_worker->runStorageSweep(iov_lists);
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+
+        ret = worker_ptr->synchronize(); // Make sure environment is not used anymore
+        if (0 != ret) {
+            return EXIT_FAILURE;
+        }
+
+        gflags::ShutDownCommandLineFlags();
+
+        return worker_ptr->signaled() ? EXIT_FAILURE : EXIT_SUCCESS;
     }
 
-    for (size_t block_size = xferBenchConfig::start_block_size;
-         !worker_ptr->signaled() &&
-         block_size <= xferBenchConfig::max_block_size;
-         block_size *= 2) {
-        ret = processBatchSizes(*worker_ptr, iov_lists, block_size, num_threads);
+    for (const int num_threads : thread_counts) {
+        if (worker_ptr->signaled()) {
+            break;
+        }
+        xferBenchConfig::num_threads = num_threads;
+
+        // Buffers are carved per thread, so each sweep step reallocates and
+        // re-exchanges metadata for its thread count
+        std::vector<std::vector<xferBenchIOV>> iov_lists = worker_ptr->allocateMemory(num_threads);
+        auto mem_guard = make_scope_guard ([&] {
+            worker_ptr->deallocateMemory(iov_lists);
+        });
+
+        ret = worker_ptr->exchangeMetadata();
         if (0 != ret) {
             return EXIT_FAILURE;
         }
+
+        if (worker_ptr->isInitiator() && worker_ptr->isMasterRank()) {
+            if (thread_counts.size() > 1) {
+                xferBenchConfig::printSeparator('=');
+                std::cout << "Thread sweep: " << num_threads << " posting threads" << std::endl;
+            }
+            xferBenchUtils::printStatsHeader();
+        }
+
+        for (size_t block_size = xferBenchConfig::start_block_size;
+             !worker_ptr->signaled() &&
+             block_size <= xferBenchConfig::max_block_size;
+             block_size *= 2) {
+            ret = processBatchSizes(*worker_ptr, iov_lists, block_size, num_threads);
+            if (0 != ret) {
+                return EXIT_FAILURE;
+            }
+        }
     }
 
     ret = worker_ptr->synchronize(); // Make sure environment is not used anymore
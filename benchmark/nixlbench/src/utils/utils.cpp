@@ -31,6 +31,7 @@
 #endif
 #include <fcntl.h>
 #include <filesystem>
+#include <fstream>
 
 #include "runtime/etcd/etcd_rt.h"
 #include "utils/utils.h"
@@ -120,6 +121,23 @@ DEFINE_string(obj_endpoint_override, "", "Endpoint override for S3 backend");
 DEFINE_string(obj_req_checksum,
               XFERBENCH_OBJ_REQ_CHECKSUM_SUPPORTED,
               "Required checksum for S3 backend [supported, required]");
+DEFINE_string(latency_percentiles, "", "Comma-separated latency percentiles to report per block \
+size (e.g. 50,90,99,99.9). Enables latency histogram mode with separate post and transfer \
+histograms (Default: disabled)");
+DEFINE_string(latency_csv_file, "", "Path to append per-metric latency percentiles as CSV rows \
+(requires --latency_percentiles)");
+DEFINE_string(num_threads_sweep, "", "Comma-separated thread counts to sweep (e.g. 1,4,32). All \
+threads share one nixlAgent and post concurrently; per-thread throughput and post latency are \
+reported per step. Overrides --num_threads (Default: disabled)");
+DEFINE_string(trace_file, "", "Path to a trace file to replay instead of the block size sweep. \
+One \"timestamp_us,op,size[,peer]\" entry per line, posted with open-loop arrival timing; goodput \
+and queueing delay are reported (only used with nixl worker, Default: disabled)");
+DEFINE_bool(storage_sweep, false, "Run the block size x batch size sweep once per file-offset \
+alignment through real nixlAgent FILE transfers, reporting IOPS and CPU per GB per combination. \
+Sweep the backend/API axis (POSIX AIO/URING, GDS, GDS_MT) by invoking nixlbench once per \
+--backend/--posix_api_type (storage backends only, Default: disabled)");
+DEFINE_string(storage_sweep_alignments, "512,4096", "Comma-separated file-offset alignments in \
+bytes for --storage_sweep (Default: 512,4096)");
 
 std::string xferBenchConfig::runtime_type = "";
 std::string xferBenchConfig::worker_type = "";
@@ -166,6 +184,24 @@ std::string xferBenchConfig::obj_region = "";
 bool xferBenchConfig::obj_use_virtual_addressing = false;
 std::string xferBenchConfig::obj_endpoint_override = "";
 std::string xferBenchConfig::obj_req_checksum = "";
+std::string xferBenchConfig::latency_percentiles = "";
+std::string xferBenchConfig::latency_csv_file = "";
+std::vector<int> xferBenchConfig::num_threads_sweep = {};
+std::string xferBenchConfig::trace_file = "";
+bool xferBenchConfig::storage_sweep = false;
+std::vector<size_t> xferBenchConfig::storage_sweep_alignments = {};
+
+static std::vector<double>
+parsePercentileList(const std::string &list) {
+    std::vector<double> percentiles;
+    std::string pct;
+    std::stringstream ss(list);
+
+    while (std::getline(ss, pct, ',')) {
+        percentiles.push_back(std::stod(pct));
+    }
+    return percentiles;
+}
 
 int
 xferBenchConfig::loadFromFlags() {
@@ -273,6 +309,98 @@ xferBenchConfig::loadFromFlags() {
     num_files = FLAGS_num_files;
     posix_api_type = FLAGS_posix_api_type;
     storage_enable_direct = FLAGS_storage_enable_direct;
+    latency_percentiles = FLAGS_latency_percentiles;
+    latency_csv_file = FLAGS_latency_csv_file;
+    trace_file = FLAGS_trace_file;
+
+    num_threads_sweep.clear();
+    if (!FLAGS_num_threads_sweep.empty()) {
+        std::string count;
+        std::stringstream ss(FLAGS_num_threads_sweep);
+        try {
+            while (std::getline(ss, count, ',')) {
+                const int n = std::stoi(count);
+                if (n <= 0) {
+                    std::cerr << "Invalid thread count in sweep: " << n << std::endl;
+                    return -1;
+                }
+                num_threads_sweep.push_back(n);
+            }
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Failed to parse thread sweep: " << FLAGS_num_threads_sweep << std::endl;
+            return -1;
+        }
+    }
+
+    if (!latency_csv_file.empty() && latency_percentiles.empty()) {
+        std::cerr << "--latency_csv_file requires --latency_percentiles" << std::endl;
+        return -1;
+    }
+    if (!latency_percentiles.empty()) {
+        try {
+            for (const double pct : parsePercentileList(latency_percentiles)) {
+                if (pct <= 0 || pct >= 100) {
+                    std::cerr << "Invalid latency percentile: " << pct
+                              << ". Must be in (0, 100)" << std::endl;
+                    return -1;
+                }
+            }
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Failed to parse latency percentiles: " << latency_percentiles
+                      << std::endl;
+            return -1;
+        }
+    }
+
+    if (!trace_file.empty()) {
+        if (worker_type != XFERBENCH_WORKER_NIXL) {
+            std::cerr << "--trace_file is only supported with the nixl worker" << std::endl;
+            return -1;
+        }
+        if (isStorageBackend()) {
+            std::cerr << "--trace_file is not supported with storage backends" << std::endl;
+            return -1;
+        }
+    }
+
+    storage_sweep = FLAGS_storage_sweep;
+    if (storage_sweep) {
+        if (worker_type != XFERBENCH_WORKER_NIXL) {
+            std::cerr << "--storage_sweep is only supported with the nixl worker" << std::endl;
+            return -1;
+        }
+        if (!isStorageBackend() || backend == XFERBENCH_BACKEND_OBJ) {
+            std::cerr << "--storage_sweep requires a FILE storage backend "
+                      << "[POSIX, GDS, GDS_MT, HF3FS]" << std::endl;
+            return -1;
+        }
+
+        storage_sweep_alignments.clear();
+        std::string align;
+        std::stringstream ss(FLAGS_storage_sweep_alignments);
+        try {
+            while (std::getline(ss, align, ',')) {
+                const long a = std::stol(align);
+                if (a <= 0 || (a & (a - 1)) != 0) {
+                    std::cerr << "Storage sweep alignments must be positive powers of two: "
+                              << align << std::endl;
+                    return -1;
+                }
+                storage_sweep_alignments.push_back(a);
+            }
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Failed to parse storage sweep alignments: "
+                      << FLAGS_storage_sweep_alignments << std::endl;
+            return -1;
+        }
+        if (storage_sweep_alignments.empty()) {
+            std::cerr << "--storage_sweep requires at least one alignment" << std::endl;
+            return -1;
+        }
+    }
 
     if (worker_type == XFERBENCH_WORKER_NVSHMEM) {
         if (!((XFERBENCH_SEG_TYPE_VRAM == initiator_seg_type) &&
@@ -319,32 +447,61 @@ xferBenchConfig::loadFromFlags() {
         return -1;
     }
 
-    int partition = (num_threads * large_blk_iter_ftr);
-    if (num_iter % partition) {
-        num_iter += partition - (num_iter % partition);
-        std::cout << "WARNING: Adjusting num_iter to " << num_iter
-                  << " to allow equal distribution to " << num_threads << " threads"
-                  << std::endl;
-    }
-    if (warmup_iter % partition) {
-        warmup_iter += partition - (warmup_iter % partition);
-        std::cout << "WARNING: Adjusting warmup_iter to " << warmup_iter
-                  << " to allow equal distribution to " << num_threads << " threads"
-                  << std::endl;
+    // All thread counts that will run: either a single run with num_threads
+    // or each step of the sweep
+    std::vector<int> thread_counts =
+        num_threads_sweep.empty() ? std::vector<int>{num_threads} : num_threads_sweep;
+
+    // Iterate the adjustment until num_iter/warmup_iter divide evenly for
+    // every thread count (one pass for the usual power-of-two sweeps)
+    bool adjusted = true;
+    for (int pass = 0; adjusted && pass < 16; pass++) {
+        adjusted = false;
+        for (const int threads : thread_counts) {
+            int partition = (threads * large_blk_iter_ftr);
+            if (num_iter % partition) {
+                num_iter += partition - (num_iter % partition);
+                std::cout << "WARNING: Adjusting num_iter to " << num_iter
+                          << " to allow equal distribution to " << threads << " threads"
+                          << std::endl;
+                adjusted = true;
+            }
+            if (warmup_iter % partition) {
+                warmup_iter += partition - (warmup_iter % partition);
+                std::cout << "WARNING: Adjusting warmup_iter to " << warmup_iter
+                          << " to allow equal distribution to " << threads << " threads"
+                          << std::endl;
+                adjusted = true;
+            }
+        }
     }
-    partition = (num_initiator_dev * num_threads);
-    if (total_buffer_size % partition) {
-        std::cerr << "Total_buffer_size must be divisible by the product of num_threads and num_initiator_dev"
-                  << ", next such value is " << total_buffer_size + partition - (total_buffer_size % partition)
+    if (adjusted) {
+        std::cerr << "Could not find a num_iter dividing evenly across the thread sweep"
                   << std::endl;
         return -1;
     }
-    partition = (num_target_dev * num_threads);
-    if (total_buffer_size % partition) {
-        std::cerr << "Total_buffer_size must be divisible by the product of num_threads and num_target_dev"
-                  << ", next such value is " << total_buffer_size + partition - (total_buffer_size % partition)
-                  << std::endl;
-        return -1;
+
+    for (const int threads : thread_counts) {
+        int partition = (num_initiator_dev * threads);
+        if (total_buffer_size % partition) {
+            std::cerr << "Total_buffer_size must be divisible by the product of num_threads and num_initiator_dev"
+                      << ", next such value is " << total_buffer_size + partition - (total_buffer_size % partition)
+                      << std::endl;
+            return -1;
+        }
+        partition = (num_target_dev * threads);
+        if (total_buffer_size % partition) {
+            std::cerr << "Total_buffer_size must be divisible by the product of num_threads and num_target_dev"
+                      << ", next such value is " << total_buffer_size + partition - (total_buffer_size % partition)
+                      << std::endl;
+            return -1;
+        }
+        if (max_block_size > (total_buffer_size / threads)) {
+            std::cerr << "Incorrect buffer size configuration" << " max_block_size("
+                      << max_block_size << ") >" << " (total_buffer_size / num_threads)("
+                      << (total_buffer_size / threads) << ")" << std::endl;
+            return -1;
+        }
     }
 
     return 0;
@@ -443,6 +600,23 @@ xferBenchConfig::printConfig() {
     printOption("Large block iter factor (--large_blk_iter_ftr=N)",
                 std::to_string(large_blk_iter_ftr));
     printOption ("Num threads (--num_threads=N)", std::to_string (num_threads));
+    if (!num_threads_sweep.empty()) {
+        printOption("Thread sweep (--num_threads_sweep=n1,n2,...)", FLAGS_num_threads_sweep);
+    }
+    if (!latency_percentiles.empty()) {
+        printOption("Latency percentiles (--latency_percentiles=p1,p2,...)", latency_percentiles);
+        if (!latency_csv_file.empty()) {
+            printOption("Latency CSV file (--latency_csv_file=path)", latency_csv_file);
+        }
+    }
+    if (!trace_file.empty()) {
+        printOption("Trace file (--trace_file=path)", trace_file);
+    }
+    if (storage_sweep) {
+        printOption("Storage sweep (--storage_sweep=[0,1])", std::to_string(storage_sweep));
+        printOption("Storage sweep alignments (--storage_sweep_alignments=a1,a2,...)",
+                    FLAGS_storage_sweep_alignments);
+    }
     printSeparator('-');
     std::cout << std::endl;
 }
@@ -742,6 +916,228 @@ xferBenchUtils::printStats(bool is_target,
     }
 }
 
+void
+xferBenchUtils::printLatencyStats(size_t block_size, size_t batch_size, xferBenchStats stats) {
+    if (xferBenchConfig::latency_percentiles.empty()) {
+        return;
+    }
+
+    const std::vector<double> percentiles =
+        parsePercentileList(xferBenchConfig::latency_percentiles);
+    const std::pair<const char *, xferMetricStats &> metrics[] = {
+        {"post", stats.post_duration},
+        {"transfer", stats.transfer_duration},
+    };
+
+    for (const auto &[name, metric] : metrics) {
+        std::cout << "Latency histogram [" << name << "] (block size " << block_size
+                  << ", batch size " << batch_size << ")" << std::endl;
+        for (const auto &[bound, count] : metric.histogram()) {
+            if (0 == count) {
+                continue;
+            }
+            std::cout << "  <= " << std::setw(12) << bound << " us: " << count << std::endl;
+        }
+        for (const double pct : percentiles) {
+            std::cout << "  p" << pct << ": " << std::fixed << std::setprecision(1)
+                      << metric.percentile(pct) << " us" << std::endl;
+        }
+    }
+
+    if (!xferBenchConfig::latency_csv_file.empty()) {
+        const bool write_header = !std::filesystem::exists(xferBenchConfig::latency_csv_file);
+        std::ofstream csv(xferBenchConfig::latency_csv_file, std::ios::app);
+        if (!csv) {
+            std::cerr << "Failed to open latency CSV file: " << xferBenchConfig::latency_csv_file
+                      << std::endl;
+            return;
+        }
+        if (write_header) {
+            csv << "block_size,batch_size,metric,percentile,latency_us" << std::endl;
+        }
+        for (const auto &[name, metric] : metrics) {
+            for (const double pct : percentiles) {
+                csv << block_size << "," << batch_size << "," << name << "," << pct << ","
+                    << metric.percentile(pct) << std::endl;
+            }
+        }
+    }
+}
+
+void
+xferBenchUtils::printThreadStats(size_t bytes_per_iter, std::vector<xferBenchStats> thread_stats) {
+    // The fastest post across all threads approximates the uncontended
+    // submission cost; per-thread average above it is time spent waiting on
+    // the shared agent (nixlLock and backend submission)
+    double min_post = 0;
+    for (auto &stats : thread_stats) {
+        if (stats.post_duration.count() &&
+            (0 == min_post || stats.post_duration.min() < min_post)) {
+            min_post = stats.post_duration.min();
+        }
+    }
+
+    // clang-format off
+    std::cout << std::left
+              << std::setw(20) << "Thread"
+              << std::setw(15) << "B/W (GB/Sec)"
+              << std::setw(15) << "Avg Post (us)"
+              << std::setw(15) << "P99 Post (us)"
+              << std::setw(20) << "Est Lock Wait (us)"
+              << std::setw(15) << "Avg Tx (us)"
+              << std::setw(15) << "P99 Tx (us)"
+              << std::endl;
+    // clang-format on
+
+    for (size_t tid = 0; tid < thread_stats.size(); tid++) {
+        auto &stats = thread_stats[tid];
+        const size_t iters = stats.transfer_duration.count();
+        const double active_us =
+            (stats.post_duration.avg() * stats.post_duration.count()) +
+            (stats.transfer_duration.avg() * iters);
+        const double throughput_gb = active_us > 0 ?
+            (((double)bytes_per_iter * iters) / (1000 * 1000 * 1000)) / (active_us / 1e6) :
+            0;
+
+        // clang-format off
+        std::cout << std::left << std::fixed << std::setprecision(6)
+                  << std::setw(20) << tid
+                  << std::setw(15) << throughput_gb
+                  << std::setprecision(1)
+                  << std::setw(15) << stats.post_duration.avg()
+                  << std::setw(15) << stats.post_duration.p99()
+                  << std::setw(20) << (stats.post_duration.avg() - min_post)
+                  << std::setw(15) << stats.transfer_duration.avg()
+                  << std::setw(15) << stats.transfer_duration.p99()
+                  << std::endl;
+        // clang-format on
+    }
+}
+
+std::vector<xferBenchTraceEntry>
+xferBenchUtils::loadTrace() {
+    std::vector<xferBenchTraceEntry> trace;
+    std::ifstream file(xferBenchConfig::trace_file);
+
+    if (!file) {
+        std::cerr << "Failed to open trace file: " << xferBenchConfig::trace_file << std::endl;
+        return trace;
+    }
+
+    std::string line;
+    size_t line_num = 0;
+    while (std::getline(file, line)) {
+        line_num++;
+        if (line.empty() || '#' == line[0]) {
+            continue;
+        }
+
+        xferBenchTraceEntry entry;
+        std::string field;
+        std::stringstream ss(line);
+        try {
+            std::getline(ss, field, ',');
+            entry.timestamp = std::stoull(field);
+            std::getline(ss, entry.op, ',');
+            std::getline(ss, field, ',');
+            entry.size = std::stoull(field);
+            if (!std::getline(ss, entry.peer, ',')) {
+                entry.peer = "target";
+            }
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Failed to parse trace entry at line " << line_num << ": " << line
+                      << std::endl;
+            return {};
+        }
+
+        if (XFERBENCH_OP_READ != entry.op && XFERBENCH_OP_WRITE != entry.op) {
+            std::cerr << "Invalid op in trace entry at line " << line_num << ": " << entry.op
+                      << ". Must be one of [READ, WRITE]" << std::endl;
+            return {};
+        }
+        if (0 == entry.size) {
+            std::cerr << "Invalid size in trace entry at line " << line_num << std::endl;
+            return {};
+        }
+        trace.push_back(entry);
+    }
+
+    if (trace.empty()) {
+        std::cerr << "Trace file is empty: " << xferBenchConfig::trace_file << std::endl;
+        return trace;
+    }
+
+    // Replay works on arrival offsets from the first captured operation
+    std::stable_sort(trace.begin(),
+                     trace.end(),
+                     [](const xferBenchTraceEntry &a, const xferBenchTraceEntry &b) {
+                         return a.timestamp < b.timestamp;
+                     });
+    const nixlTime::us_t first = trace[0].timestamp;
+    for (auto &entry : trace) {
+        entry.timestamp -= first;
+    }
+    return trace;
+}
+
+void
+xferBenchUtils::printStorageSweepHeader() {
+    std::string backend_label = xferBenchConfig::backend;
+    if (XFERBENCH_BACKEND_POSIX == xferBenchConfig::backend) {
+        backend_label += "/" + xferBenchConfig::posix_api_type;
+    }
+
+    xferBenchConfig::printSeparator('=');
+    std::cout << "Storage sweep: " << backend_label << ", "
+              << (xferBenchConfig::storage_enable_direct ? "O_DIRECT" : "buffered") << ", op "
+              << xferBenchConfig::op_type << std::endl;
+    // clang-format off
+    std::cout << std::left
+              << std::setw(15) << "Align (B)"
+              << std::setw(20) << "Block Size (B)"
+              << std::setw(15) << "Depth"
+              << std::setw(15) << "IOPS"
+              << std::setw(15) << "B/W (GB/Sec)"
+              << std::setw(15) << "Avg Lat. (us)"
+              << std::setw(15) << "CPU (s/GB)"
+              << std::endl;
+    // clang-format on
+    xferBenchConfig::printSeparator('-');
+}
+
+void
+xferBenchUtils::printStorageSweepStats(size_t alignment,
+                                       size_t block_size,
+                                       size_t depth,
+                                       size_t total_ops,
+                                       size_t total_bytes,
+                                       double duration_us,
+                                       double cpu_us) {
+    const double duration_sec = duration_us / 1e6;
+    const double total_gb = (double)total_bytes / (1000 * 1000 * 1000);
+    const double iops = duration_sec > 0 ? total_ops / duration_sec : 0;
+    const double throughput_gb = duration_sec > 0 ? total_gb / duration_sec : 0;
+    const double avg_latency = total_ops > 0 ? duration_us / total_ops : 0;
+    const double cpu_per_gb = total_gb > 0 ? (cpu_us / 1e6) / total_gb : 0;
+
+    // clang-format off
+    std::cout << std::left << std::fixed
+              << std::setw(15) << alignment
+              << std::setw(20) << block_size
+              << std::setw(15) << depth
+              << std::setprecision(0)
+              << std::setw(15) << iops
+              << std::setprecision(6)
+              << std::setw(15) << throughput_gb
+              << std::setprecision(1)
+              << std::setw(15) << avg_latency
+              << std::setprecision(4)
+              << std::setw(15) << cpu_per_gb
+              << std::endl;
+    // clang-format on
+}
+
 std::string
 xferBenchUtils::buildAwsCredentials() {
     std::string env_setup = "";
@@ -893,28 +1289,57 @@ xferMetricStats::avg() const {
 
 double
 xferMetricStats::p90() {
-    if (samples.empty()) return 0;
-    std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.9;
-    return samples[std::min(index, samples.size() - 1)];
+    return percentile(90);
 }
 
 double
 xferMetricStats::p95() {
-    if (samples.empty()) return 0;
-    std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.95;
-    return samples[std::min(index, samples.size() - 1)];
+    return percentile(95);
 }
 
 double
 xferMetricStats::p99() {
+    return percentile(99);
+}
+
+double
+xferMetricStats::percentile(double pct) {
     if (samples.empty()) return 0;
     std::sort(samples.begin(), samples.end());
-    size_t index = samples.size() * 0.99;
+    size_t index = samples.size() * (pct / 100.0);
     return samples[std::min(index, samples.size() - 1)];
 }
 
+std::vector<std::pair<double, size_t>>
+xferMetricStats::histogram() {
+    std::vector<std::pair<double, size_t>> buckets;
+
+    if (samples.empty()) {
+        return buckets;
+    }
+
+    const double max_val = max();
+    for (double bound = 1.0; ; bound *= 2) {
+        buckets.push_back({bound, 0});
+        if (bound >= max_val) {
+            break;
+        }
+    }
+    for (const double sample : samples) {
+        size_t i = 0;
+        while (buckets[i].first < sample) {
+            i++;
+        }
+        buckets[i].second++;
+    }
+    return buckets;
+}
+
+size_t
+xferMetricStats::count() const {
+    return samples.size();
+}
+
 void
 xferMetricStats::add(double value) {
     samples.push_back(value);
@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <iostream>
 #include <string>
+#include <utility>
 #include <variant>
 #include <vector>
 #include <optional>
@@ -166,6 +167,19 @@ class xferBenchConfig {
         static bool obj_use_virtual_addressing;
         static std::string obj_endpoint_override;
         static std::string obj_req_checksum;
+        static std::string latency_percentiles;
+        static std::string latency_csv_file;
+        // Thread counts to sweep; when empty a single run with num_threads is
+        // done. All counts share one nixlAgent and post concurrently
+        static std::vector<int> num_threads_sweep;
+        // Trace file to replay instead of the block size sweep, one
+        // "timestamp_us,op,size[,peer]" entry per line
+        static std::string trace_file;
+        // Storage sweep mode: run the block size x batch (queue depth)
+        // sweep once per file-offset alignment, reporting IOPS and CPU
+        // cost per GB for each combination (storage backends only)
+        static bool storage_sweep;
+        static std::vector<size_t> storage_sweep_alignments;
 
         static int
         loadFromFlags();
@@ -209,6 +223,15 @@ public:
     p95();
     double
     p99();
+    double
+    percentile(double pct);
+    size_t
+    count() const;
+
+    // Histogram of the samples with power-of-two bucket bounds (HDR style),
+    // as pairs of bucket upper bound (us) and sample count
+    std::vector<std::pair<double, size_t>>
+    histogram();
 
     void
     add(double value);
@@ -267,6 +290,15 @@ public:
           metaInfo(m) {}
 };
 
+// One operation of a captured trace: arrival time as an offset from the first
+// entry, op type (READ/WRITE), transfer size and remote agent name
+struct xferBenchTraceEntry {
+    nixlTime::us_t timestamp;
+    std::string op;
+    size_t size;
+    std::string peer;
+};
+
 class xferBenchUtils {
     private:
         static xferBenchRT *rt;
@@ -290,6 +322,34 @@ class xferBenchUtils {
         printStatsHeader();
         static void
         printStats(bool is_target, size_t block_size, size_t batch_size, xferBenchStats stats);
+        // Per-transfer latency histograms and percentiles, separately for the
+        // postXferReq call and for completion, so submission-path stalls can
+        // be told apart from network jitter. Enabled by --latency_percentiles
+        static void
+        printLatencyStats(size_t block_size, size_t batch_size, xferBenchStats stats);
+        // Per-thread throughput and post/transfer latency when threads share
+        // one agent, with the average post time above the fastest observed
+        // post reported as estimated lock/submission wait
+        static void
+        printThreadStats(size_t bytes_per_iter, std::vector<xferBenchStats> thread_stats);
+        // Parse the trace file configured with --trace_file, sorted by
+        // arrival time and with timestamps normalized to the first entry.
+        // Returns an empty trace on error
+        static std::vector<xferBenchTraceEntry>
+        loadTrace();
+        // Storage sweep reporting (--storage_sweep): one row per
+        // alignment x block size x depth combination with IOPS and CPU
+        // seconds burned per GB moved
+        static void
+        printStorageSweepHeader();
+        static void
+        printStorageSweepStats(size_t alignment,
+                               size_t block_size,
+                               size_t depth,
+                               size_t total_ops,
+                               size_t total_bytes,
+                               double duration_us,
+                               double cpu_us);
 };
 
 #endif // __UTILS_H
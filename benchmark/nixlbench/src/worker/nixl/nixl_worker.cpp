@@ -30,6 +30,7 @@
 #include "utils/utils.h"
 #include <unistd.h>
 #include <utility>
+#include <sys/resource.h>
 #include <sys/time.h>
 #include <sys/stat.h>
 #include <utils/serdes/serdes.h>
@@ -872,9 +873,13 @@ execTransfer(nixlAgent *agent,
              const nixl_xfer_op_t op,
              const int num_iter,
              const int num_threads,
-             xferBenchStats &stats) {
+             xferBenchStats &stats,
+             std::vector<xferBenchStats> *thread_stats_out = nullptr) {
     int ret = 0;
     stats.clear();
+    if (thread_stats_out) {
+        thread_stats_out->assign(num_threads, xferBenchStats());
+    }
 
     xferBenchTimer total_timer;
 #pragma omp parallel num_threads(num_threads)
@@ -948,6 +953,9 @@ execTransfer(nixlAgent *agent,
         }
 #pragma omp critical
         { stats.add(thread_stats); }
+        if (thread_stats_out) {
+            (*thread_stats_out)[tid] = std::move(thread_stats);
+        }
     }
     const nixlTime::us_t total_duration = total_timer.lap();
     stats.total_duration.add(total_duration);
@@ -985,16 +993,310 @@ xferBenchNixlWorker::transfer(size_t block_size,
 
     stats.clear();
 
-    ret = execTransfer(
-        agent, local_iovs, remote_iovs, xfer_op, num_iter, xferBenchConfig::num_threads, stats);
+    // Per-thread stats are only reported in thread-sweep mode
+    std::vector<xferBenchStats> thread_stats;
+    const bool report_threads = !xferBenchConfig::num_threads_sweep.empty();
+
+    ret = execTransfer(agent,
+                       local_iovs,
+                       remote_iovs,
+                       xfer_op,
+                       num_iter,
+                       xferBenchConfig::num_threads,
+                       stats,
+                       report_threads ? &thread_stats : nullptr);
 
     synchronize();
     if (ret < 0) {
         return std::variant<xferBenchStats, int>(ret);
     }
+
+    if (report_threads && isMasterRank()) {
+        size_t bytes_per_iter = 0;
+        for (const auto &iov : local_iovs[0]) {
+            bytes_per_iter += iov.len;
+        }
+        xferBenchUtils::printThreadStats(bytes_per_iter, std::move(thread_stats));
+    }
     return std::variant<xferBenchStats, int>(stats);
 }
 
+int
+xferBenchNixlWorker::replayTrace(const std::vector<xferBenchTraceEntry> &trace,
+                                 const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
+                                 const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists) {
+    if (isTarget()) {
+        nixl_notifs_t notifs;
+        nixl_status_t status;
+
+        do {
+            status = agent->getNotifs(notifs);
+        } while (status == NIXL_SUCCESS && trace.size() != notifs["initiator"].size());
+        synchronize();
+        return 0;
+    }
+
+    const xferBenchIOV &local_iov = local_iov_lists[0][0];
+    const xferBenchIOV &remote_iov = remote_iov_lists[0][0];
+
+    // Every operation is carved out of the head of the benchmark buffers and
+    // its request is created upfront, so preparation stays off the replay clock
+    std::vector<nixlXferReqH *> reqs;
+    reqs.reserve(trace.size());
+    for (const auto &entry : trace) {
+        if (entry.size > local_iov.len || entry.size > remote_iov.len) {
+            std::cerr << "Trace entry size " << entry.size << " exceeds buffer size "
+                      << std::min(local_iov.len, remote_iov.len)
+                      << ". Try adjusting total_buffer_size." << std::endl;
+            for (auto *req : reqs) {
+                agent->releaseXferReq(req);
+            }
+            return -1;
+        }
+
+        nixl_xfer_dlist_t local_desc(GET_SEG_TYPE(true));
+        nixl_xfer_dlist_t remote_desc(GET_SEG_TYPE(false));
+        local_desc.addDesc(nixlBasicDesc(local_iov.addr, entry.size, local_iov.devId));
+        remote_desc.addDesc(nixlBasicDesc(remote_iov.addr, entry.size, remote_iov.devId));
+
+        nixl_opt_args_t params;
+        params.notifMsg = "0xBEEF";
+        params.hasNotif = true;
+
+        const nixl_xfer_op_t op = XFERBENCH_OP_READ == entry.op ? NIXL_READ : NIXL_WRITE;
+        nixlXferReqH *req;
+        CHECK_NIXL_ERROR(
+            agent->createXferReq(op, local_desc, remote_desc, entry.peer, req, &params),
+            "createTransferReq failed");
+        reqs.push_back(req);
+    }
+
+    struct inflightXfer {
+        size_t idx;
+        nixlTime::us_t post_time;
+    };
+    std::vector<inflightXfer> inflight;
+    xferMetricStats queue_delay, completion_latency;
+    queue_delay.reserve(trace.size());
+    completion_latency.reserve(trace.size());
+    size_t total_bytes = 0;
+    int ret = 0;
+
+    const nixlTime::us_t start = nixlTime::getUs();
+    nixlTime::us_t last_completion = start;
+
+    const auto poll_inflight = [&]() -> bool {
+        for (auto it = inflight.begin(); it != inflight.end();) {
+            nixl_status_t rc = agent->getXferStatus(reqs[it->idx]);
+            if (NIXL_SUCCESS == rc) {
+                last_completion = nixlTime::getUs();
+                completion_latency.add(last_completion - it->post_time);
+                total_bytes += trace[it->idx].size;
+                it = inflight.erase(it);
+            } else if (NIXL_ERR_BACKEND == rc) {
+                std::cout << "NIXL getStatus failed" << std::endl;
+                return false;
+            } else {
+                ++it;
+            }
+        }
+        return true;
+    };
+
+    // Open-loop replay: each operation is posted at its captured arrival
+    // offset whether or not earlier ones have completed, so a backend that
+    // falls behind shows up as queueing delay instead of slowing the arrivals
+    for (size_t i = 0; i < trace.size() && 0 == ret; i++) {
+        const nixlTime::us_t scheduled = start + trace[i].timestamp;
+
+        while (nixlTime::getUs() < scheduled) {
+            if (!poll_inflight()) {
+                ret = -1;
+                break;
+            }
+        }
+        if (ret < 0) {
+            break;
+        }
+
+        const nixlTime::us_t post_time = nixlTime::getUs();
+        queue_delay.add(post_time - scheduled);
+
+        nixl_status_t rc = agent->postXferReq(reqs[i]);
+        if (NIXL_ERR_BACKEND == rc) {
+            std::cout << "NIXL postRequest failed" << std::endl;
+            ret = -1;
+            break;
+        }
+        inflight.push_back({i, post_time});
+    }
+
+    // Drain the operations still in flight
+    while (0 == ret && !inflight.empty()) {
+        if (!poll_inflight()) {
+            ret = -1;
+        }
+    }
+
+    for (auto *req : reqs) {
+        agent->releaseXferReq(req);
+    }
+
+    synchronize();
+
+    if (0 == ret && isMasterRank()) {
+        const double replay_duration = last_completion - start; // In microsec
+        const double total_gb = (double)total_bytes / (1000 * 1000 * 1000);
+        const double goodput_gb = replay_duration > 0 ? total_gb / (replay_duration / 1e6) : 0;
+
+        std::cout << "Trace replay: " << trace.size() << " ops, " << std::fixed
+                  << std::setprecision(6) << total_gb << " GB in " << (replay_duration / 1e6)
+                  << " sec, goodput " << goodput_gb << " GB/Sec" << std::endl;
+        std::cout << std::setprecision(1) << "Queueing delay (us): avg " << queue_delay.avg()
+                  << ", p99 " << queue_delay.p99() << ", max " << queue_delay.max() << std::endl;
+        std::cout << "Completion latency (us): avg " << completion_latency.avg() << ", p99 "
+                  << completion_latency.p99() << ", max " << completion_latency.max() << std::endl;
+    }
+    return ret;
+}
+
+// CPU time (user + system) consumed by this process so far, in microseconds
+static double
+getCpuTimeUs() {
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru) != 0) {
+        return 0;
+    }
+    return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1e6 +
+        (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec);
+}
+
+// Run num_iter transfers of one storage sweep combination synchronously,
+// returning wall and CPU time spent in the measured loop
+static int
+execStorageCombination(nixlAgent *agent,
+                       const nixl_xfer_dlist_t &local_desc,
+                       const nixl_xfer_dlist_t &remote_desc,
+                       const nixl_xfer_op_t op,
+                       const int skip,
+                       const int num_iter,
+                       double &duration_us,
+                       double &cpu_us) {
+    nixl_opt_args_t params;
+    nixlXferReqH *req;
+    int ret = 0;
+
+    CHECK_NIXL_ERROR(agent->createXferReq(op, local_desc, remote_desc, "initiator", req, &params),
+                     "createTransferReq failed");
+
+    for (int i = 0; i < skip + num_iter && 0 == ret; i++) {
+        // Warmup iterations run the same loop, the clocks just skip them
+        if (i == skip) {
+            cpu_us = getCpuTimeUs();
+            duration_us = nixlTime::getUs();
+        }
+
+        nixl_status_t rc = agent->postXferReq(req);
+        if (NIXL_ERR_BACKEND == rc) {
+            std::cout << "NIXL postRequest failed" << std::endl;
+            ret = -1;
+            break;
+        }
+        do {
+            rc = agent->getXferStatus(req);
+            if (NIXL_ERR_BACKEND == rc) {
+                std::cout << "NIXL getStatus failed" << std::endl;
+                ret = -1;
+                break;
+            }
+        } while (NIXL_SUCCESS != rc);
+    }
+
+    duration_us = nixlTime::getUs() - duration_us;
+    cpu_us = getCpuTimeUs() - cpu_us;
+
+    agent->releaseXferReq(req);
+    return ret;
+}
+
+int
+xferBenchNixlWorker::runStorageSweep(const std::vector<std::vector<xferBenchIOV>> &local_iov_lists) {
+    const nixl_xfer_op_t op =
+        XFERBENCH_OP_READ == xferBenchConfig::op_type ? NIXL_READ : NIXL_WRITE;
+    const xferBenchIOV &local_iov = local_iov_lists[0][0];
+    const xferBenchIOV &file_iov = remote_iovs[0][0];
+
+    if (isMasterRank()) {
+        xferBenchUtils::printStorageSweepHeader();
+    }
+
+    for (const size_t alignment : xferBenchConfig::storage_sweep_alignments) {
+        for (size_t block_size = xferBenchConfig::start_block_size;
+             !signaled() && block_size <= xferBenchConfig::max_block_size;
+             block_size *= 2) {
+            int num_iter = xferBenchConfig::num_iter;
+            int skip = xferBenchConfig::warmup_iter;
+
+            if (block_size > LARGE_BLOCK_SIZE) {
+                skip /= xferBenchConfig::large_blk_iter_ftr;
+                if (skip < MIN_WARMUP_ITERS) {
+                    skip = MIN_WARMUP_ITERS;
+                }
+                num_iter /= xferBenchConfig::large_blk_iter_ftr;
+            }
+
+            for (size_t depth = xferBenchConfig::start_batch_size;
+                 !signaled() && depth <= xferBenchConfig::max_batch_size;
+                 depth *= 2) {
+                // Each queued block starts on its own aligned file offset
+                const size_t stride = ROUND_UP(block_size, alignment);
+
+                if (depth * stride > file_iov.len || depth * block_size > local_iov.len) {
+                    std::cout << "Skipping alignment " << alignment << ", block size "
+                              << block_size << ", depth " << depth
+                              << ": exceeds registered region. Try adjusting total_buffer_size."
+                              << std::endl;
+                    continue;
+                }
+
+                nixl_xfer_dlist_t local_desc(seg_type);
+                nixl_xfer_dlist_t remote_desc(FILE_SEG);
+                for (size_t j = 0; j < depth; j++) {
+                    local_desc.addDesc(nixlBasicDesc(
+                        local_iov.addr + j * block_size, block_size, local_iov.devId));
+                    remote_desc.addDesc(nixlBasicDesc(
+                        file_iov.addr + j * stride, block_size, file_iov.devId));
+                }
+
+                double duration_us = 0, cpu_us = 0;
+                const int ret = execStorageCombination(agent,
+                                                       local_desc,
+                                                       remote_desc,
+                                                       op,
+                                                       skip,
+                                                       num_iter,
+                                                       duration_us,
+                                                       cpu_us);
+                if (0 != ret) {
+                    return ret;
+                }
+
+                if (isMasterRank()) {
+                    xferBenchUtils::printStorageSweepStats(alignment,
+                                                           block_size,
+                                                           depth,
+                                                           (size_t)num_iter * depth,
+                                                           (size_t)num_iter * depth * block_size,
+                                                           duration_us,
+                                                           cpu_us);
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
 void
 xferBenchNixlWorker::poll(size_t block_size) {
     nixl_notifs_t notifs;
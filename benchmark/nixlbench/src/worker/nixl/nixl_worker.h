@@ -66,6 +66,20 @@ class xferBenchNixlWorker: public xferBenchWorker {
                  const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
                  const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists) override;
 
+        // Replay a captured trace with open-loop arrival timing, reporting
+        // goodput and queueing delay (--trace_file mode)
+        int
+        replayTrace(const std::vector<xferBenchTraceEntry> &trace,
+                    const std::vector<std::vector<xferBenchIOV>> &local_iov_lists,
+                    const std::vector<std::vector<xferBenchIOV>> &remote_iov_lists);
+
+        // Sweep file-offset alignment x block size x queue depth through
+        // real agent transfers against the registered FILE segments,
+        // reporting IOPS and CPU per GB per combination (--storage_sweep
+        // mode)
+        int
+        runStorageSweep(const std::vector<std::vector<xferBenchIOV>> &local_iov_lists);
+
     private:
         std::optional<xferBenchIOV>
         initBasicDescDram(size_t buffer_size, int mem_dev_id);
@@ -31,8 +31,7 @@
 
 namespace fs = std::filesystem;
 
-#include "common/cyclic_buffer.h"
-#include "telemetry_event.h"
+#include "nixl_telemetry_reader.h"
 
 volatile sig_atomic_t g_running = true;
 
@@ -83,7 +82,7 @@ print_telemetry_event(const nixlTelemetryEvent &event) {
     std::cout << "Timestamp: " << format_timestamp(event.timestampUs_) << std::endl;
     std::cout << "Category: " << nixlEnumStrings::telemetryCategoryStr(event.category_)
               << std::endl;
-    std::cout << "Event name: " << event.eventName_ << std::endl;
+    std::cout << "Event name: " << nixlTelemetryReader::eventName(event) << std::endl;
     std::cout << "Value: " << event.value_ << std::endl;
 
     std::cout << "===========================" << std::endl;
@@ -117,7 +116,7 @@ main(int argc, char *argv[]) {
         std::cout << "Opening telemetry buffer: " << telemetry_path << std::endl;
         std::cout << "Press Ctrl+C to stop reading telemetry..." << std::endl;
 
-        sharedRingBuffer<nixlTelemetryEvent> buffer(telemetry_path, false, TELEMETRY_VERSION);
+        nixlTelemetryReader buffer(telemetry_path);
 
         std::cout << "Successfully opened telemetry buffer (version: " << buffer.version() << ")"
                   << std::endl;
@@ -0,0 +1,121 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+#include "common/cyclic_buffer.h"
+#include "trace_event.h"
+
+// One drained event plus the agent it came from, so the merged timeline
+// shows which side of the request each point belongs to
+struct taggedEvent {
+    std::string agent;
+    nixlTraceEvent event;
+};
+
+std::string
+format_trace_id(const nixl_trace_id_t &id) {
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (auto byte : id)
+        ss << std::setw(2) << static_cast<unsigned>(byte);
+    return ss.str();
+}
+
+void
+usage() {
+    std::cout << "Usage: trace_reader <trace_file> [<trace_file> ...]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  <trace_file>    Per-agent trace buffer, e.g. <NIXL_TRACE_DIR>/<agent>.trace;"
+              << std::endl;
+    std::cout << "                  pass the initiator's and the target's files to merge both"
+              << std::endl;
+    std::cout << "                  sides of each request into one timeline" << std::endl;
+    exit(0);
+}
+
+int
+main(int argc, char *argv[]) {
+    if (argc < 2 || argv[1] == std::string("-h") || argv[1] == std::string("--help")) {
+        usage();
+    }
+
+    std::vector<taggedEvent> events;
+
+    for (int i = 1; i < argc; ++i) {
+        fs::path trace_path = argv[i];
+        if (!fs::exists(trace_path)) {
+            std::cerr << "Trace file " << trace_path << " does not exist" << std::endl;
+            return 1;
+        }
+
+        // The file name doubles as the agent name, the way the agent
+        // wrote it ("<agent>.trace")
+        std::string agent = trace_path.stem();
+
+        try {
+            sharedRingBuffer<nixlTraceEvent> buffer(trace_path, false, TRACE_VERSION);
+            nixlTraceEvent event;
+            size_t count = 0;
+            while (buffer.pop(event)) {
+                events.push_back({agent, event});
+                count++;
+            }
+            std::cout << "Read " << count << " events from agent " << agent << " (" << trace_path
+                      << ")" << std::endl;
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Error reading " << trace_path << ": " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    // Group by trace id, then order each request's merged timeline by
+    // timestamp; the map keeps requests in first-seen id order
+    std::map<std::string, std::vector<taggedEvent>> by_trace;
+    for (auto &tagged : events)
+        by_trace[format_trace_id(tagged.event.traceId_)].push_back(tagged);
+
+    for (auto &[trace_id, timeline] : by_trace) {
+        std::stable_sort(timeline.begin(), timeline.end(), [](const auto &a, const auto &b) {
+            return a.event.timestampUs_ < b.event.timestampUs_;
+        });
+
+        std::cout << "\n=== Trace " << trace_id << " ===" << std::endl;
+        uint64_t start_us = timeline.front().event.timestampUs_;
+        for (auto &tagged : timeline) {
+            std::cout << "  +" << std::setw(10) << (tagged.event.timestampUs_ - start_us) << "us  "
+                      << std::setw(16) << std::left
+                      << nixlEnumStrings::tracePointStr(tagged.event.point_) << std::right << "  "
+                      << tagged.agent << "  (value: " << tagged.event.value_ << ")" << std::endl;
+        }
+    }
+
+    std::cout << "\nTotal: " << events.size() << " events across " << by_trace.size()
+              << " traces" << std::endl;
+
+    return 0;
+}
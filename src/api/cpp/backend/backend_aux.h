@@ -28,16 +28,39 @@
 typedef std::vector<std::pair<std::string, std::string>> notif_list_t;
 
 
+class nixlBackendMD;
+
 struct nixlBackendOptionalArgs {
     // During postXfer, user might ask for a notification if supported
     nixl_blob_t notifMsg;
     bool        hasNotif = false;
+
+    // Optional completion signal: once the transfer data has landed, the
+    // backend writes signalValue as an 8-byte word at signalAddr in the
+    // peer's registered memory described by signalMD
+    bool          hasSignal = false;
+    uint64_t      signalAddr = 0;
+    uint64_t      signalValue = 0;
+    nixlBackendMD *signalMD = nullptr;
+
+    // CUDA stream (cudaStream_t) to submit the transfer on, for backends
+    // supporting stream-ordered I/O; null means host-driven posting
+    void *cudaStream = nullptr;
+
+    // Priority class of the transfer; backends with QoS support keep
+    // high-priority requests on a reserved lane (see nixl_opt_args_t)
+    nixl_xfer_priority_t priority = NIXL_XFER_PRIO_NORMAL;
+
     nixl_blob_t customParam;
 };
 
 using nixl_opt_b_args_t = nixlBackendOptionalArgs;
 
 
+class nixlStagingPool;
+class nixlBlockCache;
+class nixlMemBudget;
+
 // A base class to point to backend initialization data
 // User doesn't know about fields such as local_agent but can access it
 // after the backend is initialized by agent. If we needed to make it private
@@ -53,6 +76,25 @@ class nixlBackendInitParams {
         nixlTime::us_t    pthrDelay;
         nixl_thread_sync_t syncMode;
         bool enableTelemetry_;
+
+        // Agent-owned pinned host staging pool, set when the backend's
+        // custom params request it (staging_pool=1); backends without a
+        // GPUDirect path bounce VRAM transfers through it. Outlives the
+        // backend, shared across backends of one agent.
+        nixlStagingPool*  stagingPool = nullptr;
+
+        // Agent-owned read cache tier, set when the backend's custom
+        // params request it (block_cache_size); storage backends that
+        // bypass the page cache serve repeated reads of hot blocks from
+        // it instead of the device. Outlives the backend, shared across
+        // backends of one agent.
+        nixlBlockCache*   blockCache = nullptr;
+
+        // Agent-owned pool-memory budget tracker, set when the agent was
+        // configured with watermarks (see nixlAgentConfig::memBudgetHard);
+        // backends report internal pool growth to it through
+        // reserveBudget/releaseBudget. Outlives the backend.
+        nixlMemBudget*    memBudget = nullptr;
 };
 
 // Pure virtual class to have a common pointer type
@@ -26,9 +26,20 @@
 #include "nixl_types.h"
 #include "backend_aux.h"
 #include "telemetry_event.h"
+#include "common/mem_budget.h"
 
 constexpr size_t MAX_TELEMETRY_QUEUE_SIZE = 1000;
 
+// A runtime-tunable backend parameter declared to the telemetry auto-tuner
+// (see NIXL_TELEMETRY_AUTO_TUNE): the tuner only ever moves `current`
+// within [min_value, max_value].
+struct nixl_tunable_param_t {
+    std::string name;
+    uint64_t min_value;
+    uint64_t max_value;
+    uint64_t current;
+};
+
 // Base backend engine class for different backend implementations
 class nixlBackendEngine {
     private:
@@ -43,6 +54,8 @@ class nixlBackendEngine {
         bool              initErr = false;
         const std::string localAgent;
         const bool enableTelemetry_;
+        // Agent-owned pool-memory budget, null when no watermarks are set
+        nixlMemBudget *const memBudget_;
 
         [[nodiscard]] nixl_status_t
         setInitParam(const std::string &key, const std::string &value) {
@@ -74,12 +87,28 @@ class nixlBackendEngine {
                                           value);
         }
 
+        // Account growth of a backend-internal pool against the agent
+        // budget (see nixlAgentConfig::memBudgetHard); a false return
+        // means the hard watermark would be crossed and the pool must
+        // not grow. Accounted bytes go back through releaseBudget when
+        // the pool shrinks or is destroyed.
+        [[nodiscard]] bool
+        reserveBudget(size_t bytes) const {
+            return !memBudget_ || memBudget_->reserve(bytes);
+        }
+
+        void
+        releaseBudget(size_t bytes) const {
+            if (memBudget_) memBudget_->release(bytes);
+        }
+
     public:
         explicit nixlBackendEngine(const nixlBackendInitParams *init_params)
             : backendType(init_params->type),
               customParams(*init_params->customParams),
               localAgent(init_params->localAgent),
-              enableTelemetry_(init_params->enableTelemetry_) {}
+              enableTelemetry_(init_params->enableTelemetry_),
+              memBudget_(init_params->memBudget) {}
 
         nixlBackendEngine(nixlBackendEngine&&) = delete;
         nixlBackendEngine(const nixlBackendEngine&) = delete;
@@ -115,6 +144,25 @@ class nixlBackendEngine {
         // Determines if a backend supports progress thread.
         virtual bool supportsProgTh() const = 0;
 
+        // Determines if a backend can write a completion signal into the
+        // peer's registered memory (see nixlBackendOptionalArgs::hasSignal).
+        // Optional capability, hence not pure virtual.
+        virtual bool supportsSignal() const { return false; }
+
+        // Determines if one engine instance can serve several agents of the
+        // same process (see the "shared_instance" backend parameter), each
+        // agent getting its own connection namespace through addLocalAgent
+        // and removeLocalAgent. Optional capability.
+        virtual bool supportsSharedInstance() const { return false; }
+
+        // Determines if postXfer consumes the descriptor lists passed to
+        // it, so a request handle whose lists were swapped by
+        // nixlAgent::updateXferReq submits the new ranges. Backends that
+        // bake their IO plan into the request handle at prepXfer time and
+        // ignore the lists at post time must leave this false. Optional
+        // capability.
+        virtual bool supportsXferUpdate() const { return false; }
+
         virtual nixl_mem_list_t getSupportedMems() const = 0;  // TODO: Return by const-reference and mark noexcept?
 
 
@@ -124,14 +172,67 @@ class nixlBackendEngine {
         virtual nixl_status_t registerMem (const nixlBlobDesc &mem,
                                            const nixl_mem_t &nixl_mem,
                                            nixlBackendMD* &out) = 0;
+
+        // Hint-aware registration overload; backends that can act on the
+        // advisory hints (see nixl_reg_hints_t) override this one, the
+        // default drops them and falls through to the plain registration
+        virtual nixl_status_t registerMem (const nixlBlobDesc &mem,
+                                           const nixl_mem_t &nixl_mem,
+                                           const nixl_reg_hints_t &hints,
+                                           nixlBackendMD* &out) {
+            return registerMem(mem, nixl_mem, out);
+        }
+
         virtual nixl_status_t deregisterMem (nixlBackendMD* meta) = 0;
 
+        // Registration sharing (see nixlAgent::exportMem/importMem):
+        // exportMem packs an existing registration into a portable handle
+        // another agent on the same node imports without pinning the
+        // pages again; importMem resolves such a handle (carried next to
+        // the descriptor) back into backend metadata, which is torn down
+        // through the regular deregisterMem. Optional capability, the
+        // defaults refuse.
+        virtual nixl_status_t exportMem (nixlBackendMD* meta,
+                                         nixl_blob_t &handle) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        virtual nixl_status_t importMem (const nixlBlobDesc &mem,
+                                         const nixl_mem_t &nixl_mem,
+                                         const nixl_blob_t &handle,
+                                         nixlBackendMD* &out) {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
         // Make connection to a remote node identified by the name into loaded conn infos
         // Child might just return 0, if making proactive connections are not necessary.
         // An agent might need to connect to itself for local operations.
         virtual nixl_status_t connect(const std::string &remote_agent) = 0;
         virtual nixl_status_t disconnect(const std::string &remote_agent) = 0;
 
+        // Initiate transport wireup toward a connected peer without moving
+        // data, for backends whose connect() only sets up local state and
+        // defers the handshake to the first transfer. Returns a request
+        // handle to be polled with checkXfer and freed with releaseReqH, so
+        // probes to many peers can be in flight at once. Backends whose
+        // connections need no warmup keep the default.
+        virtual nixl_status_t prewarmConnection(const std::string &remote_agent,
+                                                nixlBackendReqH* &handle) {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        // Attach or detach an additional local agent on a shared engine
+        // instance (see supportsSharedInstance): the extra agent name gets
+        // its own entry in the connection bookkeeping so loopback connects
+        // and per-agent lookups under that name work. Only called on
+        // engines that report the capability.
+        virtual nixl_status_t addLocalAgent(const std::string &local_agent) {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+        virtual nixl_status_t removeLocalAgent(const std::string &local_agent) {
+            return NIXL_SUCCESS;
+        }
+
         // Remove loaded local or remtoe metadata for target
         virtual nixl_status_t unloadMD (nixlBackendMD* input) = 0;
 
@@ -188,6 +289,29 @@ class nixlBackendEngine {
             return NIXL_ERR_BACKEND;
         }
 
+        // Batched form of loadRemoteMD over a whole descriptor list, so
+        // backends with fixed per-call costs (lock acquisitions, key unpack
+        // setup) can amortize them across the batch. On error no metadata is
+        // returned; partially loaded entries are unloaded by the backend.
+        virtual nixl_status_t loadRemoteMDBatch (const nixl_reg_dlist_t &input,
+                                                 const nixl_mem_t &nixl_mem,
+                                                 const std::string &remote_agent,
+                                                 std::vector<nixlBackendMD*> &output) {
+            output.reserve(input.descCount());
+            for (int i=0; i<input.descCount(); ++i) {
+                nixlBackendMD *md;
+                nixl_status_t ret = loadRemoteMD(input[i], nixl_mem, remote_agent, md);
+                if (ret < 0) {
+                    for (auto &loaded : output)
+                        unloadMD(loaded);
+                    output.clear();
+                    return ret;
+                }
+                output.push_back(md);
+            }
+            return NIXL_SUCCESS;
+        }
+
 
         // *** Needs to be implemented if supportsLocal() is true *** //
 
@@ -208,6 +332,36 @@ class nixlBackendEngine {
             return NIXL_ERR_BACKEND;
         }
 
+        // Generates several standalone notifications to the same remote agent.
+        // Backends with a packed wire format override this to send them as one
+        // message; the default falls back to one genNotif per entry.
+        virtual nixl_status_t genNotifBatch(const std::string &remote_agent,
+                                            const std::vector<std::string> &msgs) const {
+            for (const auto &msg : msgs) {
+                const nixl_status_t ret = genNotif(remote_agent, msg);
+                if (ret != NIXL_SUCCESS)
+                    return ret;
+            }
+            return NIXL_SUCCESS;
+        }
+
+
+        // *** Optional auto-tuning support *** //
+
+        // Declares the parameters the telemetry auto-tuner may adjust at
+        // runtime, with their bounds and current values. Default: nothing
+        // is tunable.
+        virtual nixl_status_t getTunableParams(std::vector<nixl_tunable_param_t> &params) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        // Applies a new value to a declared tunable; only called with values
+        // within the declared bounds. Backends apply the value to subsequent
+        // operations, in-flight ones are unaffected.
+        virtual nixl_status_t retune(const std::string &param, uint64_t value) {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
 
         // *** Needs to be implemented if supportsProgTh() is true *** //
 
@@ -217,6 +371,20 @@ class nixlBackendEngine {
             return 0;
         }
 
+        // Drive progress() repeatedly until a sweep services nothing or
+        // the given duration elapses, for caller-managed dedicated
+        // progress loops (progress threads disabled). Backends whose
+        // progress() is per-sweep get this for free.
+        virtual nixl_status_t
+        progressFor(nixlTime::us_t duration) {
+            const nixlTime::us_t deadline = nixlTime::getUs() + duration;
+            do {
+                if (progress() == 0)
+                    break;
+            } while (nixlTime::getUs() < deadline);
+            return NIXL_SUCCESS;
+        }
+
         // *** Optional virtual methods that are good to be implemented in any backend *** //
 
         // Query information about a list of memory/storage
@@ -241,5 +409,24 @@ class nixlBackendEngine {
                          const nixl_opt_args_t *extra_params = nullptr) const {
             return NIXL_ERR_NOT_SUPPORTED;
         }
+
+        // Abort a posted transfer's outstanding work so its bandwidth is
+        // reclaimed without waiting for completion. Best effort per chunk:
+        // work already picked up by the NIC or device still lands. On
+        // success the handle is quiesced and may be reposted or released.
+        // Backends that cannot abort keep the default.
+        virtual nixl_status_t
+        cancelXfer(nixlBackendReqH *handle) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        // Report how many payload bytes of a posted transfer have completed
+        // so far, from the backend's rolling accounting in the request
+        // handle (e.g. completed chunks of a split descriptor). Backends
+        // without such accounting keep the default.
+        virtual nixl_status_t
+        getXferProgress(nixlBackendReqH *handle, size_t &bytes_done) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
 };
 #endif
@@ -25,6 +25,7 @@
 #include "nixl_params.h"
 #include "nixl_descriptors.h"
 #include <chrono>
+#include <functional>
 #include <memory>
 
 /**
@@ -36,6 +37,50 @@ class nixlAgent {
         /** @var  data  The members in agent class wrapped into single nixlAgentData member. */
         std::unique_ptr<nixlAgentData> data;
 
+        /* Post logic shared by postXferReq and postXferReqBatch, caller holds the lock */
+        nixl_status_t
+        postXferReqLocked (nixlXferReqH* req_hndl,
+                           const nixl_opt_args_t* extra_params) const;
+
+        /* Status logic shared by getXferStatus and getXferStatusBatch,
+           caller holds the lock */
+        nixl_status_t
+        getXferStatusLocked (nixlXferReqH* req_hndl) const;
+
+        /* Deferred post behind a predecessor request (see
+           nixl_opt_args_t::chainAfter), caller holds the lock */
+        nixl_status_t
+        chainXferReq (nixlXferReqH* req_hndl,
+                      const nixl_opt_args_t* extra_params) const;
+
+        /* Two-leg staged transfer creation when no single backend serves both
+           sides of a request (see nixlCompoundXferState), caller holds the lock */
+        nixl_status_t
+        createCompoundXfer (const nixl_xfer_op_t &operation,
+                            const nixl_xfer_dlist_view_t &local_descs,
+                            const nixl_xfer_dlist_view_t &remote_descs,
+                            const std::string &remote_agent,
+                            nixlXferReqH &handle) const;
+
+        /* Rebind a failed or stalled request to the next recorded backend
+           candidate and repost it (see nixl_opt_args_t::enableFailover),
+           caller holds the lock */
+        nixl_status_t
+        failoverXferReq (nixlXferReqH* req_hndl) const;
+
+        /* Shared body of the index and slice based makeXferReq overloads;
+           null slice vectors select whole prepped entries */
+        nixl_status_t
+        makeXferReqInternal (const nixl_xfer_op_t &operation,
+                             const nixlDlistH* local_side,
+                             const std::vector<int> &local_indices,
+                             const std::vector<nixl_xfer_slice_t>* local_slices,
+                             const nixlDlistH* remote_side,
+                             const std::vector<int> &remote_indices,
+                             const std::vector<nixl_xfer_slice_t>* remote_slices,
+                             nixlXferReqH* &req_hndl,
+                             const nixl_opt_args_t* extra_params) const;
+
     public:
         /*** Initialization and Registering Methods ***/
 
@@ -117,6 +162,52 @@ class nixlAgent {
         registerMem (const nixl_reg_dlist_t &descs,
                      const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Extend the usable length of reserve-commit registrations
+         *         (see nixl_reg_hints_t::reserveLen). Each descriptor names a
+         *         reserved registration by addr and devId and carries the new
+         *         committed length, which must grow and stay within the
+         *         reserve. The backend registration already covers the whole
+         *         reserved range, so the commit is pure bookkeeping — growing
+         *         an elastic pool is O(1) instead of a re-pin of the full
+         *         region — and peers pick up the new length through the
+         *         regular metadata exchange. Deregistration afterwards takes
+         *         the committed length, not the one registerMem was given.
+         *
+         * @param  descs         Descriptors with the new committed lengths
+         * @param  extra_params  Optional backend list, as registerMem
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        commitMem (const nixl_reg_dlist_t &descs,
+                   const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Open, stat and register a batch of files in one call. The
+         *         opens and stats run in parallel (a sharded checkpoint means
+         *         thousands of them), and the resulting descriptors land in the
+         *         local section through a single registerMem, so restore-time
+         *         file setup is one API call instead of a per-file loop. The
+         *         returned FILE_SEG descriptors carry each file's fd as devId
+         *         and its size as len; the caller releases them with the
+         *         regular deregisterMem and owns closing the fds afterwards.
+         *
+         * @param  filenames     File paths to open and register, e.g. a
+         *                       checkpoint manifest
+         * @param  open_flags    Flags passed to open(2), e.g. O_RDONLY for a
+         *                       restore or O_WRONLY|O_CREAT for a save
+         * @param  descs [out]   Registered FILE_SEG descriptor list, in
+         *                       filenames order
+         * @param  extra_params  Optional additional parameters, as registerMem
+         * @return nixl_status_t Error code if call was not successful; no file
+         *                       stays open or registered on failure
+         */
+        nixl_status_t
+        registerFiles (const std::vector<std::string> &filenames,
+                       int open_flags,
+                       nixl_reg_dlist_t &descs,
+                       const nixl_opt_args_t* extra_params = nullptr);
+
         /**
          * @brief  Deregister a memory/storage from NIXL. If a list of backends hints is provided
          *         (via extra_params), the deregistration is limited to the specified backends.
@@ -130,6 +221,81 @@ class nixlAgent {
         deregisterMem (const nixl_reg_dlist_t &descs,
                        const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Pack existing registrations into a portable handle blob so a
+         *         colocated agent sharing the same memory (e.g. another process
+         *         attached to the same pool) can adopt them through importMem
+         *         without pinning the pages a second time. The descriptors must
+         *         match prior registerMem calls, and the backend must support
+         *         registration export (a single backend, either the one in
+         *         extra_params or the sole backend serving the memory type).
+         *
+         * @param  descs         Descriptor list of registered buffers to export
+         * @param  str [out]     Serialized handle blob to pass to importMem
+         * @param  extra_params  Optional backend hint selecting the exporter
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        exportMem (const nixl_reg_dlist_t &descs,
+                   nixl_blob_t &str,
+                   const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Adopt registrations exported by another agent's exportMem.
+         *         The memory becomes usable in transfers exactly as if it had
+         *         been registered locally, and is released through the regular
+         *         deregisterMem with the original descriptors.
+         *
+         * @param  str           Serialized handle blob produced by exportMem
+         * @param  extra_params  Optional additional parameters (currently unused)
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        importMem (const nixl_blob_t &str,
+                   const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Block until all deregistrations deferred via the deferTeardown
+         *         optional argument have completed in the backends, guaranteeing
+         *         the corresponding memory is fully released and reusable.
+         *
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        fenceDeregisterMem () const;
+
+        /**
+         * @brief  Allocate host (DRAM) memory tuned for registration and
+         *         register it in one step. The allocation is huge-page backed
+         *         (explicit 2M/1G hugetlb via hugePageSize in extra_params, or
+         *         transparent huge pages otherwise), pre-faulted, and optionally
+         *         bound to a NUMA node via numaNode, so backends pin resident
+         *         huge pages instead of walking scattered 4K pages. Backend
+         *         hints in extra_params limit the registration like registerMem.
+         *
+         * @param  len           Number of bytes to allocate; rounded up to the
+         *                       backing page granularity
+         * @param  addr [out]    Address of the allocated and registered memory
+         * @param  extra_params  Optional allocation policy and backend hints
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        allocMem (const size_t &len,
+                  void* &addr,
+                  const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Deregister and release memory obtained from allocMem. Backend
+         *         hints in extra_params limit the deregistration like deregisterMem.
+         *
+         * @param  addr          Address returned by allocMem
+         * @param  extra_params  Optional additional parameters used in deregistering memory
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        freeMem (void* addr,
+                 const nixl_opt_args_t* extra_params = nullptr);
+
         /**
          * @brief  Query information about memory/storage with NIXL.
          *         The backend should be specified via extra_params.
@@ -145,6 +311,24 @@ class nixlAgent {
                  std::vector<nixl_query_resp_t> &resp,
                  const nixl_opt_args_t *extra_params) const;
 
+        /**
+         * @brief  Batched registration check answered entirely from the agent's
+         *         local section indices, with no backend involvement, so planning
+         *         passes over thousands of candidate blocks (e.g., eviction) stay
+         *         cheap. registered[i] is set when descs[i] falls within memory
+         *         registered for its memory type, limited to the hinted backends
+         *         when extra_params provides them.
+         *
+         * @param  descs            Descriptor list of the buffers to be checked
+         * @param  registered [out] One entry per descriptor, set when registered
+         * @param  extra_params     Optional backend hints to limit the check
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        queryRegisteredMem (const nixl_xfer_dlist_t &descs,
+                            std::vector<bool> &registered,
+                            const nixl_opt_args_t* extra_params = nullptr) const;
+
         /**
          * @brief  Make connection proactively, instead of at the time of the first transfer
          *         towards the target agent. If a list of backends hints is provided
@@ -157,6 +341,43 @@ class nixlAgent {
         makeConnection (const std::string &remote_agent,
                         const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Wire up a whole set of peers in one call, for full-mesh
+         *         bootstrap. Connections are made as in makeConnection, but
+         *         backend engines connect their peers concurrently and every
+         *         peer's transport handshake is put in flight before any is
+         *         waited on, so an N-peer mesh becomes ready in about one
+         *         handshake round trip instead of N serialized ones.
+         *         Metadata for all the peers must already be loaded. Unlike
+         *         prewarmConnections this is strict: a peer that cannot be
+         *         connected on any common backend fails the whole call.
+         *
+         * @param  remote_agents Names of the remote agents
+         * @param  extra_params  Optional backend hints as in makeConnection
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        makeConnectionAll (const std::vector<std::string> &remote_agents,
+                           const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Pre-warm connections to a list of remote agents in one call.
+         *         Connections are made as in makeConnection; backends that defer
+         *         transport wireup to the first transfer (e.g. UCX) additionally
+         *         get a zero-byte probe per peer, and every probe is in flight
+         *         before any is waited on, so warming N peers costs roughly one
+         *         handshake round trip instead of N. Blocks until all probes
+         *         complete. Best effort across peers: remaining peers are still
+         *         warmed after a failure and the first error is returned.
+         *
+         * @param  remote_agents Names of the remote agents
+         * @param  extra_params  Optional backend hints as in makeConnection
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        prewarmConnections (const std::vector<std::string> &remote_agents,
+                            const nixl_opt_args_t* extra_params = nullptr);
+
         /*** Transfer Request Preparation ***/
         /**
          * @brief  Prepare a list of descriptors for a transfer request, so later elements
@@ -208,6 +429,63 @@ class nixlAgent {
                      const std::vector<int> &remote_indices,
                      nixlXferReqH* &req_hndl,
                      const nixl_opt_args_t* extra_params = nullptr) const;
+        /**
+         * @brief  Slice-addressed variant of makeXferReq: each element selects a
+         *         byte range [offset, offset+len) inside one entry of the prepared
+         *         descriptor list handles (see nixl_xfer_slice_t), so a transfer
+         *         over part of a registered block - e.g. an unaligned read within
+         *         a registered page - needs neither a new descriptor list nor a
+         *         re-registration. Corresponding local and remote slices must have
+         *         equal lengths and fit within their entries; adjacent slices are
+         *         merged like adjacent descriptors in the index-based variant.
+         *
+         * @param  operation        Operation for transfer (e.g., NIXL_WRITE)
+         * @param  local_side       Local prepared descriptor list handle
+         * @param  local_slices     Slices into the local prepared descriptor list handle
+         * @param  remote_side      Remote (or loopback) prepared descriptor list handle
+         * @param  remote_slices    Slices into the remote prepared descriptor list handle
+         * @param  req_hndl [out]   Transfer request handle output
+         * @param  extra_params     Optional additional parameters, as in makeXferReq
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        makeXferReq (const nixl_xfer_op_t &operation,
+                     const nixlDlistH* local_side,
+                     const std::vector<nixl_xfer_slice_t> &local_slices,
+                     const nixlDlistH* remote_side,
+                     const std::vector<nixl_xfer_slice_t> &remote_slices,
+                     nixlXferReqH* &req_hndl,
+                     const nixl_opt_args_t* extra_params = nullptr) const;
+        /**
+         * @brief  Update an existing transfer request in place by selecting new indices
+         *         from already prepared descriptor list handles, e.g., when only block
+         *         indices change between iterations over a fixed registration layout.
+         *         The request stays bound to the backend and remote agent chosen at
+         *         creation time, so populate and backend preparation are skipped; the
+         *         handles must therefore cover that same backend, and the remote side
+         *         must refer to the same agent. The request must not be in progress.
+         *         Optionally, the notification message can be updated via extra_params.
+         *         Only backends whose post path consumes the descriptor lists support
+         *         this (UCX does; storage backends bake their IO plan into the backend
+         *         handle at preparation time); others, as well as compound and
+         *         broadcast requests, return NIXL_ERR_NOT_SUPPORTED.
+         *
+         * @param  req_hndl         Transfer request handle from makeXferReq/createXferReq
+         * @param  local_side       Local prepared descriptor list handle
+         * @param  local_indices    Indices list to the local prepared descriptor list handle
+         * @param  remote_side      Remote (or loopback) prepared descriptor list handle
+         * @param  remote_indices   Indices list to the remote prepared descriptor list handle
+         * @param  extra_params     Optional additional parameters, as in makeXferReq
+         * @return nixl_status_t    Error code if call was not successful
+         */
+        nixl_status_t
+        updateXferReq (nixlXferReqH* req_hndl,
+                       const nixlDlistH* local_side,
+                       const std::vector<int> &local_indices,
+                       const nixlDlistH* remote_side,
+                       const std::vector<int> &remote_indices,
+                       const nixl_opt_args_t* extra_params = nullptr) const;
+
         /**
          * @brief  A combined API, to create a transfer request from two descriptor lists.
          *         NIXL will prepare each side and create a transfer handle `req_hndl`.
@@ -244,11 +522,67 @@ class nixlAgent {
                        const std::string &remote_agent,
                        nixlXferReqH* &req_hndl,
                        const nixl_opt_args_t* extra_params = nullptr) const;
+        /**
+         * @brief  Same as createXferReq, but over non-owning descriptor views
+         *         (see nixlDescListView). Selecting a contiguous window of a
+         *         large descriptor list through views costs no copy and no
+         *         allocation on the caller's side; the viewed lists must stay
+         *         alive and unmodified until this call returns.
+         *
+         * @param  operation      Operation for transfer (e.g., NIXL_WRITE)
+         * @param  local_descs    View of local descriptors
+         * @param  remote_descs   View of remote (or loopback) descriptors
+         * @param  remote_agent   Remote (or self) agent name for accessing the remote (local) data
+         * @param  req_hndl [out] Transfer request handle output
+         * @param  extra_params   Optional extra parameters used in creating a transfer request
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        createXferReq (const nixl_xfer_op_t &operation,
+                       const nixl_xfer_dlist_view_t &local_descs,
+                       const nixl_xfer_dlist_view_t &remote_descs,
+                       const std::string &remote_agent,
+                       nixlXferReqH* &req_hndl,
+                       const nixl_opt_args_t* extra_params = nullptr) const;
+        /**
+         * @brief  Create a broadcast transfer request: one local descriptor
+         *         list written to the same-shaped destination lists on N
+         *         remote agents, replacing N identical createXferReq pulls
+         *         against the source. The agent schedules the fan-out as a
+         *         chunked chain: each destination leg trails its predecessor
+         *         by at least one chunk, so at most one chunk per leg is in
+         *         flight at the source NIC at any time and legs progress as a
+         *         pipelined wavefront. The request is posted with postXferReq
+         *         and driven through getXferStatus like any other; a
+         *         notification from extra_params is generated towards every
+         *         destination once the whole broadcast completes, and
+         *         getXferProgress reports the bytes delivered to all
+         *         destinations so far. Backend hints from extra_params limit
+         *         the per-leg backend selection.
+         *
+         * @param  local_descs    Local descriptor list, the broadcast source
+         * @param  remote_agents  Destination agent names, at least one
+         * @param  remote_descs   Per-destination descriptor lists, matching
+         *                        local_descs in count and lengths
+         * @param  req_hndl [out] Transfer request handle output
+         * @param  extra_params   Optional extra parameters as in createXferReq
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        createBroadcastXferReq (const nixl_xfer_dlist_t &local_descs,
+                                const std::vector<std::string> &remote_agents,
+                                const std::vector<nixl_xfer_dlist_t> &remote_descs,
+                                nixlXferReqH* &req_hndl,
+                                const nixl_opt_args_t* extra_params = nullptr) const;
 
         /*** Operations on prepared Transfer Request ***/
 
         /**
          * @brief Estimate the cost (e.g., duration) of executing a transfer request.
+         *        When the backend provides no estimate of its own, the agent answers
+         *        from a model calibrated online against completed transfer timings
+         *        on the same backend and memory-type pair (requires telemetry to be
+         *        enabled), with the method reported as nixl_cost_t::MEASURED.
          *
          * @param req_hndl     Transfer request handle
          * @param duration     [out] Estimated duration of the transfer
@@ -270,7 +604,9 @@ class nixlAgent {
          *         In case of small transfers that are completed within the call, return value
          *         will be NIXL_SUCCESS. Otherwise, the output status will be NIXL_IN_PROG until
          *         completion. Notification  message  can be preovided through the extra_params,
-         *         and can be updated per re-post.
+         *         and can be updated per re-post. A post can also be chained behind another
+         *         in-flight request via extra_params->chainAfter, deferring it until that
+         *         request completes (see nixl_opt_args_t::chainAfter).
          *
          * @param  req_hndl      Transfer request handle obtained from makeXferReq/createXferReq
          * @param  extra_params  Optional extra parameters used in posting a transfer request
@@ -280,6 +616,47 @@ class nixlAgent {
         postXferReq (nixlXferReqH* req_hndl,
                      const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Set a software rate limit for transfers towards a peer, as a
+         *         token bucket debited at postXferReq admission. One bucket per
+         *         (peer, priority class), with the class taken from
+         *         extra_params->priority (normal by default), so bulk traffic
+         *         can be capped while high-priority transfers to the same peer
+         *         stay unshaped. A shaped post returns NIXL_ERR_NOT_POSTED and
+         *         leaves the request handle intact for a later repost. The
+         *         bucket holds up to one second of tokens at the configured
+         *         rate; rates can be readjusted at runtime, and 0 removes the
+         *         limit. Shaped posts are counted in telemetry
+         *         (agent_rate_limited_posts).
+         *
+         * @param  remote_agent  Peer agent whose incoming-from-us transfers are shaped
+         * @param  bytes_per_sec Admission rate in bytes per second, 0 to remove
+         * @param  extra_params  [optional] Extra parameters, for the priority class
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        setXferRateLimit (const std::string &remote_agent,
+                          uint64_t bytes_per_sec,
+                          const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Submit a batch of transfer requests in one call. The agent lock is
+         *         taken once for the whole batch, amortizing the per-call overhead
+         *         when many small transfers are posted back to back. The semantics
+         *         per request are identical to postXferReq, including the optional
+         *         notification from extra_params, which applies to every request in
+         *         the batch. Posting continues past failed entries; each request's
+         *         status can be queried individually via getXferStatus.
+         *
+         * @param  req_hndls     Transfer request handles to be posted
+         * @param  extra_params  Optional extra parameters, applied to every request
+         * @return nixl_status_t NIXL_IN_PROG/NIXL_SUCCESS if all posts succeeded,
+         *                       or the first error encountered otherwise
+         */
+        nixl_status_t
+        postXferReqBatch (const std::vector<nixlXferReqH*> &req_hndls,
+                          const nixl_opt_args_t* extra_params = nullptr) const;
+
         /**
          * @brief  Check the status of transfer request `req_hndl`
          *
@@ -289,6 +666,66 @@ class nixlAgent {
         nixl_status_t
         getXferStatus (nixlXferReqH* req_hndl) const;
 
+        /**
+         * @brief  Check the status of a batch of transfer requests in one
+         *         call. Requests whose terminal status is already published
+         *         answer from their atomic status word without taking the
+         *         agent lock, and the lock is then taken once for all the
+         *         still-in-flight ones, so a poll loop over many handles pays
+         *         one lock round trip per tick instead of one per handle. The
+         *         semantics per request are identical to getXferStatus,
+         *         including handle recycling on a dropped peer.
+         *
+         * @param  req_hndls      Transfer request handles after postXferReq
+         * @param  statuses [out] Per-request status, in req_hndls order
+         * @return nixl_status_t  NIXL_IN_PROG if any request is still in
+         *                        flight and none failed, NIXL_SUCCESS if all
+         *                        completed, or the first error encountered
+         */
+        nixl_status_t
+        getXferStatusBatch (const std::vector<nixlXferReqH*> &req_hndls,
+                            std::vector<nixl_status_t> &statuses) const;
+
+        /**
+         * @brief  Check the status of transfer request `req_hndl` and report how
+         *         many payload bytes have completed so far. The byte count
+         *         advances at the granularity the backend posts work (see the
+         *         UCX backend's chunk_size parameter), so long transfers can be
+         *         preempted based on partial progress instead of waiting for an
+         *         all-or-nothing completion. Compound and background-polled
+         *         requests, and backends without byte accounting, return
+         *         NIXL_ERR_NOT_SUPPORTED.
+         *
+         * @param  req_hndl      Transfer request handle after postXferReq
+         * @param  bytes_done    [out] Payload bytes completed since the post
+         * @return nixl_status_t Transfer status as in getXferStatus, or error code
+         */
+        nixl_status_t
+        getXferProgress (nixlXferReqH* req_hndl, size_t &bytes_done) const;
+
+        /**
+         * @brief  Arm a one-shot callback invoked when `req_hndl` reaches a
+         *         terminal status, instead of polling getXferStatus. The request
+         *         is handed to the agent's completion poller (see
+         *         nixl_opt_args_t::backgroundPolling) and the callback runs on
+         *         the poller thread, outside the agent lock, so it may call back
+         *         into the agent; it receives the final transfer status. The
+         *         request must not be released while a callback is pending.
+         *         Coroutine-based applications can use nixl::awaitXfer from
+         *         nixl_awaitable.h instead of calling this directly.
+         *
+         * @param  req_hndl      Transfer request handle after postXferReq
+         * @param  cb            Callback receiving the terminal status
+         * @return nixl_status_t NIXL_IN_PROG if the callback was armed; the
+         *                       terminal status if the transfer already completed,
+         *                       in which case the callback is not retained and
+         *                       never invoked; or an error code. Compound
+         *                       transfers return NIXL_ERR_NOT_SUPPORTED.
+         */
+        nixl_status_t
+        onXferCompletion (nixlXferReqH* req_hndl,
+                          std::function<void(nixl_status_t)> cb) const;
+
         /**
          * @brief  Query the backend associated with `req_hndl`. E.g., if for genNotif
          *         the same backend as a transfer is desired.
@@ -301,6 +738,21 @@ class nixlAgent {
         queryXferBackend (const nixlXferReqH* req_hndl,
                           nixlBackendH* &backend) const;
 
+        /**
+         * @brief  Retrieve the per-stage timestamps captured for `req_hndl`,
+         *         telling whether a slow transfer spent its time in descriptor
+         *         populate, backend prep, post, or on the wire. Only available
+         *         when the library is built with -Dxfer_timeline=true;
+         *         returns NIXL_ERR_NOT_SUPPORTED otherwise.
+         *
+         * @param  req_hndl       Transfer request handle obtained from makeXferReq/createXferReq
+         * @param  timeline [out] Output timestamps; stages not reached yet are 0
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        getXferTimeline (const nixlXferReqH* req_hndl,
+                         nixl_xfer_timeline_t &timeline) const;
+
         /**
          * @brief  Release the transfer request `req_hndl`. If the transfer is active,
          *         it will be canceled, or return an error if the transfer cannot be aborted.
@@ -311,6 +763,25 @@ class nixlAgent {
         nixl_status_t
         releaseXferReq (nixlXferReqH* req_hndl) const;
 
+        /**
+         * @brief  Abort the in-flight transfer request `req_hndl` without waiting
+         *         for it to complete, reclaiming the backend's outstanding work
+         *         (and hence link bandwidth) right away. Cancellation is best
+         *         effort per chunk: portions already picked up by the NIC or
+         *         device still land, so the remote data is indeterminate and any
+         *         bound notification is not sent. On success the handle's status
+         *         becomes NIXL_ERR_CANCELED and the handle stays valid for repost
+         *         or releaseXferReq. Requests that already reached a terminal
+         *         status return that status; compound requests and backends
+         *         without cancel support return NIXL_ERR_NOT_SUPPORTED, leaving
+         *         the transfer running.
+         *
+         * @param  req_hndl      Transfer request handle after postXferReq
+         * @return nixl_status_t NIXL_SUCCESS or error code if call was not successful
+         */
+        nixl_status_t
+        cancelXferReq (nixlXferReqH* req_hndl) const;
+
         /**
          * @brief  Release the prepared descriptor list handle `dlist_hndl`
          *
@@ -337,6 +808,35 @@ class nixlAgent {
         getNotifs (nixl_notifs_t &notif_map,
                    const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Zero-copy variant of getNotifs. Appends a view per received
+         *         notification to the input list instead of copying messages into a
+         *         map; the drained messages are kept alive inside the handle and the
+         *         views stay valid until releaseNotifs is called on it. Pass the same
+         *         handle to accumulate across calls, or a nullptr-initialized one to
+         *         get a fresh batch. Optionally, a list of backends can be mentioned
+         *         in extra_params to only get those backends notifications.
+         *
+         * @param  notif_hndl [inout] Notification batch handle, created if nullptr
+         * @param  notif_views   Input notification views list (can be non-empty)
+         * @param  extra_params  Optional extra parameters used in getting notifications
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        getNotifsView (nixlNotifsH* &notif_hndl,
+                       nixl_notifs_view_t &notif_views,
+                       const nixl_opt_args_t* extra_params = nullptr);
+
+        /**
+         * @brief  Release a notification batch handle obtained from getNotifsView,
+         *         invalidating all views handed out with it.
+         *
+         * @param  notif_hndl    Notification batch handle to be released
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        releaseNotifs (nixlNotifsH* notif_hndl);
+
         /**
          * @brief  Generate a notification, not bound to a transfer, e.g., for control.
          *         Metadata of remote agent should be available before this call. The
@@ -354,6 +854,40 @@ class nixlAgent {
                   const nixl_blob_t &msg,
                   const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Generate several notifications to the same remote agent in one
+         *         call. Backends that support it pack the whole batch into a
+         *         single wire message, amortizing the per-message overhead;
+         *         others send the messages one by one. Delivery semantics match
+         *         an equivalent sequence of genNotif calls, in order.
+         *
+         * @param  remote_agent  Remote agent name as string
+         * @param  msgs          Notification messages to be sent, in order
+         * @param  extra_params  Optional extra parameters used in generating standalone notifs
+         * @return nixl_status_t Error code if call was not successful
+         */
+        nixl_status_t
+        genNotifBatch (const std::string &remote_agent,
+                       const std::vector<nixl_blob_t> &msgs,
+                       const nixl_opt_args_t* extra_params = nullptr) const;
+
+        /**
+         * @brief  Get a versioned, immutable snapshot of the agent's
+         *         registration and connection state for monitoring. When
+         *         nothing changed since the last build the published
+         *         snapshot is handed out with one atomic load and no
+         *         locking, so polling dashboards never contend with the
+         *         data path; after metadata mutations the next call
+         *         rebuilds it under the shared agent lock and republishes.
+         *         The returned object never changes and stays valid for as
+         *         long as the caller holds the pointer.
+         *
+         * @param  snapshot [out] The current snapshot
+         * @return nixl_status_t  Error code if call was not successful
+         */
+        nixl_status_t
+        getAgentSnapshot (std::shared_ptr<const nixl_agent_snapshot_t> &snapshot) const;
+
         /*** Metadata handling through side channel ***/
         /**
          * @brief  Get metadata blob for this agent, to be given to other agents.
@@ -396,6 +930,23 @@ class nixlAgent {
         loadRemoteMD (const nixl_blob_t &remote_metadata,
                       std::string &agent_name);
 
+        /**
+         * @brief  Reload remote agents' metadata persisted in the directory given by
+         *         nixlAgentConfig::remoteMDCacheDir. Each persisted blob is memory-mapped
+         *         and goes through the same parsing and validation as loadRemoteMD;
+         *         entries that fail to load (corrupt, or no common backend with the
+         *         current agent) are removed and skipped. Intended to be called once
+         *         after a restart, when the relevant backends have been created, to
+         *         avoid re-fetching every peer's metadata.
+         *
+         * @param  agent_names [out] Names of the remote agents that were reloaded
+         * @return nixl_status_t     Error code if call was not successful; NIXL_SUCCESS
+         *                           with an empty list when the cache is empty or
+         *                           persistence is disabled
+         */
+        nixl_status_t
+        loadRemoteMDFromCache (std::vector<std::string> &agent_names);
+
         /**
          * @brief  Invalidate the remote agent metadata cached locally. This will
          *         disconnect from that agent if already connected, and no more
@@ -466,6 +1017,28 @@ class nixlAgent {
         fetchRemoteMD (const std::string remote_name,
                        const nixl_opt_args_t* extra_params = nullptr);
 
+        /**
+         * @brief  Prefetch a remote agent's metadata ahead of the first transfer
+         *         to a predicted peer. The fetch runs asynchronously as in
+         *         fetchRemoteMD, and once the fetched metadata has been loaded
+         *         (unpacking the backend keys), the connections to that peer are
+         *         pre-warmed as in prewarmConnections from the metadata handling
+         *         thread. The first transfer then finds everything hot instead of
+         *         paying the fetch and transport wireup latency inline.
+         *
+         * @param  remote_name   Name of the remote agent to prefetch; must match the
+         *                       agent name carried in the fetched metadata for the
+         *                       warmup step to trigger.
+         * @param  extra_params  Same options as fetchRemoteMD: IP address and/or port
+         *                       for peer to peer fetching, or metadataLabel to prefetch
+         *                       partial metadata from the metadata server.
+         *
+         * @return nixl_status_t    Error code if the fetch could not be initiated
+         */
+        nixl_status_t
+        prefetchRemoteMD (const std::string remote_name,
+                          const nixl_opt_args_t* extra_params = nullptr);
+
         /**
          * @brief  Invalidate your own memory in one/all remote agent(s).
          *
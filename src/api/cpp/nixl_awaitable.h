@@ -0,0 +1,92 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/**
+ * @file nixl_awaitable.h
+ * @brief Optional C++20 coroutine adapter over the transfer completion
+ *        callback (nixlAgent::onXferCompletion). Header-only and guarded
+ *        on compiler coroutine support, so including it from C++17
+ *        builds is harmless; the library itself stays C++17.
+ */
+#ifndef _NIXL_AWAITABLE_H
+#define _NIXL_AWAITABLE_H
+
+#include "nixl.h"
+
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+
+namespace nixl {
+
+/**
+ * @class xferAwaitable
+ * @brief Awaitable returned by awaitXfer. co_await suspends until the
+ *        transfer reaches a terminal status and yields that status;
+ *        already-completed transfers resume inline without suspending.
+ *        The coroutine is resumed on the agent's completion poller
+ *        thread. The request handle must stay valid (not released)
+ *        until the co_await returns.
+ */
+class xferAwaitable {
+    public:
+        xferAwaitable(nixlAgent &agent, nixlXferReqH *req_hndl)
+            : agent_(agent), req_(req_hndl) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> h) {
+            nixl_status_t ret =
+                agent_.onXferCompletion(req_, [this, h](nixl_status_t st) {
+                    status_ = st;
+                    h.resume();
+                });
+            // The callback owns status_ once armed; only touch it on the
+            // inline-completion path where it was never retained
+            if (ret == NIXL_IN_PROG)
+                return true;
+            status_ = ret;
+            return false;
+        }
+
+        nixl_status_t await_resume() const noexcept { return status_; }
+
+    private:
+        nixlAgent     &agent_;
+        nixlXferReqH  *req_;
+        nixl_status_t  status_ = NIXL_ERR_NOT_POSTED;
+};
+
+/**
+ * @brief Await completion of a posted transfer request, e.g.
+ *        `nixl_status_t st = co_await nixl::awaitXfer(agent, req);`
+ *
+ * @param agent    Agent the request was created on
+ * @param req_hndl Transfer request handle after postXferReq
+ * @return awaitable yielding the terminal transfer status (or
+ *         NIXL_ERR_NOT_SUPPORTED for compound transfers, which have no
+ *         completion hook and must be driven through getXferStatus)
+ */
+inline xferAwaitable
+awaitXfer(nixlAgent &agent, nixlXferReqH *req_hndl) {
+    return xferAwaitable(agent, req_hndl);
+}
+
+} // namespace nixl
+
+#endif // __cpp_impl_coroutine
+
+#endif // _NIXL_AWAITABLE_H
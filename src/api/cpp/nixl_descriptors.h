@@ -19,8 +19,12 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <algorithm>
 #include "nixl_types.h"
 
@@ -60,6 +64,13 @@ class nixlBasicDesc {
          * @param str   Serialized Descriptor
          */
         nixlBasicDesc(const nixl_blob_t &str); // deserializer
+        /**
+         * @brief Zero-copy deserializer constructor for nixlBasicDesc,
+         *        from a view into a serialized blob
+         *
+         * @param str   View into a serialized descriptor
+         */
+        explicit nixlBasicDesc(const std::string_view &str);
         /**
          * @brief Copy constructor for nixlBasicDesc
          *
@@ -158,6 +169,13 @@ class nixlBlobDesc : public nixlBasicDesc {
          * @param str   Serialized blob from another nixlBlobDesc
          */
         nixlBlobDesc(const nixl_blob_t &str);
+        /**
+         * @brief Zero-copy deserializer constructor for nixlBlobDesc,
+         *        from a view into a serialized blob
+         *
+         * @param str   View into a serialized descriptor
+         */
+        explicit nixlBlobDesc(const std::string_view &str);
         /**
          * @brief Operator overloading (==) to compare nixlBlobDesc objects
          *
@@ -178,6 +196,248 @@ class nixlBlobDesc : public nixlBasicDesc {
         void print(const std::string &suffix) const;
 };
 
+/**
+ * @class nixlSmallVector
+ * @brief A vector with inline storage for up to N elements, spilling to the
+ *        heap only beyond that. Backs the descriptor storage of nixlDescList,
+ *        so the dominant small transfer shapes (a single tensor, short block
+ *        lists) are built and copied without touching the allocator. Spills
+ *        beyond the inline capacity go through the Allocator parameter
+ *        (global allocator by default), inherited privately so a stateless
+ *        allocator costs no storage.
+ */
+template<class T, size_t N, class Allocator = std::allocator<T>>
+class nixlSmallVector : private Allocator {
+    private:
+        using alloc_traits = std::allocator_traits<Allocator>;
+
+        /** @var Inline element storage, in use while capacity is still N */
+        alignas(T) unsigned char buffer[N * sizeof(T)];
+        /** @var Current element storage, the inline buffer or a heap block */
+        T*     elems;
+        size_t count;
+        size_t cap;
+
+        inline Allocator& allocator() { return *this; }
+        inline const Allocator& allocator() const { return *this; }
+
+        inline bool inlined() const {
+            return elems == reinterpret_cast<const T*>(buffer);
+        }
+
+        /** @brief Move the elements into a larger heap block */
+        void grow(size_t min_cap) {
+            size_t new_cap = std::max(cap * 2, min_cap);
+            T* new_elems = alloc_traits::allocate(allocator(), new_cap);
+            for (size_t i = 0; i < count; ++i) {
+                new (new_elems + i) T(std::move(elems[i]));
+                elems[i].~T();
+            }
+            if (!inlined())
+                alloc_traits::deallocate(allocator(), elems, cap);
+            elems = new_elems;
+            cap   = new_cap;
+        }
+
+    public:
+        using iterator       = T*;
+        using const_iterator = const T*;
+
+        nixlSmallVector(const Allocator &alloc = Allocator())
+            : Allocator(alloc), elems(reinterpret_cast<T*>(buffer)),
+              count(0), cap(N) {}
+
+        nixlSmallVector(const nixlSmallVector &other)
+            : nixlSmallVector(other.allocator()) {
+            reserve(other.count);
+            for (size_t i = 0; i < other.count; ++i)
+                new (elems + i) T(other.elems[i]);
+            count = other.count;
+        }
+
+        nixlSmallVector(nixlSmallVector &&other)
+            : nixlSmallVector(other.allocator()) {
+            *this = std::move(other);
+        }
+
+        nixlSmallVector& operator=(const nixlSmallVector &other) {
+            if (this != &other) {
+                clear();
+                reserve(other.count);
+                for (size_t i = 0; i < other.count; ++i)
+                    new (elems + i) T(other.elems[i]);
+                count = other.count;
+            }
+            return *this;
+        }
+
+        nixlSmallVector& operator=(nixlSmallVector &&other) {
+            if (this != &other) {
+                clear();
+                if (other.inlined() || allocator() != other.allocator()) {
+                    // Inline elements (or a block owned by a different
+                    // allocator) cannot be stolen, move them over
+                    reserve(other.count);
+                    for (size_t i = 0; i < other.count; ++i)
+                        new (elems + i) T(std::move(other.elems[i]));
+                    count = other.count;
+                    other.clear();
+                } else {
+                    if (!inlined())
+                        alloc_traits::deallocate(allocator(), elems, cap);
+                    elems = other.elems;
+                    count = other.count;
+                    cap   = other.cap;
+                    other.elems = reinterpret_cast<T*>(other.buffer);
+                    other.count = 0;
+                    other.cap   = N;
+                }
+            }
+            return *this;
+        }
+
+        ~nixlSmallVector() {
+            clear();
+            if (!inlined())
+                alloc_traits::deallocate(allocator(), elems, cap);
+        }
+
+        inline size_t size() const { return count; }
+        inline T* data() { return elems; }
+        inline const T* data() const { return elems; }
+        inline iterator begin() { return elems; }
+        inline iterator end() { return elems + count; }
+        inline const_iterator begin() const { return elems; }
+        inline const_iterator end() const { return elems + count; }
+        inline T& operator[](size_t index) { return elems[index]; }
+        inline const T& operator[](size_t index) const { return elems[index]; }
+
+        inline void reserve(size_t n) {
+            if (n > cap)
+                grow(n);
+        }
+
+        /** @brief Like std::vector, keeps the spilled capacity for reuse */
+        void clear() {
+            for (size_t i = 0; i < count; ++i)
+                elems[i].~T();
+            count = 0;
+        }
+
+        void resize(size_t n) {
+            if (n > cap)
+                grow(n);
+            for (size_t i = count; i < n; ++i)
+                new (elems + i) T();
+            for (size_t i = n; i < count; ++i)
+                elems[i].~T();
+            count = n;
+        }
+
+        void push_back(const T &val) {
+            if (count == cap) {
+                T tmp(val); // val may alias an element being relocated
+                grow(count + 1);
+                new (elems + count) T(std::move(tmp));
+            } else {
+                new (elems + count) T(val);
+            }
+            ++count;
+        }
+
+        template<class... Args>
+        void emplace_back(Args&&... args) {
+            if (count == cap)
+                grow(count + 1);
+            new (elems + count) T(std::forward<Args>(args)...);
+            ++count;
+        }
+
+        iterator insert(const_iterator pos, const T &val) {
+            size_t idx = pos - elems;
+            T tmp(val); // val may alias an element being shifted
+            if (count == cap)
+                grow(count + 1);
+            if (idx < count) {
+                new (elems + count) T(std::move(elems[count - 1]));
+                for (size_t i = count - 1; i > idx; --i)
+                    elems[i] = std::move(elems[i - 1]);
+                elems[idx] = std::move(tmp);
+            } else {
+                new (elems + idx) T(std::move(tmp));
+            }
+            ++count;
+            return elems + idx;
+        }
+
+        iterator erase(const_iterator pos) {
+            size_t idx = pos - elems;
+            for (size_t i = idx; i + 1 < count; ++i)
+                elems[i] = std::move(elems[i + 1]);
+            elems[--count].~T();
+            return elems + idx;
+        }
+};
+
+/**
+ * @brief Out-of-core block allocation behind nixlDescAllocator. When
+ *        out-of-core mode is enabled (NIXL_OOC_DESC_THRESHOLD, in bytes)
+ *        and the block is at or above the threshold, the block comes from
+ *        an mmap'd unlinked temp file (created under NIXL_OOC_DESC_DIR,
+ *        default /tmp) and nixlOocAlloc returns its address; otherwise it
+ *        returns nullptr and the caller allocates from the heap.
+ */
+void* nixlOocAlloc(size_t bytes);
+/**
+ * @brief Release a block if it came from nixlOocAlloc, returning false
+ *        (and doing nothing) when the address is not an out-of-core block.
+ */
+bool nixlOocFree(void* addr);
+
+/**
+ * @class nixlDescAllocator
+ * @brief Allocator for spilled descriptor storage. Plain heap allocation
+ *        by default; with out-of-core mode enabled, blocks above the
+ *        threshold live in mmap'd unlinked temp files instead, so the
+ *        descriptor arrays of massive registrations (e.g. millions of
+ *        NVMe-offload FILE_SEG entries) sit on evictable page-cache pages
+ *        that the kernel writes out when cold and faults back in
+ *        transparently when populate touches them, instead of pinning
+ *        anonymous RSS. The hot search fields stay resident regardless:
+ *        the SoA mirror that findCovering binary-searches on large lists
+ *        remains heap-allocated.
+ */
+template<class T>
+class nixlDescAllocator {
+    public:
+        using value_type = T;
+
+        nixlDescAllocator() = default;
+        template<class U>
+        nixlDescAllocator(const nixlDescAllocator<U>&) {}
+
+        T* allocate(size_t n) {
+            if (void *p = nixlOocAlloc(n * sizeof(T)))
+                return static_cast<T*>(p);
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, size_t) {
+            if (!nixlOocFree(p))
+                ::operator delete(p);
+        }
+};
+
+template<class T, class U>
+inline bool operator==(const nixlDescAllocator<T>&,
+                       const nixlDescAllocator<U>&) { return true; }
+template<class T, class U>
+inline bool operator!=(const nixlDescAllocator<T>&,
+                       const nixlDescAllocator<U>&) { return false; }
+
+template<class T>
+class nixlDescListView;
+
 /**
  * @class nixlDescList
  * @brief A class for describing a list of descriptors, as a template based on
@@ -193,8 +453,52 @@ class nixlDescList {
          *       has comparison order of devID, then addr, then len.
          */
         bool           sorted;
-        /** @var Vector for storing nixlDescs */
-        std::vector<T> descs;
+        /** @var Inline descriptor capacity: lists up to this size (the
+         *       dominant single-tensor and small block-list transfer shapes)
+         *       live entirely inside the object, with no heap allocation.
+         */
+        static constexpr size_t SBO_CAPACITY = 16;
+        /** @var Storage for nixlDescs, inline up to SBO_CAPACITY; spills
+         *       go through nixlDescAllocator, so huge lists can live in
+         *       file-backed mappings when out-of-core mode is enabled
+         */
+        nixlSmallVector<T, SBO_CAPACITY, nixlDescAllocator<T>> descs;
+        /** @var Lazily built index into descs, ordered by the nixlBasicDesc (<)
+         *       operator. Only used for unsorted lists, to turn linear scans in
+         *       getIndex/overlaps/hasOverlaps into binary searches. Built on
+         *       first query and invalidated by any mutation of the list.
+         */
+        mutable std::vector<int> queryIndex;
+        /** @var Running max of (addr + len) over the queryIndex prefix,
+         *       reset at each devId change. Lists are not guaranteed
+         *       internally disjoint, so the overlaps stabbing query walks
+         *       back from the insertion point and uses this to stop as
+         *       soon as no earlier descriptor on the device can reach the
+         *       query address.
+         */
+        mutable std::vector<uintptr_t> prefixMaxEnd;
+        /** @var Flag for whether queryIndex matches the current descs content */
+        mutable bool indexValid = false;
+        /** @var SoA mirror of the descriptor fields (devId/addr/len), built
+         *       lazily for large lists so the validation passes run tight
+         *       loops over contiguous integers that the compiler can
+         *       vectorize, instead of striding over whole descriptors.
+         */
+        mutable std::vector<uint64_t>  soaDevId;
+        mutable std::vector<uintptr_t> soaAddr;
+        mutable std::vector<size_t>    soaLen;
+        /** @var Flag for whether the SoA mirror matches the current descs */
+        mutable bool soaValid = false;
+
+        /** @var Minimum list size for which the SoA mirror pays off */
+        static constexpr size_t SOA_THRESHOLD = 1024;
+
+        /** @brief Build queryIndex over the current descriptors */
+        void buildIndex() const;
+        /** @brief Build the SoA mirror over the current descriptors */
+        void buildSoA() const;
+        /** @brief Mark the query structures stale, called on any list mutation */
+        inline void invalidateIndex() { indexValid = false; soaValid = false; }
 
     public:
         /**
@@ -214,6 +518,15 @@ class nixlDescList {
          * @param deserialize nixlSerDes object to construct nixlDescList
          */
         nixlDescList(nixlSerDes* deserializer);
+        /**
+         * @brief Bulk constructor from a descriptor view, copying the viewed
+         *        range in one pass together with its memory type and sorted
+         *        flag. A view marked sorted is trusted (and only verified in
+         *        debug builds), not re-sorted.
+         *
+         * @param view View over the descriptors to copy
+         */
+        explicit nixlDescList(const nixlDescListView<T> &view);
         /**
          * @brief Copy constructor for creating nixlDescList from another object
          *        of the same type.
@@ -261,13 +574,13 @@ class nixlDescList {
         /**
          * @brief Vector like iterators for const and non-const elements
          */
-        inline typename std::vector<T>::const_iterator begin() const
+        inline const T* begin() const
             { return descs.begin(); }
-        inline typename std::vector<T>::const_iterator end() const
+        inline const T* end() const
             { return descs.end(); }
-        inline typename std::vector<T>::iterator begin()
+        inline T* begin()
             { return descs.begin(); }
-        inline typename std::vector<T>::iterator end()
+        inline T* end()
             { return descs.end(); }
         /**
          * @brief Operator overloading (==) to compare nixlDescList objects
@@ -293,12 +606,63 @@ class nixlDescList {
         /**
          * @brief Empty the descriptors list
          */
-        inline void clear() { descs.clear(); }
+        inline void clear() { descs.clear(); invalidateIndex(); }
+        /**
+         * @brief Re-initialize the list in place for reuse, keeping the
+         *        already allocated descriptor storage. Used by the transfer
+         *        handle pool to keep steady-state creation allocation-free.
+         *
+         * @param type      NIXL memory type of descriptor list
+         * @param sorted    Flag to set sorted option
+         * @param init_size initial size for descriptor list (default = 0)
+         */
+        void reinit (const nixl_mem_t &type,
+                     const bool &sorted,
+                     const size_t &init_size = 0);
         /**
          * @brief     Add Descriptors to descriptor list
          *               If nixlDescList object is sorted, this method keeps it sorted
          */
         void addDesc(const T &desc);
+        /**
+         * @brief Replace the list's contents with an already sorted batch of
+         *        descriptors in one bulk copy and set the sorted flag. The
+         *        batch order is only verified in debug builds; callers are
+         *        expected to hand in ranges their producers keep sorted.
+         *
+         * @param batch First descriptor of the pre-sorted batch
+         * @param count Number of descriptors in the batch
+         */
+        void assignSorted(const T *batch, const size_t &count);
+        /**
+         * @brief     Add a batch of descriptors in one call. For a sorted
+         *            list the batch must itself be sorted (verified in debug
+         *            builds only) and is merged in a single backward pass,
+         *            so each element moves once instead of the per-element
+         *            shifting of repeated addDesc calls; for an unsorted
+         *            list the batch is appended.
+         *
+         * @param batch First descriptor of the batch
+         * @param count Number of descriptors in the batch
+         */
+        void addDescs(const T *batch, const size_t &count);
+        /**
+         * @brief     Add `count` equal-size blocks starting at `base_desc`
+         *            and spaced `stride` bytes apart, as produced by paged
+         *            or otherwise strided (e.g. KV block) memory layouts.
+         *            The run is generated in place with one resize, so
+         *            expanding thousands of blocks costs a single tight
+         *            loop instead of per-block insertion. Blocks share
+         *            `base_desc`'s length, devId and metadata.
+         *
+         * @param base_desc First block of the run; `addr` advances by
+         *                  `stride` for each subsequent block
+         * @param stride    Byte distance between consecutive block starts,
+         *                  must be at least `base_desc.len`
+         * @param count     Number of blocks in the run
+         */
+        void addStridedDescs(const T &base_desc, const size_t &stride,
+                             const size_t &count);
         /**
          * @brief Remove descriptor from list at index
          *        Can throw std::out_of_range exception.
@@ -309,6 +673,17 @@ class nixlDescList {
          *        nixlDescList of nixlBasicDesc elements
          */
         nixlDescList<nixlBasicDesc> trim() const;
+        /**
+         * @brief Get a non-owning view over a contiguous range of this
+         *        list's descriptors (the whole list by default), without
+         *        copying them. The view is only valid while the list is
+         *        alive and unmodified.
+         *
+         * @param offset Index of the first descriptor included in the view
+         * @param count  Number of descriptors, clamped to the list's end
+         */
+        nixlDescListView<T> view(size_t offset = 0,
+                                 size_t count = SIZE_MAX) const;
         /**
          * @brief  Check if input descriptor `desc` overlaps with any descriptor
          *         within the current object, and returns its index if found.
@@ -323,6 +698,19 @@ class nixlDescList {
          * @return int   index of the queried nixlBasicDesc if found, or negative error value
          */
         int getIndex(const nixlBasicDesc &query) const;
+        /**
+         * @brief  Get the index of a descriptor fully covering the `query`
+         *         range. On large sorted lists the binary search runs over
+         *         the SoA mirror, so it touches only the hot addr/len/devId
+         *         fields and not the cold metadata carried by the full
+         *         descriptors (hot/cold split of the search working set).
+         *
+         * @param  query nixlBasicDesc range to resolve
+         * @param  hint  index to start the search from on sorted lists
+         *               (e.g. the previous hit when resolving a batch)
+         * @return int   index of a covering descriptor, or negative error value
+         */
+        int findCovering(const nixlBasicDesc &query, int hint = 0) const;
         /**
          * @brief Serialize a descriptor list with nixlSerDes class
          * @param serializer nixlSerDes object to serialize nixlDescList
@@ -334,6 +722,82 @@ class nixlDescList {
          */
         void print() const;
 };
+/**
+ * @class nixlDescListView
+ * @brief A non-owning, span-based view over a contiguous range of
+ *        descriptors, carrying the memory type and sorted flag of the
+ *        storage it was taken from. Selecting a window of a large
+ *        prepped list this way costs two words instead of copying
+ *        descriptors into a new list. The viewed storage must outlive
+ *        the view and must not be modified while the view is in use.
+ */
+template<class T>
+class nixlDescListView {
+    private:
+        /** @var First viewed descriptor, not owned */
+        const T*   elems;
+        /** @var Number of viewed descriptors */
+        size_t     count;
+        /** @var NIXL memory type of the viewed descriptors */
+        nixl_mem_t type;
+        /** @var Whether the viewed range is sorted (see nixlDescList) */
+        bool       sorted;
+
+    public:
+        /**
+         * @brief View over raw descriptor storage
+         *
+         * @param descs  First descriptor of the range
+         * @param count  Number of descriptors in the range
+         * @param type   NIXL memory type of the descriptors
+         * @param sorted Whether the range is sorted
+         */
+        nixlDescListView(const T *descs, const size_t &count,
+                         const nixl_mem_t &type, bool sorted = false)
+            : elems(descs), count(count), type(type), sorted(sorted) {}
+        /**
+         * @brief View over a whole descriptor list
+         *
+         * @param d_list List to view, must outlive the view
+         */
+        nixlDescListView(const nixlDescList<T> &d_list)
+            : elems(d_list.begin()), count(d_list.descCount()),
+              type(d_list.getType()), sorted(d_list.isSorted()) {}
+
+        /**
+         * @brief Get NIXL memory type of the viewed descriptors
+         */
+        inline nixl_mem_t getType() const { return type; }
+        /**
+         * @brief Get sorted flag of the viewed range
+         */
+        inline bool isSorted() const { return sorted; }
+        /**
+         * @brief Get count of viewed descriptors
+         */
+        inline int descCount() const { return (int)count; }
+        /**
+         * @brief Check if the view is empty
+         */
+        inline bool isEmpty() const { return count == 0; }
+        /**
+         * @brief Iterators over the viewed descriptors, const only
+         */
+        inline const T* begin() const { return elems; }
+        inline const T* end() const { return elems + count; }
+        /**
+         * @brief Unchecked element access into the viewed range
+         */
+        inline const T& operator[](size_t index) const { return elems[index]; }
+};
+
+template<class T>
+inline nixlDescListView<T> nixlDescList<T>::view(size_t offset, size_t count) const {
+    const size_t avail = descs.size() > offset ? descs.size() - offset : 0;
+    return nixlDescListView<T>(descs.data() + offset,
+                               std::min(count, avail), type, sorted);
+}
+
 /**
  * @brief A typedef for a nixlDescList<nixlBasicDesc>
  *        used for creating transfer descriptor lists
@@ -344,5 +808,10 @@ using nixl_xfer_dlist_t = nixlDescList<nixlBasicDesc>;
  *        used for creating registratoin descriptor lists
  */
 using nixl_reg_dlist_t = nixlDescList<nixlBlobDesc>;
+/**
+ * @brief A typedef for a nixlDescListView<nixlBasicDesc>
+ *        used for passing transfer descriptor subsets without copying
+ */
+using nixl_xfer_dlist_view_t = nixlDescListView<nixlBasicDesc>;
 
 #endif
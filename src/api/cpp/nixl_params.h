@@ -53,6 +53,101 @@ class nixlAgentConfig {
          */
         uint64_t lthrDelay;
 
+        /**
+         * @var Cap on cached remote agents' metadata. When nonzero, loading
+         *      metadata for an agent beyond the cap evicts the least
+         *      recently used remote agent, releasing its backend metadata
+         *      as if invalidateRemoteMD was called; an evicted peer can be
+         *      re-fetched lazily with fetchRemoteMD on next use.
+         *      0 (default) keeps the cache unbounded.
+         */
+        size_t maxRemoteAgents = 0;
+
+        /**
+         * @var Size in bytes of the agent's internal allocation pool.
+         *      When nonzero, the agent's internal bookkeeping containers
+         *      (remote metadata maps, name interning) draw from an
+         *      isolated per-agent arena of roughly this initial size
+         *      (rounded up to whole chunks, growing on demand), instead
+         *      of contending with application mallocs on the global
+         *      allocator during metadata load storms. The arena's
+         *      footprint is its containers' high-water mark.
+         *      0 (default) uses the global allocator.
+         */
+        size_t internalPoolSize = 0;
+
+        /**
+         * @var CPU set for NIXL internal threads, in Linux cpulist format
+         *      (e.g. "0-3,8"). When non-empty, every internal thread the
+         *      agent creates (comm worker, metadata reclaim and completion
+         *      poller threads, telemetry, backend progress threads and
+         *      plugin thread pools) is pinned to these CPUs at creation,
+         *      keeping them off latency-critical application cores.
+         *      Backends can be overridden individually through the
+         *      "thread_cpuset" backend parameter. Best effort: an invalid
+         *      spec logs a warning and leaves threads unpinned.
+         *      Empty (default) keeps inherited affinity.
+         */
+        std::string threadCpuSet;
+
+        /**
+         * @var Directory for persisted remote metadata. When non-empty,
+         *      every successfully loaded full metadata blob is mirrored to
+         *      "<dir>/<agent>.nixlmd" (written to a temp file and renamed,
+         *      so readers never see a partial blob), and a restarted agent
+         *      can reload all of its peers from disk with
+         *      loadRemoteMDFromCache() instead of re-fetching them.
+         *      Entries are removed on invalidateRemoteMD and when an
+         *      incremental update makes the persisted blob stale.
+         *      Empty (default) disables persistence.
+         */
+        std::string remoteMDCacheDir;
+
+        /**
+         * @var Watermarks, in bytes, on backend-internal pool memory
+         *      (batch pools, transfer rings, staging buffers), which
+         *      backends report against a per-agent budget. Past
+         *      memBudgetSoft the usage is flagged in telemetry and a
+         *      warning is logged; pool growth that would cross
+         *      memBudgetHard is refused, so backends cap their pools
+         *      instead of growing past the node's memory SLO. Current
+         *      usage is published as the "agent_pool_mem_used"
+         *      telemetry event. 0 (default) disables the respective
+         *      watermark.
+         */
+        size_t memBudgetSoft = 0;
+        size_t memBudgetHard = 0;
+
+        /**
+         * @var Bitmask of telemetry categories to record, one bit per
+         *      nixl_telemetry_category_t value (bit 1<<category). Lets
+         *      error and connection events stay always-on while noisy
+         *      transfer events are masked off, instead of all-or-nothing
+         *      telemetry. Intersected with the build-time mask (see the
+         *      telemetry_category_mask build option); only effective when
+         *      telemetry itself is enabled. All bits set (default) records
+         *      every compiled-in category.
+         */
+        uint32_t telemetryCategories = 0xFFFFFFFFu;
+
+        /**
+         * @var Number of agent-owned progress threads. When nonzero, the
+         *      agent runs this many poller threads that drive every
+         *      enrolled backend's progress() under progressSched, and
+         *      backends that support external progression are created
+         *      with their own progress threads disabled - one thread set
+         *      per agent instead of one per backend, pinned via
+         *      threadCpuSet. Backends that cannot be progressed
+         *      externally keep their internal mechanism.
+         *      0 (default) leaves progression fully to the backends.
+         */
+        unsigned int numProgressThreads = 0;
+
+        /**
+         * @var Schedule for the agent-owned progress threads (see
+         *      nixl_progress_sched_t). Round-robin by default.
+         */
+        nixl_progress_sched_t progressSched = nixl_progress_sched_t::NIXL_PROGRESS_SCHED_RR;
 
         /**
          * @brief  Agent configuration constructor for enabling various features.
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_TELEMETRY_READER_H
+#define _NIXL_TELEMETRY_READER_H
+
+#include <memory>
+#include <string>
+
+#include "telemetry_event.h"
+
+template<typename T> class sharedRingBuffer;
+
+/**
+ * @class nixlTelemetryReader
+ * @brief Consumer side of the agent's telemetry buffer, intended for
+ *        per-node sidecar processes. Attaches to the file an agent
+ *        writes when telemetry is enabled and tails events through the
+ *        shared header indices, so draining the buffer costs no
+ *        syscalls and adds nothing to the writer path.
+ *        The buffer supports a single consumer at a time.
+ */
+class nixlTelemetryReader {
+public:
+    /**
+     * @brief Attaches to an agent's telemetry file.
+     *
+     * @param file_path Path to the telemetry file, typically
+     *                  $NIXL_TELEMETRY_DIR/<agent_name>
+     *
+     * @throws std::runtime_error if the file cannot be mapped or was
+     *         written with an incompatible telemetry version
+     */
+    nixlTelemetryReader(const std::string &file_path);
+
+    ~nixlTelemetryReader();
+
+    /* The underlying mapping is not shareable */
+    nixlTelemetryReader(const nixlTelemetryReader &) = delete;
+    nixlTelemetryReader &
+    operator=(const nixlTelemetryReader &) = delete;
+
+    /**
+     * @brief Pops the oldest unread event from the buffer.
+     *
+     * @param event [out] Receives the event data
+     *
+     * @return true if an event was read, false if the buffer is empty
+     */
+    bool
+    pop(nixlTelemetryEvent &event);
+
+    /**
+     * @brief Returns the number of unread events in the buffer.
+     */
+    size_t
+    size() const;
+
+    /**
+     * @brief Returns the buffer capacity in events.
+     */
+    size_t
+    capacity() const;
+
+    /**
+     * @brief Returns the telemetry version the buffer was written with.
+     */
+    uint32_t
+    version() const;
+
+    /**
+     * @brief Returns the event name as a string; eventName_ is a fixed
+     *        size, NULL-padded char array.
+     */
+    static std::string
+    eventName(const nixlTelemetryEvent &event);
+
+private:
+    std::unique_ptr<sharedRingBuffer<nixlTelemetryEvent>> buffer_;
+};
+
+#endif // _NIXL_TELEMETRY_READER_H
@@ -16,10 +16,13 @@
  */
 #ifndef _NIXL_TYPES_H
 #define _NIXL_TYPES_H
+#include <array>
 #include <vector>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <optional>
+#include <functional>
 
 
 /*** Forward declarations ***/
@@ -27,6 +30,7 @@ class nixlSerDes;
 class nixlDlistH;
 class nixlBackendH;
 class nixlXferReqH;
+class nixlNotifsH;
 class nixlAgentData;
 
 
@@ -45,6 +49,80 @@ enum nixl_mem_t {DRAM_SEG, VRAM_SEG, BLK_SEG, OBJ_SEG, FILE_SEG};
  */
 enum nixl_xfer_op_t {NIXL_READ, NIXL_WRITE};
 
+/**
+ * @enum   nixl_xfer_priority_t
+ * @brief  An enumeration of transfer priority classes for NIXL.
+ *         Backends with QoS support keep high-priority transfers on a
+ *         separate lane so they don't queue behind bulk traffic.
+ */
+enum nixl_xfer_priority_t {NIXL_XFER_PRIO_NORMAL = 0, NIXL_XFER_PRIO_HIGH = 1};
+
+/**
+ * @enum   nixl_access_pattern_t
+ * @brief  An enumeration of expected access patterns for registered memory.
+ *         Purely advisory: backends that can act on it tune their mapping
+ *         or I/O strategy, others ignore it.
+ */
+enum nixl_access_pattern_t {
+    NIXL_ACCESS_DEFAULT = 0,
+    NIXL_ACCESS_SEQUENTIAL,
+    NIXL_ACCESS_RANDOM
+};
+
+/**
+ * @enum   nixl_backend_health_t
+ * @brief  Health of a backend as observed by agent telemetry: rolling
+ *         latency histograms of completed transfers plus a stall detector
+ *         that fires when requests are in flight but nothing completes
+ *         for longer than a threshold. Queryable per backend handle so a
+ *         scheduler can steer traffic away from a degraded path. UNKNOWN
+ *         is reported when telemetry is disabled or before the backend
+ *         has completed any transfer.
+ */
+enum nixl_backend_health_t {
+    NIXL_BACKEND_HEALTH_UNKNOWN = 0,
+    NIXL_BACKEND_HEALTHY,
+    NIXL_BACKEND_DEGRADED,
+    NIXL_BACKEND_STALLED
+};
+
+/**
+ * @enum   nixl_mem_lifetime_t
+ * @brief  An enumeration of expected lifetimes for registered memory.
+ *         Purely advisory: TRANSIENT marks one-pass data (e.g. checkpoint
+ *         files) whose pages need not be cached, PERSISTENT marks
+ *         long-lived hot regions worth pinned mappings.
+ */
+enum nixl_mem_lifetime_t {
+    NIXL_LIFETIME_DEFAULT = 0,
+    NIXL_LIFETIME_TRANSIENT,
+    NIXL_LIFETIME_PERSISTENT
+};
+
+/**
+ * @struct nixlRegHints
+ * @brief  Advisory registration hints passed through registerMem's
+ *         extra_params down to each backend's memory registration.
+ */
+struct nixlRegHints {
+    /** @var Expected access pattern of the region */
+    nixl_access_pattern_t pattern  = NIXL_ACCESS_DEFAULT;
+    /** @var Expected lifetime of the region */
+    nixl_mem_lifetime_t   lifetime = NIXL_LIFETIME_DEFAULT;
+    /** @var Reserve-commit registration: when larger than a descriptor's
+     *       len, the backend registration covers [addr, addr+reserveLen)
+     *       up front while only len bytes are usable; commitMem later
+     *       extends the usable length within the reserve without
+     *       re-registering. The full range must be backed VA the backend
+     *       can register (e.g. mapped, or unmapped under UCX ODP). */
+    size_t                reserveLen = 0;
+};
+
+/**
+ * @brief A typedef for nixlRegHints
+ */
+using nixl_reg_hints_t = nixlRegHints;
+
 /**
  * @enum   nixl_status_t
  * @brief  An enumeration of status values and error codes for NIXL
@@ -76,6 +154,21 @@ enum class nixl_thread_sync_t {
     NIXL_THREAD_SYNC_DEFAULT = NIXL_THREAD_SYNC_NONE,
 };
 
+/**
+ * @enum nixl_progress_sched_t
+ * @brief Schedule the agent's progress threads use across enrolled
+ *        backends (see nixlAgentConfig::numProgressThreads):
+ *        RR sweeps every backend each pass; PRIORITY progresses backends
+ *        in creation order every pass but later ones only on a widening
+ *        stride; WEIGHTED backs off backends whose progress() reported no
+ *        work, re-polling them on a widening stride until work reappears.
+ */
+enum class nixl_progress_sched_t {
+    NIXL_PROGRESS_SCHED_RR,
+    NIXL_PROGRESS_SCHED_PRIORITY,
+    NIXL_PROGRESS_SCHED_WEIGHTED,
+};
+
 /**
  * @namespace nixlEnumStrings
  * @brief     This namespace to get string representation
@@ -85,6 +178,7 @@ namespace nixlEnumStrings {
     std::string memTypeStr(const nixl_mem_t &mem);
     std::string xferOpStr (const nixl_xfer_op_t &op);
     std::string statusStr (const nixl_status_t &status);
+    std::string backendHealthStr(const nixl_backend_health_t &health);
 }
 
 
@@ -108,6 +202,37 @@ using nixl_blob_t = std::string;
  */
 using nixl_mem_list_t = std::vector<nixl_mem_t>;
 
+/**
+ * @struct nixlXferSlice
+ * @brief  Addresses a byte range inside one entry of a prepared descriptor
+ *         list handle: the entry at index contributes [offset, offset+len)
+ *         of its registered range. Used by the slice-based makeXferReq
+ *         overload, so a partial read within a registered block needs
+ *         neither a new descriptor list nor a re-registration.
+ */
+struct nixlXferSlice {
+    /** @var Index into the prepared descriptor list handle */
+    int index = 0;
+    /** @var Byte offset within the selected entry */
+    size_t offset = 0;
+    /** @var Byte length of the range; must fit within the entry */
+    size_t len = 0;
+};
+
+/**
+ * @brief A typedef for a nixlXferSlice
+ */
+using nixl_xfer_slice_t = nixlXferSlice;
+
+/**
+ * @brief A typedef for a 16-byte request trace context, carried through
+ *        transfer handles and notification payloads so one request can be
+ *        correlated across the initiator agent, the target agent and the
+ *        backends. All-zero (the default) means untraced; the application
+ *        picks the id (e.g. a UUID).
+ */
+using nixl_trace_id_t = std::array<uint8_t, 16>;
+
 /**
  * @brief A typedef for a  std::unordered_map<std::string, std::string>
  *        to hold nixl_b_params_t .
@@ -120,6 +245,24 @@ using nixl_b_params_t = std::unordered_map<std::string, std::string>;
  */
 using nixl_notifs_t = std::unordered_map<std::string, std::vector<nixl_blob_t>>;
 
+/**
+ * @struct nixlNotifView
+ * @brief  A non-owning view of one received notification, handed out by
+ *         getNotifsView. Views stay valid until the nixlNotifsH handle they
+ *         were drained with is released.
+ */
+struct nixlNotifView {
+    /** @var Name of the agent the notification was received from */
+    std::string_view remoteAgent;
+    /** @var The notification message payload */
+    std::string_view msg;
+};
+
+/**
+ * @brief A typedef for a std::vector<nixlNotifView> to hold notification views
+ */
+using nixl_notifs_view_t = std::vector<nixlNotifView>;
+
 /**
  * @brief A constant to define the default communication port.
  */
@@ -144,6 +287,7 @@ extern const std::string default_partial_metadata_label;
  */
 enum class nixl_cost_t {
     ANALYTICAL_BACKEND = 0, // Analytical backend cost estimate
+    MEASURED = 1, // Estimate calibrated online from completed transfer timings
 };
 
 /**
@@ -154,6 +298,58 @@ enum class nixl_cost_t {
 using nixl_query_resp_t = std::optional<nixl_b_params_t>;
 
 
+/**
+ * @struct nixlXferTimeline
+ * @brief  Per-stage monotonic timestamps of a transfer request in
+ *         microseconds, captured when the library is built with
+ *         -Dxfer_timeline=true and retrieved via getXferTimeline.
+ *         A value of 0 means the stage was not reached. Timestamps come
+ *         from the steady clock, so only differences are meaningful.
+ */
+struct nixlXferTimeline {
+    /** @var Entry into createXferReq */
+    uint64_t createdUs = 0;
+    /** @var Descriptor lists populated and backend selected */
+    uint64_t populatedUs = 0;
+    /** @var Backend prepXfer returned */
+    uint64_t preppedUs = 0;
+    /** @var Backend postXfer returned (updated on repost) */
+    uint64_t postedUs = 0;
+    /** @var Completion (or failure) first observed */
+    uint64_t completedUs = 0;
+};
+/**
+ * @brief A typedef for a nixlXferTimeline
+ */
+using nixl_xfer_timeline_t = nixlXferTimeline;
+
+/**
+ * @struct nixlAgentSnapshot
+ * @brief  Versioned, immutable snapshot of an agent's registration and
+ *         connection state for monitoring, retrieved via getAgentSnapshot.
+ *         The version bumps with every metadata mutation (registrations,
+ *         backend creation, remote metadata loads and invalidations), so
+ *         two snapshots with equal versions are identical.
+ */
+struct nixlAgentSnapshot {
+    /** @var Metadata epoch this snapshot was built at */
+    uint64_t version = 0;
+    /** @var Name of the agent the snapshot describes */
+    std::string agentName;
+    /** @var Types of the backends created on the agent */
+    std::vector<nixl_backend_t> backends;
+    /** @var Remote agents whose metadata is currently loaded */
+    std::vector<std::string> remoteAgents;
+    /** @var Registered descriptor count per memory type, indexed by nixl_mem_t */
+    std::array<size_t, FILE_SEG + 1> regDescCounts{};
+    /** @var Registered bytes per memory type, indexed by nixl_mem_t */
+    std::array<size_t, FILE_SEG + 1> regBytes{};
+};
+/**
+ * @brief A typedef for a nixlAgentSnapshot
+ */
+using nixl_agent_snapshot_t = nixlAgentSnapshot;
+
 /**
  * @struct nixlAgentOptionalArgs
  * @brief A structure for optional argument that can be provided to relevant agent methods.
@@ -183,6 +379,14 @@ struct nixlAgentOptionalArgs {
      */
     bool skipDescMerge = false;
 
+    /**
+     * @var mergeDescs boolean to coalesce physically contiguous descriptor pairs
+     *      (addr+len == next addr on both sides, same device and registration)
+     *      before backend preparation, used in createXferReq. Turns N backend
+     *      operations into one for adjacent blocks.
+     */
+    bool mergeDescs = false;
+
     /**
      * @var includeConnInfo boolean to include connection information in the metadata,
      *                      used in getLocalPartialMD.
@@ -212,6 +416,211 @@ struct nixlAgentOptionalArgs {
      */
     std::string metadataLabel;
 
+    /**
+     * @var regGroup Named registration group label. Used in registerMem to
+     *      tag the registered descriptors under the label, and in
+     *      getLocalPartialMD / sendLocalPartialMD (with an empty descriptor
+     *      list) to select every descriptor currently tagged with it, so a
+     *      group can be published to a new peer without the caller tracking
+     *      its addresses. Descriptors leave their groups on deregisterMem.
+     *      The serialized fragment of a group is cached until the group or
+     *      the backends change, making repeat publishes of an unchanged
+     *      group a blob copy instead of a re-serialization.
+     */
+    std::string regGroup;
+
+    /**
+     * @var deferTeardown boolean to defer backend memory teardown in deregisterMem.
+     *      The descriptors leave the agent's sections before the call returns, so
+     *      no new transfer can target them, but the backends release (unpin) the
+     *      memory on a background reclamation thread. Use fenceDeregisterMem to
+     *      wait until deferred teardowns have fully completed.
+     */
+    bool deferTeardown = false;
+
+    /**
+     * @var backgroundPolling boolean to hand the posted transfer to the agent's
+     *      completion poller thread. The poller advances the backend and
+     *      publishes the request state into a status word, so getXferStatus
+     *      returns without entering the backend. Useful when requests on a
+     *      slow backend would otherwise delay status visibility of others.
+     *      Used in postXferReq, postXferReqBatch.
+     */
+    bool backgroundPolling = false;
+
+    /**
+     * @var completionCb Completion callback, used in createXferReq. Each
+     *      post that leaves the request in flight hands it to the agent's
+     *      completion poller (as with backgroundPolling), which invokes the
+     *      callback once with the terminal status from its progress
+     *      context, collapsing the wakeup/poll/dispatch chain into one
+     *      call. The callback must not block; it may re-enter the agent
+     *      (e.g. to release or repost the handle). Posts that complete
+     *      inline return the terminal status to the caller instead and do
+     *      not invoke it. Not supported for compound or broadcast
+     *      requests, which are driven from getXferStatus.
+     */
+    std::function<void(nixl_status_t)> completionCb;
+
+    /**
+     * @var chainAfter Predecessor request handle, used in postXferReq.
+     *      The post is deferred until the predecessor completes: its
+     *      completion is observed by the agent's completion poller, which
+     *      posts this request from its progress context the instant the
+     *      predecessor succeeds, removing the application wakeup between
+     *      pipeline stages (e.g. VRAM->DRAM chained into DRAM->NVMe). If
+     *      the predecessor fails, the chained request takes its error
+     *      status instead of being posted. The predecessor handle must
+     *      stay valid until it completes. Not supported when the
+     *      predecessor is a compound or broadcast request, which are
+     *      driven from getXferStatus.
+     */
+    nixlXferReqH* chainAfter = nullptr;
+
+    /**
+     * @var tempReg One-shot transfer mode, used in createXferReq: the local
+     *      descriptors are registered internally for the lifetime of this
+     *      request and deregistered through the reclamation thread when the
+     *      handle is released, so single-use buffers (e.g. sampling
+     *      outputs) skip the explicit registerMem/deregisterMem round
+     *      trip. Ranges inside an already registered block share its
+     *      backend registration instead of re-pinning, so the flag is
+     *      cheap even when the buffer turns out to be covered. Buffers
+     *      transferred repeatedly should still be registered explicitly.
+     */
+    bool tempReg = false;
+
+    /**
+     * @var lazyReg Lazy multi-backend registration, used in registerMem:
+     *      the buffer is pinned with the preferred (first) backend only,
+     *      and the remaining backends are recorded as intents that
+     *      materialize on the first transfer they must serve. Buffers
+     *      that only ever move via one backend never pay the other
+     *      backends' registration cost (e.g. no GDS pinning for buffers
+     *      that only cross the network). Deregistration drops
+     *      unmaterialized intents for free.
+     */
+    bool lazyReg = false;
+
+    /**
+     * @var cudaStream CUDA stream (a cudaStream_t) on which backends capable
+     *      of stream-ordered I/O (e.g., GDS cuFile async) submit the transfer,
+     *      used in postXferReq / postXferReqBatch. The I/O is ordered with the
+     *      stream's other work and its completion can be observed with CUDA
+     *      events instead of CPU polling; getXferStatus stays usable and
+     *      queries the stream. Backends without stream support ignore it.
+     */
+    void* cudaStream = nullptr;
+
+    /**
+     * @var hugePageSize Huge page size in bytes for allocMem: (1<<21) or
+     *      (1<<30) select explicit 2M or 1G hugetlb backing and round the
+     *      allocation length up to that granularity; 0 requests transparent
+     *      huge pages. The allocation is pre-faulted in both cases.
+     */
+    size_t hugePageSize = 0;
+
+    /**
+     * @var numaNode NUMA node to bind the allocation to in allocMem;
+     *      -1 keeps the kernel's default (local first-touch) policy.
+     */
+    int numaNode = -1;
+
+    /**
+     * @var hasSignal boolean to request a device-visible completion signal,
+     *      used in createXferReq. Once the transfer data has landed, the
+     *      backend writes signalValue as a single 8-byte word to signalAddr
+     *      (device signalDevId) in the remote agent's registered memory, so
+     *      a kernel spinning on that flag observes completion without the
+     *      CPU seeing getXferStatus first. The flag must fall within memory
+     *      the remote agent registered with the selected backend, with the
+     *      same memory type as the target descriptor list.
+     */
+    bool hasSignal = false;
+
+    /**
+     * @var signalAddr Address of the 8-byte completion flag in the remote
+     *      agent's registered memory, used with hasSignal.
+     */
+    uint64_t signalAddr = 0;
+
+    /**
+     * @var signalDevId Device ID of the completion flag, used with hasSignal.
+     */
+    uint64_t signalDevId = 0;
+
+    /**
+     * @var signalValue Value written to the completion flag, used with hasSignal.
+     */
+    uint64_t signalValue = 0;
+
+    /**
+     * @var priority Transfer priority class, used in createXferReq /
+     *      makeXferReq and carried for the request's lifetime. Backends
+     *      with QoS support (currently UCX with priority_workers set) post
+     *      high-priority transfers on a reserved worker/endpoint lane so
+     *      latency-critical transfers don't queue behind bulk traffic on
+     *      the shared endpoints; other backends ignore it.
+     */
+    nixl_xfer_priority_t priority = NIXL_XFER_PRIO_NORMAL;
+
+    /**
+     * @var deadlineUs Optional absolute completion deadline, used in
+     *      postXferReq / postXferReqBatch: microseconds since the
+     *      std::chrono::steady_clock epoch, 0 meaning no deadline.
+     *      postXferReqBatch submits a mixed batch earliest-deadline-first
+     *      with deadline-less requests after, so under congestion the
+     *      transfers that can still make their deadline go down to the
+     *      backend first. Completions past their deadline are counted in
+     *      telemetry ("agent_deadline_misses"); the transfer itself is
+     *      never aborted.
+     */
+    uint64_t deadlineUs = 0;
+
+    /**
+     * @var regHints Advisory access-pattern and lifetime hints for the
+     *      registered region, used in registerMem and forwarded to every
+     *      backend the registration lands on (e.g. POSIX issues the
+     *      matching posix_fadvise for file segments). Backends without a
+     *      use for them ignore them.
+     */
+    nixl_reg_hints_t regHints;
+
+    /**
+     * @var enableFailover boolean to arm automatic backend failover, used
+     *      in createXferReq. The request records the backend candidates it
+     *      was not bound to, in selection order; when a post fails, the
+     *      agent re-resolves the descriptor lists against the next
+     *      candidate and reposts there, and the failing backend is demoted
+     *      to the back of the candidate order for subsequent requests
+     *      toward that peer. Not supported for requests carrying a
+     *      completion signal, whose resolved flag is backend-specific.
+     */
+    bool enableFailover = false;
+
+    /**
+     * @var failoverTimeoutUs Stall timeout in microseconds, used in
+     *      createXferReq together with enableFailover (a nonzero value
+     *      implies it). When a status check finds the request still in
+     *      flight past the timeout and the backend can cancel it, the
+     *      agent fails the transfer over as on a post error; backends that
+     *      cannot cancel disarm the timer and the transfer keeps running.
+     *      0 disables stall detection, post-error failover is unaffected.
+     */
+    uint64_t failoverTimeoutUs = 0;
+
+    /**
+     * @var traceId Request trace context, used in createXferReq /
+     *      makeXferReq and genNotif. When nonzero and the agent runs with
+     *      NIXL_TRACE_DIR set, the request's lifecycle is recorded into
+     *      the agent's binary trace buffer under this id, and the id rides
+     *      in the notification payload so the target agent's buffer
+     *      carries the same id - one request becomes one merged timeline
+     *      across agents (see the trace_reader tool). All-zero (default)
+     *      leaves the request untraced.
+     */
+    nixl_trace_id_t traceId{};
+
     /**
      * @var Backend custom parameter
      */
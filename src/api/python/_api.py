@@ -13,6 +13,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import asyncio
 import pickle
 from typing import Optional, Union
 
@@ -476,6 +477,47 @@ class nixl_agent:
 
         return handle
 
+    """
+    @brief  Initialize a batch of transfer operations towards one remote agent in a
+            single binding crossing. The descriptor lists are built in C++ (e.g. from
+            Nx3 numpy arrays of (addr, len, devId) via get_xfer_descs) and the requests
+            are created with the GIL released, so per-request interpreter overhead is
+            paid once per batch instead of once per transfer.
+
+    @param operation Type of operation ("WRITE" or "READ"), shared by the batch.
+    @param local_descs_batch List of local transfer descriptor lists, one per transfer.
+    @param remote_descs_batch List of remote transfer descriptor lists, one per transfer.
+    @param remote_agent Name of the remote agent.
+    @param notif_msg Optional notification message, applied to every transfer.
+    @param backends Optional list of backend names to limit which backends NIXL can use.
+    @return List of opaque handles for posting/checking the transfers.
+    """
+
+    def initialize_xfer_batch(
+        self,
+        operation: str,
+        local_descs_batch: list[nixlBind.nixlXferDList],
+        remote_descs_batch: list[nixlBind.nixlXferDList],
+        remote_agent: str,
+        notif_msg: bytes = b"",
+        backends: list[str] = [],
+    ) -> list[nixl_xfer_handle]:
+        op = self.nixl_ops[operation]
+        handle_list = []
+        for backend_string in backends:
+            handle_list.append(self.backends[backend_string])
+
+        handles = self.agent.createXferReqBatch(
+            op,
+            local_descs_batch,
+            remote_descs_batch,
+            remote_agent,
+            notif_msg,
+            handle_list,
+        )
+
+        return handles
+
     """
     @brief  Initiate a data transfer operation.
             After calling this, the transfer state can be checked asynchronously till completion.
@@ -497,6 +539,29 @@ class nixl_agent:
         else:
             return "ERR"
 
+    """
+    @brief  Initiate a batch of transfer operations in one binding crossing, with the
+            GIL released while the requests are posted. Best effort: the whole batch is
+            posted and the first error, if any, is reported.
+
+    @param handles List of transfer handles, from make_prepped_xfer, initialize_xfer or
+           initialize_xfer_batch.
+    @param notif_msg Optional notification message, applied to every transfer.
+    @return Status of the batch ("DONE" if all completed inline, "PROC" if any is still
+            in progress, or "ERR").
+    """
+
+    def transfer_batch(
+        self, handles: list[nixl_xfer_handle], notif_msg: bytes = b""
+    ) -> str:
+        status = self.agent.postXferReqBatch(handles, notif_msg)
+        if status == nixlBind.NIXL_SUCCESS:
+            return "DONE"
+        elif status == nixlBind.NIXL_IN_PROG:
+            return "PROC"
+        else:
+            return "ERR"
+
     """
     @brief Check the state of a transfer operation.
 
@@ -513,6 +578,32 @@ class nixl_agent:
         else:
             return "ERR"
 
+    """
+    @brief  Await a transfer without polling. The completion callback fires on
+            the agent's poller thread and wakes the running event loop through
+            call_soon_threadsafe, so thousands of in-flight transfers can be
+            awaited concurrently with no check_xfer_state busy loop. Must be
+            called from a running event loop, after transfer().
+
+    @param handle Handle to the transfer operation, from make_prepped_xfer, or initialize_xfer.
+    @return Status of the transfer operation ("DONE" or "ERR").
+    """
+
+    async def wait_xfer_state(self, handle: nixl_xfer_handle) -> str:
+        loop = asyncio.get_running_loop()
+        future: asyncio.Future = loop.create_future()
+
+        def _completed(status):
+            # Runs on the poller thread; the future must be touched on the loop
+            loop.call_soon_threadsafe(
+                lambda: future.cancelled() or future.set_result(status)
+            )
+
+        status = self.agent.onXferCompletion(handle, _completed)
+        if status == nixlBind.NIXL_IN_PROG:
+            status = await future
+        return "DONE" if status == nixlBind.NIXL_SUCCESS else "ERR"
+
     """
     @brief Query the backend that was chosen for a transfer operation.
 
@@ -563,6 +654,25 @@ class nixl_agent:
             handle_list.append(self.backends[backend_string])
         return self.agent.getNotifs({}, handle_list)
 
+    """
+    @brief Get new notifications without allocating a bytes object per message.
+           The returned batch owns the notification payloads; getView(i) exposes each
+           payload as a memoryview into that storage and getAgent(i) names its sender.
+           copyInto(buf) packs all payloads back-to-back into a preallocated bytearray
+           and returns a list of (agent, offset, length) tuples. Views become invalid
+           once release() is called (or the batch is garbage collected), so copy out
+           anything that must outlive the batch.
+
+    @param backends Optional list of backend names to limit which backends are checked for notifications.
+    @return Batch object over the new notifications.
+    """
+
+    def get_new_notifs_batch(self, backends: list[str] = []):
+        handle_list = []
+        for backend_string in backends:
+            handle_list.append(self.backends[backend_string])
+        return self.agent.getNotifsBatch(handle_list)
+
     """
     @brief Update notifications in a map
             Same as get_new_notifs, but returns all unhandled notifications in agent.
@@ -781,7 +891,8 @@ class nixl_agent:
     @brief Get nixlXferDList from different input types:
             a) list of 3 element tuples (address, len, device ID) alongside a mandatory memory type
             b) a tensor
-            c) a list of tensors
+            c) a list of tensors, or of any objects supporting DLPack or the
+               __cuda_array_interface__ protocol (resolved in C++ in one pass)
             d) a Nx3 2D numpy array, each row defines a single descriptor (address, len, device ID),
                alongside a mandatory memory type
             e) passes along if an xfer_dlist is given.
@@ -799,8 +910,6 @@ class nixl_agent:
         mem_type: Optional[str] = None,
         is_sorted: bool = False,
     ) -> nixlBind.nixlXferDList:
-        # can add check for DLPack input
-
         if isinstance(descs, nixlBind.nixlXferDList):
             return descs
         elif isinstance(descs, nixlBind.nixlRegDList):
@@ -846,26 +955,18 @@ class nixl_agent:
             else:
                 logger.error("Please use a list of contiguous Tensors")
                 new_descs = None
-        elif isinstance(descs[0], torch.Tensor):  # List[torch.Tensor]:
-            tensor_type = descs[0].device
-            dlist = np.zeros((len(descs), 3), dtype=np.uint64)
-
-            for i in range(len(descs)):
-                if descs[i].device != tensor_type:
-                    return None
-                if not descs[i].is_contiguous():
-                    logger.error("Please use a list of contiguous Tensors")
-                    return None
-                base_addr = descs[i].data_ptr()
-                region_len = descs[i].numel() * descs[i].element_size()
-                gpu_id = descs[i].get_device()
-                if gpu_id == -1:  # DRAM
-                    gpu_id = 0
-                dlist[i, :] = (base_addr, region_len, gpu_id)
-            mem_type = "cuda" if str(tensor_type).startswith("cuda") else "cpu"
-            new_descs = nixlBind.nixlXferDList(
-                self.nixl_mems[mem_type], dlist, is_sorted
-            )
+        elif (
+            isinstance(descs[0], torch.Tensor)
+            or hasattr(descs[0], "__dlpack__")
+            or hasattr(descs[0], "__cuda_array_interface__")
+        ):
+            # Pointers, lengths and device ids are resolved in C++ in one
+            # pass over the DLPack / __cuda_array_interface__ metadata
+            try:
+                new_descs = nixlBind.nixlXferDList(descs, is_sorted)
+            except ValueError as e:
+                logger.error(e)
+                new_descs = None
         else:
             new_descs = None
 
@@ -875,7 +976,8 @@ class nixl_agent:
     @brief Get nixlRegDList from different input types:
             a) list of 4 element tuples (address, len, device ID, meta info) alongside a mandatory memory type
             b) a tensor
-            c) a list of tensors
+            c) a list of tensors, or of any objects supporting DLPack or the
+               __cuda_array_interface__ protocol (resolved in C++ in one pass)
             d) a Nx3 2D numpy array, each row defines a single descriptor (address, len, device ID),
                alongside a mandatory memory type. Empty meta info will be considered for each descriptor.
             e) passes along if a reg_dlist is given.
@@ -893,8 +995,6 @@ class nixl_agent:
         mem_type: Optional[str] = None,
         is_sorted: bool = False,
     ) -> nixlBind.nixlRegDList:
-        # can add check for DLPack input
-
         if isinstance(descs, nixlBind.nixlRegDList):
             return descs
         elif isinstance(descs, nixlBind.nixlXferDList):
@@ -940,26 +1040,18 @@ class nixl_agent:
             else:
                 logger.error("Please use a list of contiguous Tensors")
                 new_descs = None
-        elif isinstance(descs[0], torch.Tensor):  # List[torch.Tensor]:
-            tensor_type = descs[0].device
-            dlist = np.zeros((len(descs), 3), dtype=np.uint64)
-
-            for i in range(len(descs)):
-                if descs[i].device != tensor_type:
-                    return None
-                if not descs[i].is_contiguous():
-                    logger.error("Please use a list of contiguous Tensors")
-                    return None
-                base_addr = descs[i].data_ptr()
-                region_len = descs[i].numel() * descs[i].element_size()
-                gpu_id = descs[i].get_device()
-                if gpu_id == -1:  # DRAM
-                    gpu_id = 0
-                dlist[i, :] = (base_addr, region_len, gpu_id)
-            mem_type = "cuda" if str(tensor_type).startswith("cuda") else "cpu"
-            new_descs = nixlBind.nixlRegDList(
-                self.nixl_mems[mem_type], dlist, is_sorted
-            )
+        elif (
+            isinstance(descs[0], torch.Tensor)
+            or hasattr(descs[0], "__dlpack__")
+            or hasattr(descs[0], "__cuda_array_interface__")
+        ):
+            # Pointers, lengths and device ids are resolved in C++ in one
+            # pass over the DLPack / __cuda_array_interface__ metadata
+            try:
+                new_descs = nixlBind.nixlRegDList(descs, is_sorted)
+            except ValueError as e:
+                logger.error(e)
+                new_descs = None
         else:
             new_descs = None
 
@@ -0,0 +1,201 @@
+# SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: Apache-2.0
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Reader for the NIXL agent telemetry buffer.
+
+An agent started with NIXL_TELEMETRY_ENABLE writes events into a
+memory-mapped ring buffer at $NIXL_TELEMETRY_DIR/<agent_name>. This
+module attaches to that file and tails it through the shared header
+indices, so draining events costs no syscalls and adds nothing to the
+writer path. The buffer supports a single consumer at a time.
+
+Example:
+    from nixl.telemetry import TelemetryReader
+
+    reader = TelemetryReader("/tmp/my_agent")
+    for event in reader.drain():
+        print(event.timestamp_us, event.category.name, event.name, event.value)
+"""
+
+import ctypes
+import mmap
+import os
+from dataclasses import dataclass
+from enum import IntEnum
+
+# Mirrors TELEMETRY_VERSION / MAX_EVENT_NAME_LEN in telemetry_event.h
+TELEMETRY_VERSION = 1
+MAX_EVENT_NAME_LEN = 32
+
+
+class TelemetryCategory(IntEnum):
+    """Mirrors nixl_telemetry_category_t in telemetry_event.h"""
+
+    MEMORY = 0
+    TRANSFER = 1
+    CONNECTION = 2
+    BACKEND = 3
+    ERROR = 4
+    PERFORMANCE = 5
+    SYSTEM = 6
+    CUSTOM = 7
+
+
+@dataclass(frozen=True)
+class TelemetryEvent:
+    """One decoded telemetry event."""
+
+    timestamp_us: int
+    category: TelemetryCategory
+    name: str
+    value: int
+
+
+class _RawEvent(ctypes.Structure):
+    """Memory layout of nixlTelemetryEvent"""
+
+    _pack_ = 1
+    _fields_ = [
+        ("timestamp_us", ctypes.c_uint64),
+        ("category", ctypes.c_int),
+        ("event_name", ctypes.c_char * MAX_EVENT_NAME_LEN),
+        ("_padding", ctypes.c_uint32),
+        ("value", ctypes.c_uint64),
+    ]
+
+
+class _BufferHeader(ctypes.Structure):
+    """Memory layout of sharedRingBuffer's bufferHeader"""
+
+    _pack_ = 1
+    _fields_ = [
+        ("write_pos", ctypes.c_size_t),
+        ("read_pos", ctypes.c_size_t),
+        ("version", ctypes.c_uint32),
+        ("expected_version", ctypes.c_uint32),
+        ("capacity", ctypes.c_size_t),
+        ("mask", ctypes.c_size_t),
+    ]
+
+
+class TelemetryReader:
+    """Attaches to an agent's telemetry file and pops events from it."""
+
+    def __init__(self, file_path, version=TELEMETRY_VERSION):
+        self._fd = os.open(file_path, os.O_RDWR)
+        try:
+            header_map = mmap.mmap(
+                self._fd,
+                ctypes.sizeof(_BufferHeader),
+                mmap.MAP_SHARED,
+                mmap.PROT_READ | mmap.PROT_WRITE,
+            )
+            try:
+                header = _BufferHeader.from_buffer(header_map)
+                file_version = header.version
+                capacity = header.capacity
+                del header
+            finally:
+                header_map.close()
+
+            if file_version != version:
+                raise RuntimeError(
+                    f"Version mismatch: expected {version}, got {file_version}"
+                )
+
+            self._capacity = capacity
+            total_size = (
+                ctypes.sizeof(_BufferHeader) + ctypes.sizeof(_RawEvent) * capacity
+            )
+            self._mmap = mmap.mmap(
+                self._fd,
+                total_size,
+                mmap.MAP_SHARED,
+                mmap.PROT_READ | mmap.PROT_WRITE,
+            )
+            self._header = _BufferHeader.from_buffer(self._mmap)
+            self._data = (_RawEvent * capacity).from_buffer(
+                self._mmap, ctypes.sizeof(_BufferHeader)
+            )
+        except BaseException:
+            os.close(self._fd)
+            self._fd = None
+            raise
+
+    @property
+    def version(self):
+        """Telemetry version the buffer was written with"""
+        return self._header.version
+
+    @property
+    def capacity(self):
+        """Buffer capacity in events"""
+        return self._capacity
+
+    def size(self):
+        """Number of unread events in the buffer"""
+        return (self._header.write_pos - self._header.read_pos) & self._header.mask
+
+    def empty(self):
+        """Whether the buffer has no unread events"""
+        return self._header.read_pos == self._header.write_pos
+
+    def pop(self):
+        """Pop the oldest unread event, or None if the buffer is empty"""
+        read_pos = self._header.read_pos
+        if read_pos == self._header.write_pos:
+            return None
+
+        raw = self._data[read_pos]
+        event = TelemetryEvent(
+            timestamp_us=raw.timestamp_us,
+            category=TelemetryCategory(raw.category),
+            name=raw.event_name.split(b"\x00", 1)[0].decode("utf-8", "replace"),
+            value=raw.value,
+        )
+
+        self._header.read_pos = (read_pos + 1) & self._header.mask
+        return event
+
+    def drain(self):
+        """Yield all currently unread events without blocking"""
+        while True:
+            event = self.pop()
+            if event is None:
+                return
+            yield event
+
+    def close(self):
+        """Release the mapping and file descriptor"""
+        if getattr(self, "_header", None) is not None:
+            del self._data
+            del self._header
+            self._mmap.close()
+            self._header = None
+        if getattr(self, "_fd", None) is not None:
+            os.close(self._fd)
+            self._fd = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.close()
+
+    def __del__(self):
+        try:
+            self.close()
+        except Exception:
+            pass
@@ -21,6 +21,7 @@
 
 #include <tuple>
 #include <iostream>
+#include <cstring>
 
 #include "nixl.h"
 #include "serdes/serdes.h"
@@ -113,6 +114,198 @@ throw_nixl_exception(const nixl_status_t &status) {
     }
 }
 
+// Zero-copy notification batch: owns the payload strings moved out of
+// getNotifs and hands them to Python as memoryviews into that storage,
+// so a notification-heavy event loop doesn't allocate a bytes object
+// per message. The views alias the batch's memory: release() (or
+// dropping the batch) invalidates them, and anything needed past that
+// point must be copied out first -- copyInto() does so in one pass into
+// a caller-preallocated buffer
+class nixlNotifBatch {
+public:
+    // Flattened (agent, payload) pairs, per-agent arrival order preserved
+    std::vector<std::pair<std::string, std::string>> entries;
+    bool released = false;
+
+    void
+    checkAccess(size_t index) const {
+        if (released)
+            throw nixlInvalidParamError("notification batch already released");
+        if (index >= entries.size())
+            throw std::out_of_range("notification index out of range");
+    }
+
+    size_t
+    totalBytes() const {
+        size_t total = 0;
+        for (const auto &entry : entries)
+            total += entry.second.size();
+        return total;
+    }
+};
+
+namespace {
+
+// Minimal subset of the DLPack C ABI (stable since v0.2), declared locally so
+// the bindings can consume capsules without vendoring the dlpack headers
+extern "C" {
+typedef struct {
+    int32_t device_type;
+    int32_t device_id;
+} nixlDLDevice;
+
+typedef struct {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+} nixlDLDataType;
+
+typedef struct {
+    void *data;
+    nixlDLDevice device;
+    int32_t ndim;
+    nixlDLDataType dtype;
+    int64_t *shape;
+    int64_t *strides;
+    uint64_t byte_offset;
+} nixlDLTensor;
+
+typedef struct nixlDLManagedTensor {
+    nixlDLTensor dl_tensor;
+    void *manager_ctx;
+    void (*deleter)(struct nixlDLManagedTensor *);
+} nixlDLManagedTensor;
+}
+
+constexpr int32_t kDLCPU = 1;
+constexpr int32_t kDLCUDA = 2;
+constexpr int32_t kDLCUDAHost = 3;
+constexpr int32_t kDLCUDAManaged = 13;
+
+// A contiguous memory region resolved from a tensor-like python object
+struct nixlPyMemRegion {
+    uintptr_t addr;
+    size_t len;
+    uint64_t devId;
+    nixl_mem_t memType;
+};
+
+// Total byte length of a dense row-major tensor; strides (given in elements)
+// may be null for implicitly contiguous tensors
+size_t
+dense_tensor_bytes(int32_t ndim, const int64_t *shape, const int64_t *strides, size_t elem_bytes) {
+    size_t numel = 1;
+    for (int32_t i = 0; i < ndim; i++)
+        numel *= (size_t)shape[i];
+    if (strides) {
+        int64_t expected = 1;
+        for (int32_t i = ndim - 1; i >= 0; i--) {
+            if (shape[i] != 1 && strides[i] != expected)
+                throw std::invalid_argument(
+                    "only contiguous tensors can be converted to descriptors");
+            expected *= shape[i];
+        }
+    }
+    return numel * elem_bytes;
+}
+
+nixlPyMemRegion
+region_from_dlpack(const py::object &obj) {
+    py::capsule cap = obj.attr("__dlpack__")();
+    if (std::strcmp(cap.name(), "dltensor") != 0)
+        throw std::invalid_argument("__dlpack__ did not return a dltensor capsule");
+    auto *managed = static_cast<nixlDLManagedTensor *>(cap.get_pointer());
+    const nixlDLTensor &t = managed->dl_tensor;
+
+    nixlPyMemRegion region;
+    region.addr = (uintptr_t)t.data + t.byte_offset;
+    region.len = dense_tensor_bytes(
+        t.ndim, t.shape, t.strides, ((size_t)t.dtype.bits * t.dtype.lanes + 7) / 8);
+    switch (t.device.device_type) {
+    case kDLCUDA:
+    case kDLCUDAManaged:
+        region.devId = t.device.device_id;
+        region.memType = VRAM_SEG;
+        break;
+    case kDLCPU:
+    case kDLCUDAHost:
+        region.devId = 0;
+        region.memType = DRAM_SEG;
+        break;
+    default:
+        throw std::invalid_argument("unsupported DLPack device type");
+    }
+
+    // Per the DLPack protocol the consumer renames the capsule and invokes
+    // the deleter once done with the tensor view
+    PyCapsule_SetName(cap.ptr(), "used_dltensor");
+    if (managed->deleter) managed->deleter(managed);
+
+    return region;
+}
+
+nixlPyMemRegion
+region_from_cuda_array_interface(const py::object &obj) {
+    py::dict iface = obj.attr("__cuda_array_interface__").cast<py::dict>();
+
+    nixlPyMemRegion region;
+    region.addr = iface["data"].cast<py::tuple>()[0].cast<uintptr_t>();
+
+    auto shape = iface["shape"].cast<std::vector<int64_t>>();
+    // typestr is e.g. "<f4"; the trailing digits are the item size in bytes
+    size_t elem_bytes = std::stoul(iface["typestr"].cast<std::string>().substr(2));
+    std::vector<int64_t> strides;
+    if (iface.contains("strides") && !iface["strides"].is_none()) {
+        // The interface reports strides in bytes, dense_tensor_bytes expects
+        // elements
+        for (int64_t s : iface["strides"].cast<std::vector<int64_t>>())
+            strides.push_back(s / (int64_t)elem_bytes);
+    }
+    region.len = dense_tensor_bytes((int32_t)shape.size(),
+                                    shape.data(),
+                                    strides.empty() ? nullptr : strides.data(),
+                                    elem_bytes);
+
+    // The interface does not carry the device id; probe the attributes common
+    // producers (torch, cupy) expose alongside it
+    region.devId = 0;
+    if (py::hasattr(obj, "device")) {
+        py::object device = obj.attr("device");
+        if (py::hasattr(device, "index") && !device.attr("index").is_none())
+            region.devId = device.attr("index").cast<uint64_t>();
+        else if (py::hasattr(device, "id"))
+            region.devId = device.attr("id").cast<uint64_t>();
+    }
+    region.memType = VRAM_SEG;
+
+    return region;
+}
+
+nixlPyMemRegion
+region_from_tensor(const py::object &obj) {
+    if (py::hasattr(obj, "__cuda_array_interface__"))
+        return region_from_cuda_array_interface(obj);
+    if (py::hasattr(obj, "__dlpack__")) return region_from_dlpack(obj);
+    throw std::invalid_argument(
+        "tensor does not support __dlpack__ or __cuda_array_interface__");
+}
+
+std::vector<nixlPyMemRegion>
+regions_from_tensor_list(const py::list &tensors) {
+    if (tensors.size() == 0)
+        throw std::invalid_argument("tensor list must not be empty");
+    std::vector<nixlPyMemRegion> regions;
+    regions.reserve(tensors.size());
+    for (size_t i = 0; i < tensors.size(); i++) {
+        regions.push_back(region_from_tensor(tensors[i]));
+        if (regions[i].memType != regions[0].memType)
+            throw std::invalid_argument("tensors must all be in the same memory type");
+    }
+    return regions;
+}
+
+} // namespace
+
 PYBIND11_MODULE(_bindings, m) {
 
     // TODO: each nixl class and/or function can be documented in place
@@ -226,6 +419,22 @@ PYBIND11_MODULE(_bindings, m) {
              py::arg("type"),
              py::arg("descs").noconvert(),
              py::arg("sorted") = false)
+        .def(py::init([](py::list tensors, bool sorted) {
+                 // One-pass ingestion of DLPack / __cuda_array_interface__
+                 // capable objects (torch tensors, cupy arrays, ...), avoiding
+                 // a per-tensor python round trip through data_ptr()
+                 auto regions = regions_from_tensor_list(tensors);
+                 nixl_xfer_dlist_t new_list(regions[0].memType, sorted, regions.size());
+                 for (size_t i = 0; i < regions.size(); i++)
+                     new_list[i] =
+                         nixlBasicDesc(regions[i].addr, regions[i].len, regions[i].devId);
+
+                 new_list.verifySorted();
+
+                 return new_list;
+             }),
+             py::arg("tensors").noconvert(),
+             py::arg("sorted") = false)
         .def("getType", &nixl_xfer_dlist_t::getType)
         .def("descCount", &nixl_xfer_dlist_t::descCount)
         .def("isEmpty", &nixl_xfer_dlist_t::isEmpty)
@@ -331,6 +540,19 @@ PYBIND11_MODULE(_bindings, m) {
              py::arg("type"),
              py::arg("descs"),
              py::arg("sorted") = false)
+        .def(py::init([](py::list tensors, bool sorted) {
+                 auto regions = regions_from_tensor_list(tensors);
+                 nixl_reg_dlist_t new_list(regions[0].memType, sorted, regions.size());
+                 for (size_t i = 0; i < regions.size(); i++)
+                     new_list[i] =
+                         nixlBlobDesc(regions[i].addr, regions[i].len, regions[i].devId, "");
+
+                 new_list.verifySorted();
+
+                 return new_list;
+             }),
+             py::arg("tensors").noconvert(),
+             py::arg("sorted") = false)
         .def("getType", &nixl_reg_dlist_t::getType)
         .def("descCount", &nixl_reg_dlist_t::descCount)
         .def("isEmpty", &nixl_reg_dlist_t::isEmpty)
@@ -396,6 +618,54 @@ PYBIND11_MODULE(_bindings, m) {
         .def(py::init<bool, bool, int>())
         .def(py::init<bool, bool, int, nixl_thread_sync_t>());
 
+    py::class_<nixlNotifBatch>(m, "nixlNotifBatch")
+        .def("__len__", [](const nixlNotifBatch &batch) { return batch.entries.size(); })
+        .def("totalBytes", [](const nixlNotifBatch &batch) { return batch.totalBytes(); })
+        .def("getAgent",
+             [](const nixlNotifBatch &batch, size_t index) -> py::str {
+                 batch.checkAccess(index);
+                 return batch.entries[index].first;
+             })
+        .def(
+            "getView",
+            [](const nixlNotifBatch &batch, size_t index) -> py::memoryview {
+                batch.checkAccess(index);
+                const std::string &payload = batch.entries[index].second;
+                // Read-only view straight into the batch's storage; no
+                // per-notification bytes allocation
+                return py::memoryview::from_memory(payload.data(),
+                                                   (py::ssize_t)payload.size());
+            })
+        .def("copyInto",
+             [](const nixlNotifBatch &batch, py::buffer buffer) -> py::list {
+                 if (batch.released)
+                     throw nixlInvalidParamError("notification batch already released");
+
+                 py::buffer_info info = buffer.request(true);
+                 const size_t capacity = (size_t)info.size * (size_t)info.itemsize;
+                 if (batch.totalBytes() > capacity)
+                     throw nixlInvalidParamError(
+                         "buffer too small for notification batch, see totalBytes()");
+
+                 // One pass into the caller's preallocated storage; the
+                 // batch keeps its payloads, so an undersized buffer can
+                 // be regrown and the copy retried without losing notifs
+                 char *out = static_cast<char *>(info.ptr);
+                 size_t offset = 0;
+                 py::list layout;
+                 for (const auto &entry : batch.entries) {
+                     memcpy(out + offset, entry.second.data(), entry.second.size());
+                     layout.append(py::make_tuple(entry.first, offset, entry.second.size()));
+                     offset += entry.second.size();
+                 }
+                 return layout;
+             })
+        .def("release", [](nixlNotifBatch &batch) {
+            batch.entries.clear();
+            batch.entries.shrink_to_fit();
+            batch.released = true;
+        });
+
     // note: pybind will automatically convert notif_map to python types:
     // so, a Dictionary of string: List<string>
 
@@ -617,6 +887,61 @@ PYBIND11_MODULE(_bindings, m) {
             py::arg("remote_agent"),
             py::arg("notif_msg") = std::string(""),
             py::arg("backend") = std::vector<uintptr_t>({}))
+        .def(
+            "createXferReqBatch",
+            [](nixlAgent &agent,
+               const nixl_xfer_op_t &operation,
+               std::vector<nixl_xfer_dlist_t> &local_descs,
+               std::vector<nixl_xfer_dlist_t> &remote_descs,
+               const std::string &remote_agent,
+               const std::string &notif_msg,
+               std::vector<uintptr_t> backends) -> std::vector<uintptr_t> {
+                nixl_opt_args_t extra_params;
+
+                if (local_descs.size() != remote_descs.size())
+                    throw std::invalid_argument(
+                        "local and remote descriptor list counts must match");
+
+                for (uintptr_t backend : backends)
+                    extra_params.backends.push_back((nixlBackendH *)backend);
+
+                if (notif_msg.size() > 0) {
+                    extra_params.notifMsg = notif_msg;
+                    extra_params.hasNotif = true;
+                }
+
+                // One GIL crossing for the whole batch; the descriptor lists
+                // were already built in C++ (numpy nixlXferDList constructor)
+                std::vector<uintptr_t> handles(local_descs.size(), 0);
+                nixl_status_t bad_ret = NIXL_SUCCESS;
+                {
+                    py::gil_scoped_release release;
+                    for (size_t i = 0; i < local_descs.size(); i++) {
+                        nixlXferReqH *handle = nullptr;
+                        nixl_status_t ret = agent.createXferReq(operation,
+                                                                local_descs[i],
+                                                                remote_descs[i],
+                                                                remote_agent,
+                                                                handle,
+                                                                &extra_params);
+                        if (ret != NIXL_SUCCESS) {
+                            for (size_t j = 0; j < i; j++)
+                                agent.releaseXferReq((nixlXferReqH *)handles[j]);
+                            bad_ret = ret;
+                            break;
+                        }
+                        handles[i] = (uintptr_t)handle;
+                    }
+                }
+                throw_nixl_exception(bad_ret);
+                return handles;
+            },
+            py::arg("operation"),
+            py::arg("local_descs"),
+            py::arg("remote_descs"),
+            py::arg("remote_agent"),
+            py::arg("notif_msg") = std::string(""),
+            py::arg("backend") = std::vector<uintptr_t>({}))
         .def(
             "estimateXferCost",
             [](nixlAgent &agent, uintptr_t reqh) -> std::tuple<int64_t, int64_t, int> {
@@ -634,24 +959,89 @@ PYBIND11_MODULE(_bindings, m) {
             [](nixlAgent &agent, uintptr_t reqh, std::string notif_msg) -> nixl_status_t {
                 nixl_opt_args_t extra_params;
                 nixl_status_t ret;
-                if (notif_msg.size() > 0) {
-                    extra_params.notifMsg = notif_msg;
-                    extra_params.hasNotif = true;
-                    ret = agent.postXferReq((nixlXferReqH *)reqh, &extra_params);
-                } else {
-                    ret = agent.postXferReq((nixlXferReqH *)reqh);
+                {
+                    py::gil_scoped_release release;
+                    if (notif_msg.size() > 0) {
+                        extra_params.notifMsg = notif_msg;
+                        extra_params.hasNotif = true;
+                        ret = agent.postXferReq((nixlXferReqH *)reqh, &extra_params);
+                    } else {
+                        ret = agent.postXferReq((nixlXferReqH *)reqh);
+                    }
                 }
                 throw_nixl_exception(ret);
                 return ret;
             },
             py::arg("reqh"),
             py::arg("notif_msg") = std::string(""))
+        .def(
+            "postXferReqBatch",
+            [](nixlAgent &agent,
+               std::vector<uintptr_t> reqhs,
+               std::string notif_msg) -> nixl_status_t {
+                nixl_opt_args_t extra_params;
+                nixl_status_t ret;
+
+                std::vector<nixlXferReqH *> handles;
+                handles.reserve(reqhs.size());
+                for (uintptr_t reqh : reqhs)
+                    handles.push_back((nixlXferReqH *)reqh);
+
+                {
+                    py::gil_scoped_release release;
+                    if (notif_msg.size() > 0) {
+                        extra_params.notifMsg = notif_msg;
+                        extra_params.hasNotif = true;
+                        ret = agent.postXferReqBatch(handles, &extra_params);
+                    } else {
+                        ret = agent.postXferReqBatch(handles);
+                    }
+                }
+                throw_nixl_exception(ret);
+                return ret;
+            },
+            py::arg("reqhs"),
+            py::arg("notif_msg") = std::string(""))
         .def("getXferStatus",
              [](nixlAgent &agent, uintptr_t reqh) -> nixl_status_t {
-                 nixl_status_t ret = agent.getXferStatus((nixlXferReqH *)reqh);
+                 nixl_status_t ret;
+                 {
+                     py::gil_scoped_release release;
+                     ret = agent.getXferStatus((nixlXferReqH *)reqh);
+                 }
                  throw_nixl_exception(ret);
                  return ret;
              })
+        .def(
+            "onXferCompletion",
+            [](nixlAgent &agent, uintptr_t reqh, py::object callback) -> nixl_status_t {
+                // The armed callback fires on the agent's poller thread,
+                // which does not hold the GIL, so it takes it around the
+                // Python call and drops its reference there: the later
+                // GIL-less destruction of the std::function then only
+                // destroys an empty py::object
+                auto cb = std::make_shared<py::object>(std::move(callback));
+                nixl_status_t ret;
+                {
+                    py::gil_scoped_release release;
+                    ret = agent.onXferCompletion(
+                        (nixlXferReqH *)reqh, [cb](nixl_status_t status) {
+                            py::gil_scoped_acquire acquire;
+                            try {
+                                (*cb)(status);
+                            }
+                            catch (py::error_already_set &e) {
+                                std::cerr << "nixl: exception in completion callback: " << e.what()
+                                          << std::endl;
+                            }
+                            *cb = py::object();
+                        });
+                }
+                throw_nixl_exception(ret);
+                return ret;
+            },
+            py::arg("reqh"),
+            py::arg("callback"))
         .def("queryXferBackend",
              [](nixlAgent &agent, uintptr_t reqh) -> uintptr_t {
                  nixlBackendH *backend = nullptr;
@@ -660,7 +1050,11 @@ PYBIND11_MODULE(_bindings, m) {
              })
         .def("releaseXferReq",
              [](nixlAgent &agent, uintptr_t reqh) -> nixl_status_t {
-                 nixl_status_t ret = agent.releaseXferReq((nixlXferReqH *)reqh);
+                 nixl_status_t ret;
+                 {
+                     py::gil_scoped_release release;
+                     ret = agent.releaseXferReq((nixlXferReqH *)reqh);
+                 }
                  throw_nixl_exception(ret);
                  return ret;
              })
@@ -681,7 +1075,11 @@ PYBIND11_MODULE(_bindings, m) {
                 for (uintptr_t backend : backends)
                     extra_params.backends.push_back((nixlBackendH *)backend);
 
-                nixl_status_t ret = agent.getNotifs(new_notifs, &extra_params);
+                nixl_status_t ret;
+                {
+                    py::gil_scoped_release release;
+                    ret = agent.getNotifs(new_notifs, &extra_params);
+                }
 
                 throw_nixl_exception(ret);
 
@@ -693,6 +1091,33 @@ PYBIND11_MODULE(_bindings, m) {
             },
             py::arg("notif_map"),
             py::arg("backends") = std::vector<uintptr_t>({}))
+        .def(
+            "getNotifsBatch",
+            [](nixlAgent &agent, std::vector<uintptr_t> backends) -> nixlNotifBatch {
+                nixl_notifs_t new_notifs;
+                nixl_opt_args_t extra_params;
+
+                for (uintptr_t backend : backends)
+                    extra_params.backends.push_back((nixlBackendH *)backend);
+
+                nixl_status_t ret;
+                {
+                    py::gil_scoped_release release;
+                    ret = agent.getNotifs(new_notifs, &extra_params);
+                }
+
+                throw_nixl_exception(ret);
+
+                // The payloads move out of the notification map into the
+                // batch, which Python reads through memoryviews (see
+                // nixlNotifBatch); nothing is copied on the way out
+                nixlNotifBatch batch;
+                for (auto &pair : new_notifs)
+                    for (auto &msg : pair.second)
+                        batch.entries.emplace_back(pair.first, std::move(msg));
+                return batch;
+            },
+            py::arg("backends") = std::vector<uintptr_t>({}))
         .def(
             "genNotif",
             [](nixlAgent &agent,
@@ -23,6 +23,16 @@ pub use query::{QueryResponse, QueryResponseIterator, QueryResponseList};
 pub use reg::RegDescList;
 pub use xfer::XferDescList;
 
+/// A plain transfer descriptor matching the `nixl_capi_xfer_desc_t` C layout,
+/// so whole `&[XferDesc]` slices can be handed to the FFI in a single call
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct XferDesc {
+    pub addr: usize,
+    pub len: usize,
+    pub dev_id: u64,
+}
+
 /// Memory types supported by NIXL
 #[derive(Debug, Clone, Copy, PartialEq, Eq, Serialize, Deserialize)]
 pub enum MemType {
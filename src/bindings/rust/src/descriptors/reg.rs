@@ -51,6 +51,37 @@ impl<'a> RegDescList<'a> {
         Self::new(mem_type, true)
     }
 
+    /// Creates an empty list with storage pre-allocated for `capacity`
+    /// descriptors, so the handle can be reused (clear + bulk add) across
+    /// batches without reallocating
+    pub fn with_capacity(
+        mem_type: MemType,
+        sorted: bool,
+        capacity: usize,
+    ) -> Result<Self, NixlError> {
+        let mut dlist = ptr::null_mut();
+        let status = unsafe {
+            nixl_capi_create_reg_dlist_sized(
+                mem_type as nixl_capi_mem_type_t,
+                &mut dlist,
+                sorted,
+                capacity,
+            )
+        };
+
+        match status {
+            NIXL_CAPI_SUCCESS => {
+                let ptr = NonNull::new(dlist).ok_or(NixlError::RegDescListCreationFailed)?;
+
+                Ok(Self {
+                    inner: ptr,
+                    _phantom: PhantomData,
+                })
+            }
+            _ => Err(NixlError::RegDescListCreationFailed),
+        }
+    }
+
     pub fn get_type(&self) -> Result<MemType, NixlError> {
         let mut mem_type = 0;
         let status = unsafe { nixl_capi_reg_dlist_get_type(self.inner.as_ptr(), &mut mem_type) };
@@ -92,6 +123,30 @@ impl<'a> RegDescList<'a> {
         }
     }
 
+    /// Appends a whole slice of descriptors (with empty metadata) in a single
+    /// FFI crossing
+    pub fn add_descs(&mut self, descs: &[XferDesc]) -> Result<(), NixlError> {
+        let reg_descs: Vec<bindings::nixl_capi_reg_desc_t> = descs
+            .iter()
+            .map(|d| bindings::nixl_capi_reg_desc_t {
+                addr: d.addr as uintptr_t,
+                len: d.len,
+                dev_id: d.dev_id,
+                metadata: ptr::null(),
+                metadata_len: 0,
+            })
+            .collect();
+        let status = unsafe {
+            nixl_capi_reg_dlist_add_descs(self.inner.as_ptr(), reg_descs.as_ptr(), reg_descs.len())
+        };
+
+        match status {
+            NIXL_CAPI_SUCCESS => Ok(()),
+            NIXL_CAPI_ERROR_INVALID_PARAM => Err(NixlError::InvalidParam),
+            _ => Err(NixlError::BackendError),
+        }
+    }
+
     /// Returns true if the list is empty
     pub fn is_empty(&self) -> Result<bool, NixlError> {
         Ok(self.len()? == 0)
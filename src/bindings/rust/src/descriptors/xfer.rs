@@ -52,6 +52,38 @@ impl<'a> XferDescList<'a> {
         Self::new(mem_type, true)
     }
 
+    /// Creates an empty list with storage pre-allocated for `capacity`
+    /// descriptors, so the handle can be reused (clear + bulk add) across
+    /// batches without reallocating
+    pub fn with_capacity(
+        mem_type: MemType,
+        sorted: bool,
+        capacity: usize,
+    ) -> Result<Self, NixlError> {
+        let mut dlist = ptr::null_mut();
+        let status = unsafe {
+            nixl_capi_create_xfer_dlist_sized(
+                mem_type as nixl_capi_mem_type_t,
+                &mut dlist,
+                sorted,
+                capacity,
+            )
+        };
+
+        match status {
+            NIXL_CAPI_SUCCESS => {
+                // SAFETY: If status is NIXL_CAPI_SUCCESS, dlist is non-null
+                let inner = unsafe { NonNull::new_unchecked(dlist) };
+                Ok(Self {
+                    inner,
+                    _phantom: PhantomData,
+                })
+            }
+            NIXL_CAPI_ERROR_INVALID_PARAM => Err(NixlError::InvalidParam),
+            _ => Err(NixlError::BackendError),
+        }
+    }
+
     /// Returns the memory type of the transfer descriptor list
     pub fn get_type(&self) -> Result<MemType, NixlError> {
         let mut mem_type = 0;
@@ -76,6 +108,23 @@ impl<'a> XferDescList<'a> {
         }
     }
 
+    /// Appends a whole slice of descriptors with a single FFI crossing
+    pub fn add_descs(&mut self, descs: &[XferDesc]) -> Result<(), NixlError> {
+        let status = unsafe {
+            nixl_capi_xfer_dlist_add_descs(
+                self.inner.as_ptr(),
+                descs.as_ptr() as *const bindings::nixl_capi_xfer_desc_t,
+                descs.len(),
+            )
+        };
+
+        match status {
+            NIXL_CAPI_SUCCESS => Ok(()),
+            NIXL_CAPI_ERROR_INVALID_PARAM => Err(NixlError::InvalidParam),
+            _ => Err(NixlError::BackendError),
+        }
+    }
+
      /// Returns true if the list is sorted
      fn verify_sorted_inner(inner: NonNull<bindings::nixl_capi_xfer_dlist_s>) -> Result<bool, NixlError>   {
         let mut is_sorted = false;
@@ -45,6 +45,7 @@ use bindings::{
     nixl_capi_create_opt_args, nixl_capi_create_reg_dlist, nixl_capi_create_xfer_dlist,
     nixl_capi_deregister_mem, nixl_capi_destroy_agent, nixl_capi_destroy_backend,
     nixl_capi_destroy_mem_list, nixl_capi_destroy_notif_map, nixl_capi_destroy_opt_args,
+    nixl_capi_create_reg_dlist_sized, nixl_capi_create_xfer_dlist_sized,
     nixl_capi_destroy_params, nixl_capi_destroy_reg_dlist, nixl_capi_destroy_string_list,
     nixl_capi_destroy_xfer_dlist, nixl_capi_get_available_plugins, nixl_capi_get_backend_params,
     nixl_capi_get_local_md, nixl_capi_get_notifs, nixl_capi_get_plugin_params,
@@ -60,6 +61,7 @@ use bindings::{
     nixl_capi_params_iterator_next, nixl_capi_post_xfer_req, nixl_capi_reg_dlist_add_desc,
     nixl_capi_reg_dlist_clear, nixl_capi_reg_dlist_has_overlaps, nixl_capi_reg_dlist_len,
     nixl_capi_reg_dlist_resize, nixl_capi_register_mem, nixl_capi_string_list_get,
+    nixl_capi_reg_dlist_add_descs, nixl_capi_xfer_dlist_add_descs,
     nixl_capi_string_list_size, nixl_capi_xfer_dlist_add_desc, nixl_capi_xfer_dlist_clear,
     nixl_capi_xfer_dlist_has_overlaps, nixl_capi_xfer_dlist_len, nixl_capi_xfer_dlist_resize,
     nixl_capi_agent_make_connection, nixl_capi_reg_dlist_get_type, nixl_capi_reg_dlist_desc_count,
@@ -236,6 +236,44 @@ fn test_xfer_dlist() {
     assert!(dlist.has_overlaps().unwrap());
 }
 
+#[test]
+fn test_dlist_bulk_add() {
+    let descs = [
+        XferDesc {
+            addr: 0x1000,
+            len: 0x100,
+            dev_id: 0,
+        },
+        XferDesc {
+            addr: 0x2000,
+            len: 0x200,
+            dev_id: 1,
+        },
+        XferDesc {
+            addr: 0x3000,
+            len: 0x300,
+            dev_id: 0,
+        },
+    ];
+
+    // Whole slice is appended with a single FFI call
+    let mut dlist = XferDescList::with_capacity(MemType::Dram, false, descs.len()).unwrap();
+    assert_eq!(dlist.len().unwrap(), 0);
+    dlist.add_descs(&descs).unwrap();
+    assert_eq!(dlist.len().unwrap(), 3);
+    assert!(!dlist.has_overlaps().unwrap());
+
+    // The handle can be reused across batches
+    dlist.clear().unwrap();
+    assert_eq!(dlist.len().unwrap(), 0);
+    dlist.add_descs(&descs[..2]).unwrap();
+    assert_eq!(dlist.len().unwrap(), 2);
+
+    let mut reg_dlist = RegDescList::with_capacity(MemType::Dram, false, descs.len()).unwrap();
+    reg_dlist.add_descs(&descs).unwrap();
+    assert_eq!(reg_dlist.len().unwrap(), 3);
+}
+
 #[test]
 fn test_reg_dlist() {
     let mut dlist = RegDescList::new(MemType::Dram, false).unwrap();
@@ -821,6 +821,28 @@ nixl_capi_create_xfer_dlist(nixl_capi_mem_type_t mem_type, nixl_capi_xfer_dlist_
   }
 }
 
+nixl_capi_status_t
+nixl_capi_create_xfer_dlist_sized(
+    nixl_capi_mem_type_t mem_type, nixl_capi_xfer_dlist_t* dlist, bool sorted, size_t capacity)
+{
+  if (!dlist) {
+    return NIXL_CAPI_ERROR_INVALID_PARAM;
+  }
+
+  try {
+    auto d = new nixl_capi_xfer_dlist_s;
+    d->dlist = new nixl_xfer_dlist_t(static_cast<nixl_mem_t>(mem_type), sorted, capacity);
+    // The list is handed out empty; clearing after the sized construction
+    // keeps the vector's storage so later bulk adds don't reallocate
+    d->dlist->clear();
+    *dlist = d;
+    return NIXL_CAPI_SUCCESS;
+  }
+  catch (...) {
+    return NIXL_CAPI_ERROR_BACKEND;
+  }
+}
+
 nixl_capi_status_t
 nixl_capi_destroy_xfer_dlist(nixl_capi_xfer_dlist_t dlist)
 {
@@ -871,6 +893,30 @@ nixl_capi_xfer_dlist_add_desc(nixl_capi_xfer_dlist_t dlist, uintptr_t addr, size
   }
 }
 
+nixl_capi_status_t
+nixl_capi_xfer_dlist_add_descs(
+    nixl_capi_xfer_dlist_t dlist, const nixl_capi_xfer_desc_t* descs, size_t count)
+{
+  if (!dlist || (!descs && count > 0)) {
+    return NIXL_CAPI_ERROR_INVALID_PARAM;
+  }
+
+  try {
+    static_assert(sizeof(nixl_capi_xfer_desc_t) == sizeof(nixlBasicDesc),
+                  "nixl_capi_xfer_desc_t must mirror nixlBasicDesc");
+    size_t old_count = dlist->dlist->descCount();
+    dlist->dlist->resize(old_count + count);
+    // The C struct matches the nixlBasicDesc layout, so the whole slice can
+    // be appended with one copy instead of a sorted insert per element
+    std::memcpy(&(*dlist->dlist)[old_count], descs, count * sizeof(nixlBasicDesc));
+    dlist->dlist->verifySorted();
+    return NIXL_CAPI_SUCCESS;
+  }
+  catch (...) {
+    return NIXL_CAPI_ERROR_BACKEND;
+  }
+}
+
 nixl_capi_status_t
 nixl_capi_xfer_dlist_desc_count(nixl_capi_xfer_dlist_t dlist, size_t* count)
 {
@@ -1055,6 +1101,26 @@ nixl_capi_create_reg_dlist(nixl_capi_mem_type_t mem_type, nixl_capi_reg_dlist_t*
   }
 }
 
+nixl_capi_status_t
+nixl_capi_create_reg_dlist_sized(
+    nixl_capi_mem_type_t mem_type, nixl_capi_reg_dlist_t* dlist, bool sorted, size_t capacity)
+{
+  if (!dlist) {
+    return NIXL_CAPI_ERROR_INVALID_PARAM;
+  }
+
+  try {
+    auto d = new nixl_capi_reg_dlist_s;
+    d->dlist = new nixl_reg_dlist_t(static_cast<nixl_mem_t>(mem_type), sorted, capacity);
+    d->dlist->clear();
+    *dlist = d;
+    return NIXL_CAPI_SUCCESS;
+  }
+  catch (...) {
+    return NIXL_CAPI_ERROR_BACKEND;
+  }
+}
+
 nixl_capi_status_t
 nixl_capi_destroy_reg_dlist(nixl_capi_reg_dlist_t dlist)
 {
@@ -1134,6 +1200,33 @@ nixl_capi_reg_dlist_add_desc(nixl_capi_reg_dlist_t dlist,
     }
 }
 
+nixl_capi_status_t
+nixl_capi_reg_dlist_add_descs(
+    nixl_capi_reg_dlist_t dlist, const nixl_capi_reg_desc_t* descs, size_t count)
+{
+  if (!dlist || (!descs && count > 0)) {
+    return NIXL_CAPI_ERROR_INVALID_PARAM;
+  }
+
+  try {
+    size_t old_count = dlist->dlist->descCount();
+    dlist->dlist->resize(old_count + count);
+    for (size_t i = 0; i < count; i++) {
+      nixl_blob_t meta_blob;
+      if (descs[i].metadata && descs[i].metadata_len > 0) {
+        meta_blob.assign((const char*)descs[i].metadata, descs[i].metadata_len);
+      }
+      (*dlist->dlist)[old_count + i] =
+          nixlBlobDesc(descs[i].addr, descs[i].len, descs[i].dev_id, meta_blob);
+    }
+    dlist->dlist->verifySorted();
+    return NIXL_CAPI_SUCCESS;
+  }
+  catch (...) {
+    return NIXL_CAPI_ERROR_BACKEND;
+  }
+}
+
 nixl_capi_status_t
 nixl_capi_reg_dlist_desc_count(nixl_capi_reg_dlist_t dlist, size_t* count)
 {
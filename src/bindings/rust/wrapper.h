@@ -199,12 +199,35 @@ nixl_capi_status_t nixl_capi_release_xfer_req(nixl_capi_agent_t agent, nixl_capi
 
 nixl_capi_status_t nixl_capi_destroy_xfer_req(nixl_capi_xfer_req_t req);
 
+// Plain descriptor structs mirroring nixlBasicDesc, so language bindings can
+// hand over a whole descriptor array in a single FFI call instead of one
+// crossing per descriptor
+typedef struct {
+  uintptr_t addr;
+  size_t len;
+  uint64_t dev_id;
+} nixl_capi_xfer_desc_t;
+
+typedef struct {
+  uintptr_t addr;
+  size_t len;
+  uint64_t dev_id;
+  const void* metadata;  // optional, may be NULL
+  size_t metadata_len;
+} nixl_capi_reg_desc_t;
+
 // Descriptor list functions
 nixl_capi_status_t nixl_capi_create_xfer_dlist(nixl_capi_mem_type_t mem_type, nixl_capi_xfer_dlist_t* dlist, bool sorted);
+// Creates an empty list with storage pre-allocated for capacity descriptors,
+// so the handle can be reused (clear + bulk add) without reallocating
+nixl_capi_status_t nixl_capi_create_xfer_dlist_sized(
+    nixl_capi_mem_type_t mem_type, nixl_capi_xfer_dlist_t* dlist, bool sorted, size_t capacity);
 nixl_capi_status_t nixl_capi_destroy_xfer_dlist(nixl_capi_xfer_dlist_t dlist);
 nixl_capi_status_t nixl_capi_xfer_dlist_get_type(nixl_capi_xfer_dlist_t dlist, nixl_capi_mem_type_t* mem_type);
 nixl_capi_status_t nixl_capi_xfer_dlist_add_desc(
     nixl_capi_xfer_dlist_t dlist, uintptr_t addr, size_t len, uint64_t dev_id);
+nixl_capi_status_t nixl_capi_xfer_dlist_add_descs(
+    nixl_capi_xfer_dlist_t dlist, const nixl_capi_xfer_desc_t* descs, size_t count);
 nixl_capi_status_t nixl_capi_xfer_dlist_desc_count(nixl_capi_xfer_dlist_t dlist, size_t* count);
 nixl_capi_status_t nixl_capi_xfer_dlist_len(nixl_capi_xfer_dlist_t dlist, size_t* len);
 nixl_capi_status_t nixl_capi_xfer_dlist_is_empty(nixl_capi_xfer_dlist_t dlist, bool* is_empty);
@@ -218,6 +241,8 @@ nixl_capi_status_t nixl_capi_xfer_dlist_resize(nixl_capi_xfer_dlist_t dlist, siz
 nixl_capi_status_t nixl_capi_xfer_dlist_print(nixl_capi_xfer_dlist_t dlist);
 
 nixl_capi_status_t nixl_capi_create_reg_dlist(nixl_capi_mem_type_t mem_type, nixl_capi_reg_dlist_t* dlist, bool sorted);
+nixl_capi_status_t nixl_capi_create_reg_dlist_sized(
+    nixl_capi_mem_type_t mem_type, nixl_capi_reg_dlist_t* dlist, bool sorted, size_t capacity);
 nixl_capi_status_t nixl_capi_destroy_reg_dlist(nixl_capi_reg_dlist_t dlist);
 nixl_capi_status_t nixl_capi_reg_dlist_get_type(nixl_capi_reg_dlist_t dlist, nixl_capi_mem_type_t* mem_type);
 nixl_capi_status_t nixl_capi_reg_dlist_verify_sorted(nixl_capi_reg_dlist_t dlist, bool *is_sorted);
@@ -228,6 +253,8 @@ nixl_capi_reg_dlist_add_desc(nixl_capi_reg_dlist_t dlist,
                              uint64_t dev_id,
                              const void *metadata,
                              size_t metadata_len);
+nixl_capi_status_t nixl_capi_reg_dlist_add_descs(
+    nixl_capi_reg_dlist_t dlist, const nixl_capi_reg_desc_t* descs, size_t count);
 nixl_capi_status_t nixl_capi_reg_dlist_len(nixl_capi_reg_dlist_t dlist, size_t* len);
 nixl_capi_status_t nixl_capi_reg_dlist_desc_count(nixl_capi_reg_dlist_t dlist, size_t* count);
 nixl_capi_status_t nixl_capi_reg_dlist_is_empty(nixl_capi_reg_dlist_t dlist, bool* is_empty);
@@ -17,10 +17,20 @@
 #ifndef __AGENT_DATA_H_
 #define __AGENT_DATA_H_
 
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <unordered_set>
+
+#include "common/mem_budget.h"
+#include "common/mpsc_queue.h"
+#include "common/nixl_mem_pool.h"
 #include "common/str_tools.h"
 #include "mem_section.h"
 #include "stream/metadata_stream.h"
 #include "sync.h"
+#include "trace.h"
 
 
 #if HAVE_ETCD
@@ -34,9 +44,19 @@ class SyncClient;
 #endif // HAVE_ETCD
 
 class nixlTelemetry;
+class nixlStagingPool;
+class nixlBlockCache;
 
 using backend_list_t = std::vector<nixlBackendEngine*>;
 
+// Agent-internal hash map with the allocator parameter threaded through
+// (see nixlMemPool): with a null pool it behaves exactly like the
+// global-allocator map it replaces, and an agent configured with
+// internalPoolSize routes these containers into its own arena
+template<class K, class V, class H = std::hash<K>, class E = std::equal_to<K>>
+using nixl_pooled_umap =
+    std::unordered_map<K, V, H, E, nixlPoolAllocator<std::pair<const K, V>>>;
+
 //Internal typedef to define metadata communication request types
 //To be extended with ETCD operations
 enum nixl_comm_t {
@@ -66,6 +86,12 @@ class nixlAgentData {
         nixlAgentConfig config;
         nixlLock        lock;
 
+        // Per-agent allocation arena (config.internalPoolSize): the
+        // pooled containers below are constructed over it, so their
+        // allocations stay out of the global allocator's way. Declared
+        // ahead of them so it outlives every container it backs
+        std::unique_ptr<nixlMemPool> internalPool;
+
         // some handle that can be used to instantiate an object from the lib
         std::map<std::string, void*> backendLibs;
 
@@ -78,25 +104,303 @@ class nixlAgentData {
         std::unordered_map<nixl_backend_t, nixlBackendH*> backendHandles;
         std::unordered_map<nixl_backend_t, nixl_blob_t>   connMD;
 
+        // Pinned host staging pool, created when the first backend
+        // requests it through its custom params and shared from then on
+        // (see nixlStagingPool)
+        std::unique_ptr<nixlStagingPool>                  stagingPool;
+
+        // Shared read cache tier for storage backends that bypass the
+        // page cache, created when the first backend requests it through
+        // its custom params and shared from then on (see nixlBlockCache)
+        std::unique_ptr<nixlBlockCache>                   blockCache;
+
+        // Budget the backends account their internal pool memory against,
+        // created when the config sets watermarks (see nixlMemBudget)
+        std::unique_ptr<nixlMemBudget>                    memBudget;
+
         // Local section, and Remote sections and their available common backends
         nixlLocalSection*                                        memorySection;
 
-        std::unordered_map<std::string,
-                           std::unordered_map<nixl_backend_t, nixl_blob_t>,
-                           std::hash<std::string>, strEqual>     remoteBackends;
-        std::unordered_map<std::string, nixlRemoteSection*,
-                           std::hash<std::string>, strEqual>     remoteSections;
+        nixl_pooled_umap<std::string,
+                         std::unordered_map<nixl_backend_t, nixl_blob_t>,
+                         std::hash<std::string>, strEqual>       remoteBackends;
+        nixl_pooled_umap<std::string, nixlRemoteSection*,
+                         std::hash<std::string>, strEqual>       remoteSections;
+
+        // Incremental metadata bookkeeping: the section generation last
+        // loaded from each remote agent, and the generation last sent to
+        // each socket peer (keyed "ip:port") so repeat sends can ship diffs
+        nixl_pooled_umap<std::string, uint64_t>                  remoteMDGen;
+        nixl_pooled_umap<std::string, uint64_t>                  peerSentMDGen;
+
+        // Label-addressable registration groups (nixl_opt_args_t::regGroup):
+        // per label, the tagged registrations per memory type plus the
+        // serialized fragment cached from the last publish. The fragment
+        // is dropped whenever the group membership or the backends change,
+        // so repeat publishes of an unchanged group reuse the cached bytes
+        struct regGroupEntry {
+            std::array<std::unique_ptr<nixl_reg_dlist_t>, FILE_SEG+1> descs;
+            nixl_blob_t cachedMD;
+            bool        cachedValid = false;
+            bool        cachedConnInfo = false;
+        };
+        std::unordered_map<std::string, regGroupEntry> regGroups;
+
+        // Lazily recorded multi-backend registrations (see
+        // nixl_opt_args_t::lazyReg): intents materialized on first use by
+        // a transfer their backend must serve. Guarded by the exclusive
+        // agent lock; the counter lets createXferReq skip the hook with
+        // one load while no intents are outstanding
+        struct pendingReg {
+            nixlBackendEngine* backend;
+            nixl_reg_dlist_t   descs;
+            nixl_reg_hints_t   hints;
+        };
+        std::vector<pendingReg> pendingRegs;
+        std::atomic<size_t>     pendingRegCount{0};
+        nixl_status_t materializePendingRegs(const nixl_xfer_dlist_view_t &local_descs,
+                                             const nixl_xfer_dlist_view_t &remote_descs,
+                                             const std::string &remote_agent,
+                                             const nixl_opt_args_t *extra_params);
+
+        // Monitoring snapshot (see nixlAgent::getAgentSnapshot): the
+        // published pointer is swapped atomically so readers take no lock;
+        // mdEpoch bumps on every registration/connection mutation and
+        // marks the published snapshot stale
+        std::shared_ptr<const nixl_agent_snapshot_t> agentSnapshot;
+        std::atomic<uint64_t> mdEpoch{1};
+        void addRegGroupDescs(const std::string &label,
+                              const nixl_reg_dlist_t &descs);
+        void remRegGroupDescs(const nixl_reg_dlist_t &descs);
+        void flushRegGroupMDCache();
+
+        // Raw-blob fingerprint (hash, size) of the metadata last loaded
+        // from each remote agent; loadRemoteMD returns early when an
+        // identical blob is re-sent (e.g. periodic orchestrator refreshes)
+        // instead of re-deserializing and re-validating it
+        nixl_pooled_umap<std::string,
+                         std::pair<uint64_t, size_t>>            remoteMDHash;
+
+        // Bounded remote-metadata cache (config.maxRemoteAgents): recency
+        // ticks per remote agent, bumped on metadata load and transfer
+        // preparation under their own lock so readers of the agent lock
+        // can touch concurrently. When the cap is exceeded the least
+        // recently used agent is invalidated, including backend unloadMD;
+        // departed peers thus age out and live ones re-fetch lazily.
+        // The ticks themselves live in the interned remoteSlots below
+        uint64_t                                                 remoteLRUClock = 0;
+        std::mutex                                               remoteLRULock;
+        void touchRemoteAgent(const std::string &remote_name);
+        void touchRemoteAgent(uint32_t agent_id);
+        // Caller holds the exclusive agent lock
+        void enforceRemoteAgentCap();
+
+        // Backend dispatch tables (createXferReq): per remote agent, a flat
+        // array indexed by (local mem, remote mem) holding the backend
+        // candidates common to the local section and that agent's remote
+        // section, in selection order. Rebuilt under the exclusive lock
+        // whenever either side changes (backend creation, memory
+        // (de)registration, metadata loads), so backend selection is one
+        // table load instead of re-intersecting the sets on every request
+        static constexpr size_t XFER_TABLE_DIM = FILE_SEG + 1;
+        using xfer_backend_table_t =
+            std::array<backend_list_t, XFER_TABLE_DIM * XFER_TABLE_DIM>;
+        void rebuildXferBackendTable(const std::string &remote_name);
+        void rebuildXferBackendTables();
+
+        // Agent name interning: a remote name is hashed once at the API
+        // boundary into a dense id, and the per-remote hot state (section
+        // pointer, dispatch table, LRU tick) lives in remoteSlots indexed
+        // by that id, so the rest of createXferReq is array loads. Ids are
+        // assigned under the exclusive lock when a remote's metadata first
+        // lands and never reused; invalidation clears the slot but keeps
+        // the id for a later reload of the same agent
+        struct remoteAgentSlot {
+            nixlRemoteSection    *section = nullptr; // mirrors remoteSections
+            xfer_backend_table_t  xferTable;
+            uint64_t              lruTick = 0;       // guarded by remoteLRULock
+            // Last backend that failed over toward this peer; createXferReq
+            // demotes it to the end of the candidate order until another
+            // backend fails in turn. Guarded by remoteLRULock
+            nixlBackendEngine    *demotedEngine = nullptr;
+        };
+        nixl_pooled_umap<std::string, uint32_t,
+                         std::hash<std::string>, strEqual>   agentNameIds;
+        std::vector<remoteAgentSlot>                         remoteSlots;
+        // RCU snapshot of the interning map: readers resolve a remote
+        // name with one atomic shared_ptr load and no agent lock, and
+        // internAgentName republishes a copied map on each new id (rare:
+        // the first metadata load per remote). Ids are never reused, so a
+        // stale snapshot can only miss the newest remotes, which then
+        // resolve as not-found exactly as before their metadata landed
+        using agent_id_map_t =
+            std::unordered_map<std::string, uint32_t,
+                               std::hash<std::string>, strEqual>;
+        std::shared_ptr<const agent_id_map_t>                agentIdSnapshot;
+        uint32_t internAgentName(const std::string &remote_name);
+        int32_t getAgentId(const std::string &remote_name) const;
+        int32_t lookupAgentId(const std::string &remote_name) const;
+        void clearRemoteSlot(const std::string &remote_name);
+        const backend_list_t* lookupXferBackends(int32_t agent_id,
+                                                 const nixl_mem_t &local_mem,
+                                                 const nixl_mem_t &remote_mem) const;
 
         // State/methods for listener thread
         nixlMDStreamListener               *listener;
         std::map<nixl_socket_peer_t, int>  remoteSockets;
         std::thread                        commThread;
-        std::vector<nixl_comm_req_t>       commQueue;
-        std::mutex                         commLock;
+        // Lock-free MPSC handoff to the commWorker: enqueues from the API
+        // threads (sendLocalMD/fetchRemoteMD/...) are wait-free and never
+        // contend with the worker draining
+        nixlMpscQueue<nixl_comm_req_t>     commQueue;
         bool                               commThreadStop;
+        // eventfd doorbell for the epoll-based commWorker, rung when work
+        // is enqueued or the thread should exit, so it sleeps while idle
+        int                                commDoorbell;
         bool                               useEtcd;
+        // Peers with a metadata prefetch in flight (prefetchRemoteMD): the
+        // commWorker warms their connections once the fetched metadata has
+        // been loaded, so the first transfer to a predicted peer skips the
+        // wireup round trip. Guarded by its own lock so the API side never
+        // serializes against a metadata load in progress
+        std::mutex                         prefetchLock;
+        std::unordered_set<std::string>    prefetchPending;
         std::unique_ptr<nixlTelemetry> telemetry_;
+
+        // Request tracer (see nixlTracer); only set when NIXL_TRACE_DIR is
+        // configured, so trace checks elsewhere double as the enable gate
+        std::unique_ptr<nixlTracer> tracer_;
+
+        // Online transfer cost model (estimateXferCost): completed transfers
+        // recorded by telemetry feed per-(backend, mem-type pair) samples,
+        // bucketed by log2 size class, with a least-squares latency plus
+        // size-over-bandwidth line fitted across all sizes for classes not
+        // yet observed. Serves backends that have no estimator of their own.
+        struct nixlCostModel {
+            struct sizeClass {
+                uint64_t count   = 0;
+                double   sumUs   = 0;
+                double   sumSqUs = 0;
+            };
+            std::array<sizeClass, 48> classes;
+            double n = 0, sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+            void addSample(size_t bytes, double us);
+            nixl_status_t estimate(size_t bytes,
+                                   std::chrono::microseconds &duration,
+                                   std::chrono::microseconds &err_margin) const;
+        };
+        using cost_model_key_t =
+            std::tuple<nixlBackendEngine*, nixl_mem_t, nixl_mem_t>;
+        std::map<cost_model_key_t, nixlCostModel> costModels;
+        std::mutex                         costModelLock;
+        void recordXferSample(const nixlXferReqH* req_hndl);
+
+        // Per-(peer, priority class) token buckets (setXferRateLimit):
+        // posts debit the bucket at postXferReq admission, so a peer
+        // pulling bulk data can be capped where the request boundaries
+        // are known instead of by external shaping below NIXL. Any
+        // positive balance admits and may go into debt, so a single
+        // request larger than the burst drains through instead of being
+        // rejected forever; the debt throttles the posts after it.
+        struct nixlTokenBucket {
+            uint64_t bytesPerSec = 0;
+            uint64_t burstBytes  = 0;
+            int64_t  tokens      = 0;
+            std::chrono::steady_clock::time_point lastRefill;
+        };
+        using rate_limit_key_t = std::pair<std::string, nixl_xfer_priority_t>;
+        std::map<rate_limit_key_t, nixlTokenBucket> rateLimits;
+        std::mutex                         rateLimitLock;
+        // Lets the post path skip the bucket lock while no limit is set
+        std::atomic<bool>                  rateLimitActive{false};
+        bool admitXferBytes(const std::string &remote_agent,
+                            nixl_xfer_priority_t prio, size_t bytes);
+
+        // Mappings owned by the agent (allocMem): mapped length and the
+        // registered descriptor list, so freeMem can deregister and unmap
+        std::unordered_map<void*, std::pair<size_t, nixl_reg_dlist_t>> ownedAllocs;
+
+        // Prepped descriptor-list cache (prepXferDlist): identical lists for
+        // the same agent reuse one populated nixlDlistH, refcounted through
+        // releasedDlistH. Zero-ref entries persist so recurring per-request
+        // preps stay a hash lookup, and are evicted when the section they
+        // point into changes (deregisterMem / remote invalidation).
+        struct dlistCacheEntry {
+            nixl_xfer_dlist_t descs;
+            std::string       agent;
+            nixlDlistH        *handle;
+            size_t            refCount;
+        };
+        std::unordered_multimap<uint64_t, dlistCacheEntry> dlistCache;
+        // Guards dlistCache on its own, so prepXferDlist/releasedDlistH can
+        // run as readers of the agent lock and only serialize on the cache
+        // itself; section mutations still hold the exclusive agent lock
+        // before flushing
+        std::mutex                         dlistCacheLock;
+        void flushDlistCache(const std::string &agent);
+
+        // Serializes backend notification drains (getNotifs/getNotifsView),
+        // which run as readers of the agent lock and must not enter a
+        // backend's notification path from two threads at once
+        std::mutex                         notifLock;
+
+        // Freelist of transfer request handles (with their descriptor list
+        // storage), so steady-state create/release cycles are allocation-free
+        std::vector<nixlXferReqH*>         xferReqPool;
+        std::mutex                         xferReqPoolLock;
+        nixlXferReqH* acquireXferReqH();
+        void recycleXferReqH(nixlXferReqH* req_hndl);
+
+        // Deferred teardown: descriptors leave the sections inline while the
+        // slow work (driver unpinning, connection shutdown) runs as queued
+        // tasks on the reclamation thread, started lazily on first use
+        std::thread                        reclaimThread;
+        std::mutex                         reclaimLock;
+        std::condition_variable            reclaimCv;
+        std::vector<std::function<void()>> reclaimQueue;
+        bool                               reclaimStop;
+        size_t                             reclaimInFlight;
+        void reclaimWorker();
+        void enqueueReclaim(std::vector<std::pair<nixlBackendEngine*,
+                                                  nixlBackendMD*>> &&mds);
+        void enqueueReclaimTask(std::function<void()> &&task);
+        // Undo of a one-shot registration (nixl_opt_args_t::tempReg),
+        // run on the reclamation thread when the handle is recycled
+        void deregisterOneShot(const nixl_reg_dlist_t &descs);
+
+        // Opt-in completion poller (backgroundPolling): advances checkXfer
+        // off the caller's thread and publishes each request's status word,
+        // started lazily on first use
+        std::thread                        pollerThread;
+        std::mutex                         pollerLock;
+        std::condition_variable            pollerCv;
+        std::vector<nixlXferReqH*>         polledReqs;
+        bool                               pollerStop;
+        void pollerWorker();
+        void enqueuePoll(nixlXferReqH* req_hndl);
+        void pollerRemove(nixlXferReqH* req_hndl);
+        // Arms a one-shot completion callback fired by the poller; returns
+        // NIXL_IN_PROG when armed, or the terminal status right away if the
+        // request already completed (callback not retained then)
+        nixl_status_t armXferCallback(nixlXferReqH* req_hndl,
+                                      std::function<void(nixl_status_t)> &&cb);
+
+        // Agent-owned progress engine (numProgressThreads): a fixed set of
+        // threads drives every enrolled backend's progress() under the
+        // configured schedule (see nixl_progress_sched_t), replacing the
+        // internal progress threads of backends that support external
+        // progression. Backends enroll at creation time; the threads start
+        // with the first enrollee and stop in the destructor, before the
+        // engines are torn down
+        std::vector<std::thread>           progressThreads;
+        std::mutex                         progressLock;
+        std::vector<nixlBackendEngine*>    progressEngines;
+        bool                               progressStop;
+        void progressWorker(size_t thread_idx);
+        void enrollProgressEngine(nixlBackendEngine* engine);
         void commWorker(nixlAgent* myAgent);
+        void processPrefetches(nixlAgent* myAgent);
+        void wakeCommThread();
         void enqueueCommWork(nixl_comm_req_t request);
         void getCommWork(std::vector<nixl_comm_req_t> &req_list);
         nixl_status_t
@@ -106,7 +410,39 @@ class nixlAgentData {
         nixl_status_t
         loadRemoteSections(const std::string &remote_name, nixlSerDes &sd);
         nixl_status_t
+        applyRemoteMDDiff(const std::string &remote_name, nixlSerDes &sd);
+        // Parses the fixed-layout metadata envelope (see nixlMDHeader in
+        // nixl_agent.cpp) and loads the section stream behind it; caller
+        // holds the agent lock and has verified the leading magic
+        nixl_status_t
+        loadRemoteMDEnvelope(const nixl_blob_t &md, std::string &agent_name);
+        nixl_status_t
         invalidateRemoteData(const std::string &remote_name);
+        // Coalesced invalidation epoch: detaches every agent's state under
+        // one lock acquisition and defers the slow teardown to the
+        // reclamation thread; caller holds the agent lock
+        nixl_status_t
+        invalidateRemoteDataBatch(const std::vector<std::string> &remote_names);
+        // Full metadata serialization; caller holds the agent lock
+        nixl_status_t
+        serializeLocalMD(nixl_blob_t &str) const;
+        // Streaming variant: serialized bytes are handed to the sink in
+        // bounded chunks instead of materializing the whole blob; caller
+        // holds the agent lock
+        nixl_status_t
+        serializeLocalMDToSink(
+            const std::function<nixl_status_t(const void *buf, size_t len)> &sink) const;
+        // Diff vs full decision for a socket peer, updating peerSentMDGen
+        nixl_status_t
+        serializeLocalMDForPeer(const std::string &peer_key, nixl_blob_t &str);
+        // Remote-metadata persistence (config.remoteMDCacheDir): each
+        // peer's last full metadata blob is mirrored to
+        // "<dir>/<agent>.nixlmd" so a restarted agent can reload its peers
+        // from disk; both are no-ops when the directory is unset
+        nixl_status_t
+        persistRemoteMD(const std::string &remote_name,
+                        const nixl_blob_t &md) const;
+        void dropPersistedRemoteMD(const std::string &remote_name) const;
 
     public:
         nixlAgentData(const std::string &name, const nixlAgentConfig &cfg);
@@ -121,6 +457,9 @@ class nixlBackendH {
     private:
         nixlBackendEngine* engine;
 
+        // Set at creation when telemetry is enabled; backs getHealth()
+        nixlTelemetry* telemetry = nullptr;
+
         nixlBackendH(nixlBackendEngine* &engine) { this->engine = engine; }
         ~nixlBackendH () {}
 
@@ -132,6 +471,11 @@ class nixlBackendH {
         bool supportsNotif  () const { return engine->supportsNotif (); }
         bool supportsProgTh () const { return engine->supportsProgTh(); }
 
+        // Health from telemetry's per-backend latency histograms and
+        // stall detector; NIXL_BACKEND_HEALTH_UNKNOWN when telemetry is
+        // disabled or the backend hasn't completed a transfer yet
+        nixl_backend_health_t getHealth () const;
+
     friend class nixlAgentData;
     friend class nixlAgent;
 };
@@ -15,10 +15,23 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
 #include <iostream>
 #include <chrono>
 #include <iostream>
+#include <mutex>
 #include <numeric>
+#include <thread>
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 #include "nixl.h"
 #include "serdes/serdes.h"
@@ -26,19 +39,37 @@
 #include "transfer_request.h"
 #include "agent_data.h"
 #include "plugin_manager.h"
+#include "common/nixl_affinity.h"
 #include "common/nixl_log.h"
+#include "file/file_utils.h"
+#include "cuda/staging_pool.h"
+#include "common/block_cache.h"
 #include "telemetry.h"
 #include "telemetry_event.h"
 
-// Macro to safely call telemetry methods only if telemetry_ is not null
+// Macro to safely call telemetry methods only if telemetry_ is not null.
+// A -Ddisable_telemetry=true build compiles the instrumentation out: the
+// macro expands to nothing and telemetryBuiltIn turns every remaining
+// telemetry branch into dead code the compiler removes, so the hot paths
+// carry no observer cost at all
+#ifdef NIXL_NO_TELEMETRY
+constexpr bool telemetryBuiltIn = false;
+#define UPDATE_TELEMETRY_DATA(telemetry_ptr, method_call) \
+    do {                                                  \
+    } while (0)
+#else
+constexpr bool telemetryBuiltIn = true;
 #define UPDATE_TELEMETRY_DATA(telemetry_ptr, method_call) \
     do {                                                  \
         if (telemetry_ptr) {                              \
             telemetry_ptr->method_call;                   \
         }                                                 \
     } while (0)
+#endif
 
 const char TELEMETRY_ENABLED_VAR[] = "NIXL_TELEMETRY_ENABLE";
+// Upper bound on recycled transfer request handles kept in the pool
+constexpr size_t XFER_REQ_POOL_CAP = 4096;
 static const std::vector<std::vector<std::string>> illegal_plugin_combinations = {
     {"GDS", "GDS_MT"},
 };
@@ -88,20 +119,53 @@ nixlXferReqH::updateRequestStats(std::unique_ptr<nixlTelemetry> &telemetry_pub,
 
     static const std::array<std::string, 3> nixl_post_status_str = {
         " Posted", " Posted and Completed", " Completed"};
+
+    // Compound requests have no single backend to account health against
+    if (stat_status == NIXL_TELEMETRY_ABORT) {
+        if (telemetry.posted_ && engine) {
+            telemetry_pub->abortBackendXfer(engine);
+        }
+        telemetry.posted_ = false;
+        return;
+    }
+
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
         std::chrono::steady_clock::now() - telemetry.startTime);
 
     if (stat_status == NIXL_TELEMETRY_POST) {
         telemetry.postDuration_ = duration;
+        if (engine) {
+            telemetry_pub->addBackendPost(engine);
+            telemetry.posted_ = true;
+        }
     } else if (stat_status == NIXL_TELEMETRY_POST_AND_FINISH) {
         telemetry.postDuration_ = duration;
         telemetry.xferDuration_ = duration;
         telemetry_pub->addPostTime(duration);
         telemetry_pub->addXferTime(duration, backendOp == NIXL_WRITE, telemetry.totalBytes);
+        telemetry_pub->addXferClassTime(engine, remoteAgent, duration, telemetry.totalBytes);
+        if (engine) {
+            telemetry_pub->addBackendXfer(engine, duration, false);
+        }
     } else { // stat_status == NIXL_TELEMETRY_FINISH
         telemetry.xferDuration_ = duration;
         telemetry_pub->addPostTime(telemetry.postDuration_);
         telemetry_pub->addXferTime(duration, backendOp == NIXL_WRITE, telemetry.totalBytes);
+        telemetry_pub->addXferClassTime(engine, remoteAgent, duration, telemetry.totalBytes);
+        if (engine) {
+            telemetry_pub->addBackendXfer(engine, duration, telemetry.posted_);
+            telemetry.posted_ = false;
+        }
+    }
+
+    // Deadline accounting (see nixl_opt_args_t::deadlineUs): a completion
+    // past its deadline is a miss, whether or not the transfer succeeded
+    if ((deadlineUs != 0) && (stat_status != NIXL_TELEMETRY_POST)) {
+        const uint64_t now_us =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        if (now_us > deadlineUs)
+            telemetry_pub->updateDeadlineMissCount();
     }
 
     NIXL_TRACE << "[NIXL TELEMETRY]: From backend " << engine->getType()
@@ -110,11 +174,28 @@ nixlXferReqH::updateRequestStats(std::unique_ptr<nixlTelemetry> &telemetry_pub,
                << duration.count() << "us.";
 }
 
+nixl_backend_health_t
+nixlBackendH::getHealth() const {
+    return telemetry ? telemetry->getBackendHealth(engine) : NIXL_BACKEND_HEALTH_UNKNOWN;
+}
+
 /*** nixlAgentData constructor/destructor, as part of nixlAgent's ***/
 nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &cfg)
     : name(name),
       config(cfg),
-      lock(cfg.syncMode) {
+      lock(cfg.syncMode),
+      internalPool(cfg.internalPoolSize ? std::make_unique<nixlMemPool>(cfg.internalPoolSize)
+                                        : nullptr),
+      remoteBackends(internalPool.get()),
+      remoteSections(internalPool.get()),
+      remoteMDGen(internalPool.get()),
+      peerSentMDGen(internalPool.get()),
+      remoteMDHash(internalPool.get()),
+      agentNameIds(internalPool.get()),
+      reclaimStop(false),
+      reclaimInFlight(0),
+      pollerStop(false),
+      progressStop(false) {
 #if HAVE_ETCD
     if (getenv("NIXL_ETCD_ENDPOINTS")) {
         useEtcd = true;
@@ -127,21 +208,710 @@ nixlAgentData::nixlAgentData(const std::string &name, const nixlAgentConfig &cfg
     if (name.empty())
         throw std::invalid_argument("Agent needs a name");
 
+    commDoorbell = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (commDoorbell == -1)
+        throw std::runtime_error("eventfd creation failed");
+
     memorySection = new nixlLocalSection();
+    if (cfg.memBudgetSoft || cfg.memBudgetHard)
+        memBudget = std::make_unique<nixlMemBudget>(cfg.memBudgetSoft,
+                                                    cfg.memBudgetHard);
     auto telemetry_env_val = std::getenv(TELEMETRY_ENABLED_VAR);
     auto telemetry_enabled = (telemetry_env_val != nullptr &&
                               (telemetry_env_val[0] == 'y' || telemetry_env_val[0] == 'Y' ||
                                telemetry_env_val[0] == '1'));
-    if (telemetry_enabled) {
-        telemetry_ = std::make_unique<nixlTelemetry>(name, backendEngines);
+    if (!telemetryBuiltIn && telemetry_env_val != nullptr) {
+        NIXL_WARN << "Built with -Ddisable_telemetry=true, ignoring " << TELEMETRY_ENABLED_VAR;
+    } else if (telemetry_enabled) {
+        // The telemetry pool threads inherit the mask applied here
+        nixlScopedThreadAffinity aff(cfg.threadCpuSet);
+        telemetry_ = std::make_unique<nixlTelemetry>(name, backendEngines, memBudget.get(),
+                                                     cfg.telemetryCategories);
     } else if (telemetry_env_val != nullptr) {
         NIXL_WARN << "Invalid NIXL_TELEMETRY_ENABLE environment variable, not enabling telemetry.";
     }
+
+    if (std::getenv(TRACE_DIR_VAR))
+        tracer_ = std::make_unique<nixlTracer>(name);
+}
+
+void
+nixlAgentData::nixlCostModel::addSample(size_t bytes, double us) {
+    size_t cls = 0;
+    for (size_t b = bytes; b > 1; b >>= 1)
+        cls++;
+    cls = std::min(cls, classes.size() - 1);
+
+    classes[cls].count++;
+    classes[cls].sumUs   += us;
+    classes[cls].sumSqUs += us * us;
+
+    n     += 1;
+    sumX  += (double) bytes;
+    sumY  += us;
+    sumXX += (double) bytes * (double) bytes;
+    sumXY += (double) bytes * us;
+}
+
+nixl_status_t
+nixlAgentData::nixlCostModel::estimate(size_t bytes,
+                                       std::chrono::microseconds &duration,
+                                       std::chrono::microseconds &err_margin) const {
+    size_t cls = 0;
+    for (size_t b = bytes; b > 1; b >>= 1)
+        cls++;
+    cls = std::min(cls, classes.size() - 1);
+
+    // A populated size class answers directly with its mean and spread
+    if (classes[cls].count > 0) {
+        double mean = classes[cls].sumUs / classes[cls].count;
+        double var  = classes[cls].sumSqUs / classes[cls].count - mean * mean;
+        duration   = microseconds((int64_t) mean);
+        err_margin = microseconds((int64_t) std::sqrt(std::max(var, 0.0)));
+        return NIXL_SUCCESS;
+    }
+
+    // Otherwise interpolate on the latency + size/bandwidth line fitted
+    // across all recorded sizes
+    double det = n * sumXX - sumX * sumX;
+    if ((n < 2) || (det <= 0))
+        return NIXL_ERR_NOT_SUPPORTED;
+    double slope     = (n * sumXY - sumX * sumY) / det;
+    double intercept = (sumY - slope * sumX) / n;
+    double est = std::max(intercept + slope * (double) bytes, 0.0);
+    duration   = microseconds((int64_t) est);
+    // Extrapolated rather than observed, so keep a generous margin
+    err_margin = microseconds((int64_t) (est / 2));
+    return NIXL_SUCCESS;
+}
+
+// Called on transfer completion where telemetry recorded the timing
+void
+nixlAgentData::recordXferSample(const nixlXferReqH* req_hndl) {
+    cost_model_key_t key{req_hndl->engine,
+                         req_hndl->initiatorDescs->getType(),
+                         req_hndl->targetDescs->getType()};
+    std::lock_guard<std::mutex> guard(costModelLock);
+    costModels[key].addSample(req_hndl->telemetry.totalBytes,
+                              (double) req_hndl->telemetry.xferDuration_.count());
+}
+
+// Token-bucket admission for one post (see setXferRateLimit); refills
+// lazily from the wall clock on each check, so no timer is needed
+bool
+nixlAgentData::admitXferBytes(const std::string &remote_agent,
+                              nixl_xfer_priority_t prio, size_t bytes) {
+    std::lock_guard<std::mutex> guard(rateLimitLock);
+    auto it = rateLimits.find({remote_agent, prio});
+    if (it == rateLimits.end())
+        return true;
+
+    nixlTokenBucket &bucket = it->second;
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - bucket.lastRefill).count();
+    bucket.lastRefill = now;
+    bucket.tokens = std::min((int64_t) bucket.burstBytes,
+                             bucket.tokens +
+                                 (int64_t) (elapsed * bucket.bytesPerSec));
+    if (bucket.tokens <= 0)
+        return false;
+    bucket.tokens -= (int64_t) bytes;
+    return true;
+}
+
+// Evicts idle prepped-dlist cache entries whose metadata may have changed:
+// the local ones for "" (a deregistration), or those of one remote agent (a
+// metadata invalidation). Held references stay valid until released, like
+// any other handle whose section changed underneath it.
+void
+nixlAgentData::flushDlistCache(const std::string &agent) {
+    std::lock_guard<std::mutex> guard(dlistCacheLock);
+    for (auto it = dlistCache.begin(); it != dlistCache.end();) {
+        if ((it->second.agent == agent) && (it->second.refCount == 0)) {
+            delete it->second.handle;
+            it = dlistCache.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Tags freshly registered descriptors under a named group; caller holds
+// the exclusive agent lock
+void
+nixlAgentData::addRegGroupDescs(const std::string &label,
+                                const nixl_reg_dlist_t &descs) {
+    regGroupEntry &group = regGroups[label];
+    const nixl_mem_t nixl_mem = descs.getType();
+    auto &dlist = group.descs[nixl_mem];
+    if (!dlist)
+        dlist = std::make_unique<nixl_reg_dlist_t>(nixl_mem, true);
+    for (const auto &desc : descs)
+        if (dlist->getIndex(desc) < 0)
+            dlist->addDesc(desc);
+    group.cachedValid = false;
+}
+
+// Drops deregistered descriptors from every group holding them, so group
+// publishes never reference descriptors that left the local section
+void
+nixlAgentData::remRegGroupDescs(const nixl_reg_dlist_t &descs) {
+    for (auto &[label, group] : regGroups) {
+        auto &dlist = group.descs[descs.getType()];
+        if (!dlist)
+            continue;
+        for (const auto &desc : descs) {
+            int index = dlist->getIndex(desc);
+            if (index >= 0) {
+                dlist->remDesc(index);
+                group.cachedValid = false;
+            }
+        }
+    }
+}
+
+// Backend changes can alter a group's serialized form (backend sets,
+// connection info), so the cached fragments are rebuilt on next publish
+void
+nixlAgentData::flushRegGroupMDCache() {
+    for (auto &[label, group] : regGroups)
+        group.cachedValid = false;
+}
+
+uint32_t
+nixlAgentData::internAgentName(const std::string &remote_name) {
+    auto it = agentNameIds.find(remote_name);
+    if (it != agentNameIds.end())
+        return it->second;
+
+    uint32_t id = (uint32_t) remoteSlots.size();
+    agentNameIds.emplace(remote_name, id);
+    remoteSlots.emplace_back();
+
+    // Republish the lock-free read-side view (see agentIdSnapshot)
+    auto snapshot = std::make_shared<agent_id_map_t>(agentNameIds.begin(),
+                                                     agentNameIds.end());
+    std::atomic_store_explicit(&agentIdSnapshot,
+                               std::shared_ptr<const agent_id_map_t>(
+                                   std::move(snapshot)),
+                               std::memory_order_release);
+    return id;
+}
+
+int32_t
+nixlAgentData::getAgentId(const std::string &remote_name) const {
+    auto it = agentNameIds.find(remote_name);
+    return (it == agentNameIds.end()) ? -1 : (int32_t) it->second;
+}
+
+// Lock-free name resolution off the RCU snapshot; -1 means no metadata
+// was ever loaded from that agent
+int32_t
+nixlAgentData::lookupAgentId(const std::string &remote_name) const {
+    auto snap = std::atomic_load_explicit(&agentIdSnapshot,
+                                          std::memory_order_acquire);
+    if (!snap)
+        return -1;
+    auto it = snap->find(remote_name);
+    return (it == snap->end()) ? -1 : (int32_t) it->second;
+}
+
+// Detaches an invalidated remote's slot; the id stays assigned so a
+// later reload of the same agent reuses it
+void
+nixlAgentData::clearRemoteSlot(const std::string &remote_name) {
+    int32_t id = getAgentId(remote_name);
+    if (id < 0)
+        return;
+
+    remoteAgentSlot &slot = remoteSlots[id];
+    slot.section = nullptr;
+    for (auto &cands : slot.xferTable)
+        cands.clear();
+
+    std::lock_guard<std::mutex> lock(remoteLRULock);
+    slot.lruTick = 0;
+    slot.demotedEngine = nullptr;
+}
+
+// Rebuilds one remote agent's backend dispatch table from the current
+// section backend sets; caller holds the exclusive agent lock
+void
+nixlAgentData::rebuildXferBackendTable(const std::string &remote_name) {
+    auto sec_it = remoteSections.find(remote_name);
+    if (sec_it == remoteSections.end()) {
+        clearRemoteSlot(remote_name);
+        return;
+    }
+
+    remoteAgentSlot &slot = remoteSlots[internAgentName(remote_name)];
+    slot.section = sec_it->second;
+
+    xfer_backend_table_t &table = slot.xferTable;
+    for (size_t lmem = 0; lmem < XFER_TABLE_DIM; ++lmem) {
+        backend_set_t *local_set =
+            memorySection->queryBackends(static_cast<nixl_mem_t>(lmem));
+        for (size_t rmem = 0; rmem < XFER_TABLE_DIM; ++rmem) {
+            backend_list_t &cands = table[lmem * XFER_TABLE_DIM + rmem];
+            cands.clear();
+
+            backend_set_t *remote_set =
+                sec_it->second->queryBackends(static_cast<nixl_mem_t>(rmem));
+            if (!local_set || !remote_set)
+                continue;
+
+            for (auto &elm : *local_set)
+                if (remote_set->count(elm) != 0)
+                    cands.push_back(elm);
+        }
+    }
+}
+
+void
+nixlAgentData::rebuildXferBackendTables() {
+    for (auto &it : remoteSections)
+        rebuildXferBackendTable(it.first);
+}
+
+const backend_list_t*
+nixlAgentData::lookupXferBackends(int32_t agent_id,
+                                  const nixl_mem_t &local_mem,
+                                  const nixl_mem_t &remote_mem) const {
+    if (local_mem < DRAM_SEG || local_mem > FILE_SEG ||
+        remote_mem < DRAM_SEG || remote_mem > FILE_SEG)
+        return nullptr;
+
+    if (agent_id < 0 || (size_t) agent_id >= remoteSlots.size())
+        return nullptr;
+    return &remoteSlots[agent_id].xferTable[local_mem * XFER_TABLE_DIM +
+                                            remote_mem];
+}
+
+nixlXferReqH*
+nixlAgentData::acquireXferReqH() {
+    {
+        std::lock_guard<std::mutex> guard(xferReqPoolLock);
+        if (!xferReqPool.empty()) {
+            nixlXferReqH* req_hndl = xferReqPool.back();
+            xferReqPool.pop_back();
+            return req_hndl;
+        }
+    }
+    return new nixlXferReqH;
+}
+
+void
+nixlAgentData::recycleXferReqH(nixlXferReqH* req_hndl) {
+    if (!req_hndl)
+        return;
+    // Make sure the completion poller is done with the request before its
+    // backend handle goes away; reset() clears the polled flag
+    if (req_hndl->polled)
+        pollerRemove(req_hndl);
+    // Hand back the in-flight health count if the request never finished
+    if (telemetryBuiltIn && telemetry_ && req_hndl->telemetry.posted_)
+        req_hndl->updateRequestStats(telemetry_, NIXL_TELEMETRY_ABORT);
+    // One-shot registrations made for this request (see
+    // nixl_opt_args_t::tempReg) are returned through the reclamation
+    // thread so recycling never stalls on driver unpins
+    if (req_hndl->tempRegDescs) {
+        std::shared_ptr<nixl_reg_dlist_t> descs(std::move(req_hndl->tempRegDescs));
+        enqueueReclaimTask([this, descs]() { deregisterOneShot(*descs); });
+    }
+    // Releases the backend handle and clears per-transfer state,
+    // keeping the descriptor list storage for the next user
+    req_hndl->reset();
+    {
+        std::lock_guard<std::mutex> guard(xferReqPoolLock);
+        if (xferReqPool.size() < XFER_REQ_POOL_CAP) {
+            xferReqPool.push_back(req_hndl);
+            return;
+        }
+    }
+    delete req_hndl;
+}
+
+void
+nixlAgentData::enqueueReclaim(std::vector<std::pair<nixlBackendEngine*,
+                                                    nixlBackendMD*>> &&mds) {
+    std::unique_lock<std::mutex> lk(reclaimLock);
+    if (!reclaimThread.joinable())
+        reclaimThread = std::thread(&nixlAgentData::reclaimWorker, this);
+    for (auto & [backend, md] : mds)
+        reclaimQueue.emplace_back([backend, md] { backend->deregisterMem(md); });
+    lk.unlock();
+    reclaimCv.notify_all();
+}
+
+// Undo of a one-shot registration (see nixl_opt_args_t::tempReg),
+// executed on the reclamation thread: mirrors the section side of
+// deregisterMem for every backend serving the memory type; nested
+// one-shot ranges only drop a reference on the enclosing block's MD
+void
+nixlAgentData::deregisterOneShot(const nixl_reg_dlist_t &descs) {
+    NIXL_LOCK_GUARD(lock);
+    backend_set_t* avail_backends = memorySection->queryBackends(descs.getType());
+    if (!avail_backends || avail_backends->empty())
+        return;
+    // Make a copy as remDescList might change it
+    backend_set_t backend_set = *avail_backends;
+    for (auto & backend : backend_set)
+        memorySection->remDescList(descs, backend);
+
+    // Cached local prepped lists may point at the removed metadata
+    flushDlistCache(NIXL_INIT_AGENT);
+    rebuildXferBackendTables();
+    mdEpoch.fetch_add(1, std::memory_order_release);
+}
+
+// First-use side of lazy registration (see nixl_opt_args_t::lazyReg):
+// replays the candidate walk of createXferReq and only turns an intent
+// into a real registration when the transfer would otherwise have no
+// backend serving its local side. Intents for backends no transfer ever
+// needs are never pinned.
+nixl_status_t
+nixlAgentData::materializePendingRegs(const nixl_xfer_dlist_view_t &local_descs,
+                                      const nixl_xfer_dlist_view_t &remote_descs,
+                                      const std::string &remote_agent,
+                                      const nixl_opt_args_t *extra_params) {
+    NIXL_LOCK_GUARD(lock);
+    if (pendingRegs.empty())
+        return NIXL_SUCCESS;
+
+    const int32_t remote_id = getAgentId(remote_agent);
+    nixlRemoteSection *remote_sec =
+        (remote_id < 0) ? nullptr : remoteSlots[remote_id].section;
+    if (!remote_sec)
+        return NIXL_ERR_NOT_FOUND;
+
+    const backend_list_t* backend_list;
+    backend_list_t        hinted_backends;
+    if (!extra_params || extra_params->backends.size() == 0) {
+        backend_list = lookupXferBackends(remote_id,
+                                          local_descs.getType(),
+                                          remote_descs.getType());
+    } else {
+        for (auto & elm : extra_params->backends)
+            if (std::find(hinted_backends.begin(), hinted_backends.end(),
+                          elm->engine) == hinted_backends.end())
+                hinted_backends.push_back(elm->engine);
+        backend_list = &hinted_backends;
+    }
+    if (!backend_list || backend_list->empty())
+        return NIXL_ERR_NOT_FOUND;
+
+    nixl_meta_dlist_t local_meta (local_descs.getType(),  local_descs.isSorted());
+    nixl_meta_dlist_t remote_meta (remote_descs.getType(), remote_descs.isSorted());
+
+    for (auto & backend : *backend_list) {
+        nixl_status_t ret1 = memorySection->populate(local_descs, backend,
+                                                     local_meta);
+        nixl_status_t ret2 = remote_sec->populate(remote_descs, backend,
+                                                  remote_meta);
+        if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS))
+            // An already-pinned backend serves both sides; nothing to do
+            return NIXL_SUCCESS;
+        if ((ret1 == NIXL_SUCCESS) || (ret2 != NIXL_SUCCESS))
+            continue;
+
+        // The remote side is reachable through this backend but the local
+        // buffers are not pinned with it; materialize the covering intents
+        bool materialized = false;
+        for (auto it = pendingRegs.begin(); it != pendingRegs.end();) {
+            int  idx;
+            bool covers = (it->backend == backend);
+            for (int i = 0; covers && (i < local_descs.descCount()); ++i)
+                covers = it->descs.overlaps(
+                             nixlBlobDesc(local_descs[i], nixl_blob_t()), idx);
+            if (!covers) {
+                ++it;
+                continue;
+            }
+            nixl_sec_dlist_t sec_descs(it->descs.getType(), false);
+            nixl_status_t b_ret = memorySection->addDescList(
+                it->descs, backend, sec_descs, it->hints);
+            if (b_ret == NIXL_SUCCESS && backend->supportsLocal()) {
+                if (remoteSections.count(name) == 0)
+                    remoteSections[name] = new nixlRemoteSection(name);
+                b_ret = remoteSections[name]->loadLocalData(sec_descs, backend);
+                if (b_ret != NIXL_SUCCESS)
+                    memorySection->remDescList(it->descs, backend);
+            }
+            if (b_ret != NIXL_SUCCESS) {
+                NIXL_WARN << "Failed to materialize lazy registration with backend "
+                          << backend->getType() << " status " << b_ret;
+                ++it;
+                continue;
+            }
+            it = pendingRegs.erase(it);
+            materialized = true;
+        }
+        if (materialized) {
+            pendingRegCount.store(pendingRegs.size(), std::memory_order_release);
+            rebuildXferBackendTables();
+            mdEpoch.fetch_add(1, std::memory_order_release);
+            return NIXL_SUCCESS;
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
+void
+nixlAgentData::enqueueReclaimTask(std::function<void()> &&task) {
+    std::unique_lock<std::mutex> lk(reclaimLock);
+    if (!reclaimThread.joinable())
+        reclaimThread = std::thread(&nixlAgentData::reclaimWorker, this);
+    reclaimQueue.push_back(std::move(task));
+    lk.unlock();
+    reclaimCv.notify_all();
+}
+
+void
+nixlAgentData::reclaimWorker() {
+    nixlApplyThreadAffinity(config.threadCpuSet);
+    std::unique_lock<std::mutex> lk(reclaimLock);
+    while (true) {
+        reclaimCv.wait(lk, [this] { return reclaimStop || !reclaimQueue.empty(); });
+        if (reclaimQueue.empty()) {
+            // Drained; only exit once no more work can arrive
+            if (reclaimStop)
+                return;
+            continue;
+        }
+
+        std::vector<std::function<void()>> batch;
+        batch.swap(reclaimQueue);
+        reclaimInFlight = batch.size();
+        lk.unlock();
+
+        // The slow part (driver unpinning, connection shutdown) runs
+        // without the lock held
+        for (auto &task : batch)
+            task();
+
+        lk.lock();
+        reclaimInFlight = 0;
+        reclaimCv.notify_all();
+    }
+}
+
+void
+nixlAgentData::enqueuePoll(nixlXferReqH* req_hndl) {
+    req_hndl->pollStatus.store(NIXL_IN_PROG, std::memory_order_release);
+    req_hndl->polled = true;
+    std::unique_lock<std::mutex> lk(pollerLock);
+    if (!pollerThread.joinable())
+        pollerThread = std::thread(&nixlAgentData::pollerWorker, this);
+    polledReqs.push_back(req_hndl);
+    lk.unlock();
+    pollerCv.notify_all();
+}
+
+void
+nixlAgentData::pollerRemove(nixlXferReqH* req_hndl) {
+    // The poller holds pollerLock across a sweep, so after this returns it
+    // will not touch the request again
+    std::lock_guard<std::mutex> guard(pollerLock);
+    polledReqs.erase(std::remove(polledReqs.begin(), polledReqs.end(), req_hndl),
+                     polledReqs.end());
+}
+
+nixl_status_t
+nixlAgentData::armXferCallback(nixlXferReqH* req_hndl,
+                               std::function<void(nixl_status_t)> &&cb) {
+    std::unique_lock<std::mutex> lk(pollerLock);
+    if (req_hndl->polled) {
+        // The poller owns completion; re-check under pollerLock so a sweep
+        // finishing between the caller's status check and here is not missed
+        nixl_status_t ret =
+            req_hndl->pollStatus.load(std::memory_order_acquire);
+        if (ret != NIXL_IN_PROG)
+            return ret;
+        req_hndl->doneCb = std::move(cb);
+        return NIXL_IN_PROG;
+    }
+
+    // Not polled yet: the caller verified NIXL_IN_PROG under the agent
+    // lock, so hand the request to the poller with the callback armed
+    req_hndl->doneCb = std::move(cb);
+    req_hndl->pollStatus.store(NIXL_IN_PROG, std::memory_order_release);
+    req_hndl->polled = true;
+    if (!pollerThread.joinable())
+        pollerThread = std::thread(&nixlAgentData::pollerWorker, this);
+    polledReqs.push_back(req_hndl);
+    lk.unlock();
+    pollerCv.notify_all();
+    return NIXL_IN_PROG;
+}
+
+void
+nixlAgentData::enrollProgressEngine(nixlBackendEngine* engine) {
+    std::lock_guard<std::mutex> guard(progressLock);
+    progressEngines.push_back(engine);
+    // Threads start with the first enrollee, so agents that never create
+    // an externally progressable backend pay nothing
+    if (progressThreads.empty())
+        for (unsigned int i = 0; i < config.numProgressThreads; ++i)
+            progressThreads.emplace_back(&nixlAgentData::progressWorker, this,
+                                         (size_t) i);
+}
+
+void
+nixlAgentData::progressWorker(size_t thread_idx) {
+    nixlApplyThreadAffinity(config.threadCpuSet);
+
+    // Per-engine polling stride for the WEIGHTED schedule: idle engines
+    // back off exponentially and snap back once work reappears
+    std::vector<uint64_t> strides;
+    uint64_t pass = 0;
+
+    while (true) {
+        std::vector<nixlBackendEngine*> engines;
+        {
+            std::lock_guard<std::mutex> guard(progressLock);
+            if (progressStop)
+                return;
+            engines = progressEngines;
+        }
+        strides.resize(engines.size(), 1);
+
+        bool any_work = false;
+        for (size_t i = 0; i < engines.size(); ++i) {
+            // Threads start at different offsets so they don't hit the
+            // same backend's worker in lockstep
+            size_t slot = (i + thread_idx) % engines.size();
+
+            switch (config.progressSched) {
+            case nixl_progress_sched_t::NIXL_PROGRESS_SCHED_PRIORITY:
+                // Creation order is the preference order: engine k is
+                // progressed only every (k+1)-th pass
+                if (pass % (slot + 1) != 0)
+                    continue;
+                break;
+            case nixl_progress_sched_t::NIXL_PROGRESS_SCHED_WEIGHTED:
+                if (pass % strides[slot] != 0)
+                    continue;
+                break;
+            default:
+                break;
+            }
+
+            int count = engines[slot]->progress();
+            if (count > 0) {
+                any_work = true;
+                strides[slot] = 1;
+            } else if (strides[slot] < 64) {
+                strides[slot] *= 2;
+            }
+        }
+        ++pass;
+
+        // An idle sweep backs off like the backends' own progress threads
+        // would, keeping the poller set off the bus when nothing moves
+        if (!any_work) {
+            if (config.pthrDelay > 0)
+                std::this_thread::sleep_for(
+                    std::chrono::microseconds(config.pthrDelay));
+            else
+                std::this_thread::yield();
+        }
+    }
+}
+
+void
+nixlAgentData::pollerWorker() {
+    nixlApplyThreadAffinity(config.threadCpuSet);
+
+    std::vector<std::pair<std::function<void(nixl_status_t)>,
+                          nixl_status_t>> fired;
+
+    std::unique_lock<std::mutex> lk(pollerLock);
+    while (true) {
+        pollerCv.wait(lk, [this] { return pollerStop || !polledReqs.empty(); });
+        if (pollerStop)
+            return;
+
+        // Shared try-lock: threads holding the agent lock may be blocked on
+        // pollerLock in pollerRemove, so waiting here could deadlock behind
+        // a pending writer. On failure just retry the sweep.
+        if (lock.try_lock_shared()) {
+            for (auto it = polledReqs.begin(); it != polledReqs.end();) {
+                nixlXferReqH* req = *it;
+                nixl_status_t ret = req->engine->checkXfer(req->backendHandle);
+                req->pollStatus.store(ret, std::memory_order_release);
+                if (ret != NIXL_IN_PROG) {
+                    if (req->doneCb)
+                        fired.emplace_back(std::move(req->doneCb), ret);
+                    req->doneCb = nullptr;
+                    it = polledReqs.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            lock.unlock_shared();
+        }
+
+        // Callbacks run outside both locks: they may resume coroutines or
+        // call back into the agent (e.g. releaseXferReq -> pollerRemove)
+        if (!fired.empty()) {
+            lk.unlock();
+            for (auto & f : fired)
+                f.first(f.second);
+            fired.clear();
+            lk.lock();
+        }
+
+        if (!polledReqs.empty()) {
+            lk.unlock();
+            std::this_thread::yield();
+            lk.lock();
+        }
+    }
 }
 
 nixlAgentData::~nixlAgentData() {
+    // Progress threads dereference enrolled engines, stop them before any
+    // backend teardown below
+    if (!progressThreads.empty()) {
+        {
+            std::lock_guard<std::mutex> guard(progressLock);
+            progressStop = true;
+        }
+        for (auto & thread : progressThreads)
+            thread.join();
+    }
+
+    if (pollerThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(pollerLock);
+            pollerStop = true;
+        }
+        pollerCv.notify_all();
+        pollerThread.join();
+    }
+
+    if (reclaimThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(reclaimLock);
+            reclaimStop = true;
+        }
+        reclaimCv.notify_all();
+        reclaimThread.join();
+    }
+
+    close(commDoorbell);
+
     delete memorySection;
 
+    for (auto & elm: dlistCache)
+        delete elm.second.handle;
+
+    for (auto & elm: ownedAllocs)
+        munmap(elm.first, elm.second.first);
+
+    for (auto & elm: xferReqPool)
+        delete elm;
+
     // explicitly reset telemetry so i can publish backend events before destroying backends
     telemetry_.reset();
 
@@ -150,6 +920,12 @@ nixlAgentData::~nixlAgentData() {
 
     for (auto & elm: backendEngines) {
         auto& plugin_manager = nixlPluginManager::getInstance();
+
+        // Shared engines are refcounted in the plugin manager and torn
+        // down with the last agent using them
+        if (plugin_manager.releaseSharedEngine(elm.second, name))
+            continue;
+
         auto plugin_handle = plugin_manager.getPlugin(elm.second->getType());
 
         if (plugin_handle) {
@@ -184,6 +960,7 @@ nixlAgent::nixlAgent(const std::string &name, const nixlAgentConfig &cfg) :
 nixlAgent::~nixlAgent() {
     if (data && (data->useEtcd || data->config.useListenThread)) {
         data->commThreadStop = true;
+        data->wakeCommThread();
         if(data->commThread.joinable()) data->commThread.join();
 
         // Close remaining connections from comm thread
@@ -288,38 +1065,138 @@ nixlAgent::createBackend(const nixl_backend_t &type,
     init_params.localAgent = data->name;
     init_params.type = type;
     init_params.customParams = const_cast<nixl_b_params_t *>(&params);
-    init_params.enableProgTh = data->config.useProgThread;
+
+    // The agent-wide thread cpuset reaches backend-created threads as a
+    // backend parameter; explicit per-backend "thread_cpuset" wins
+    nixl_b_params_t eff_params;
+    if (!data->config.threadCpuSet.empty() && params.count("thread_cpuset") == 0) {
+        eff_params = params;
+        eff_params["thread_cpuset"] = data->config.threadCpuSet;
+        init_params.customParams = &eff_params;
+    }
+    // With an agent-owned progress engine (numProgressThreads), backends
+    // that can be progressed externally are not asked to spawn their own
+    // thread; they enroll with the agent's poller set below instead
+    init_params.enableProgTh =
+        data->config.useProgThread && (data->config.numProgressThreads == 0);
     init_params.pthrDelay = data->config.pthrDelay;
     init_params.syncMode = data->config.syncMode;
     init_params.enableTelemetry_ = data->telemetry_ != nullptr;
+    init_params.memBudget = data->memBudget.get();
+
+    // Backends without a GPUDirect path can request the shared pinned
+    // staging pool; it is created on first request and its geometry is
+    // fixed then, later requesters reuse the same pool
+    if (params.count("staging_pool") && std::stoi(params.at("staging_pool")) != 0) {
+        if (!data->stagingPool) {
+            size_t buf_size = params.count("staging_buf_size") ?
+                                  std::stoul(params.at("staging_buf_size")) :
+                                  16 * 1024 * 1024;
+            size_t buf_count = params.count("staging_buf_count") ?
+                                   std::stoul(params.at("staging_buf_count")) :
+                                   4;
+            // Two buffers minimum for the double-buffered drain helpers
+            buf_count = std::max(buf_count, (size_t) 2);
+            if (data->memBudget && !data->memBudget->reserve(buf_size * buf_count)) {
+                NIXL_ERROR << "Staging pool for backend " << type
+                           << " would cross the agent memory budget ("
+                           << data->memBudget->hardWatermark() << " bytes)";
+                return NIXL_ERR_BACKEND;
+            }
+            data->stagingPool =
+                std::make_unique<nixlStagingPool>(buf_size, buf_count);
+            if (data->stagingPool->bufCount() < 2) {
+                NIXL_ERROR << "Failed to allocate staging pool for backend: "
+                           << type;
+                data->stagingPool.reset();
+                if (data->memBudget)
+                    data->memBudget->release(buf_size * buf_count);
+                return NIXL_ERR_BACKEND;
+            }
+        }
+        init_params.stagingPool = data->stagingPool.get();
+    }
+
+    // Storage backends can request the shared read cache tier
+    // (block_cache_size in bytes); it is created on first request with
+    // that capacity, later requesters reuse the same cache
+    if (params.count("block_cache_size") && std::stoul(params.at("block_cache_size")) != 0) {
+        if (!data->blockCache) {
+            size_t cache_size = std::stoul(params.at("block_cache_size"));
+            if (data->memBudget && !data->memBudget->reserve(cache_size)) {
+                NIXL_ERROR << "Block cache for backend " << type
+                           << " would cross the agent memory budget ("
+                           << data->memBudget->hardWatermark() << " bytes)";
+                return NIXL_ERR_BACKEND;
+            }
+            data->blockCache = std::make_unique<nixlBlockCache>(cache_size);
+        }
+        init_params.blockCache = data->blockCache.get();
+    }
 
     // First, try to load the backend as a plugin
     auto& plugin_manager = nixlPluginManager::getInstance();
-    auto plugin_handle = plugin_manager.loadPlugin(type);
 
-    if (plugin_handle) {
-        // Plugin found, use it to create the backend
-        backend = plugin_handle->createEngine(&init_params);
-    } else {
-        NIXL_ERROR << "Unsupported backend: " << type;
-        return NIXL_ERR_NOT_FOUND;
+    // One engine instance can serve several agents of this process when
+    // they pass the same "shared_instance" key (see
+    // supportsSharedInstance), sharing its NIC resources, registrations
+    // and progress threads across co-located replicas
+    const auto shared_it = params.find("shared_instance");
+    bool reused_shared = false;
+    if (shared_it != params.end()) {
+        backend = plugin_manager.lookupSharedEngine(shared_it->second, type);
+        reused_shared = (backend != nullptr);
+    }
+
+    if (!backend) {
+        auto plugin_handle = plugin_manager.loadPlugin(type);
+
+        if (plugin_handle) {
+            // Plugin found, use it to create the backend. Threads the backend
+            // spawns during construction (progress threads, pool workers)
+            // inherit the cpuset applied here, covering plugins that don't
+            // parse "thread_cpuset" themselves
+            const auto cpuset_it = init_params.customParams->find("thread_cpuset");
+            nixlScopedThreadAffinity aff(
+                cpuset_it != init_params.customParams->end() ? cpuset_it->second : "");
+            backend = plugin_handle->createEngine(&init_params);
+        } else {
+            NIXL_ERROR << "Unsupported backend: " << type;
+            return NIXL_ERR_NOT_FOUND;
+        }
     }
 
     if (backend) {
-        if (backend->getInitErr()) {
+        if (reused_shared) {
+            // Give this agent its own namespace in the shared engine
+            ret = backend->addLocalAgent(data->name);
+            if (ret != NIXL_SUCCESS) {
+                plugin_manager.releaseSharedEngine(backend, data->name);
+                return ret;
+            }
+        } else if (backend->getInitErr()) {
             delete backend;
             return NIXL_ERR_BACKEND;
+        } else if (shared_it != params.end()) {
+            if (backend->supportsSharedInstance()) {
+                plugin_manager.registerSharedEngine(shared_it->second, backend);
+            } else {
+                NIXL_WARN << "Backend " << type
+                          << " does not support shared instances, creating a private one";
+            }
         }
 
         if (backend->supportsRemote()) {
             if (!backend->supportsNotif()) {
-                delete backend;
+                if (!plugin_manager.releaseSharedEngine(backend, data->name))
+                    delete backend;
                 return NIXL_ERR_BACKEND;
             }
 
             ret = backend->getConnInfo(str);
             if (ret != NIXL_SUCCESS) {
-                delete backend;
+                if (!plugin_manager.releaseSharedEngine(backend, data->name))
+                    delete backend;
                 return ret;
             }
             data->connMD[type] = str;
@@ -329,16 +1206,19 @@ nixlAgent::createBackend(const nixl_backend_t &type,
             ret = backend->connect(data->name);
 
             if (NIXL_SUCCESS != ret) {
-                delete backend;
+                if (!plugin_manager.releaseSharedEngine(backend, data->name))
+                    delete backend;
                 return ret;
             }
         }
 
         bknd_hndl = new nixlBackendH(backend);
         if (!bknd_hndl) {
-            delete backend;
+            if (!plugin_manager.releaseSharedEngine(backend, data->name))
+                delete backend;
             return NIXL_ERR_BACKEND;
         }
+        bknd_hndl->telemetry = data->telemetry_.get();
 
         data->backendEngines[type] = backend;
         data->backendHandles[type] = bknd_hndl;
@@ -353,11 +1233,17 @@ nixlAgent::createBackend(const nixl_backend_t &type,
         if (backend->supportsRemote())
             data->notifEngines.push_back(backend);
 
-        // TODO: Check if backend supports ProgThread
-        //       when threading is in agent
+        if ((data->config.numProgressThreads > 0) && backend->supportsProgTh())
+            data->enrollProgressEngine(backend);
+
+        // The new engine may now serve mem-type pairs for known remotes,
+        // and cached group fragments may miss its connection info
+        data->rebuildXferBackendTables();
+        data->flushRegGroupMDCache();
 
         NIXL_DEBUG << "Created backend: " << type;
 
+        data->mdEpoch.fetch_add(1, std::memory_order_release);
         return NIXL_SUCCESS;
     }
 
@@ -376,12 +1262,38 @@ nixlAgent::queryMem(const nixl_reg_dlist_t &descs,
     return extra_params->backends[0]->engine->queryMem(descs, resp);
 }
 
+nixl_status_t
+nixlAgent::queryRegisteredMem(const nixl_xfer_dlist_t &descs,
+                              std::vector<bool> &registered,
+                              const nixl_opt_args_t* extra_params) const {
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    if (!extra_params || extra_params->backends.size() == 0)
+        return data->memorySection->queryCoverage(descs, nullptr, registered);
+
+    // With hints, a descriptor counts as registered when any of the hinted
+    // backends covers it
+    nixl_status_t     ret;
+    std::vector<bool> per_backend;
+
+    registered.assign(descs.descCount(), false);
+    for (auto & elm : extra_params->backends) {
+        ret = data->memorySection->queryCoverage(descs, elm->engine,
+                                                 per_backend);
+        if (ret != NIXL_SUCCESS)
+            return ret;
+        for (size_t i = 0; i < per_backend.size(); ++i)
+            if (per_backend[i])
+                registered[i] = true;
+    }
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
                        const nixl_opt_args_t* extra_params) {
 
     backend_list_t* backend_list;
-    nixl_status_t   ret;
     unsigned int    count = 0;
 
     NIXL_LOCK_GUARD(data->lock);
@@ -395,37 +1307,88 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
             backend_list->push_back(elm->engine);
     }
 
+    // Lazy multi-backend registration (see nixl_opt_args_t::lazyReg): pin
+    // with the preferred backend now and record the rest as intents,
+    // materialized on first use by a transfer those backends must serve
+    backend_list_t lazy_single;
+    std::vector<nixlBackendEngine*> deferred_backends;
+    if (extra_params && extra_params->lazyReg && backend_list->size() > 1) {
+        lazy_single.push_back((*backend_list)[0]);
+        deferred_backends.assign(backend_list->begin() + 1, backend_list->end());
+        if (extra_params->backends.size() > 0)
+            delete backend_list;
+        backend_list = &lazy_single;
+    }
+
     // Best effort, if at least one succeeds NIXL_SUCCESS is returned
     // Can become more sophisticated to have a soft error case
-    for (size_t i=0; i<backend_list->size(); ++i) {
+    // Registration cost is dominated by per-backend driver calls (page
+    // pinning, GPU address-range handles) that are independent across
+    // engines, so backends register concurrently while the shared self
+    // remote section updates stay serialized.
+    std::vector<nixl_status_t> backend_ret(backend_list->size(), NIXL_ERR_BACKEND);
+    std::mutex self_section_lock;
+
+    auto register_with_backend = [&](size_t i) {
         nixlBackendEngine* backend = (*backend_list)[i];
         // meta_descs use to be passed to loadLocalData
         nixl_sec_dlist_t sec_descs(descs.getType(), false);
-        ret = data->memorySection->addDescList(descs, backend, sec_descs);
-        if (ret == NIXL_SUCCESS) {
-            if (backend->supportsLocal()) {
-                if (data->remoteSections.count(data->name) == 0)
-                    data->remoteSections[data->name] =
-                          new nixlRemoteSection(data->name);
-
-                ret = data->remoteSections[data->name]->loadLocalData(
-                                                        sec_descs, backend);
-                if (ret == NIXL_SUCCESS)
-                    count++;
-                else
-                    data->memorySection->remDescList(descs, backend);
-            } else {
-                count++;
-            }
-        } // a bad_ret can be saved in an else
+        nixl_status_t b_ret = data->memorySection->addDescList(
+            descs, backend, sec_descs,
+            extra_params ? extra_params->regHints : nixl_reg_hints_t());
+        if (b_ret == NIXL_SUCCESS && backend->supportsLocal()) {
+            std::lock_guard<std::mutex> guard(self_section_lock);
+            if (data->remoteSections.count(data->name) == 0)
+                data->remoteSections[data->name] =
+                      new nixlRemoteSection(data->name);
+
+            b_ret = data->remoteSections[data->name]->loadLocalData(
+                                                      sec_descs, backend);
+            if (b_ret != NIXL_SUCCESS)
+                data->memorySection->remDescList(descs, backend);
+        }
+        if (b_ret != NIXL_SUCCESS)
+            NIXL_WARN << "Failed to register memory with backend " << backend->getType()
+                      << " status " << b_ret;
+        backend_ret[i] = b_ret;
+    };
+
+    if (backend_list->size() == 1) {
+        register_with_backend(0);
+    } else {
+        std::vector<std::thread> workers;
+        workers.reserve(backend_list->size());
+        for (size_t i=0; i<backend_list->size(); ++i)
+            workers.emplace_back(register_with_backend, i);
+        for (auto & worker : workers)
+            worker.join();
     }
 
-    if (extra_params && extra_params->backends.size() > 0)
+    for (const auto & b_ret : backend_ret)
+        if (b_ret == NIXL_SUCCESS)
+            count++;
+
+    if (extra_params && extra_params->backends.size() > 0 &&
+        backend_list != &lazy_single)
         delete backend_list;
 
     if (count > 0) {
+        // The local section's backend sets may have grown
+        data->rebuildXferBackendTables();
+
+        // The pinned backend is in place; the rest become intents
+        if (!deferred_backends.empty()) {
+            for (auto *backend : deferred_backends)
+                data->pendingRegs.push_back({backend, descs, extra_params->regHints});
+            data->pendingRegCount.store(data->pendingRegs.size(),
+                                        std::memory_order_release);
+        }
+
+        if (extra_params && !extra_params->regGroup.empty())
+            data->addRegGroupDescs(extra_params->regGroup, descs);
+
         // sum all the sizes of the descriptors using std::accumulate
-        if (data->telemetry_) {
+        if (telemetryBuiltIn && data->telemetry_) {
             uint64_t total_size = std::accumulate(
                 descs.begin(),
                 descs.end(),
@@ -433,50 +1396,403 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
                 [](uint64_t sum, const nixlBlobDesc &desc) { return sum + desc.len; });
             data->telemetry_->updateMemoryRegistered(total_size);
         }
+        data->mdEpoch.fetch_add(1, std::memory_order_release);
         return NIXL_SUCCESS;
     }
     return NIXL_ERR_BACKEND;
 }
 
 nixl_status_t
-nixlAgent::deregisterMem(const nixl_reg_dlist_t &descs,
-                         const nixl_opt_args_t* extra_params) {
-
+nixlAgent::commitMem(const nixl_reg_dlist_t &descs,
+                     const nixl_opt_args_t* extra_params) {
 
-    backend_set_t     backend_set;
-    nixl_status_t     ret, bad_ret=NIXL_SUCCESS;
+    backend_list_t* backend_list;
+    unsigned int    count = 0;
+    nixl_status_t   bad_ret = NIXL_ERR_NOT_FOUND;
 
     NIXL_LOCK_GUARD(data->lock);
     if (!extra_params || extra_params->backends.size() == 0) {
-        backend_set_t* avail_backends;
-        avail_backends = data->memorySection->queryBackends(
-                                              descs.getType());
-        if (!avail_backends || avail_backends->empty())
+        backend_list = &data->memToBackend[descs.getType()];
+        if (backend_list->empty())
             return NIXL_ERR_NOT_FOUND;
-        // Make a copy as we might change it in remDescList
-        backend_set = *avail_backends;
     } else {
+        backend_list = new backend_list_t();
         for (auto & elm : extra_params->backends)
-            backend_set.insert(elm->engine);
+            backend_list->push_back(elm->engine);
     }
 
-    // Doing best effort, and returning err if any
-    for (auto & backend : backend_set) {
-        ret = data->memorySection->remDescList(descs, backend);
-        if (ret != NIXL_SUCCESS)
+    // Best effort across backends like registerMem: the commit lands on
+    // every backend holding a matching reserved registration. No backend
+    // call is involved, the reserve was pinned at registration time.
+    for (auto & backend : *backend_list) {
+        nixl_status_t ret = data->memorySection->growDescList(descs, backend);
+        if (ret == NIXL_SUCCESS) {
+            if (backend->supportsLocal() &&
+                (data->remoteSections.count(data->name) != 0))
+                data->remoteSections[data->name]->growLocalData(descs,
+                                                                backend);
+            count++;
+        } else {
             bad_ret = ret;
-    }
-    if (bad_ret == NIXL_SUCCESS) {
-        if (data->telemetry_) {
-            uint64_t total_size = std::accumulate(
-                descs.begin(),
-                descs.end(),
-                uint64_t{0},
-                [](uint64_t sum, const nixlBlobDesc &desc) { return sum + desc.len; });
-            data->telemetry_->updateMemoryDeregistered(total_size);
         }
     }
-    return bad_ret;
+
+    if (extra_params && extra_params->backends.size() > 0)
+        delete backend_list;
+
+    if (count > 0) {
+        data->mdEpoch.fetch_add(1, std::memory_order_release);
+        return NIXL_SUCCESS;
+    }
+    UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(bad_ret));
+    return bad_ret;
+}
+
+nixl_status_t
+nixlAgent::registerFiles(const std::vector<std::string> &filenames,
+                         int open_flags,
+                         nixl_reg_dlist_t &descs,
+                         const nixl_opt_args_t* extra_params) {
+
+    // The opens and stats fan out across threads (see openFileList); the
+    // section then grows by the whole manifest in a single registerMem
+    std::vector<std::pair<int, size_t>> fds;
+    nixl_status_t ret = nixl::openFileList(filenames, open_flags, fds);
+    if (ret != NIXL_SUCCESS) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret));
+        return ret;
+    }
+
+    descs = nixl_reg_dlist_t(FILE_SEG, false, (int)filenames.size());
+    for (size_t i = 0; i < filenames.size(); ++i) {
+        nixlBlobDesc desc;
+        desc.addr = 0;
+        desc.len = fds[i].second;
+        desc.devId = (uint64_t)fds[i].first;
+        desc.metaInfo = filenames[i];
+        descs[(int)i] = desc;
+    }
+
+    ret = registerMem(descs, extra_params);
+    if (ret != NIXL_SUCCESS) {
+        for (auto &entry : fds)
+            close(entry.first);
+        descs.clear();
+    }
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::deregisterMem(const nixl_reg_dlist_t &descs,
+                         const nixl_opt_args_t* extra_params) {
+
+
+    backend_set_t     backend_set;
+    nixl_status_t     ret, bad_ret=NIXL_SUCCESS;
+
+    NIXL_LOCK_GUARD(data->lock);
+    if (!extra_params || extra_params->backends.size() == 0) {
+        backend_set_t* avail_backends;
+        avail_backends = data->memorySection->queryBackends(
+                                              descs.getType());
+        if (!avail_backends || avail_backends->empty())
+            return NIXL_ERR_NOT_FOUND;
+        // Make a copy as we might change it in remDescList
+        backend_set = *avail_backends;
+    } else {
+        for (auto & elm : extra_params->backends)
+            backend_set.insert(elm->engine);
+    }
+
+    // With deferred teardown the descriptors leave the section now, but the
+    // backends unpin on the reclamation thread so this call doesn't stall
+    const bool defer = extra_params && extra_params->deferTeardown;
+    std::vector<std::pair<nixlBackendEngine*, nixlBackendMD*>> detached;
+
+    // Doing best effort, and returning err if any
+    for (auto & backend : backend_set) {
+        ret = data->memorySection->remDescList(descs, backend,
+                                               defer ? &detached : nullptr);
+        if (ret != NIXL_SUCCESS)
+            bad_ret = ret;
+    }
+
+    if (!detached.empty())
+        data->enqueueReclaim(std::move(detached));
+
+    // Cached local prepped lists may point at the removed metadata
+    data->flushDlistCache(NIXL_INIT_AGENT);
+    data->rebuildXferBackendTables();
+    data->remRegGroupDescs(descs);
+
+    // Intents that never materialized are dropped for free
+    if (!data->pendingRegs.empty()) {
+        data->pendingRegs.erase(
+            std::remove_if(data->pendingRegs.begin(), data->pendingRegs.end(),
+                           [&descs](const nixlAgentData::pendingReg &p) {
+                               return p.descs == descs;
+                           }),
+            data->pendingRegs.end());
+        data->pendingRegCount.store(data->pendingRegs.size(),
+                                    std::memory_order_release);
+    }
+
+    if (bad_ret == NIXL_SUCCESS) {
+        if (telemetryBuiltIn && data->telemetry_) {
+            uint64_t total_size = std::accumulate(
+                descs.begin(),
+                descs.end(),
+                uint64_t{0},
+                [](uint64_t sum, const nixlBlobDesc &desc) { return sum + desc.len; });
+            data->telemetry_->updateMemoryDeregistered(total_size);
+        }
+    }
+    data->mdEpoch.fetch_add(1, std::memory_order_release);
+    return bad_ret;
+}
+
+nixl_status_t
+nixlAgent::exportMem(const nixl_reg_dlist_t &descs,
+                     nixl_blob_t &str,
+                     const nixl_opt_args_t* extra_params) const {
+
+    nixlBackendEngine* backend;
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    if (extra_params && extra_params->backends.size() > 0) {
+        if (extra_params->backends.size() != 1)
+            return NIXL_ERR_INVALID_PARAM;
+        backend = extra_params->backends[0]->engine;
+    } else {
+        backend_set_t* avail_backends;
+        avail_backends = data->memorySection->queryBackends(descs.getType());
+        if (!avail_backends || avail_backends->empty())
+            return NIXL_ERR_NOT_FOUND;
+        // Without a hint the exporter must be unambiguous
+        if (avail_backends->size() != 1)
+            return NIXL_ERR_INVALID_PARAM;
+        backend = *avail_backends->begin();
+    }
+
+    // Resolve the descriptors to the backend MDs behind them; exact
+    // registered blocks only, as the handle stands in for a registration
+    nixl_meta_dlist_t resp(descs.getType(), descs.isSorted());
+    nixl_status_t ret = data->memorySection->populate(descs.trim(), backend,
+                                                      resp);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    // The export blob is the backend type plus the descriptor list with
+    // each metaInfo carrying that descriptor's packed registration handle
+    nixl_reg_dlist_t exp_descs(descs.getType(), descs.isSorted());
+    nixlBlobDesc exp_elm;
+    nixlBasicDesc *p = &exp_elm;
+    for (int i = 0; i < descs.descCount(); ++i) {
+        ret = backend->exportMem(resp[i].metadataP, exp_elm.metaInfo);
+        if (ret != NIXL_SUCCESS)
+            return ret;
+        *p = descs[i];
+        exp_descs.addDesc(exp_elm);
+    }
+
+    nixlSerDes sd;
+    ret = sd.addStr("Backend", backend->getType());
+    if (ret != NIXL_SUCCESS)
+        return ret;
+    ret = exp_descs.serialize(&sd);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    str = sd.exportStr();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::importMem(const nixl_blob_t &str,
+                     const nixl_opt_args_t* extra_params) {
+
+    nixlSerDes sd;
+    nixl_status_t ret = sd.importStr(str);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    nixl_backend_t backend_type = sd.getStr("Backend");
+    if (backend_type.empty())
+        return NIXL_ERR_MISMATCH;
+
+    NIXL_LOCK_GUARD(data->lock);
+    auto it = data->backendEngines.find(backend_type);
+    if (it == data->backendEngines.end())
+        return NIXL_ERR_NOT_FOUND;
+    nixlBackendEngine* backend = it->second;
+
+    nixl_reg_dlist_t descs(&sd);
+    if (descs.descCount() == 0)
+        return NIXL_ERR_MISMATCH;
+
+    // Mirrors the single-backend registerMem path, with the backend
+    // adopting the exported handles instead of pinning the pages
+    nixl_sec_dlist_t sec_descs(descs.getType(), false);
+    ret = data->memorySection->addDescList(descs, backend, sec_descs,
+                                           nixl_reg_hints_t(), true);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    if (backend->supportsLocal()) {
+        if (data->remoteSections.count(data->name) == 0)
+            data->remoteSections[data->name] =
+                  new nixlRemoteSection(data->name);
+
+        ret = data->remoteSections[data->name]->loadLocalData(sec_descs,
+                                                              backend);
+        if (ret != NIXL_SUCCESS) {
+            data->memorySection->remDescList(descs, backend);
+            return ret;
+        }
+    }
+
+    data->rebuildXferBackendTables();
+
+    if (telemetryBuiltIn && data->telemetry_) {
+        uint64_t total_size = std::accumulate(
+            descs.begin(),
+            descs.end(),
+            uint64_t{0},
+            [](uint64_t sum, const nixlBlobDesc &desc) { return sum + desc.len; });
+        data->telemetry_->updateMemoryRegistered(total_size);
+    }
+    data->mdEpoch.fetch_add(1, std::memory_order_release);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::fenceDeregisterMem() const {
+    // Not taking the agent lock: the fence only waits on the reclamation
+    // thread, and holding the lock would stall concurrent transfers
+    std::unique_lock<std::mutex> lk(data->reclaimLock);
+    data->reclaimCv.wait(lk, [this] {
+        return data->reclaimQueue.empty() && data->reclaimInFlight == 0;
+    });
+    return NIXL_SUCCESS;
+}
+
+// Avoiding a libnuma dependency for a single binding call; the constants
+// match the kernel UAPI (numaif.h is not shipped with glibc)
+#ifndef MPOL_BIND
+#define MPOL_BIND 2
+#endif
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+nixl_status_t
+nixlAgent::allocMem(const size_t &len,
+                    void* &addr,
+                    const nixl_opt_args_t* extra_params) {
+
+    const size_t huge_sz   = extra_params ? extra_params->hugePageSize : 0;
+    const int    numa_node = extra_params ? extra_params->numaNode : -1;
+
+    addr = nullptr;
+    if (len == 0)
+        return NIXL_ERR_INVALID_PARAM;
+
+    int    flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    size_t page_sz;
+    if (huge_sz == (1ULL << 21)) {
+        flags |= MAP_HUGETLB | (21 << MAP_HUGE_SHIFT);
+        page_sz = huge_sz;
+    } else if (huge_sz == (1ULL << 30)) {
+        flags |= MAP_HUGETLB | (30 << MAP_HUGE_SHIFT);
+        page_sz = huge_sz;
+    } else if (huge_sz == 0) {
+        // Transparent huge pages: size the mapping in 2M units so the
+        // madvise below can back it fully with huge pages
+        page_sz = 1ULL << 21;
+    } else {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    const size_t map_len = ((len + page_sz - 1) / page_sz) * page_sz;
+    void* mem = mmap(nullptr, map_len, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (mem == MAP_FAILED) {
+        NIXL_PERROR << "allocMem: mmap of " << map_len << " bytes failed";
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_BACKEND));
+        return NIXL_ERR_BACKEND;
+    }
+
+    // The binding must precede the pre-fault so the pages land on the node
+    if (numa_node >= 0) {
+        if ((size_t) numa_node >= sizeof(unsigned long) * 8) {
+            munmap(mem, map_len);
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+            return NIXL_ERR_INVALID_PARAM;
+        }
+        unsigned long node_mask = 1UL << numa_node;
+        if (syscall(SYS_mbind, mem, map_len, MPOL_BIND, &node_mask,
+                    sizeof(node_mask) * 8, 0) != 0) {
+            NIXL_PERROR << "allocMem: mbind to NUMA node " << numa_node
+                        << " failed";
+            munmap(mem, map_len);
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_SUPPORTED));
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+    }
+
+    if (huge_sz == 0)
+        madvise(mem, map_len, MADV_HUGEPAGE);
+
+    // Pre-fault so the backends pin resident pages, instead of taking the
+    // fault-then-pin path on every page during registration
+    for (size_t off = 0; off < map_len; off += page_sz)
+        static_cast<volatile char*>(mem)[off] = 0;
+
+    nixl_reg_dlist_t descs(DRAM_SEG);
+    descs.addDesc(nixlBlobDesc((uintptr_t) mem, map_len, 0));
+
+    // registerMem takes the agent lock itself
+    nixl_status_t ret = registerMem(descs, extra_params);
+    if (ret != NIXL_SUCCESS) {
+        munmap(mem, map_len);
+        return ret;
+    }
+
+    {
+        NIXL_LOCK_GUARD(data->lock);
+        data->ownedAllocs.emplace(mem, std::make_pair(map_len, descs));
+    }
+    addr = mem;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::freeMem(void* addr, const nixl_opt_args_t* extra_params) {
+    size_t           map_len;
+    nixl_reg_dlist_t descs(DRAM_SEG);
+
+    {
+        NIXL_LOCK_GUARD(data->lock);
+        auto it = data->ownedAllocs.find(addr);
+        if (it == data->ownedAllocs.end()) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
+            return NIXL_ERR_NOT_FOUND;
+        }
+        map_len = it->second.first;
+        descs   = std::move(it->second.second);
+        data->ownedAllocs.erase(it);
+    }
+
+    // deregisterMem takes the agent lock itself
+    nixl_status_t ret = deregisterMem(descs, extra_params);
+
+    // The mapping cannot go away while a deferred teardown may still be
+    // unpinning it in the backends
+    if (extra_params && extra_params->deferTeardown)
+        fenceDeregisterMem();
+
+    munmap(addr, map_len);
+    return ret;
 }
 
 nixl_status_t
@@ -520,6 +1836,198 @@ nixlAgent::makeConnection(const std::string &remote_agent,
         return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::makeConnectionAll(const std::vector<std::string> &remote_agents,
+                             const nixl_opt_args_t* extra_params) {
+    NIXL_LOCK_GUARD(data->lock);
+
+    // Resolve every (engine, peer) pair up front so a peer without loaded
+    // metadata or without a common backend fails before any wireup starts
+    std::map<nixlBackendEngine*, std::vector<std::string>> by_engine;
+    for (const auto &remote_agent : remote_agents) {
+        if (data->remoteBackends.count(remote_agent) == 0)
+            return NIXL_ERR_NOT_FOUND;
+
+        std::set<nixl_backend_t> backend_set;
+        if (!extra_params || extra_params->backends.size() == 0) {
+            for (auto & [r_bknd, conn_info] : data->remoteBackends[remote_agent])
+                backend_set.insert(r_bknd);
+        } else {
+            for (auto & elm : extra_params->backends)
+                backend_set.insert(elm->engine->getType());
+        }
+
+        int count = 0;
+        for (auto & backend : backend_set) {
+            if (data->backendEngines.count(backend) == 0)
+                continue;
+            by_engine[data->backendEngines[backend]].push_back(remote_agent);
+            count++;
+        }
+        if (count == 0) // No common backend
+            return NIXL_ERR_BACKEND;
+    }
+
+    // Engines are independent of each other, so each one connects its
+    // peers on its own thread; within an engine the loop stays serial
+    // since backends are not required to take concurrent control calls
+    std::vector<nixl_status_t> engine_ret(by_engine.size(), NIXL_SUCCESS);
+    {
+        std::vector<std::thread> workers;
+        workers.reserve(by_engine.size());
+        size_t e = 0;
+        for (auto it = by_engine.begin(); it != by_engine.end(); ++it, ++e) {
+            nixlBackendEngine *eng = it->first;
+            const std::vector<std::string> *peers = &it->second;
+            workers.emplace_back([eng, peers, out = &engine_ret[e]]() {
+                for (const auto &peer : *peers) {
+                    nixl_status_t ret = eng->connect(peer);
+                    if (ret != NIXL_SUCCESS) {
+                        *out = ret;
+                        return;
+                    }
+                }
+            });
+        }
+        for (auto & worker : workers)
+            worker.join();
+    }
+    for (const auto & e_ret : engine_ret)
+        if (e_ret != NIXL_SUCCESS)
+            return e_ret;
+
+    // All peers are connected; force the deferred transport wireup now,
+    // with every peer's probe in flight before any is waited on (same
+    // reap pattern as prewarmConnections, but failures are returned)
+    nixl_status_t bad_ret = NIXL_SUCCESS;
+    std::vector<std::pair<nixlBackendEngine*, nixlBackendReqH*>> pending;
+    for (auto & [eng, peers] : by_engine) {
+        for (const auto &peer : peers) {
+            nixlBackendReqH *probe = nullptr;
+            nixl_status_t ret = eng->prewarmConnection(peer, probe);
+            if (ret == NIXL_SUCCESS)
+                pending.emplace_back(eng, probe);
+            else if (ret != NIXL_ERR_NOT_SUPPORTED && bad_ret == NIXL_SUCCESS)
+                bad_ret = ret;
+        }
+    }
+
+    while (!pending.empty()) {
+        for (auto it = pending.begin(); it != pending.end();) {
+            nixl_status_t ret = it->first->checkXfer(it->second);
+            if (ret == NIXL_IN_PROG) {
+                ++it;
+                continue;
+            }
+            if (ret != NIXL_SUCCESS && bad_ret == NIXL_SUCCESS)
+                bad_ret = ret;
+            it->first->releaseReqH(it->second);
+            it = pending.erase(it);
+        }
+    }
+
+    if (bad_ret != NIXL_SUCCESS)
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(bad_ret));
+    return bad_ret;
+}
+
+nixl_status_t
+nixlAgent::prewarmConnections(const std::vector<std::string> &remote_agents,
+                              const nixl_opt_args_t* extra_params) {
+    nixl_status_t ret, bad_ret = NIXL_SUCCESS;
+    int count = 0;
+
+    NIXL_LOCK_GUARD(data->lock);
+    // One entry per initiated wireup probe, reaped together below
+    std::vector<std::pair<nixlBackendEngine*, nixlBackendReqH*>> pending;
+
+    for (const auto &remote_agent : remote_agents) {
+        if (data->remoteBackends.count(remote_agent) == 0) {
+            if (bad_ret == NIXL_SUCCESS)
+                bad_ret = NIXL_ERR_NOT_FOUND;
+            continue;
+        }
+
+        std::set<nixl_backend_t> backend_set;
+        if (!extra_params || extra_params->backends.size() == 0) {
+            for (auto & [r_bknd, conn_info] : data->remoteBackends[remote_agent])
+                backend_set.insert(r_bknd);
+        } else {
+            for (auto & elm : extra_params->backends)
+                backend_set.insert(elm->engine->getType());
+        }
+
+        // Best effort across peers, unlike makeConnection: one unreachable
+        // peer must not leave the other connections cold
+        for (auto & backend : backend_set) {
+            if (data->backendEngines.count(backend) == 0)
+                continue;
+            nixlBackendEngine *eng = data->backendEngines[backend];
+            ret = eng->connect(remote_agent);
+            if (ret != NIXL_SUCCESS) {
+                if (bad_ret == NIXL_SUCCESS)
+                    bad_ret = ret;
+                continue;
+            }
+            count++;
+
+            nixlBackendReqH *probe = nullptr;
+            ret = eng->prewarmConnection(remote_agent, probe);
+            if (ret == NIXL_SUCCESS) {
+                pending.emplace_back(eng, probe);
+            } else if (ret != NIXL_ERR_NOT_SUPPORTED && bad_ret == NIXL_SUCCESS) {
+                // The connection itself is made; the probe is an optimization
+                bad_ret = ret;
+            }
+        }
+    }
+
+    // Every probe is in flight before any is waited on, so the whole
+    // batch completes in about one handshake round trip
+    while (!pending.empty()) {
+        for (auto it = pending.begin(); it != pending.end();) {
+            ret = it->first->checkXfer(it->second);
+            if (ret == NIXL_IN_PROG) {
+                ++it;
+                continue;
+            }
+            if (ret != NIXL_SUCCESS && bad_ret == NIXL_SUCCESS)
+                bad_ret = ret;
+            it->first->releaseReqH(it->second);
+            it = pending.erase(it);
+        }
+    }
+
+    if (bad_ret != NIXL_SUCCESS) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(bad_ret));
+        return bad_ret;
+    }
+    return (count == 0 && !remote_agents.empty()) ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
+}
+
+// Content hash for the prepped-dlist cache: FNV-1a over the agent name,
+// memory type and the addr/len/devId tuples of the list
+static uint64_t
+hashXferDlist(const std::string &agent_name, const nixl_xfer_dlist_t &descs) {
+    constexpr uint64_t prime = 1099511628211ULL;
+    uint64_t hash = 14695981039346656037ULL;
+
+    auto mix = [&hash](uint64_t val) {
+        for (size_t i = 0; i < sizeof(val); i++)
+            hash = (hash ^ ((val >> (i * 8)) & 0xff)) * prime;
+    };
+
+    for (const char c : agent_name)
+        hash = (hash ^ static_cast<uint8_t>(c)) * prime;
+    mix(descs.getType());
+    for (int i = 0; i < descs.descCount(); i++) {
+        mix(descs[i].addr);
+        mix(descs[i].len);
+        mix(descs[i].devId);
+    }
+    return hash;
+}
+
 nixl_status_t
 nixlAgent::prepXferDlist (const std::string &agent_name,
                           const nixl_xfer_dlist_t &descs,
@@ -532,7 +2040,10 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
     int            count = 0;
     bool           init_side = (agent_name == NIXL_INIT_AGENT);
 
-    NIXL_LOCK_GUARD(data->lock);
+    // Sections are only read here; mutators (registration, metadata loads)
+    // hold the exclusive lock, so preps run concurrently with each other
+    // and with the posting/polling paths
+    NIXL_SHARED_LOCK_GUARD(data->lock);
     // When central KV is supported, still it should return error,
     // just we can add a call to fetchRemoteMD for next time
     if (!init_side && (data->remoteSections.count(agent_name) == 0)) {
@@ -540,6 +2051,27 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
         return NIXL_ERR_NOT_FOUND;
     }
 
+    if (!init_side)
+        data->touchRemoteAgent(agent_name);
+
+    // With the default backend selection repeated preps of an identical
+    // list reuse the cached, already populated handle; an explicit backend
+    // set may differ between calls, so those preps bypass the cache
+    const bool cacheable = (!extra_params || extra_params->backends.size() == 0);
+    uint64_t   cache_key = 0;
+    if (cacheable) {
+        cache_key = hashXferDlist(agent_name, descs);
+        std::lock_guard<std::mutex> guard(data->dlistCacheLock);
+        auto range = data->dlistCache.equal_range(cache_key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if ((it->second.agent == agent_name) && (it->second.descs == descs)) {
+                it->second.refCount++;
+                dlist_hndl = it->second.handle;
+                return NIXL_SUCCESS;
+            }
+        }
+    }
+
     if (!extra_params || extra_params->backends.size() == 0) {
         if (!init_side)
             backend_set = data->remoteSections[agent_name]->
@@ -596,11 +2128,171 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
         UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
         return NIXL_ERR_NOT_FOUND;
     } else {
+        if (cacheable) {
+            handle->cached   = true;
+            handle->cacheKey = cache_key;
+            // Concurrent preps of the same list may each insert; the
+            // multimap keeps both and releasedDlistH matches by handle
+            std::lock_guard<std::mutex> guard(data->dlistCacheLock);
+            data->dlistCache.emplace(
+                cache_key,
+                nixlAgentData::dlistCacheEntry{descs, agent_name, handle, 1});
+        }
         dlist_hndl = handle;
         return NIXL_SUCCESS;
     }
 }
 
+// Slice-aware counterpart of fillXferDescs for the slice-addressed
+// makeXferReq: each selected prepped entry contributes the byte range
+// [offset, offset+len) instead of its whole registration entry, validated
+// for containment. Adjacent slices merge under the same rule as adjacent
+// descriptors.
+static nixl_status_t
+fillXferDescsSliced(const nixl_meta_dlist_t* local_descs,
+                    const std::vector<nixl_xfer_slice_t> &local_slices,
+                    const nixl_meta_dlist_t* remote_descs,
+                    const std::vector<nixl_xfer_slice_t> &remote_slices,
+                    nixl_meta_dlist_t* initiator_descs,
+                    nixl_meta_dlist_t* target_descs,
+                    bool skip_desc_merge,
+                    size_t &total_bytes) {
+
+    int desc_count = (int) local_slices.size();
+
+    total_bytes = 0;
+    for (int i=0; i<desc_count; ++i) {
+        const nixl_xfer_slice_t &ls = local_slices[i];
+        const nixl_xfer_slice_t &rs = remote_slices[i];
+        if ((ls.index >= local_descs->descCount()) || (ls.index < 0))
+            return NIXL_ERR_INVALID_PARAM;
+        if ((rs.index >= remote_descs->descCount()) || (rs.index < 0))
+            return NIXL_ERR_INVALID_PARAM;
+        if ((ls.len == 0) || (ls.len != rs.len))
+            return NIXL_ERR_INVALID_PARAM;
+        if ((ls.offset + ls.len > (*local_descs)[ls.index].len) ||
+            (rs.offset + rs.len > (*remote_descs)[rs.index].len))
+            return NIXL_ERR_INVALID_PARAM;
+        total_bytes += ls.len;
+    }
+
+    auto slice = [](const nixlMetaDesc &base, const nixl_xfer_slice_t &s) {
+        nixlMetaDesc out = base;
+        out.addr += s.offset;
+        out.len = s.len;
+        return out;
+    };
+
+    int j = 0;
+    for (int i=0; i<desc_count; ++i) {
+        nixlMetaDesc local_d  = slice((*local_descs) [local_slices[i].index],
+                                      local_slices[i]);
+        nixlMetaDesc remote_d = slice((*remote_descs)[remote_slices[i].index],
+                                      remote_slices[i]);
+
+        if (!skip_desc_merge && (j > 0)) {
+            nixlMetaDesc &local_p  = (*initiator_descs)[j-1];
+            nixlMetaDesc &remote_p = (*target_descs)[j-1];
+            if (((local_p.addr + local_p.len) == local_d.addr)
+                && ((remote_p.addr + remote_p.len) == remote_d.addr)
+                && (local_p.metadataP == local_d.metadataP)
+                && (remote_p.metadataP == remote_d.metadataP)
+                && (local_p.devId == local_d.devId)
+                && (remote_p.devId == remote_d.devId)) {
+                local_p.len += local_d.len;
+                remote_p.len += remote_d.len;
+                continue;
+            }
+        }
+
+        (*initiator_descs)[j] = local_d;
+        (*target_descs)   [j] = remote_d;
+        j++;
+    }
+
+    if (j < desc_count)
+        NIXL_DEBUG << "reqH descList size down to " << j;
+    initiator_descs->resize(j);
+    target_descs->resize(j);
+
+    return NIXL_SUCCESS;
+}
+
+// Validates the selected indices against the prepped descriptor lists and
+// fills the request handle's lists, merging back-to-back descriptors unless
+// asked not to. Shared between makeXferReq and updateXferReq.
+static nixl_status_t
+fillXferDescs(const nixl_meta_dlist_t* local_descs,
+              const std::vector<int> &local_indices,
+              const nixl_meta_dlist_t* remote_descs,
+              const std::vector<int> &remote_indices,
+              nixl_meta_dlist_t* initiator_descs,
+              nixl_meta_dlist_t* target_descs,
+              bool skip_desc_merge,
+              size_t &total_bytes) {
+
+    int desc_count = (int) local_indices.size();
+
+    total_bytes = 0;
+    for (int i=0; i<desc_count; ++i) {
+        if ((local_indices[i] >= local_descs->descCount())
+               || (local_indices[i]<0))
+            return NIXL_ERR_INVALID_PARAM;
+        if ((remote_indices[i] >= remote_descs->descCount())
+               || (remote_indices[i]<0))
+            return NIXL_ERR_INVALID_PARAM;
+        if ((*local_descs )[local_indices [i]].len !=
+            (*remote_descs)[remote_indices[i]].len)
+            return NIXL_ERR_INVALID_PARAM;
+        total_bytes += (*local_descs)[local_indices[i]].len;
+    }
+
+    if (skip_desc_merge) {
+        for (int i=0; i<desc_count; ++i) {
+            (*initiator_descs)[i] = (*local_descs)[local_indices[i]];
+            (*target_descs)[i]    = (*remote_descs)[remote_indices[i]];
+        }
+    } else {
+        int i = 0, j = 0; //final list size
+        while (i<(desc_count)) {
+            nixlMetaDesc local_desc1  = (*local_descs) [local_indices[i]];
+            nixlMetaDesc remote_desc1 = (*remote_descs)[remote_indices[i]];
+
+            if(i != (desc_count-1) ) {
+                const nixlMetaDesc* local_desc2  = &((*local_descs) [local_indices[i+1]]);
+                const nixlMetaDesc* remote_desc2 = &((*remote_descs)[remote_indices[i+1]]);
+
+              while (((local_desc1.addr + local_desc1.len) == local_desc2->addr)
+                  && ((remote_desc1.addr + remote_desc1.len) == remote_desc2->addr)
+                  && (local_desc1.metadataP == local_desc2->metadataP)
+                  && (remote_desc1.metadataP == remote_desc2->metadataP)
+                  && (local_desc1.devId == local_desc2->devId)
+                  && (remote_desc1.devId == remote_desc2->devId)) {
+
+                    local_desc1.len += local_desc2->len;
+                    remote_desc1.len += remote_desc2->len;
+
+                    i++;
+                    if(i == (desc_count-1)) break;
+
+                    local_desc2  = &((*local_descs) [local_indices[i+1]]);
+                    remote_desc2 = &((*remote_descs)[remote_indices[i+1]]);
+                }
+            }
+
+            (*initiator_descs)[j] = local_desc1;
+            (*target_descs)   [j] = remote_desc1;
+            j++;
+            i++;
+        }
+        NIXL_DEBUG << "reqH descList size down to " << j;
+        initiator_descs->resize(j);
+        target_descs->resize(j);
+    }
+
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
                         const nixlDlistH* local_side,
@@ -609,6 +2301,45 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
                         const std::vector<int> &remote_indices,
                         nixlXferReqH* &req_hndl,
                         const nixl_opt_args_t* extra_params) const {
+    return makeXferReqInternal(operation, local_side, local_indices, nullptr,
+                               remote_side, remote_indices, nullptr,
+                               req_hndl, extra_params);
+}
+
+nixl_status_t
+nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
+                        const nixlDlistH* local_side,
+                        const std::vector<nixl_xfer_slice_t> &local_slices,
+                        const nixlDlistH* remote_side,
+                        const std::vector<nixl_xfer_slice_t> &remote_slices,
+                        nixlXferReqH* &req_hndl,
+                        const nixl_opt_args_t* extra_params) const {
+
+    // The shared body keys its per-entry validation and sizing off the
+    // index vectors, so mirror the slices into them
+    std::vector<int> local_indices(local_slices.size());
+    std::vector<int> remote_indices(remote_slices.size());
+
+    for (size_t i=0; i<local_slices.size(); ++i)
+        local_indices[i] = local_slices[i].index;
+    for (size_t i=0; i<remote_slices.size(); ++i)
+        remote_indices[i] = remote_slices[i].index;
+
+    return makeXferReqInternal(operation, local_side, local_indices, &local_slices,
+                               remote_side, remote_indices, &remote_slices,
+                               req_hndl, extra_params);
+}
+
+nixl_status_t
+nixlAgent::makeXferReqInternal (const nixl_xfer_op_t &operation,
+                                const nixlDlistH* local_side,
+                                const std::vector<int> &local_indices,
+                                const std::vector<nixl_xfer_slice_t>* local_slices,
+                                const nixlDlistH* remote_side,
+                                const std::vector<int> &remote_indices,
+                                const std::vector<nixl_xfer_slice_t>* remote_slices,
+                                nixlXferReqH* &req_hndl,
+                                const nixl_opt_args_t* extra_params) const {
 
     nixl_opt_b_args_t  opt_args;
     nixl_status_t      ret;
@@ -627,7 +2358,9 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         return NIXL_ERR_INVALID_PARAM;
     }
 
-    NIXL_LOCK_GUARD(data->lock);
+    // Only reads agent data: the prepped sides are caller owned, and the
+    // handle comes from the pool which has its own lock
+    NIXL_SHARED_LOCK_GUARD(data->lock);
     // The remote was invalidated in between prepXferDlist and this call
     if (data->remoteSections.count(remote_side->remoteAgent) == 0) {
         UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
@@ -656,115 +2389,520 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         }
     }
 
-    if (!backend)
-        return NIXL_ERR_INVALID_PARAM;
+    if (!backend)
+        return NIXL_ERR_INVALID_PARAM;
+
+    nixl_meta_dlist_t* local_descs  = local_side->descs.at(backend);
+    nixl_meta_dlist_t* remote_descs = remote_side->descs.at(backend);
+    size_t total_bytes = 0;
+
+    if ((desc_count == 0) || (remote_indices.size() == 0) ||
+        (desc_count != (int) remote_indices.size()))
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (extra_params && extra_params->hasNotif) {
+        opt_args.notifMsg = extra_params->notifMsg;
+        opt_args.hasNotif = true;
+    }
+
+    if (extra_params)
+        opt_args.priority = extra_params->priority;
+
+    if ((opt_args.hasNotif) && (!backend->supportsNotif())) {
+        return NIXL_ERR_BACKEND;
+    }
+
+    // Populate has been already done, no benefit in having sorted descriptors
+    // which will be overwritten by [] assignment operator.
+    auto recycle = [this](nixlXferReqH* r) { data->recycleXferReqH(r); };
+    std::unique_ptr<nixlXferReqH, decltype(recycle)> handle(
+        data->acquireXferReqH(), recycle);
+    if (handle->initiatorDescs)
+        handle->initiatorDescs->reinit(local_descs->getType(),
+                                       false, desc_count);
+    else
+        handle->initiatorDescs = new nixl_meta_dlist_t (
+                                         local_descs->getType(),
+                                         false, desc_count);
+
+    if (handle->targetDescs)
+        handle->targetDescs->reinit(remote_descs->getType(),
+                                    false, desc_count);
+    else
+        handle->targetDescs    = new nixl_meta_dlist_t (
+                                         remote_descs->getType(),
+                                         false, desc_count);
+
+    if (local_slices)
+        ret = fillXferDescsSliced(local_descs, *local_slices,
+                                  remote_descs, *remote_slices,
+                                  handle->initiatorDescs, handle->targetDescs,
+                                  extra_params && extra_params->skipDescMerge,
+                                  total_bytes);
+    else
+        ret = fillXferDescs(local_descs, local_indices,
+                            remote_descs, remote_indices,
+                            handle->initiatorDescs, handle->targetDescs,
+                            extra_params && extra_params->skipDescMerge,
+                            total_bytes);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    handle->engine = backend;
+    handle->remoteAgent = remote_side->remoteAgent;
+    handle->notifMsg = opt_args.notifMsg;
+    handle->hasNotif = opt_args.hasNotif;
+    handle->priority = opt_args.priority;
+    handle->deadlineUs = extra_params ? extra_params->deadlineUs : 0;
+    handle->backendOp = operation;
+    handle->status = NIXL_ERR_NOT_POSTED;
+    handle->telemetry.totalBytes = total_bytes;
+
+    if (extra_params && nixlTracer::idSet(extra_params->traceId)) {
+        handle->traceId = extra_params->traceId;
+        if (data->tracer_)
+            data->tracer_->record(handle->traceId,
+                                  nixl_trace_point_t::NIXL_TRACE_XFER_CREATED,
+                                  total_bytes);
+    }
+
+    ret = handle->engine->prepXfer (handle->backendOp,
+                                    *handle->initiatorDescs,
+                                    *handle->targetDescs,
+                                    handle->remoteAgent,
+                                    handle->backendHandle,
+                                    &opt_args);
+    if (ret != NIXL_SUCCESS) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret));
+        return ret;
+    }
+
+    req_hndl = handle.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::updateXferReq (nixlXferReqH* req_hndl,
+                          const nixlDlistH* local_side,
+                          const std::vector<int> &local_indices,
+                          const nixlDlistH* remote_side,
+                          const std::vector<int> &remote_indices,
+                          const nixl_opt_args_t* extra_params) const {
+
+    nixl_status_t ret;
+    int           desc_count = (int) local_indices.size();
+    size_t        total_bytes = 0;
+
+    if (!req_hndl || !local_side || !remote_side) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if ((!local_side->isLocal) || (remote_side->isLocal)) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if ((desc_count == 0) || (remote_indices.size() == 0) ||
+        (desc_count != (int) remote_indices.size()))
+        return NIXL_ERR_INVALID_PARAM;
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Compound and broadcast pipelines are built from the creation-time
+    // descriptor lists and are not rebuilt by an update
+    if (req_hndl->compound || req_hndl->broadcast)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    // Only backends whose postXfer consumes the descriptor lists can
+    // repost updated ranges; storage backends bake their IO plan into the
+    // backend handle at prepXfer time and would silently re-transfer the
+    // original ranges
+    if (!req_hndl->engine->supportsXferUpdate())
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    // Cannot swap descriptors under an in-flight transfer
+    if (req_hndl->status == NIXL_IN_PROG) {
+        req_hndl->status = req_hndl->engine->checkXfer(req_hndl->backendHandle);
+        if (req_hndl->status == NIXL_IN_PROG)
+            return NIXL_ERR_REPOST_ACTIVE;
+    }
+
+    // The request stays bound to the backend and agent chosen at creation,
+    // so both prepped sides must cover that backend, and the remote side
+    // must refer to the same agent
+    if (remote_side->remoteAgent != req_hndl->remoteAgent)
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    if ((local_side->descs.count(req_hndl->engine) == 0) ||
+        (remote_side->descs.count(req_hndl->engine) == 0))
+        return NIXL_ERR_INVALID_PARAM;
+
+    nixl_meta_dlist_t* local_descs  = local_side->descs.at(req_hndl->engine);
+    nixl_meta_dlist_t* remote_descs = remote_side->descs.at(req_hndl->engine);
+
+    req_hndl->initiatorDescs->reinit(local_descs->getType(),
+                                     false, desc_count);
+    req_hndl->targetDescs->reinit(remote_descs->getType(),
+                                  false, desc_count);
+
+    ret = fillXferDescs(local_descs, local_indices,
+                        remote_descs, remote_indices,
+                        req_hndl->initiatorDescs, req_hndl->targetDescs,
+                        extra_params && extra_params->skipDescMerge,
+                        total_bytes);
+    if (ret != NIXL_SUCCESS) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret));
+        return ret;
+    }
+
+    if (extra_params && extra_params->hasNotif) {
+        req_hndl->notifMsg = extra_params->notifMsg;
+        req_hndl->hasNotif = true;
+    }
+
+    // Registrations did not change and the backend reads the lists at
+    // post time (see supportsXferUpdate), so populate and backend
+    // prepXfer are skipped; the next postXferReq submits the updated
+    // descriptors
+    req_hndl->status = NIXL_ERR_NOT_POSTED;
+    req_hndl->telemetry.totalBytes = total_bytes;
+    return NIXL_SUCCESS;
+}
+
+// In-place coalescing of physically contiguous descriptor pairs: both
+// sides must be adjacent and share their device and registration for the
+// pair to merge (same criteria as the makeXferReq merge)
+static void
+mergeXferDescs(nixl_meta_dlist_t &local, nixl_meta_dlist_t &remote) {
+    int j = 0;
+    for (int i = 1; i < local.descCount(); ++i) {
+        if ((local[j].addr + local[j].len == local[i].addr) &&
+            (remote[j].addr + remote[j].len == remote[i].addr) &&
+            (local[j].metadataP == local[i].metadataP) &&
+            (remote[j].metadataP == remote[i].metadataP) &&
+            (local[j].devId == local[i].devId) &&
+            (remote[j].devId == remote[i].devId)) {
+            local[j].len += local[i].len;
+            remote[j].len += remote[i].len;
+        } else {
+            ++j;
+            local[j] = local[i];
+            remote[j] = remote[i];
+        }
+    }
+    local.resize(j + 1);
+    remote.resize(j + 1);
+}
+
+// Staging pool geometry for compound transfers: two chunk-sized buffers
+// give double-buffering, so one chunk's second leg overlaps the next
+// chunk's first leg
+static constexpr size_t compound_chunk_size = 4 * 1024 * 1024;
+static constexpr size_t compound_num_bufs   = 2;
+
+// Carve the flattened byte range [offset, offset+len) out of a populated
+// descriptor list; the slices keep the metadataP of the descriptor they
+// came from, which stays valid for any sub-range of the registered region
+static void
+sliceMetaDescs(const nixl_meta_dlist_t &src,
+               size_t offset, size_t len,
+               nixl_meta_dlist_t &out) {
+    size_t cursor = 0;
+    for (int i = 0; (i < src.descCount()) && (len > 0); ++i) {
+        const nixlMetaDesc &desc = src[i];
+        if (offset < cursor + desc.len) {
+            size_t skip = offset - cursor;
+            size_t take = std::min(len, desc.len - skip);
+            nixlMetaDesc slice;
+            slice.addr      = desc.addr + skip;
+            slice.len       = take;
+            slice.devId     = desc.devId;
+            slice.metadataP = desc.metadataP;
+            out.addDesc(slice);
+            offset += take;
+            len    -= take;
+        }
+        cursor += desc.len;
+    }
+}
 
-    nixl_meta_dlist_t* local_descs  = local_side->descs.at(backend);
-    nixl_meta_dlist_t* remote_descs = remote_side->descs.at(backend);
-    size_t total_bytes = 0;
+nixl_status_t
+nixlCompoundXferState::postLeg(stagingBuf &buf, int leg) {
+    // The first leg always reads the chunk into staging and the second
+    // writes it out; the network leg comes first for NIXL_READ requests
+    // and last for NIXL_WRITE
+    bool net_leg = (op == NIXL_READ) ? (leg == 1) : (leg == 2);
+
+    nixlBackendEngine*       engine = net_leg ? netEngine   : storageEngine;
+    const nixl_meta_dlist_t& side   = net_leg ? remoteDescs : storageDescs;
+    const std::string&       agent  = net_leg ? remoteAgent : localAgent;
+
+    nixl_meta_dlist_t staging_meta(DRAM_SEG);
+    nixlMetaDesc staging;
+    staging.addr      = (uintptr_t) buf.addr;
+    staging.len       = buf.chunkLen;
+    staging.devId     = 0;
+    staging.metadataP = net_leg ? buf.netMD : buf.storageMD;
+    staging_meta.addDesc(staging);
+
+    nixl_meta_dlist_t side_meta(side.getType());
+    sliceMetaDescs(side, buf.chunkOffset, buf.chunkLen, side_meta);
+
+    buf.leg       = leg;
+    buf.legEngine = engine;
+    buf.legHandle = nullptr;
+
+    nixl_xfer_op_t leg_op = (leg == 1) ? NIXL_READ : NIXL_WRITE;
+    nixl_status_t ret = engine->prepXfer(leg_op, staging_meta, side_meta,
+                                         agent, buf.legHandle);
+    if (ret != NIXL_SUCCESS)
+        return ret;
 
-    if ((desc_count == 0) || (remote_indices.size() == 0) ||
-        (desc_count != (int) remote_indices.size()))
-        return NIXL_ERR_INVALID_PARAM;
+    ret = engine->postXfer(leg_op, staging_meta, side_meta,
+                           agent, buf.legHandle);
+    if (ret == NIXL_SUCCESS)
+        return completeLeg(buf);
+    return ret;
+}
 
-    for (int i=0; i<desc_count; ++i) {
-        if ((local_indices[i] >= local_descs->descCount())
-               || (local_indices[i]<0))
-            return NIXL_ERR_INVALID_PARAM;
-        if ((remote_indices[i] >= remote_descs->descCount())
-               || (remote_indices[i]<0))
-            return NIXL_ERR_INVALID_PARAM;
-        if ((*local_descs )[local_indices [i]].len !=
-            (*remote_descs)[remote_indices[i]].len)
-            return NIXL_ERR_INVALID_PARAM;
-        total_bytes += (*local_descs)[local_indices[i]].len;
+nixl_status_t
+nixlCompoundXferState::completeLeg(stagingBuf &buf) {
+    if (buf.legHandle) {
+        buf.legEngine->releaseReqH(buf.legHandle);
+        buf.legHandle = nullptr;
     }
 
-    if (extra_params && extra_params->hasNotif) {
-        opt_args.notifMsg = extra_params->notifMsg;
-        opt_args.hasNotif = true;
+    if (buf.leg == 1)
+        return postLeg(buf, 2);
+
+    // Chunk fully written out; the buffer is free for the next one
+    buf.leg    = 0;
+    doneBytes += buf.chunkLen;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlCompoundXferState::progress() {
+    nixl_status_t ret;
+
+    // Reap in-flight legs, chaining the second leg of a finished first
+    for (auto & buf : bufs) {
+        if (buf.leg == 0)
+            continue;
+        ret = buf.legEngine->checkXfer(buf.legHandle);
+        if (ret == NIXL_IN_PROG)
+            continue;
+        if (ret != NIXL_SUCCESS)
+            return ret;
+        ret = completeLeg(buf);
+        if (ret < 0)
+            return ret;
     }
 
-    if ((opt_args.hasNotif) && (!backend->supportsNotif())) {
-        return NIXL_ERR_BACKEND;
+    // Refill idle buffers with the next chunks
+    for (auto & buf : bufs) {
+        if ((buf.leg != 0) || (nextOffset >= totalBytes))
+            continue;
+        buf.chunkOffset = nextOffset;
+        buf.chunkLen    = std::min(chunkSize, totalBytes - nextOffset);
+        nextOffset     += buf.chunkLen;
+        ret = postLeg(buf, 1);
+        if (ret < 0)
+            return ret;
     }
 
-    // Populate has been already done, no benefit in having sorted descriptors
-    // which will be overwritten by [] assignment operator.
-    std::unique_ptr<nixlXferReqH> handle = std::make_unique<nixlXferReqH>();
-    handle->initiatorDescs = new nixl_meta_dlist_t (
-                                     local_descs->getType(),
-                                     false, desc_count);
+    return (doneBytes == totalBytes) ? NIXL_SUCCESS : NIXL_IN_PROG;
+}
 
-    handle->targetDescs    = new nixl_meta_dlist_t (
-                                     remote_descs->getType(),
-                                     false, desc_count);
+// Broadcast chunk granularity; also the stagger distance between
+// consecutive legs of the chain schedule
+static constexpr size_t bcast_chunk_size = 4 * 1024 * 1024;
 
-    if (extra_params && extra_params->skipDescMerge) {
-        for (int i=0; i<desc_count; ++i) {
-            (*handle->initiatorDescs)[i] =
-                                     (*local_descs)[local_indices[i]];
-            (*handle->targetDescs)[i] =
-                                     (*remote_descs)[remote_indices[i]];
+nixl_status_t
+nixlBcastXferState::postChunk(destLeg &leg) {
+    leg.chunkLen = std::min(chunkSize, totalBytes - leg.nextOffset);
+
+    nixl_meta_dlist_t local_meta(leg.localDescs.getType());
+    nixl_meta_dlist_t remote_meta(leg.remoteDescs.getType());
+    sliceMetaDescs(leg.localDescs, leg.nextOffset, leg.chunkLen, local_meta);
+    sliceMetaDescs(leg.remoteDescs, leg.nextOffset, leg.chunkLen, remote_meta);
+
+    leg.handle = nullptr;
+    nixl_status_t ret = leg.engine->prepXfer(NIXL_WRITE, local_meta,
+                                             remote_meta, leg.agent,
+                                             leg.handle);
+    if (ret != NIXL_SUCCESS) {
+        leg.status = ret;
+        return ret;
+    }
+
+    ret = leg.engine->postXfer(NIXL_WRITE, local_meta, remote_meta,
+                               leg.agent, leg.handle);
+    if (ret < 0) {
+        leg.status = ret;
+        return ret;
+    }
+    leg.nextOffset += leg.chunkLen;
+
+    if (ret == NIXL_SUCCESS) {
+        // Chunk completed within the post
+        leg.engine->releaseReqH(leg.handle);
+        leg.handle     = nullptr;
+        leg.doneBytes += leg.chunkLen;
+    }
+    leg.status = (leg.doneBytes == totalBytes) ? NIXL_SUCCESS : NIXL_IN_PROG;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlBcastXferState::progress() {
+    nixl_status_t ret;
+
+    // Reap in-flight chunks, tracking each leg's status individually
+    for (auto & leg : legs) {
+        if (!leg.handle)
+            continue;
+        ret = leg.engine->checkXfer(leg.handle);
+        if (ret == NIXL_IN_PROG)
+            continue;
+        leg.engine->releaseReqH(leg.handle);
+        leg.handle = nullptr;
+        if (ret != NIXL_SUCCESS) {
+            leg.status = ret;
+            return ret;
         }
-    } else {
-        int i = 0, j = 0; //final list size
-        while (i<(desc_count)) {
-            nixlMetaDesc local_desc1  = (*local_descs) [local_indices[i]];
-            nixlMetaDesc remote_desc1 = (*remote_descs)[remote_indices[i]];
+        leg.doneBytes += leg.chunkLen;
+        if (leg.doneBytes == totalBytes)
+            leg.status = NIXL_SUCCESS;
+    }
 
-            if(i != (desc_count-1) ) {
-                nixlMetaDesc* local_desc2  = &((*local_descs) [local_indices[i+1]]);
-                nixlMetaDesc* remote_desc2 = &((*remote_descs)[remote_indices[i+1]]);
+    // Post the next chunks along the wavefront: a leg only takes a chunk
+    // its predecessor has already moved past, so the in-flight set forms
+    // a chain down the destination list instead of N concurrent
+    // full-list posts against the source NIC
+    for (size_t i = 0; i < legs.size(); ++i) {
+        destLeg &leg = legs[i];
+        if (leg.handle || (leg.nextOffset >= totalBytes))
+            continue;
+        if ((i > 0) && (legs[i-1].nextOffset <= leg.nextOffset))
+            continue;
+        ret = postChunk(leg);
+        if (ret < 0)
+            return ret;
+    }
 
-              while (((local_desc1.addr + local_desc1.len) == local_desc2->addr)
-                  && ((remote_desc1.addr + remote_desc1.len) == remote_desc2->addr)
-                  && (local_desc1.metadataP == local_desc2->metadataP)
-                  && (remote_desc1.metadataP == remote_desc2->metadataP)
-                  && (local_desc1.devId == local_desc2->devId)
-                  && (remote_desc1.devId == remote_desc2->devId)) {
+    for (auto & leg : legs)
+        if (leg.doneBytes != totalBytes)
+            return NIXL_IN_PROG;
+    return NIXL_SUCCESS;
+}
 
-                    local_desc1.len += local_desc2->len;
-                    remote_desc1.len += remote_desc2->len;
+nixl_status_t
+nixlAgent::createCompoundXfer (const nixl_xfer_op_t &operation,
+                               const nixl_xfer_dlist_view_t &local_descs,
+                               const nixl_xfer_dlist_view_t &remote_descs,
+                               const std::string &remote_agent,
+                               nixlXferReqH &handle) const {
+    nixl_status_t ret;
 
-                    i++;
-                    if(i == (desc_count-1)) break;
+    // Only the remote memory <-> local storage split is staged; any other
+    // combination keeps the single-backend NIXL_ERR_NOT_FOUND result
+    nixl_mem_t local_mem  = local_descs.getType();
+    nixl_mem_t remote_mem = remote_descs.getType();
+    if ((local_mem != FILE_SEG) && (local_mem != OBJ_SEG))
+        return NIXL_ERR_NOT_FOUND;
+    if ((remote_mem != DRAM_SEG) && (remote_mem != VRAM_SEG))
+        return NIXL_ERR_NOT_FOUND;
+    if (remote_agent == data->name)
+        return NIXL_ERR_NOT_FOUND;
+    // The storage leg resolves against our own loopback section, same as
+    // a direct local storage transfer would
+    if (data->remoteSections.count(data->name) == 0)
+        return NIXL_ERR_NOT_FOUND;
 
-                    local_desc2  = &((*local_descs) [local_indices[i+1]]);
-                    remote_desc2 = &((*remote_descs)[remote_indices[i+1]]);
-                }
-            }
+    auto compound = std::make_unique<nixlCompoundXferState>(remote_mem,
+                                                            local_mem);
 
-            (*handle->initiatorDescs)[j] = local_desc1;
-            (*handle->targetDescs)   [j] = remote_desc1;
-            j++;
-            i++;
+    // Network leg: first remote-capable backend that resolves the remote
+    // side, same first-match policy as the single-backend path
+    backend_set_t* remote_set =
+        data->remoteSections[remote_agent]->queryBackends(remote_mem);
+    if (!remote_set)
+        return NIXL_ERR_NOT_FOUND;
+    for (auto & backend : *remote_set) {
+        if (!backend->supportsRemote())
+            continue;
+        ret = data->remoteSections[remote_agent]->populate(
+                    remote_descs, backend, compound->remoteDescs);
+        if (ret == NIXL_SUCCESS) {
+            compound->netEngine = backend;
+            break;
         }
-        NIXL_DEBUG << "reqH descList size down to " << j;
-        handle->initiatorDescs->resize(j);
-        handle->targetDescs->resize(j);
     }
+    if (!compound->netEngine)
+        return NIXL_ERR_NOT_FOUND;
 
-    handle->engine = backend;
-    handle->remoteAgent = remote_side->remoteAgent;
-    handle->notifMsg = opt_args.notifMsg;
-    handle->hasNotif = opt_args.hasNotif;
-    handle->backendOp = operation;
-    handle->status = NIXL_ERR_NOT_POSTED;
-    handle->telemetry.totalBytes = total_bytes;
+    // Storage leg: first local-capable backend that resolves the file side
+    backend_set_t* local_set =
+        data->remoteSections[data->name]->queryBackends(local_mem);
+    if (!local_set)
+        return NIXL_ERR_NOT_FOUND;
+    for (auto & backend : *local_set) {
+        if (!backend->supportsLocal() || (backend == compound->netEngine))
+            continue;
+        ret = data->remoteSections[data->name]->populate(
+                    local_descs, backend, compound->storageDescs);
+        if (ret == NIXL_SUCCESS) {
+            compound->storageEngine = backend;
+            break;
+        }
+    }
+    if (!compound->storageEngine)
+        return NIXL_ERR_NOT_FOUND;
 
-    ret = handle->engine->prepXfer (handle->backendOp,
-                                    *handle->initiatorDescs,
-                                    *handle->targetDescs,
-                                    handle->remoteAgent,
-                                    handle->backendHandle,
-                                    &opt_args);
-    if (ret != NIXL_SUCCESS) {
-        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret));
-        return ret;
+    NIXL_INFO << "Compound transfer: " << compound->netEngine->getType()
+              << " staged through DRAM into "
+              << compound->storageEngine->getType();
+
+    compound->op          = operation;
+    compound->remoteAgent = remote_agent;
+    compound->localAgent  = data->name;
+    for (int i = 0; i < local_descs.descCount(); ++i)
+        compound->totalBytes += local_descs[i].len;
+    compound->chunkSize = std::min(compound_chunk_size,
+                                   compound->totalBytes);
+
+    // The staging pool is plain page-aligned DRAM registered with both
+    // engines; buffers enter the vector before allocation so the state
+    // destructor unwinds partially built pools
+    for (size_t i = 0; i < compound_num_bufs; ++i) {
+        auto & buf = compound->bufs.emplace_back();
+        if (posix_memalign(&buf.addr, sysconf(_SC_PAGESIZE),
+                           compound->chunkSize) != 0)
+            return NIXL_ERR_BACKEND;
+
+        nixlBlobDesc staging(nixlBasicDesc((uintptr_t) buf.addr,
+                                           compound->chunkSize, 0), "");
+        ret = compound->netEngine->registerMem(staging, DRAM_SEG,
+                                               buf.netMD);
+        if (ret != NIXL_SUCCESS) {
+            buf.netMD = nullptr;
+            return ret;
+        }
+        ret = compound->storageEngine->registerMem(staging, DRAM_SEG,
+                                                   buf.storageMD);
+        if (ret != NIXL_SUCCESS) {
+            buf.storageMD = nullptr;
+            return ret;
+        }
     }
 
-    req_hndl = handle.release();
+    handle.compound = std::move(compound);
     return NIXL_SUCCESS;
 }
 
@@ -775,121 +2913,443 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
                          const std::string &remote_agent,
                          nixlXferReqH* &req_hndl,
                          const nixl_opt_args_t* extra_params) const {
+    return createXferReq(operation, local_descs.view(), remote_descs.view(),
+                         remote_agent, req_hndl, extra_params);
+}
+
+nixl_status_t
+nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
+                         const nixl_xfer_dlist_view_t &local_descs,
+                         const nixl_xfer_dlist_view_t &remote_descs,
+                         const std::string &remote_agent,
+                         nixlXferReqH* &req_hndl,
+                         const nixl_opt_args_t* extra_params) const {
     nixl_status_t     ret1, ret2;
     nixl_opt_b_args_t opt_args;
 
-    std::unique_ptr<backend_set_t> backend_set = std::make_unique<backend_set_t>();
+    // Backends able to serve both sides; the default path reads the
+    // precomputed per-remote dispatch table (see remoteSlots), the
+    // hinted path dedups into a local flat list
+    const backend_list_t* backend_list;
+    backend_list_t        hinted_backends;
 
     req_hndl = nullptr;
 
+#ifdef NIXL_XFER_TIMELINE
+    // Taken before the handle exists; stamped into it once acquired
+    nixlTime::us_t created_us = nixlTime::getUsFast();
+#endif
+
+    // One-shot local buffers (see nixl_opt_args_t::tempReg): register the
+    // local side for just this request, before the shared lock since
+    // registration takes the exclusive one. Ranges inside an already
+    // registered block share its backend MD through the section's
+    // refcounting, so this stays cheap for covered buffers. The handle
+    // returns the registration through the reclamation thread when it is
+    // recycled; until then it lives in temp_reg and the early-error paths
+    // below hand it back the same way.
+    std::unique_ptr<nixl_reg_dlist_t> temp_reg;
+    if (extra_params && extra_params->tempReg) {
+        temp_reg = std::make_unique<nixl_reg_dlist_t>(local_descs.getType());
+        for (int i = 0; i < local_descs.descCount(); ++i)
+            temp_reg->addDesc(nixlBlobDesc(local_descs[i], nixl_blob_t()));
+        // Limited to the hinted backends when given; reg groups and other
+        // registration-time options don't apply to a one-shot mapping
+        nixl_opt_args_t reg_params;
+        reg_params.backends = extra_params->backends;
+        nixl_status_t reg_ret =
+            const_cast<nixlAgent*>(this)->registerMem(*temp_reg, &reg_params);
+        if (reg_ret != NIXL_SUCCESS) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(reg_ret));
+            return reg_ret;
+        }
+    }
+    auto drop_temp_reg = [this, &temp_reg]() {
+        if (!temp_reg)
+            return;
+        std::shared_ptr<nixl_reg_dlist_t> descs(std::move(temp_reg));
+        data->enqueueReclaimTask([d = data.get(), descs]() {
+            d->deregisterOneShot(*descs);
+        });
+    };
+
+    // Deferred registrations (see nixl_opt_args_t::lazyReg) are turned
+    // into real ones if this transfer needs them; also before the shared
+    // lock since materialization takes the exclusive one
+    if (data->pendingRegCount.load(std::memory_order_acquire) != 0)
+        data->materializePendingRegs(local_descs, remote_descs,
+                                     remote_agent, extra_params);
+
+    // One string hash at the API boundary, resolved against the RCU id
+    // snapshot before the lock; the rest of the call works on the
+    // interned slot (see remoteSlots)
+    const int32_t remote_id = data->lookupAgentId(remote_agent);
+    if (remote_id < 0) {
+        drop_temp_reg();
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
+        return NIXL_ERR_NOT_FOUND;
+    }
+
     NIXL_SHARED_LOCK_GUARD(data->lock);
-    if (data->remoteSections.count(remote_agent) == 0)
+    // The slot array and the section contents stay fenced by the agent
+    // lock: invalidation detaches them under the exclusive side, so a
+    // reader inside the lock never sees a freed section
+    nixlRemoteSection *remote_sec = data->remoteSlots[remote_id].section;
+    if (!remote_sec)
     {
+        drop_temp_reg();
         UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
         return NIXL_ERR_NOT_FOUND;
     }
 
+    data->touchRemoteAgent((uint32_t) remote_id);
+
     size_t total_bytes = 0;
     // Check the correspondence between descriptor lists
-    if (local_descs.descCount() != remote_descs.descCount())
+    if (local_descs.descCount() != remote_descs.descCount()) {
+        drop_temp_reg();
         return NIXL_ERR_INVALID_PARAM;
+    }
     for (int i = 0; i < local_descs.descCount(); ++i) {
-        if (local_descs[i].len != remote_descs[i].len)
+        if (local_descs[i].len != remote_descs[i].len) {
+            drop_temp_reg();
             return NIXL_ERR_INVALID_PARAM;
+        }
         total_bytes += local_descs[i].len;
     }
 
     if (!extra_params || extra_params->backends.size() == 0) {
-        // Finding backends that support the corresponding memories
-        // locally and remotely, and find the common ones.
-        backend_set_t* local_set =
-            data->memorySection->queryBackends(local_descs.getType());
-        backend_set_t* remote_set =
-            data->remoteSections[remote_agent]->queryBackends(
+        // Backends supporting the corresponding memories locally and
+        // remotely were already intersected when either side last changed
+        backend_list = data->lookupXferBackends(remote_id,
+                                                local_descs.getType(),
                                                 remote_descs.getType());
-        if (!local_set || !remote_set) {
-            return NIXL_ERR_NOT_FOUND;
-        }
-
-        for (auto & elm : *local_set)
-            if (remote_set->count(elm) != 0)
-                backend_set->insert(elm);
-
-        if (backend_set->empty()) {
+        if (!backend_list || backend_list->empty()) {
+            drop_temp_reg();
             return NIXL_ERR_NOT_FOUND;
         }
     } else {
         for (auto & elm : extra_params->backends)
-            backend_set->insert(elm->engine);
+            if (std::find(hinted_backends.begin(), hinted_backends.end(),
+                          elm->engine) == hinted_backends.end())
+                hinted_backends.push_back(elm->engine);
+        backend_list = &hinted_backends;
     }
 
     // TODO: when central KV is supported, add a call to fetchRemoteMD
-    // TODO: merge descriptors back to back in memory (like makeXferReq).
-    // TODO [Perf]: Avoid heap allocation on the datapath, maybe use a mem pool
 
-    std::unique_ptr<nixlXferReqH> handle = std::make_unique<nixlXferReqH>();
-    handle->initiatorDescs = new nixl_meta_dlist_t (
-                                     local_descs.getType(),
-                                     local_descs.isSorted());
+    auto recycle = [this](nixlXferReqH* r) { data->recycleXferReqH(r); };
+    std::unique_ptr<nixlXferReqH, decltype(recycle)> handle(
+        data->acquireXferReqH(), recycle);
+    // From here on the handle owns the one-shot registration: every exit,
+    // including the error paths that recycle it, hands the registration
+    // to the reclamation thread
+    handle->tempRegDescs = std::move(temp_reg);
+#ifdef NIXL_XFER_TIMELINE
+    handle->timeline.createdUs = created_us;
+#endif
+    if (handle->initiatorDescs)
+        handle->initiatorDescs->reinit(local_descs.getType(),
+                                       local_descs.isSorted());
+    else
+        handle->initiatorDescs = new nixl_meta_dlist_t (
+                                         local_descs.getType(),
+                                         local_descs.isSorted());
+
+    if (handle->targetDescs)
+        handle->targetDescs->reinit(remote_descs.getType(),
+                                    remote_descs.isSorted());
+    else
+        handle->targetDescs    = new nixl_meta_dlist_t (
+                                         remote_descs.getType(),
+                                         remote_descs.isSorted());
 
-    handle->targetDescs    = new nixl_meta_dlist_t (
-                                     remote_descs.getType(),
-                                     remote_descs.isSorted());
+    // Failover (opt-in) keeps the unchosen candidates on the handle so a
+    // failed or stalled post can rebind to the next one; signal delivery
+    // is excluded since the resolved flag is backend-specific
+    const bool failover_armed = extra_params && !extra_params->hasSignal &&
+        (extra_params->enableFailover || (extra_params->failoverTimeoutUs > 0));
 
     // Currently we loop through and find first local match. Can use a
-    // preference list or more exhaustive search.
-    for (auto & backend : *backend_set) {
+    // preference list or more exhaustive search. A backend that recently
+    // failed over toward this peer is tried last (see failoverXferReq)
+    backend_list_t candidates;
+    candidates.reserve(backend_list->size());
+    nixlBackendEngine* demoted = nullptr;
+    {
+        std::lock_guard<std::mutex> lru_guard(data->remoteLRULock);
+        demoted = data->remoteSlots[remote_id].demotedEngine;
+    }
+    for (auto & backend : *backend_list)
+        if (backend != demoted)
+            candidates.push_back(backend);
+    if (demoted && (std::find(backend_list->begin(), backend_list->end(),
+                              demoted) != backend_list->end()))
+        candidates.push_back(demoted);
+
+    int remote_cursor = 0;
+    for (size_t cand = 0; cand < candidates.size(); ++cand) {
+        nixlBackendEngine* backend = candidates[cand];
         // If populate fails, it clears the resp before return
         ret1 = data->memorySection->populate(
                      local_descs, backend, *handle->initiatorDescs);
-        ret2 = data->remoteSections[remote_agent]->populate(
-                     remote_descs, backend, *handle->targetDescs);
+        // Resumable form on the remote side: a miss reports the first
+        // descriptor without metadata, and after the caller fetches it
+        // (fetchRemoteMD) the retried call answers the already resolved
+        // prefix from the section's caches instead of redoing the list
+        remote_cursor = 0;
+        ret2 = remote_sec->populatePartial(
+                     remote_descs, backend, *handle->targetDescs,
+                     remote_cursor);
 
         if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS)) {
             NIXL_INFO << "Selected backend: " << backend->getType();
             handle->engine = backend;
+            if (failover_armed)
+                handle->backupEngines.assign(candidates.begin() + cand + 1,
+                                             candidates.end());
             break;
         }
     }
 
     if (!handle->engine) {
-        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
-        return NIXL_ERR_NOT_FOUND;
+        if (remote_cursor < remote_descs.descCount())
+            NIXL_DEBUG << "remote metadata missing from descriptor "
+                       << remote_cursor << " of " << remote_descs.descCount()
+                       << " for agent " << remote_agent;
+        // No single backend serves both sides; attempt an agent-managed
+        // compound transfer staged through DRAM (see nixlCompoundXferState)
+        ret1 = createCompoundXfer(operation, local_descs, remote_descs,
+                                  remote_agent, *handle);
+        if (ret1 != NIXL_SUCCESS) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret1));
+            return ret1;
+        }
+    } else if (extra_params && extra_params->mergeDescs) {
+        // Opt-in coalescing: adjacent blocks often populate to physically
+        // contiguous descriptor pairs, and merging them lets the backend
+        // issue one operation where it would issue N
+        int desc_count = handle->initiatorDescs->descCount();
+        mergeXferDescs(*handle->initiatorDescs, *handle->targetDescs);
+        NIXL_DEBUG << "reqH descList size down to "
+                   << handle->initiatorDescs->descCount();
+        UPDATE_TELEMETRY_DATA(data->telemetry_,
+                              addDescMerge(desc_count,
+                                           handle->initiatorDescs->descCount()));
     }
 
+    NIXL_XFER_STAMP(handle, populatedUs);
+
     if (extra_params) {
         if (extra_params->hasNotif) {
             opt_args.notifMsg = extra_params->notifMsg;
             opt_args.hasNotif = true;
         }
 
+        opt_args.priority = extra_params->priority;
+
         if (extra_params->customParam.length() > 0)
             opt_args.customParam = extra_params->customParam;
+
+        if (failover_armed)
+            handle->failoverTimeout =
+                microseconds(extra_params->failoverTimeoutUs);
+
+        if (extra_params->completionCb) {
+            // Compound requests are driven from getXferStatus and never
+            // reach the poller, so there is no completion point to hook
+            if (handle->compound) {
+                UPDATE_TELEMETRY_DATA(data->telemetry_,
+                                      updateErrorCount(NIXL_ERR_NOT_SUPPORTED));
+                return NIXL_ERR_NOT_SUPPORTED;
+            }
+            handle->completionCb = extra_params->completionCb;
+        }
     }
 
-    if (opt_args.hasNotif && (!handle->engine->supportsNotif())) {
+    // Compound notifications ride on the network leg's backend
+    nixlBackendEngine* notif_engine = handle->compound ?
+                                          handle->compound->netEngine :
+                                          handle->engine;
+    if (opt_args.hasNotif && (!notif_engine->supportsNotif())) {
         UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_BACKEND));
         return NIXL_ERR_BACKEND;
     }
 
+    if (extra_params && extra_params->hasSignal) {
+        // A completion signal would need the staged pipeline to fence the
+        // final chunk on the remote; not supported for compound transfers
+        if (handle->compound) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_SUPPORTED));
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+        if (!handle->engine->supportsSignal()) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_BACKEND));
+            return NIXL_ERR_BACKEND;
+        }
+
+        // The flag must resolve against the remote section for the selected
+        // backend, like any other target descriptor
+        nixl_xfer_dlist_t signal_descs(remote_descs.getType());
+        signal_descs.addDesc(nixlBasicDesc(extra_params->signalAddr,
+                                           sizeof(uint64_t),
+                                           extra_params->signalDevId));
+        nixl_meta_dlist_t signal_meta(remote_descs.getType());
+        ret1 = data->remoteSections[remote_agent]->populate(
+                     signal_descs, handle->engine, signal_meta);
+        if (ret1 != NIXL_SUCCESS) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret1));
+            return ret1;
+        }
+
+        handle->hasSignal = true;
+        handle->signalAddr = extra_params->signalAddr;
+        handle->signalValue = extra_params->signalValue;
+        handle->signalMD = signal_meta[0].metadataP;
+    }
+
     handle->remoteAgent = remote_agent;
     handle->backendOp = operation;
     handle->status = NIXL_ERR_NOT_POSTED;
     handle->notifMsg = opt_args.notifMsg;
     handle->hasNotif = opt_args.hasNotif;
+    handle->priority = opt_args.priority;
+    handle->deadlineUs = extra_params ? extra_params->deadlineUs : 0;
     handle->telemetry.totalBytes = total_bytes;
 
-    ret1 = handle->engine->prepXfer (handle->backendOp,
-                                     *handle->initiatorDescs,
-                                     *handle->targetDescs,
-                                     handle->remoteAgent,
-                                     handle->backendHandle,
-                                     &opt_args);
-    if (ret1 != NIXL_SUCCESS) {
-        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret1));
-        return ret1;
+    if (extra_params && nixlTracer::idSet(extra_params->traceId)) {
+        handle->traceId = extra_params->traceId;
+        if (data->tracer_)
+            data->tracer_->record(handle->traceId,
+                                  nixl_trace_point_t::NIXL_TRACE_XFER_CREATED,
+                                  total_bytes);
+    }
+
+    // Compound legs are prepped chunk by chunk at post time
+    if (!handle->compound) {
+        ret1 = handle->engine->prepXfer (handle->backendOp,
+                                         *handle->initiatorDescs,
+                                         *handle->targetDescs,
+                                         handle->remoteAgent,
+                                         handle->backendHandle,
+                                         &opt_args);
+        if (ret1 != NIXL_SUCCESS) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret1));
+            return ret1;
+        }
+        NIXL_XFER_STAMP(handle, preppedUs);
+    }
+
+    req_hndl = handle.release();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::createBroadcastXferReq(const nixl_xfer_dlist_t &local_descs,
+                                  const std::vector<std::string> &remote_agents,
+                                  const std::vector<nixl_xfer_dlist_t> &remote_descs,
+                                  nixlXferReqH* &req_hndl,
+                                  const nixl_opt_args_t* extra_params) const {
+    nixl_status_t ret1, ret2;
+
+    req_hndl = nullptr;
+
+    if (remote_agents.empty() ||
+        (remote_agents.size() != remote_descs.size())) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // Broadcasts are driven from getXferStatus and never reach the
+    // poller, so there is no completion point to hook a callback
+    if (extra_params && extra_params->completionCb) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_SUPPORTED));
+        return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    // Every destination list must mirror the source list's shape
+    size_t total_bytes = 0;
+    for (int i = 0; i < local_descs.descCount(); ++i)
+        total_bytes += local_descs[i].len;
+    for (auto & descs : remote_descs) {
+        if (descs.descCount() != local_descs.descCount())
+            return NIXL_ERR_INVALID_PARAM;
+        for (int i = 0; i < descs.descCount(); ++i)
+            if (descs[i].len != local_descs[i].len)
+                return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+
+    auto bcast = std::make_unique<nixlBcastXferState>();
+    bcast->legs.reserve(remote_agents.size());
+
+    for (size_t d = 0; d < remote_agents.size(); ++d) {
+        const std::string &agent = remote_agents[d];
+        if ((agent == data->name) ||
+            (data->remoteSections.count(agent) == 0)) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
+            return NIXL_ERR_NOT_FOUND;
+        }
+
+        auto & leg = bcast->legs.emplace_back(local_descs.getType(),
+                                              remote_descs[d].getType());
+        leg.agent = agent;
+
+        // First backend serving both sides of this leg, same first-match
+        // policy as createXferReq; each leg may land on a different one
+        backend_set_t* remote_set =
+            data->remoteSections[agent]->queryBackends(remote_descs[d].getType());
+        if (!remote_set)
+            return NIXL_ERR_NOT_FOUND;
+        for (auto & backend : *remote_set) {
+            if (!backend->supportsRemote())
+                continue;
+            if (extra_params && !extra_params->backends.empty() &&
+                (std::find_if(extra_params->backends.begin(),
+                              extra_params->backends.end(),
+                              [backend](nixlBackendH* hndl)
+                              { return hndl->engine == backend; }) ==
+                 extra_params->backends.end()))
+                continue;
+            ret1 = data->memorySection->populate(
+                         local_descs, backend, leg.localDescs);
+            ret2 = data->remoteSections[agent]->populate(
+                         remote_descs[d], backend, leg.remoteDescs);
+            if ((ret1 == NIXL_SUCCESS) && (ret2 == NIXL_SUCCESS)) {
+                leg.engine = backend;
+                break;
+            }
+        }
+        if (!leg.engine) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
+            return NIXL_ERR_NOT_FOUND;
+        }
+        if (extra_params && extra_params->hasNotif &&
+            !leg.engine->supportsNotif()) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_BACKEND));
+            return NIXL_ERR_BACKEND;
+        }
+    }
+
+    bcast->totalBytes = total_bytes;
+    bcast->chunkSize  = std::min(bcast_chunk_size, total_bytes);
+
+    auto recycle = [this](nixlXferReqH* r) { data->recycleXferReqH(r); };
+    std::unique_ptr<nixlXferReqH, decltype(recycle)> handle(
+        data->acquireXferReqH(), recycle);
+
+    if (extra_params && extra_params->hasNotif) {
+        handle->notifMsg = extra_params->notifMsg;
+        handle->hasNotif = true;
     }
 
+    handle->backendOp = NIXL_WRITE;
+    handle->status    = NIXL_ERR_NOT_POSTED;
+    // Source-side egress: the full list leaves the root once per leg
+    handle->telemetry.totalBytes = total_bytes * bcast->legs.size();
+    handle->broadcast = std::move(bcast);
+
     req_hndl = handle.release();
     return NIXL_SUCCESS;
 }
@@ -912,61 +3372,248 @@ nixlAgent::estimateXferCost(const nixlXferReqH *req_hndl,
         return NIXL_ERR_NOT_FOUND;
     }
 
-    if (!req_hndl->engine) {
-        NIXL_ERROR << "Invalid request handle: engine is null";
-        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_UNKNOWN));
-        return NIXL_ERR_UNKNOWN;
+    if (!req_hndl->engine) {
+        NIXL_ERROR << "Invalid request handle: engine is null";
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_UNKNOWN));
+        return NIXL_ERR_UNKNOWN;
+    }
+
+    nixl_status_t ret = req_hndl->engine->estimateXferCost(req_hndl->backendOp,
+                                                           *req_hndl->initiatorDescs,
+                                                           *req_hndl->targetDescs,
+                                                           req_hndl->remoteAgent,
+                                                           req_hndl->backendHandle,
+                                                           duration,
+                                                           err_margin,
+                                                           method,
+                                                           extra_params);
+    if (ret != NIXL_ERR_NOT_SUPPORTED)
+        return ret;
+
+    // Backends without an estimator fall back to the agent's cost model,
+    // calibrated online from telemetry timings of completed transfers on
+    // the same backend and memory-type pair
+    size_t total_bytes = 0;
+    for (const auto &desc : *req_hndl->initiatorDescs)
+        total_bytes += desc.len;
+
+    nixlAgentData::cost_model_key_t key{req_hndl->engine,
+                                        req_hndl->initiatorDescs->getType(),
+                                        req_hndl->targetDescs->getType()};
+    std::lock_guard<std::mutex> guard(data->costModelLock);
+    auto it = data->costModels.find(key);
+    if (it == data->costModels.end())
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    ret = it->second.estimate(total_bytes, duration, err_margin);
+    if (ret == NIXL_SUCCESS)
+        method = nixl_cost_t::MEASURED;
+    return ret;
+}
+
+nixl_status_t
+nixlAgent::setXferRateLimit(const std::string &remote_agent,
+                            uint64_t bytes_per_sec,
+                            const nixl_opt_args_t* extra_params) {
+    if (remote_agent.empty())
+        return NIXL_ERR_INVALID_PARAM;
+
+    nixl_xfer_priority_t prio = extra_params ? extra_params->priority :
+                                               NIXL_XFER_PRIO_NORMAL;
+    nixlAgentData::rate_limit_key_t key{remote_agent, prio};
+    std::lock_guard<std::mutex> guard(data->rateLimitLock);
+
+    if (bytes_per_sec == 0) {
+        data->rateLimits.erase(key);
+        data->rateLimitActive.store(!data->rateLimits.empty(),
+                                    std::memory_order_relaxed);
+        return NIXL_SUCCESS;
     }
 
-    return req_hndl->engine->estimateXferCost(req_hndl->backendOp,
-                                              *req_hndl->initiatorDescs,
-                                              *req_hndl->targetDescs,
-                                              req_hndl->remoteAgent,
-                                              req_hndl->backendHandle,
-                                              duration,
-                                              err_margin,
-                                              method,
-                                              extra_params);
+    auto [it, inserted] = data->rateLimits.try_emplace(key);
+    nixlAgentData::nixlTokenBucket &bucket = it->second;
+    bucket.bytesPerSec = bytes_per_sec;
+    // One second of burst: enough slack that bursty posting keeps the
+    // pipe busy, while the cap still holds at any coarser time scale
+    bucket.burstBytes = bytes_per_sec;
+    if (inserted) {
+        bucket.tokens = (int64_t) bucket.burstBytes;
+        bucket.lastRefill = std::chrono::steady_clock::now();
+    } else if (bucket.tokens > (int64_t) bucket.burstBytes) {
+        // A rate cut caps the stored balance; accumulated debt is kept
+        bucket.tokens = (int64_t) bucket.burstBytes;
+    }
+    data->rateLimitActive.store(true, std::memory_order_relaxed);
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t
-nixlAgent::postXferReq(nixlXferReqH *req_hndl,
-                       const nixl_opt_args_t* extra_params) const {
+nixlAgent::failoverXferReq(nixlXferReqH *req_hndl) const {
+    // The original byte ranges survive populate (only the per-backend
+    // metadata pointers differ), so the candidate's descriptor lists are
+    // re-resolved from the ones on the handle
+    nixl_xfer_dlist_t local_descs  = req_hndl->initiatorDescs->trim();
+    nixl_xfer_dlist_t remote_descs = req_hndl->targetDescs->trim();
+
+    const int32_t remote_id = data->getAgentId(req_hndl->remoteAgent);
+    nixlRemoteSection *remote_sec =
+        (remote_id < 0) ? nullptr : data->remoteSlots[remote_id].section;
+    if (!remote_sec)
+        return NIXL_ERR_NOT_FOUND;
+
+    // Rebuilt from the handle rather than threaded from the caller, since
+    // stall failover fires from getXferStatus where no post args exist
     nixl_opt_b_args_t opt_args;
+    opt_args.hasNotif = req_hndl->hasNotif;
+    if (req_hndl->hasNotif)
+        opt_args.notifMsg = req_hndl->notifMsg;
+    opt_args.priority = req_hndl->priority;
 
-    opt_args.hasNotif = false;
+    nixlBackendEngine* failed = req_hndl->engine;
 
-    if (!req_hndl) {
-        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
-        return NIXL_ERR_INVALID_PARAM;
+    while (!req_hndl->backupEngines.empty()) {
+        nixlBackendEngine* backend = req_hndl->backupEngines.front();
+        req_hndl->backupEngines.erase(req_hndl->backupEngines.begin());
+
+        if (opt_args.hasNotif && !backend->supportsNotif())
+            continue;
+
+        // Resolve into scratch lists first: if every candidate fails, the
+        // handle must stay consistent with the backend it is bound to
+        nixl_meta_dlist_t local_meta(local_descs.getType(),
+                                     local_descs.isSorted());
+        nixl_meta_dlist_t remote_meta(remote_descs.getType(),
+                                      remote_descs.isSorted());
+        if (data->memorySection->populate(local_descs, backend,
+                                          local_meta) != NIXL_SUCCESS)
+            continue;
+        if (remote_sec->populate(remote_descs, backend,
+                                 remote_meta) != NIXL_SUCCESS)
+            continue;
+
+        nixlBackendReqH* backend_handle = nullptr;
+        if (backend->prepXfer(req_hndl->backendOp, local_meta, remote_meta,
+                              req_hndl->remoteAgent, backend_handle,
+                              &opt_args) != NIXL_SUCCESS)
+            continue;
+
+        nixl_status_t ret = backend->postXfer(req_hndl->backendOp,
+                                              local_meta, remote_meta,
+                                              req_hndl->remoteAgent,
+                                              backend_handle, &opt_args);
+        if (ret < 0) {
+            backend->releaseReqH(backend_handle);
+            continue;
+        }
+
+        if (req_hndl->backendHandle)
+            req_hndl->engine->releaseReqH(req_hndl->backendHandle);
+        req_hndl->engine        = backend;
+        req_hndl->backendHandle = backend_handle;
+        *req_hndl->initiatorDescs = std::move(local_meta);
+        *req_hndl->targetDescs    = std::move(remote_meta);
+        req_hndl->status        = ret;
+        req_hndl->postedTime    = std::chrono::steady_clock::now();
+
+        NIXL_WARN << "Transfer toward " << req_hndl->remoteAgent
+                  << " failed over from " << failed->getType()
+                  << " to " << backend->getType();
+
+        // Remember the failing backend for this peer so later requests
+        // pick it last (see createXferReq)
+        {
+            std::lock_guard<std::mutex> lru_guard(data->remoteLRULock);
+            data->remoteSlots[remote_id].demotedEngine = failed;
+        }
+        return ret;
     }
+    return NIXL_ERR_BACKEND;
+}
 
-    if (data->telemetry_) req_hndl->telemetry.startTime = std::chrono::steady_clock::now();
+nixl_status_t
+nixlAgent::postXferReqLocked(nixlXferReqH *req_hndl,
+                             const nixl_opt_args_t* extra_params) const {
+    nixl_opt_b_args_t opt_args;
 
-    NIXL_SHARED_LOCK_GUARD(data->lock);
-    // Check if the remote was invalidated before post/repost
-    if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
-        delete req_hndl;
+    opt_args.hasNotif = false;
+
+    // A chained request is owned by its predecessor's completion
+    // continuation until that fires; don't recycle it out from under it
+    if (req_hndl->chainPending)
+        return NIXL_ERR_REPOST_ACTIVE;
+
+    if (telemetryBuiltIn && data->telemetry_)
+        req_hndl->telemetry.startTime = std::chrono::steady_clock::now();
+
+    // Check if the remote was invalidated before post/repost; a broadcast
+    // has one remote per leg instead of a single remoteAgent
+    if (req_hndl->broadcast) {
+        for (auto & leg : req_hndl->broadcast->legs) {
+            if (data->remoteSections.count(leg.agent) == 0) {
+                data->recycleXferReqH(req_hndl);
+                UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
+                return NIXL_ERR_NOT_FOUND;
+            }
+        }
+    } else if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
+        data->recycleXferReqH(req_hndl);
         UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_NOT_FOUND));
         return NIXL_ERR_NOT_FOUND;
     }
 
     // We can't repost while a request is in progress
     if (req_hndl->status == NIXL_IN_PROG) {
-        req_hndl->status = req_hndl->engine->checkXfer(
-                                     req_hndl->backendHandle);
+        // For polled requests the poller owns checkXfer; read its status word
+        if (req_hndl->compound)
+            req_hndl->status = req_hndl->compound->progress();
+        else if (req_hndl->broadcast)
+            req_hndl->status = req_hndl->broadcast->progress();
+        else
+            req_hndl->status = req_hndl->polled ?
+                               req_hndl->pollStatus.load(std::memory_order_acquire) :
+                               req_hndl->engine->checkXfer(req_hndl->backendHandle);
         if (req_hndl->status == NIXL_IN_PROG) {
-            delete req_hndl;
+            data->recycleXferReqH(req_hndl);
             return NIXL_ERR_REPOST_ACTIVE;
         }
+        req_hndl->polled = false;
 
         if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
             data->invalidateRemoteData(req_hndl->remoteAgent);
-            delete req_hndl;
+            data->recycleXferReqH(req_hndl);
             return NIXL_ERR_REMOTE_DISCONNECT;
         }
     }
 
+    // Token-bucket admission (setXferRateLimit): a shaped post returns
+    // NIXL_ERR_NOT_POSTED without entering the backend and without
+    // consuming the handle, so the caller can repost once the bucket has
+    // refilled. Checked after the repost logic so only idle handles are
+    // turned away.
+    if (data->rateLimitActive.load(std::memory_order_relaxed)) {
+        size_t total_bytes = 0;
+        for (const auto &desc : *req_hndl->initiatorDescs)
+            total_bytes += desc.len;
+        nixl_status_t admit = NIXL_SUCCESS;
+        if (req_hndl->broadcast) {
+            // Each leg carries the full payload towards its own peer
+            for (auto & leg : req_hndl->broadcast->legs) {
+                if (!data->admitXferBytes(leg.agent, req_hndl->priority,
+                                          total_bytes)) {
+                    admit = NIXL_ERR_NOT_POSTED;
+                    break;
+                }
+            }
+        } else if (!data->admitXferBytes(req_hndl->remoteAgent,
+                                         req_hndl->priority, total_bytes)) {
+            admit = NIXL_ERR_NOT_POSTED;
+        }
+        if (admit != NIXL_SUCCESS) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateRateLimitedCount());
+            return admit;
+        }
+    }
+
     // Carrying over notification from xfer handle creation time
     if (req_hndl->hasNotif) {
         opt_args.notifMsg = req_hndl->notifMsg;
@@ -986,62 +3633,394 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
         }
     }
 
-    if (opt_args.hasNotif && (!req_hndl->engine->supportsNotif())) {
-        delete req_hndl;
-        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_BACKEND));
-        return NIXL_ERR_BACKEND;
+    // A traced request's context rides in the notification payload, so
+    // the target agent's trace buffer picks up the same id (see the
+    // unwrapping in getNotifs)
+    if (opt_args.hasNotif && nixlTracer::idSet(req_hndl->traceId))
+        opt_args.notifMsg = nixlTracer::wrapNotif(req_hndl->traceId, opt_args.notifMsg);
+
+    // Priority is fixed at creation time, when the backend bound the
+    // request to its lane
+    opt_args.priority = req_hndl->priority;
+
+    // The deadline can be refreshed per post (a reposted handle serves a
+    // new token with a new budget); it drives the batch submission order
+    // and the miss accounting, not the backend
+    if (extra_params && (extra_params->deadlineUs != 0))
+        req_hndl->deadlineUs = extra_params->deadlineUs;
+
+    // Carrying over the completion signal from xfer handle creation time;
+    // it is fixed at creation since it needs the remote section resolved
+    if (req_hndl->hasSignal) {
+        opt_args.hasSignal = true;
+        opt_args.signalAddr = req_hndl->signalAddr;
+        opt_args.signalValue = req_hndl->signalValue;
+        opt_args.signalMD = req_hndl->signalMD;
+    }
+
+    // Backends able to order the transfer on a user CUDA stream pick the
+    // stream up at post time; others ignore it
+    if (extra_params && extra_params->cudaStream)
+        opt_args.cudaStream = extra_params->cudaStream;
+
+    if (opt_args.hasNotif) {
+        // Broadcast notifications are generated per leg, so every leg's
+        // backend must support them
+        if (req_hndl->broadcast) {
+            for (auto & leg : req_hndl->broadcast->legs) {
+                if (!leg.engine->supportsNotif()) {
+                    data->recycleXferReqH(req_hndl);
+                    UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_BACKEND));
+                    return NIXL_ERR_BACKEND;
+                }
+            }
+        } else {
+            nixlBackendEngine* notif_engine = req_hndl->compound ?
+                                                  req_hndl->compound->netEngine :
+                                                  req_hndl->engine;
+            if (!notif_engine->supportsNotif()) {
+                data->recycleXferReqH(req_hndl);
+                UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_BACKEND));
+                return NIXL_ERR_BACKEND;
+            }
+        }
     }
 
     // If status is not NIXL_IN_PROG we can repost,
-    req_hndl->status = req_hndl->engine->postXfer(req_hndl->backendOp,
-                                                  *req_hndl->initiatorDescs,
-                                                  *req_hndl->targetDescs,
-                                                  req_hndl->remoteAgent,
-                                                  req_hndl->backendHandle,
-                                                  &opt_args);
+    if (req_hndl->broadcast) {
+        // Rewind the chain; the first progress pass posts the head legs
+        // of the wavefront. Notifications are generated by the agent
+        // towards each destination once every leg has completed, since no
+        // backend request spans the whole broadcast
+        req_hndl->broadcast->restart();
+        req_hndl->status = req_hndl->broadcast->progress();
+        if ((req_hndl->status == NIXL_SUCCESS) && opt_args.hasNotif)
+            for (auto & leg : req_hndl->broadcast->legs)
+                leg.engine->genNotif(leg.agent, opt_args.notifMsg);
+    } else if (req_hndl->compound) {
+        // Rewind the staged pipeline; the first progress pass posts the
+        // initial legs on the idle staging buffers. The notification is
+        // generated by the agent once the last chunk lands, since neither
+        // leg's backend sees the whole transfer
+        req_hndl->compound->restart();
+        req_hndl->status = req_hndl->compound->progress();
+        if ((req_hndl->status == NIXL_SUCCESS) && opt_args.hasNotif)
+            req_hndl->compound->netEngine->genNotif(req_hndl->remoteAgent,
+                                                    opt_args.notifMsg);
+    } else {
+        req_hndl->status = req_hndl->engine->postXfer(req_hndl->backendOp,
+                                                      *req_hndl->initiatorDescs,
+                                                      *req_hndl->targetDescs,
+                                                      req_hndl->remoteAgent,
+                                                      req_hndl->backendHandle,
+                                                      &opt_args);
+    }
     if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
         data->invalidateRemoteData(req_hndl->remoteAgent);
-        delete req_hndl;
+        data->recycleXferReqH(req_hndl);
         return NIXL_ERR_REMOTE_DISCONNECT;
     }
 
-    if (data->telemetry_) {
+    // Post-error failover: rebind to the next recorded candidate and
+    // repost there; on success req_hndl->status carries the new post's
+    // status and the caller never sees the original error
+    if ((req_hndl->status < 0) && !req_hndl->backupEngines.empty()) {
+        NIXL_WARN << "Post toward " << req_hndl->remoteAgent
+                  << " failed with " << req_hndl->status
+                  << ", attempting backend failover";
+        failoverXferReq(req_hndl);
+    }
+
+    // Stall detection (see failoverTimeout) measures from the last post
+    if ((req_hndl->status == NIXL_IN_PROG) &&
+        (req_hndl->failoverTimeout.count() > 0))
+        req_hndl->postedTime = std::chrono::steady_clock::now();
+
+    NIXL_XFER_STAMP(req_hndl, postedUs);
+    if (req_hndl->status != NIXL_IN_PROG)
+        NIXL_XFER_STAMP(req_hndl, completedUs);
+
+    if (telemetryBuiltIn && data->telemetry_) {
         if (req_hndl->status < 0) {
             data->telemetry_->updateErrorCount(req_hndl->status);
         } else if (req_hndl->status == NIXL_IN_PROG) {
             req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_POST);
         } else {
             req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_POST_AND_FINISH);
+            data->recordXferSample(req_hndl);
         }
     }
 
+    if (data->tracer_ && nixlTracer::idSet(req_hndl->traceId)) {
+        if (req_hndl->status < 0)
+            data->tracer_->record(req_hndl->traceId,
+                                  nixl_trace_point_t::NIXL_TRACE_XFER_FAILED,
+                                  -req_hndl->status);
+        else
+            data->tracer_->record(req_hndl->traceId,
+                                  nixl_trace_point_t::NIXL_TRACE_XFER_POSTED,
+                                  req_hndl->telemetry.totalBytes);
+        if (req_hndl->status == NIXL_SUCCESS)
+            data->tracer_->record(req_hndl->traceId,
+                                  nixl_trace_point_t::NIXL_TRACE_XFER_COMPLETED,
+                                  req_hndl->telemetry.totalBytes);
+    }
+
+    // The completion poller drives a single backend handle; compound and
+    // broadcast requests advance through getXferStatus calls instead. A
+    // creation-time completion callback re-arms on every post, so each
+    // async completion is pushed from the poller's progress context
+    if ((req_hndl->status == NIXL_IN_PROG) && !req_hndl->compound &&
+        !req_hndl->broadcast &&
+        ((extra_params && extra_params->backgroundPolling) ||
+         req_hndl->completionCb)) {
+        if (req_hndl->completionCb)
+            req_hndl->doneCb = req_hndl->completionCb;
+        data->enqueuePoll(req_hndl);
+    }
+
     return req_hndl->status;
 }
 
+nixl_status_t
+nixlAgent::postXferReq(nixlXferReqH *req_hndl,
+                       const nixl_opt_args_t* extra_params) const {
+    if (!req_hndl) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    if (extra_params && extra_params->chainAfter)
+        return chainXferReq(req_hndl, extra_params);
+    return postXferReqLocked(req_hndl, extra_params);
+}
+
+nixl_status_t
+nixlAgent::chainXferReq(nixlXferReqH *req_hndl,
+                        const nixl_opt_args_t* extra_params) const {
+    nixlXferReqH *pred = extra_params->chainAfter;
+
+    if (pred == req_hndl) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    // The completion poller drives a single backend handle; compound and
+    // broadcast predecessors advance through getXferStatus and offer no
+    // completion point to hook (as with onXferCompletion)
+    if (pred->compound || pred->broadcast)
+        return NIXL_ERR_NOT_SUPPORTED;
+    if (req_hndl->chainPending)
+        return NIXL_ERR_REPOST_ACTIVE;
+
+    // Post args for the deferred leg, minus the chain marker so the
+    // continuation takes the regular path
+    nixl_opt_args_t next_params = *extra_params;
+    next_params.chainAfter = nullptr;
+
+    const nixl_status_t pred_status = pred->status.load(std::memory_order_acquire);
+    if (pred_status != NIXL_IN_PROG) {
+        // Predecessor already terminal: a success posts right away, a
+        // failure severs the chain without entering the backend
+        if (pred_status != NIXL_SUCCESS)
+            return (pred_status < 0) ? pred_status : NIXL_ERR_INVALID_PARAM;
+        return postXferReqLocked(req_hndl, &next_params);
+    }
+
+    // Report the chained request as in flight until the continuation
+    // posts it; getXferStatus short-circuits on chainPending so the
+    // backend is never entered with the yet-unposted handle
+    req_hndl->chainPending = true;
+    req_hndl->status.store(NIXL_IN_PROG, std::memory_order_release);
+
+    // Fired once by the poller from its progress context, outside the
+    // agent lock, the instant the predecessor reaches a terminal status
+    auto continuation = [this, req_hndl,
+                         next_params = std::move(next_params)](nixl_status_t pred_ret) {
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        req_hndl->chainPending = false;
+        if (pred_ret != NIXL_SUCCESS) {
+            req_hndl->status.store((pred_ret < 0) ? pred_ret : NIXL_ERR_BACKEND,
+                                   std::memory_order_release);
+            return;
+        }
+        req_hndl->status.store(NIXL_ERR_NOT_POSTED, std::memory_order_relaxed);
+        postXferReqLocked(req_hndl, &next_params);
+    };
+
+    nixl_status_t ret = data->armXferCallback(pred, std::move(continuation));
+    if (ret != NIXL_IN_PROG) {
+        // Predecessor finished between the status check and arming; the
+        // callback was not installed, resolve the chain inline
+        req_hndl->chainPending = false;
+        req_hndl->status.store(NIXL_ERR_NOT_POSTED, std::memory_order_relaxed);
+        if (ret != NIXL_SUCCESS)
+            return (ret < 0) ? ret : NIXL_ERR_INVALID_PARAM;
+        return postXferReqLocked(req_hndl, &next_params);
+    }
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t
+nixlAgent::postXferReqBatch(const std::vector<nixlXferReqH*> &req_hndls,
+                            const nixl_opt_args_t* extra_params) const {
+    nixl_status_t ret, bad_ret = NIXL_SUCCESS;
+
+    // Validate upfront so a null entry doesn't abort the batch midway
+    for (auto & req_hndl : req_hndls) {
+        if (!req_hndl) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    // Earliest-deadline-first submission (see nixl_opt_args_t::deadlineUs):
+    // both the UCX posting order and the io_uring SQE order follow the
+    // post order, so sorting here is what decides who queues behind whom
+    // under congestion. Deadline-bearing requests go first by deadline,
+    // deadline-less ones keep their given order after them
+    std::vector<nixlXferReqH*> ordered;
+    const std::vector<nixlXferReqH*> *post_order = &req_hndls;
+    if (std::any_of(req_hndls.begin(), req_hndls.end(),
+                    [](const nixlXferReqH* r) { return r->deadlineUs != 0; })) {
+        ordered = req_hndls;
+        std::stable_sort(ordered.begin(), ordered.end(),
+                         [](const nixlXferReqH* a, const nixlXferReqH* b) {
+                             if ((a->deadlineUs == 0) != (b->deadlineUs == 0))
+                                 return a->deadlineUs != 0;
+                             return a->deadlineUs < b->deadlineUs;
+                         });
+        post_order = &ordered;
+    }
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Best effort, post the whole batch and report the first error
+    bool in_prog = false;
+    for (auto & req_hndl : *post_order) {
+        ret = postXferReqLocked(req_hndl, extra_params);
+        if (ret == NIXL_IN_PROG)
+            in_prog = true;
+        else if ((ret < 0) && (bad_ret == NIXL_SUCCESS))
+            bad_ret = ret;
+    }
+
+    if (bad_ret != NIXL_SUCCESS)
+        return bad_ret;
+    return in_prog ? NIXL_IN_PROG : NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::getXferStatus (nixlXferReqH *req_hndl) const {
 
+    // Fast path: terminal statuses never change until the handle is
+    // reposted or recycled, so poll loops dominated by already-completed
+    // requests answer with one uncontended load instead of taking the
+    // shared lock and entering the backend. Acquire pairs with the
+    // completing thread's store, so the transferred data is visible too.
+    const nixl_status_t cur_status =
+        req_hndl->status.load(std::memory_order_acquire);
+    if (cur_status != NIXL_IN_PROG)
+        return cur_status;
+
     NIXL_SHARED_LOCK_GUARD(data->lock);
+    return getXferStatusLocked(req_hndl);
+}
+
+nixl_status_t
+nixlAgent::getXferStatusLocked (nixlXferReqH *req_hndl) const {
+
     // If the status is done, no need to recheck and no state changes.
     // Same for users incorrectly recalling this method in error/done.
     if (req_hndl->status == NIXL_IN_PROG) {
-        // Check if the remote was invalidated before completion
-        if (data->remoteSections.count(req_hndl->remoteAgent) == 0) {
-            delete req_hndl;
+        // A chained request has not entered a backend yet; the
+        // predecessor's completion continuation performs the real post
+        // (see chainXferReq) and owns the handle until then
+        if (req_hndl->chainPending)
+            return NIXL_IN_PROG;
+
+        // Check if the remote was invalidated before completion; broadcast
+        // legs surface a dropped peer through their own checkXfer
+        if (!req_hndl->broadcast &&
+            (data->remoteSections.count(req_hndl->remoteAgent) == 0)) {
+            data->recycleXferReqH(req_hndl);
             return NIXL_ERR_NOT_FOUND;
         }
 
-        req_hndl->status = req_hndl->engine->checkXfer(req_hndl->backendHandle);
+        if (req_hndl->broadcast) {
+            // Broadcasts are driven from here like compound transfers;
+            // once every leg completed, notify each destination
+            req_hndl->status = req_hndl->broadcast->progress();
+            if ((req_hndl->status == NIXL_SUCCESS) && req_hndl->hasNotif)
+                for (auto & leg : req_hndl->broadcast->legs)
+                    leg.engine->genNotif(leg.agent,
+                                         nixlTracer::wrapNotif(req_hndl->traceId,
+                                                               req_hndl->notifMsg));
+        } else if (req_hndl->compound) {
+            // Compound transfers are driven from here: each status check
+            // reaps finished legs and posts the next ones
+            req_hndl->status = req_hndl->compound->progress();
+            if ((req_hndl->status == NIXL_SUCCESS) && req_hndl->hasNotif)
+                req_hndl->compound->netEngine->genNotif(
+                    req_hndl->remoteAgent,
+                    nixlTracer::wrapNotif(req_hndl->traceId, req_hndl->notifMsg));
+        } else if (req_hndl->polled) {
+            // The completion poller owns checkXfer for this request and
+            // publishes into the status word; don't enter the backend
+            req_hndl->status = req_hndl->pollStatus.load(std::memory_order_acquire);
+            if (req_hndl->status != NIXL_IN_PROG)
+                req_hndl->polled = false;
+        } else {
+            req_hndl->status = req_hndl->engine->checkXfer(req_hndl->backendHandle);
+
+            // Stall failover: a request armed with a timeout that is still
+            // in flight past it gets canceled and reposted on the next
+            // candidate; a backend that cannot cancel disarms the timer so
+            // the transfer keeps running undisturbed
+            if ((req_hndl->status == NIXL_IN_PROG) &&
+                (req_hndl->failoverTimeout.count() > 0) &&
+                !req_hndl->backupEngines.empty() &&
+                ((std::chrono::steady_clock::now() - req_hndl->postedTime) >
+                 req_hndl->failoverTimeout)) {
+                if (req_hndl->engine->cancelXfer(req_hndl->backendHandle) ==
+                    NIXL_SUCCESS) {
+                    NIXL_WARN << "Transfer toward " << req_hndl->remoteAgent
+                              << " stalled past its failover timeout, "
+                              << "attempting backend failover";
+                    nixl_status_t fo_ret = failoverXferReq(req_hndl);
+                    // The original post was canceled; if no candidate took
+                    // over, the request is failed rather than left dangling
+                    if (fo_ret < 0)
+                        req_hndl->status = fo_ret;
+                } else {
+                    req_hndl->failoverTimeout = microseconds(0);
+                }
+            }
+        }
         if (req_hndl->status == NIXL_ERR_REMOTE_DISCONNECT) {
             data->invalidateRemoteData(req_hndl->remoteAgent);
-            delete req_hndl;
+            data->recycleXferReqH(req_hndl);
             return NIXL_ERR_REMOTE_DISCONNECT;
         }
-        if (data->telemetry_) {
+        if (req_hndl->status != NIXL_IN_PROG)
+            NIXL_XFER_STAMP(req_hndl, completedUs);
+        if (data->tracer_ && (req_hndl->status != NIXL_IN_PROG) &&
+            nixlTracer::idSet(req_hndl->traceId)) {
+            if (req_hndl->status == NIXL_SUCCESS)
+                data->tracer_->record(req_hndl->traceId,
+                                      nixl_trace_point_t::NIXL_TRACE_XFER_COMPLETED,
+                                      req_hndl->telemetry.totalBytes);
+            else
+                data->tracer_->record(req_hndl->traceId,
+                                      nixl_trace_point_t::NIXL_TRACE_XFER_FAILED,
+                                      -req_hndl->status);
+        }
+        if (telemetryBuiltIn && data->telemetry_) {
             if (req_hndl->status == NIXL_SUCCESS) {
                 req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_FINISH);
+                data->recordXferSample(req_hndl);
             } else if (req_hndl->status < 0) {
                 data->telemetry_->updateErrorCount(req_hndl->status);
+                req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_ABORT);
             }
         }
     }
@@ -1049,13 +4028,134 @@ nixlAgent::getXferStatus (nixlXferReqH *req_hndl) const {
     return req_hndl->status;
 }
 
+nixl_status_t
+nixlAgent::getXferStatusBatch (const std::vector<nixlXferReqH*> &req_hndls,
+                               std::vector<nixl_status_t> &statuses) const {
+
+    // Validate upfront so a null entry doesn't abort the batch midway
+    for (auto & req_hndl : req_hndls) {
+        if (!req_hndl) {
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+            return NIXL_ERR_INVALID_PARAM;
+        }
+    }
+
+    statuses.resize(req_hndls.size());
+
+    // First pass without the lock: terminal status words answer from
+    // their atomic load alone, so a poll tick dominated by completed
+    // requests never takes the lock at all
+    bool any_in_prog = false;
+    for (size_t i = 0; i < req_hndls.size(); ++i) {
+        statuses[i] = req_hndls[i]->status.load(std::memory_order_acquire);
+        if (statuses[i] == NIXL_IN_PROG)
+            any_in_prog = true;
+    }
+
+    nixl_status_t bad_ret = NIXL_SUCCESS;
+    if (any_in_prog) {
+        // One lock acquisition drives every still-in-flight request,
+        // instead of a lock/backend round trip per handle per tick
+        NIXL_SHARED_LOCK_GUARD(data->lock);
+        for (size_t i = 0; i < req_hndls.size(); ++i) {
+            if (statuses[i] == NIXL_IN_PROG)
+                statuses[i] = getXferStatusLocked(req_hndls[i]);
+        }
+    }
+
+    bool in_prog = false;
+    for (auto & status : statuses) {
+        if (status == NIXL_IN_PROG)
+            in_prog = true;
+        else if ((status < 0) && (bad_ret == NIXL_SUCCESS))
+            bad_ret = status;
+    }
+
+    if (bad_ret != NIXL_SUCCESS)
+        return bad_ret;
+    return in_prog ? NIXL_IN_PROG : NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getXferProgress(nixlXferReqH *req_hndl, size_t &bytes_done) const {
+    if (!req_hndl) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    bytes_done = 0;
+    // Drive the transfer through the regular status path first, so the
+    // backend's completion accounting reflects this poll
+    nixl_status_t status = getXferStatus(req_hndl);
+    if (status < 0)
+        return status; // on disconnect/invalidation the handle was recycled
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // A broadcast is as done as its slowest leg: report the bytes
+    // delivered to every destination so far
+    if (req_hndl->broadcast) {
+        bytes_done = req_hndl->broadcast->totalBytes;
+        for (auto & leg : req_hndl->broadcast->legs)
+            bytes_done = std::min(bytes_done, leg.doneBytes);
+        return status;
+    }
+
+    // Compound requests span two backends with no single byte count;
+    // polled requests' backend handles are owned by the poller thread,
+    // and chained requests have not entered a backend yet
+    if (req_hndl->compound || req_hndl->polled || req_hndl->chainPending)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    nixl_status_t ret = req_hndl->engine->getXferProgress(req_hndl->backendHandle, bytes_done);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+    return status;
+}
+
+nixl_status_t
+nixlAgent::onXferCompletion(nixlXferReqH* req_hndl,
+                            std::function<void(nixl_status_t)> cb) const {
+    if (!req_hndl || !cb)
+        return NIXL_ERR_INVALID_PARAM;
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Compound and broadcast transfers are driven from getXferStatus and
+    // never reach the poller, so there is no completion point to hook
+    if (req_hndl->compound || req_hndl->broadcast)
+        return NIXL_ERR_NOT_SUPPORTED;
+    if (req_hndl->status != NIXL_IN_PROG)
+        return req_hndl->status;
+
+    return data->armXferCallback(req_hndl, std::move(cb));
+}
 
 nixl_status_t
 nixlAgent::queryXferBackend(const nixlXferReqH* req_hndl,
                             nixlBackendH* &backend) const {
-    NIXL_LOCK_GUARD(data->lock);
-    backend = data->backendHandles[req_hndl->engine->getType()];
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Compound requests span two backends and have no single engine
+    if (!req_hndl->engine)
+        return NIXL_ERR_NOT_FOUND;
+    auto it = data->backendHandles.find(req_hndl->engine->getType());
+    if (it == data->backendHandles.end())
+        return NIXL_ERR_NOT_FOUND;
+    backend = it->second;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::getXferTimeline(const nixlXferReqH* req_hndl,
+                           nixl_xfer_timeline_t &timeline) const {
+#ifdef NIXL_XFER_TIMELINE
+    if (!req_hndl)
+        return NIXL_ERR_INVALID_PARAM;
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    timeline = req_hndl->timeline;
     return NIXL_SUCCESS;
+#else
+    // Stamps compile to no-ops without -Dxfer_timeline=true
+    return NIXL_ERR_NOT_SUPPORTED;
+#endif
 }
 
 nixl_status_t
@@ -1064,10 +4164,26 @@ nixlAgent::releaseXferReq(nixlXferReqH *req_hndl) const {
     NIXL_SHARED_LOCK_GUARD(data->lock);
     //attempt to cancel request
     if(req_hndl->status == NIXL_IN_PROG) {
-        req_hndl->status = req_hndl->engine->checkXfer(
-                                     req_hndl->backendHandle);
+        // The predecessor's completion continuation still holds this
+        // handle (see chainXferReq); it cannot be recycled yet
+        if (req_hndl->chainPending)
+            return NIXL_ERR_REPOST_ACTIVE;
+
+        if (req_hndl->compound || req_hndl->broadcast) {
+            // In-flight legs are released by the compound or broadcast
+            // state teardown when the handle is recycled below
+        } else if (req_hndl->polled) {
+            // Detach from the poller before touching the backend handle
+            data->pollerRemove(req_hndl);
+            req_hndl->polled = false;
+            req_hndl->status = req_hndl->pollStatus.load(std::memory_order_acquire);
+        } else {
+            req_hndl->status = req_hndl->engine->checkXfer(
+                                         req_hndl->backendHandle);
+        }
 
-        if(req_hndl->status == NIXL_IN_PROG) {
+        if((req_hndl->status == NIXL_IN_PROG) &&
+           !req_hndl->compound && !req_hndl->broadcast) {
 
             req_hndl->status = req_hndl->engine->releaseReqH(
                                          req_hndl->backendHandle);
@@ -1080,13 +4196,70 @@ nixlAgent::releaseXferReq(nixlXferReqH *req_hndl) const {
             req_hndl->backendHandle = nullptr;
         }
     }
-    delete req_hndl;
+    data->recycleXferReqH(req_hndl);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgent::cancelXferReq(nixlXferReqH *req_hndl) const {
+    if (!req_hndl) {
+        UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(NIXL_ERR_INVALID_PARAM));
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Nothing in flight; report the terminal status as-is
+    if (req_hndl->status != NIXL_IN_PROG)
+        return req_hndl->status;
+
+    // Compound and broadcast legs are posted lazily from getXferStatus, so
+    // there is no single backend handle whose outstanding work could be
+    // aborted
+    if (req_hndl->compound || req_hndl->broadcast)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    if (req_hndl->polled) {
+        // Detach from the poller before touching the backend handle
+        data->pollerRemove(req_hndl);
+        req_hndl->polled = false;
+        req_hndl->status = req_hndl->pollStatus.load(std::memory_order_acquire);
+        if (req_hndl->status != NIXL_IN_PROG)
+            return req_hndl->status; // completed before the cancel won
+    }
+
+    nixl_status_t ret = req_hndl->engine->cancelXfer(req_hndl->backendHandle);
+    if (ret != NIXL_SUCCESS) {
+        // The transfer keeps running; the caller can fall back to
+        // releaseXferReq or keep polling getXferStatus
+        if (ret != NIXL_ERR_NOT_SUPPORTED)
+            UPDATE_TELEMETRY_DATA(data->telemetry_, updateErrorCount(ret));
+        return ret;
+    }
+
+    req_hndl->status = NIXL_ERR_CANCELED;
+    if (telemetryBuiltIn && data->telemetry_)
+        req_hndl->updateRequestStats(data->telemetry_, NIXL_TELEMETRY_ABORT);
+    NIXL_XFER_STAMP(req_hndl, completedUs);
     return NIXL_SUCCESS;
 }
 
 nixl_status_t
 nixlAgent::releasedDlistH (nixlDlistH* dlist_hndl) const {
-    NIXL_LOCK_GUARD(data->lock);
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    if (dlist_hndl->cached) {
+        std::lock_guard<std::mutex> guard(data->dlistCacheLock);
+        // Shared through the prepped-dlist cache; the entry stays at zero
+        // references for reuse until the underlying section changes
+        auto range = data->dlistCache.equal_range(dlist_hndl->cacheKey);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second.handle == dlist_hndl) {
+                if (it->second.refCount > 0)
+                    it->second.refCount--;
+                return NIXL_SUCCESS;
+            }
+        }
+        return NIXL_ERR_NOT_FOUND;
+    }
     delete dlist_hndl;
     return NIXL_SUCCESS;
 }
@@ -1098,7 +4271,81 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
     nixl_status_t   ret, bad_ret=NIXL_SUCCESS;
     backend_list_t* backend_list;
 
-    NIXL_LOCK_GUARD(data->lock);
+    // Drains run as readers so they never contend with transfer creation;
+    // notifLock keeps each backend's notification path single-entrant
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    std::lock_guard<std::mutex> notif_guard(data->notifLock);
+    if (!extra_params || extra_params->backends.size() == 0) {
+        backend_list = &data->notifEngines;
+        if (backend_list->empty())
+            return NIXL_ERR_BACKEND;
+    } else {
+        backend_list = new backend_list_t();
+        for (auto & elm : extra_params->backends)
+            if (elm->engine->supportsNotif())
+                backend_list->push_back(elm->engine);
+
+        if (backend_list->empty()) {
+            delete backend_list;
+            return NIXL_ERR_BACKEND;
+        }
+    }
+
+    // Doing best effort, if any backend errors out we return
+    // error but proceed with the rest. We can add metadata about
+    // the backend to the msg, but user could put it themselves.
+    for (auto & eng: *backend_list) {
+        bknd_notif_list.clear();
+        ret = eng->getNotifs(bknd_notif_list);
+        if (ret < 0)
+            bad_ret=ret;
+
+        if (bknd_notif_list.size() == 0)
+            continue;
+
+        for (auto & elm: bknd_notif_list) {
+            // Traced notifications carry their request's trace context in
+            // a frame the initiator prepended; strip it before the message
+            // reaches the application and stitch our timeline to theirs
+            nixl_trace_id_t trace_id;
+            if (nixlTracer::unwrapNotif(elm.second, trace_id) && data->tracer_)
+                data->tracer_->record(trace_id,
+                                      nixl_trace_point_t::NIXL_TRACE_NOTIF_RECEIVED,
+                                      elm.second.size());
+
+            if (notif_map.count(elm.first) == 0)
+                notif_map[elm.first] = std::vector<nixl_blob_t>();
+
+            notif_map[elm.first].push_back(elm.second);
+        }
+    }
+
+    // Locally generated SLO breach events ride the same drain, keyed by
+    // this agent's own name, so a control plane polling notifications
+    // sees them in-band next to peer messages (see NIXL_TELEMETRY_SLO_US)
+    if (telemetryBuiltIn && data->telemetry_) {
+        bknd_notif_list.clear();
+        data->telemetry_->drainSloBreaches(data->name, bknd_notif_list);
+        for (auto & elm: bknd_notif_list)
+            notif_map[elm.first].push_back(elm.second);
+    }
+
+    if (extra_params && extra_params->backends.size() > 0)
+        delete backend_list;
+
+    return bad_ret;
+}
+
+nixl_status_t
+nixlAgent::getNotifsView(nixlNotifsH* &notif_hndl,
+                         nixl_notifs_view_t &notif_views,
+                         const nixl_opt_args_t* extra_params) {
+    notif_list_t    bknd_notif_list;
+    nixl_status_t   ret, bad_ret=NIXL_SUCCESS;
+    backend_list_t* backend_list;
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    std::lock_guard<std::mutex> notif_guard(data->notifLock);
     if (!extra_params || extra_params->backends.size() == 0) {
         backend_list = &data->notifEngines;
         if (backend_list->empty())
@@ -1115,9 +4362,12 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
         }
     }
 
-    // Doing best effort, if any backend errors out we return
-    // error but proceed with the rest. We can add metadata about
-    // the backend to the msg, but user could put it themselves.
+    if (!notif_hndl)
+        notif_hndl = new nixlNotifsH();
+
+    // Same best effort policy as getNotifs, but the drained batches are
+    // moved into the handle and only views are handed out, skipping the
+    // per-message copy and map insertion of the map based variant
     for (auto & eng: *backend_list) {
         bknd_notif_list.clear();
         ret = eng->getNotifs(bknd_notif_list);
@@ -1127,11 +4377,30 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
         if (bknd_notif_list.size() == 0)
             continue;
 
+        // Same trace unwrapping as getNotifs, done before the views are
+        // taken so they point at the application payload only
         for (auto & elm: bknd_notif_list) {
-            if (notif_map.count(elm.first) == 0)
-                notif_map[elm.first] = std::vector<nixl_blob_t>();
+            nixl_trace_id_t trace_id;
+            if (nixlTracer::unwrapNotif(elm.second, trace_id) && data->tracer_)
+                data->tracer_->record(trace_id,
+                                      nixl_trace_point_t::NIXL_TRACE_NOTIF_RECEIVED,
+                                      elm.second.size());
+        }
 
-            notif_map[elm.first].push_back(elm.second);
+        notif_hndl->batches.push_back(std::move(bknd_notif_list));
+        for (const auto & elm: notif_hndl->batches.back())
+            notif_views.push_back({elm.first, elm.second});
+    }
+
+    // SLO breach events join the drain as one extra batch, same as the
+    // map based variant above
+    if (telemetryBuiltIn && data->telemetry_) {
+        notif_list_t slo_list;
+        data->telemetry_->drainSloBreaches(data->name, slo_list);
+        if (!slo_list.empty()) {
+            notif_hndl->batches.push_back(std::move(slo_list));
+            for (const auto & elm: notif_hndl->batches.back())
+                notif_views.push_back({elm.first, elm.second});
         }
     }
 
@@ -1141,6 +4410,14 @@ nixlAgent::getNotifs(nixl_notifs_t &notif_map,
     return bad_ret;
 }
 
+nixl_status_t
+nixlAgent::releaseNotifs(nixlNotifsH* notif_hndl) {
+    if (!notif_hndl)
+        return NIXL_ERR_INVALID_PARAM;
+    delete notif_hndl;
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::genNotif(const std::string &remote_agent,
                     const nixl_blob_t &msg,
@@ -1164,12 +4441,25 @@ nixlAgent::genNotif(const std::string &remote_agent,
         return NIXL_ERR_BACKEND;
     }
 
+    // Standalone notifications can carry a trace context too, so control
+    // messages show up on the same merged timeline as the transfers
+    nixl_blob_t wrapped_msg;
+    const nixl_blob_t *send_msg = &msg;
+    if (extra_params && nixlTracer::idSet(extra_params->traceId)) {
+        wrapped_msg = nixlTracer::wrapNotif(extra_params->traceId, msg);
+        send_msg = &wrapped_msg;
+        if (data->tracer_)
+            data->tracer_->record(extra_params->traceId,
+                                  nixl_trace_point_t::NIXL_TRACE_NOTIF_SENT,
+                                  msg.size());
+    }
+
     NIXL_SHARED_LOCK_GUARD(data->lock);
 
     if (data->name == remote_agent) {
         for (const auto &eng : *backend_list) {
             if (eng->supportsLocal()) {
-                return eng->genNotif(remote_agent, msg);
+                return eng->genNotif(remote_agent, *send_msg);
             }
         }
         return NIXL_ERR_NOT_FOUND;
@@ -1179,7 +4469,7 @@ nixlAgent::genNotif(const std::string &remote_agent,
     if (iter != data->remoteBackends.end()) {
         for (const auto &eng : *backend_list) {
             if (iter->second.count(eng->getType()) != 0) {
-                return eng->genNotif(remote_agent, msg);
+                return eng->genNotif(remote_agent, *send_msg);
             }
         }
     }
@@ -1187,49 +4477,292 @@ nixlAgent::genNotif(const std::string &remote_agent,
 }
 
 nixl_status_t
-nixlAgent::getLocalMD (nixl_blob_t &str) const {
+nixlAgent::genNotifBatch(const std::string &remote_agent,
+                         const std::vector<nixl_blob_t> &msgs,
+                         const nixl_opt_args_t *extra_params) const {
+
+    backend_list_t backend_list_value;
+    backend_list_t *backend_list;
+
+    if (msgs.empty())
+        return NIXL_SUCCESS;
+
+    if (!extra_params || extra_params->backends.empty()) {
+        backend_list = &data->notifEngines;
+    } else {
+        backend_list = &backend_list_value;
+        for (auto &elm : extra_params->backends) {
+            if (elm->engine->supportsNotif()) {
+                backend_list->push_back(elm->engine);
+            }
+        }
+    }
+
+    if (backend_list->empty()) {
+        return NIXL_ERR_BACKEND;
+    }
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+
+    if (data->name == remote_agent) {
+        for (const auto &eng : *backend_list) {
+            if (eng->supportsLocal()) {
+                return eng->genNotifBatch(remote_agent, msgs);
+            }
+        }
+        return NIXL_ERR_NOT_FOUND;
+    }
+    const auto iter = data->remoteBackends.find(remote_agent);
+
+    if (iter != data->remoteBackends.end()) {
+        for (const auto &eng : *backend_list) {
+            if (iter->second.count(eng->getType()) != 0) {
+                return eng->genNotifBatch(remote_agent, msgs);
+            }
+        }
+    }
+    return NIXL_ERR_NOT_FOUND;
+}
+
+// Agent metadata wire format: a fixed-layout envelope parsed by direct
+// field access, in place of the tag-per-field serdes stream that cost the
+// receiver a string compare per field on the peer-join path. The envelope
+// carries the fields every load touches (agent name, connection info);
+// the memory-section payload behind it stays a tagged serdes stream, so
+// section-level format evolution doesn't need an envelope version bump.
+// Variable-size fields are length-prefixed rather than indexed by an
+// up-front offset table, which would break the streaming serialization
+// path (serializeLocalMDToSink emits bytes before the section size is
+// known). Readers still accept the legacy fully-tagged layout from older
+// peers; see loadRemoteMDEnvelope.
+static constexpr uint32_t md_envelope_magic = 0x444D584E; // "NXMD"
+static constexpr uint16_t md_envelope_version = 1;
+
+enum nixl_md_kind_t : uint16_t {
+    NIXL_MD_FULL = 0, // conns + full section + sender generation
+    NIXL_MD_PARTIAL = 1, // optional conns + partial section, no generation
+    NIXL_MD_DIFF = 2, // section journal diff on top of loaded full MD
+};
+
+struct nixlMDHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t kind;
+    uint64_t gen; // Sender's section generation; NIXL_MD_FULL only
+    uint32_t nameLen; // Agent name bytes following the header
+    uint32_t connCnt; // {u32 typeLen, u32 infoLen, bytes, bytes} entries
+};
+static_assert(sizeof(nixlMDHeader) == 24, "no padding in the wire layout");
+
+static void
+appendMDHeader (std::string &out, uint16_t kind, uint64_t gen,
+                const std::string &name, size_t conn_cnt) {
+    nixlMDHeader hdr;
+    hdr.magic = md_envelope_magic;
+    hdr.version = md_envelope_version;
+    hdr.kind = kind;
+    hdr.gen = gen;
+    hdr.nameLen = static_cast<uint32_t>(name.size());
+    hdr.connCnt = static_cast<uint32_t>(conn_cnt);
+    out.append(reinterpret_cast<const char*>(&hdr), sizeof(hdr));
+    out.append(name);
+}
+
+static void
+appendMDConnEntry (std::string &out, const std::string &type,
+                   const std::string &info) {
+    const uint32_t lens[2] = {static_cast<uint32_t>(type.size()),
+                              static_cast<uint32_t>(info.size())};
+    out.append(reinterpret_cast<const char*>(lens), sizeof(lens));
+    out.append(type);
+    out.append(info);
+}
+
+nixl_status_t
+nixlAgentData::serializeLocalMD (nixl_blob_t &str) const {
+    str.clear();
+    // Stream into the output blob chunk by chunk; same bytes as before,
+    // minus the full-size intermediate copy exportStr would make
+    return serializeLocalMDToSink(
+        [&str](const void *buf, size_t len) -> nixl_status_t {
+            str.append(reinterpret_cast<const char*>(buf), len);
+            return NIXL_SUCCESS;
+        });
+}
+
+nixl_status_t
+nixlAgentData::serializeLocalMDToSink (
+    const std::function<nixl_status_t(const void *buf, size_t len)> &sink) const {
+    // Flush granularity: large enough to amortize per-chunk costs, small
+    // enough that the serializer's working buffer stays a rounding error
+    // next to the metadata itself
+    constexpr size_t md_sink_chunk = 256 * 1024;
     size_t conn_cnt;
     nixl_backend_t nixl_backend;
     nixl_status_t ret;
 
-    NIXL_LOCK_GUARD(data->lock);
-    // data->connMD was populated when the backend was created
-    conn_cnt = data->connMD.size();
+    // connMD was populated when the backend was created
+    conn_cnt = connMD.size();
 
     if (conn_cnt == 0) // Error, no backend supports remote
         return NIXL_ERR_INVALID_PARAM;
 
-    nixlSerDes sd;
-    ret = sd.addStr("Agent", data->name);
+    // The generation rides in the header (the legacy format carried it as
+    // a trailing tag), so the receiver can validate later diffs
+    std::string envelope;
+    appendMDHeader(envelope, NIXL_MD_FULL, memorySection->getGeneration(),
+                   name, conn_cnt);
+    for (auto &c : connMD) {
+        nixl_backend = c.first;
+        appendMDConnEntry(envelope, nixl_backend, c.second);
+    }
+    ret = sink(envelope.data(), envelope.size());
     if(ret)
         return ret;
 
-    ret = sd.addBuf("Conns", &conn_cnt, sizeof(conn_cnt));
+    // Recycled serialization staging: periodic metadata publishing reuses
+    // the per-thread serializer's buffer capacity instead of re-growing it
+    // from scratch every cycle (the counterpart of notifAmCb's recycled
+    // receive staging)
+    static thread_local nixlSerDes sd;
+    sd.resetSerialize();
+    sd.setSink(sink, md_sink_chunk);
+
+    ret = memorySection->serialize(&sd);
     if(ret)
         return ret;
 
-    for (auto &c : data->connMD) {
-        nixl_backend = c.first;
-        ret = sd.addStr("t", nixl_backend);
-        if(ret)
-            return ret;
-        ret = sd.addStr("c", c.second);
-        if(ret)
+    return sd.finishSink();
+}
+
+nixl_status_t
+nixlAgentData::serializeLocalMDForPeer (const std::string &peer_key,
+                                        nixl_blob_t &str) {
+    const uint64_t cur_gen = memorySection->getGeneration();
+    nixl_status_t ret;
+
+    auto it = peerSentMDGen.find(peer_key);
+    if (it != peerSentMDGen.end()) {
+        // Recycled serialization staging, as in serializeLocalMDToSink
+        static thread_local nixlSerDes sd;
+        sd.resetSerialize();
+
+        ret = memorySection->serializeDiff(&sd, it->second);
+        if (ret == NIXL_SUCCESS) {
+            it->second = cur_gen;
+            // Peer got the connection info with the initial full metadata
+            str.clear();
+            appendMDHeader(str, NIXL_MD_DIFF, 0, name, 0);
+            str += sd.exportStr();
+            return NIXL_SUCCESS;
+        }
+        if (ret != NIXL_ERR_NOT_FOUND)
             return ret;
+        // Journal no longer covers the peer's generation, send full metadata
     }
 
-    ret = sd.addStr("", "MemSection");
-    if(ret)
-        return ret;
+    ret = serializeLocalMD(str);
+    if (ret == NIXL_SUCCESS)
+        peerSentMDGen[peer_key] = cur_gen;
+    return ret;
+}
 
-    ret = data->memorySection->serialize(&sd);
-    if(ret)
-        return ret;
+static std::string
+remoteMDCachePath (const std::string &dir, const std::string &remote_name) {
+    return dir + "/" + remote_name + ".nixlmd";
+}
 
-    str = sd.exportStr();
+nixl_status_t
+nixlAgentData::persistRemoteMD (const std::string &remote_name,
+                                const nixl_blob_t &md) const {
+    if (config.remoteMDCacheDir.empty())
+        return NIXL_SUCCESS;
+
+    const std::string path = remoteMDCachePath(config.remoteMDCacheDir, remote_name);
+    const std::string tmp_path = path + ".tmp";
+
+    int fd = open(tmp_path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, 0600);
+    if (fd < 0) {
+        NIXL_WARN << "Failed to create metadata cache file " << tmp_path
+                  << ": " << strerror(errno);
+        return NIXL_ERR_UNKNOWN;
+    }
+
+    size_t off = 0;
+    while (off < md.size()) {
+        ssize_t written = write(fd, md.data() + off, md.size() - off);
+        if (written < 0) {
+            if (errno == EINTR)
+                continue;
+            NIXL_WARN << "Failed to write metadata cache file " << tmp_path
+                      << ": " << strerror(errno);
+            close(fd);
+            unlink(tmp_path.c_str());
+            return NIXL_ERR_UNKNOWN;
+        }
+        off += written;
+    }
+    close(fd);
+
+    // Rename is atomic, so a crash mid-update leaves the previous blob
+    // in place rather than a torn one
+    if (rename(tmp_path.c_str(), path.c_str()) != 0) {
+        NIXL_WARN << "Failed to publish metadata cache file " << path
+                  << ": " << strerror(errno);
+        unlink(tmp_path.c_str());
+        return NIXL_ERR_UNKNOWN;
+    }
+    return NIXL_SUCCESS;
+}
+
+void
+nixlAgentData::dropPersistedRemoteMD (const std::string &remote_name) const {
+    if (config.remoteMDCacheDir.empty())
+        return;
+    std::error_code ec;
+    std::filesystem::remove(
+        remoteMDCachePath(config.remoteMDCacheDir, remote_name), ec);
+}
+
+nixl_status_t
+nixlAgent::getAgentSnapshot (std::shared_ptr<const nixl_agent_snapshot_t> &snapshot) const {
+    // Fast path for monitoring loops: when nothing changed since the last
+    // build, hand out the published snapshot with one atomic load and no
+    // lock, so observability never contends with the data path
+    const uint64_t epoch = data->mdEpoch.load(std::memory_order_acquire);
+    auto cur = std::atomic_load_explicit(&data->agentSnapshot, std::memory_order_acquire);
+    if (cur && (cur->version == epoch)) {
+        snapshot = std::move(cur);
+        return NIXL_SUCCESS;
+    }
+
+    // Stale or first read: rebuild under the shared lock (metadata
+    // mutations hold it exclusively, so the state read here is consistent
+    // and the epoch cannot advance mid-build) and republish
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    auto snap = std::make_shared<nixl_agent_snapshot_t>();
+    snap->version = data->mdEpoch.load(std::memory_order_acquire);
+    snap->agentName = data->name;
+    snap->backends.reserve(data->backendEngines.size());
+    for (const auto &[backend, engine] : data->backendEngines)
+        snap->backends.push_back(backend);
+    snap->remoteAgents.reserve(data->remoteSections.size());
+    for (const auto &[agent, section] : data->remoteSections)
+        snap->remoteAgents.push_back(agent);
+    data->memorySection->statsPerMemType(snap->regDescCounts, snap->regBytes);
+
+    snapshot = std::move(snap);
+    std::atomic_store_explicit(&data->agentSnapshot, snapshot,
+                               std::memory_order_release);
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::getLocalMD (nixl_blob_t &str) const {
+    NIXL_LOCK_GUARD(data->lock);
+    return data->serializeLocalMD(str);
+}
+
 nixl_status_t
 nixlAgent::getLocalPartialMD(const nixl_reg_dlist_t &descs,
                              nixl_blob_t &str,
@@ -1240,8 +4773,37 @@ nixlAgent::getLocalPartialMD(const nixl_reg_dlist_t &descs,
 
     NIXL_LOCK_GUARD(data->lock);
 
+    // Label-addressable selection: an empty dlist plus a group label picks
+    // every descriptor tagged with the label, served from the cached
+    // fragment when the group hasn't changed since the last publish
+    const bool want_conn = extra_params && extra_params->includeConnInfo;
+    nixlAgentData::regGroupEntry *group = nullptr;
+    if (extra_params && !extra_params->regGroup.empty() && descs.descCount() == 0) {
+        auto git = data->regGroups.find(extra_params->regGroup);
+        if (git == data->regGroups.end())
+            return NIXL_ERR_NOT_FOUND;
+        group = &git->second;
+        if (group->cachedValid && (group->cachedConnInfo == want_conn)) {
+            str = group->cachedMD;
+            return NIXL_SUCCESS;
+        }
+    }
+
     if (!extra_params || extra_params->backends.size() == 0) {
-        if (descs.descCount() != 0) {
+        if (group != nullptr) {
+            // Union of the backends serving each memory type in the group
+            backend_list = &tmp_list;
+            for (size_t mem = 0; mem < group->descs.size(); ++mem) {
+                if (!group->descs[mem] || group->descs[mem]->descCount() == 0)
+                    continue;
+                for (const auto &backend : data->memToBackend[mem])
+                    if (std::find(tmp_list.begin(), tmp_list.end(), backend) ==
+                        tmp_list.end())
+                        tmp_list.push_back(backend);
+            }
+            if (backend_list->empty())
+                return NIXL_ERR_NOT_FOUND;
+        } else if (descs.descCount() != 0) {
             // Non-empty dlist, return backends that support the memory type
             backend_list = &data->memToBackend[descs.getType()];
             if (backend_list->empty())
@@ -1270,40 +4832,167 @@ nixlAgent::getLocalPartialMD(const nixl_reg_dlist_t &descs,
         selected_engines.insert(backend);
     }
 
-    nixlSerDes sd;
-    ret = sd.addStr("Agent", data->name);
-    if(ret)
-        return ret;
+    // No engines found, but there are descs, this is an error
+    if (selected_engines.size() == 0 && (descs.descCount() > 0 || group != nullptr))
+        return NIXL_ERR_BACKEND;
 
     // Only add connection info if requested via extra_params or empty dlist
-    size_t conn_cnt = ((extra_params && extra_params->includeConnInfo) || descs.descCount() == 0) ?
+    size_t conn_cnt = (want_conn || (descs.descCount() == 0 && group == nullptr)) ?
                       found_iters.size() : 0;
-    ret = sd.addBuf("Conns", &conn_cnt, sizeof(conn_cnt));
+    std::string envelope;
+    appendMDHeader(envelope, NIXL_MD_PARTIAL, 0, data->name, conn_cnt);
+    for (size_t i = 0; i < conn_cnt; i++)
+        appendMDConnEntry(envelope, found_iters[i]->first, found_iters[i]->second);
+
+    // Recycled serialization staging, as in serializeLocalMDToSink
+    static thread_local nixlSerDes sd;
+    sd.resetSerialize();
+
+    if (group != nullptr) {
+        std::vector<const nixl_reg_dlist_t*> group_lists;
+        for (const auto &dlist : group->descs)
+            if (dlist && dlist->descCount() > 0)
+                group_lists.push_back(dlist.get());
+        ret = data->memorySection->serializePartial(&sd, selected_engines, group_lists);
+    } else {
+        ret = data->memorySection->serializePartial(&sd, selected_engines, descs);
+    }
     if(ret)
         return ret;
 
-    for (size_t i = 0; i < conn_cnt; i++) {
-        ret = sd.addStr("t", found_iters[i]->first);
-        if(ret)
-            return ret;
-        ret = sd.addStr("c", found_iters[i]->second);
-        if(ret)
+    str = std::move(envelope) + sd.exportStr();
+    if (group != nullptr) {
+        group->cachedMD = str;
+        group->cachedConnInfo = want_conn;
+        group->cachedValid = true;
+    }
+    return NIXL_SUCCESS;
+}
+
+// Fixed-layout counterpart of the legacy parse below; caller holds the
+// agent lock. Every length is bounds-checked against the blob before the
+// bytes are touched, so a truncated or corrupt envelope fails with
+// NIXL_ERR_MISMATCH instead of reading past the end
+nixl_status_t
+nixlAgentData::loadRemoteMDEnvelope (const nixl_blob_t &md,
+                                     std::string &agent_name) {
+    nixlMDHeader hdr;
+    nixl_status_t ret;
+
+    memcpy(&hdr, md.data(), sizeof(hdr));
+    if (hdr.version != md_envelope_version) {
+        NIXL_ERROR << "Unsupported remote metadata version: " << hdr.version;
+        return NIXL_ERR_MISMATCH;
+    }
+
+    size_t off = sizeof(hdr);
+    if ((hdr.nameLen == 0) || (md.size() - off < hdr.nameLen)) {
+        return NIXL_ERR_MISMATCH;
+    }
+    const std::string remote_agent(md.data() + off, hdr.nameLen);
+    off += hdr.nameLen;
+
+    if (remote_agent == name) {
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // Periodic refreshes mostly re-send the exact blob loaded before;
+    // fingerprint the raw bytes and skip the deserialization when
+    // nothing changed since the last load
+    const uint64_t md_hash = std::hash<nixl_blob_t>{}(md);
+    auto hash_it = remoteMDHash.find(remote_agent);
+    if ((hash_it != remoteMDHash.end()) &&
+        (hash_it->second.first == md_hash) &&
+        (hash_it->second.second == md.size())) {
+        touchRemoteAgent(remote_agent);
+        agent_name = remote_agent;
+        return NIXL_SUCCESS;
+    }
+
+    NIXL_DEBUG << "Loading remote metadata for agent: " << remote_agent;
+
+    int count = 0;
+    for (uint32_t i = 0; i < hdr.connCnt; ++i) {
+        uint32_t lens[2];
+        if (md.size() - off < sizeof(lens)) {
+            return NIXL_ERR_MISMATCH;
+        }
+        memcpy(lens, md.data() + off, sizeof(lens));
+        off += sizeof(lens);
+        if ((lens[0] == 0) || (lens[1] == 0) ||
+            (md.size() - off < (size_t)lens[0] + lens[1])) {
+            return NIXL_ERR_MISMATCH;
+        }
+        const nixl_backend_t nixl_backend(md.data() + off, lens[0]);
+        off += lens[0];
+        const nixl_blob_t conn_info(md.data() + off, lens[1]);
+        off += lens[1];
+
+        ret = loadConnInfo(remote_agent, nixl_backend, conn_info);
+        if (ret == NIXL_SUCCESS) {
+            count++;
+        } else if (ret != NIXL_ERR_NOT_SUPPORTED) {
             return ret;
+        }
     }
 
-    // No engines found, but there are descs, this is an error
-    if (selected_engines.size() == 0 && descs.descCount() > 0)
+    // No common backend, no point in loading the rest, unexpected
+    if ((count == 0) && (hdr.connCnt > 0)) {
         return NIXL_ERR_BACKEND;
+    }
 
-    ret = sd.addStr("", "MemSection");
-    if(ret)
+    // Everything behind the envelope is the tagged section stream
+    nixlSerDes sd;
+    ret = sd.importBuf(md.data() + off, md.size() - off);
+    if (ret != NIXL_SUCCESS) {
         return ret;
+    }
 
-    ret = data->memorySection->serializePartial(&sd, selected_engines, descs);
-    if(ret)
+    if (hdr.kind == NIXL_MD_DIFF) {
+        // Incremental update: applies only on top of previously loaded full
+        // metadata with a matching generation, otherwise the caller should
+        // re-fetch the full metadata
+        ret = applyRemoteMDDiff(remote_agent, sd);
+        if (ret != NIXL_SUCCESS) {
+            return ret;
+        }
+
+        touchRemoteAgent(remote_agent);
+        rebuildXferBackendTable(remote_agent);
+        // The persisted full blob and the recorded fingerprint no longer
+        // match the live state; drop both so a restart re-fetches this
+        // peer and a re-sent full blob is reloaded instead of skipped
+        dropPersistedRemoteMD(remote_agent);
+        remoteMDHash.erase(remote_agent);
+        agent_name = remote_agent;
+        return NIXL_SUCCESS;
+    }
+
+    if ((hdr.kind != NIXL_MD_FULL) && (hdr.kind != NIXL_MD_PARTIAL)) {
+        return NIXL_ERR_MISMATCH;
+    }
+
+    ret = loadRemoteSections(remote_agent, sd);
+    if (ret != NIXL_SUCCESS) {
         return ret;
+    }
 
-    str = sd.exportStr();
+    // Full metadata carries the sender's section generation in the header
+    // (partial metadata doesn't); record it so later diffs can be validated
+    if (hdr.kind == NIXL_MD_FULL) {
+        remoteMDGen[remote_agent] = hdr.gen;
+    }
+
+    touchRemoteAgent(remote_agent);
+    enforceRemoteAgentCap();
+    rebuildXferBackendTable(remote_agent);
+    remoteMDHash[remote_agent] = {md_hash, md.size()};
+
+    // Mirror the raw blob to the metadata cache; best effort, a
+    // persistence failure doesn't fail the load
+    persistRemoteMD(remote_agent, md);
+
+    agent_name = remote_agent;
     return NIXL_SUCCESS;
 }
 
@@ -1316,6 +5005,17 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
     nixl_status_t ret;
 
     NIXL_LOCK_GUARD(data->lock);
+
+    // Blobs from current peers start with the envelope magic; anything
+    // else goes through the legacy tagged parse below
+    if (remote_metadata.size() >= sizeof(nixlMDHeader)) {
+        uint32_t magic;
+        memcpy(&magic, remote_metadata.data(), sizeof(magic));
+        if (magic == md_envelope_magic) {
+            return data->loadRemoteMDEnvelope(remote_metadata, agent_name);
+        }
+    }
+
     ret = sd.importStr(remote_metadata);
     if (ret != NIXL_SUCCESS) {
         return ret;
@@ -1330,6 +5030,19 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
         return NIXL_ERR_INVALID_PARAM;
     }
 
+    // Periodic refreshes mostly re-send the exact blob loaded before;
+    // fingerprint the raw bytes and skip the deserialization when
+    // nothing changed since the last load
+    const uint64_t md_hash = std::hash<nixl_blob_t>{}(remote_metadata);
+    auto hash_it = data->remoteMDHash.find(remote_agent);
+    if ((hash_it != data->remoteMDHash.end()) &&
+        (hash_it->second.first == md_hash) &&
+        (hash_it->second.second == remote_metadata.size())) {
+        data->touchRemoteAgent(remote_agent);
+        agent_name = remote_agent;
+        return NIXL_SUCCESS;
+    }
+
     NIXL_DEBUG << "Loading remote metadata for agent: " << remote_agent;
 
     size_t conn_cnt;
@@ -1364,7 +5077,28 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
         return NIXL_ERR_BACKEND;
     }
 
-    if (sd.getStr("") != "MemSection") {
+    const std::string marker = sd.getStr("");
+    if (marker == "MemSectionDiff") {
+        // Incremental update: applies only on top of previously loaded full
+        // metadata with a matching generation, otherwise the caller should
+        // re-fetch the full metadata
+        ret = data->applyRemoteMDDiff(remote_agent, sd);
+        if (ret != NIXL_SUCCESS) {
+            return ret;
+        }
+
+        data->touchRemoteAgent(remote_agent);
+        data->rebuildXferBackendTable(remote_agent);
+        // The persisted full blob and the recorded fingerprint no longer
+        // match the live state; drop both so a restart re-fetches this
+        // peer and a re-sent full blob is reloaded instead of skipped
+        data->dropPersistedRemoteMD(remote_agent);
+        data->remoteMDHash.erase(remote_agent);
+        agent_name = remote_agent;
+        return NIXL_SUCCESS;
+    }
+
+    if (marker != "MemSection") {
         return NIXL_ERR_MISMATCH;
     }
 
@@ -1373,10 +5107,91 @@ nixlAgent::loadRemoteMD (const nixl_blob_t &remote_metadata,
         return ret;
     }
 
+    // Full metadata may carry the sender's section generation (partial
+    // metadata doesn't); record it so later diffs can be validated
+    uint64_t gen;
+    if (sd.getBuf("Gen", &gen, sizeof(gen)) == NIXL_SUCCESS) {
+        data->remoteMDGen[remote_agent] = gen;
+    }
+
+    data->touchRemoteAgent(remote_agent);
+    data->enforceRemoteAgentCap();
+    data->rebuildXferBackendTable(remote_agent);
+    data->remoteMDHash[remote_agent] = {md_hash, remote_metadata.size()};
+
+    // Mirror the raw blob to the metadata cache; best effort, a
+    // persistence failure doesn't fail the load
+    data->persistRemoteMD(remote_agent, remote_metadata);
+
     agent_name = remote_agent;
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlAgent::loadRemoteMDFromCache (std::vector<std::string> &agent_names) {
+    agent_names.clear();
+
+    const std::string &dir = data->config.remoteMDCacheDir;
+    if (dir.empty())
+        return NIXL_SUCCESS;
+
+    std::error_code ec;
+    std::filesystem::directory_iterator dir_iter(dir, ec);
+    if (ec) {
+        NIXL_ERROR << "Error accessing metadata cache directory(" << dir
+                   << "): " << ec.message();
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    constexpr char suffix[] = ".nixlmd";
+    constexpr size_t suffix_len = sizeof(suffix) - 1;
+    for (const auto &entry : dir_iter) {
+        const std::string filename = entry.path().filename().string();
+        if ((filename.size() <= suffix_len) ||
+            (filename.compare(filename.size() - suffix_len, suffix_len, suffix) != 0))
+            continue;
+
+        // Map the blob instead of streaming it in: the reload cost is the
+        // page faults on the bytes the parser actually touches
+        int fd = open(entry.path().c_str(), O_RDONLY);
+        if (fd < 0) {
+            NIXL_WARN << "Failed to open metadata cache file " << entry.path()
+                      << ": " << strerror(errno);
+            continue;
+        }
+        struct stat st;
+        if ((fstat(fd, &st) != 0) || (st.st_size == 0)) {
+            close(fd);
+            std::filesystem::remove(entry.path(), ec);
+            continue;
+        }
+        void *map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (map == MAP_FAILED) {
+            NIXL_WARN << "Failed to map metadata cache file " << entry.path()
+                      << ": " << strerror(errno);
+            continue;
+        }
+
+        nixl_blob_t md(static_cast<const char*>(map), st.st_size);
+        munmap(map, st.st_size);
+
+        // Same parsing and validation as a freshly fetched blob; a cached
+        // entry that no longer loads (corrupt file, or no common backend
+        // with the restarted agent) is dropped so the peer is re-fetched
+        std::string remote_agent;
+        nixl_status_t ret = loadRemoteMD(md, remote_agent);
+        if (ret != NIXL_SUCCESS) {
+            NIXL_WARN << "Dropping stale metadata cache entry " << entry.path()
+                      << ": " << nixlEnumStrings::statusStr(ret);
+            std::filesystem::remove(entry.path(), ec);
+            continue;
+        }
+        agent_names.push_back(remote_agent);
+    }
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::invalidateRemoteMD(const std::string &remote_agent) {
     NIXL_LOCK_GUARD(data->lock);
@@ -1391,6 +5206,9 @@ nixlAgent::invalidateRemoteMD(const std::string &remote_agent) {
         data->remoteSections.erase(remote_agent);
         ret = NIXL_SUCCESS;
     }
+    data->remoteMDGen.erase(remote_agent);
+    data->remoteMDHash.erase(remote_agent);
+    data->clearRemoteSlot(remote_agent);
 
     if (data->remoteBackends.count(remote_agent) != 0) {
         for (auto &it : data->remoteBackends[remote_agent]) {
@@ -1401,21 +5219,36 @@ nixlAgent::invalidateRemoteMD(const std::string &remote_agent) {
         ret = NIXL_SUCCESS;
     }
 
+    if (ret == NIXL_SUCCESS) {
+        data->dropPersistedRemoteMD(remote_agent);
+    }
+
     return ret;
 }
 
 nixl_status_t
 nixlAgent::sendLocalMD (const nixl_opt_args_t* extra_params) const {
     nixl_blob_t myMD;
-    nixl_status_t ret = getLocalMD(myMD);
-    if(ret < 0) return ret;
+    nixl_status_t ret;
 
-    // If IP is provided, use socket-based communication
+    // If IP is provided, use socket-based communication. Repeat sends to the
+    // same peer ship only the section changes since the last send.
     if (extra_params && !extra_params->ipAddr.empty()) {
+        const std::string peer_key = extra_params->ipAddr + ":" +
+                                     std::to_string(extra_params->port);
+        {
+            NIXL_LOCK_GUARD(data->lock);
+            ret = data->serializeLocalMDForPeer(peer_key, myMD);
+        }
+        if(ret < 0) return ret;
+
         data->enqueueCommWork(std::make_tuple(SOCK_SEND, extra_params->ipAddr, extra_params->port, std::move(myMD)));
         return NIXL_SUCCESS;
     }
 
+    ret = getLocalMD(myMD);
+    if(ret < 0) return ret;
+
 #if HAVE_ETCD
     // If no IP is provided, use etcd (now via thread)
     if (data->useEtcd) {
@@ -1481,6 +5314,27 @@ nixlAgent::fetchRemoteMD (const std::string remote_name,
 #endif // HAVE_ETCD
 }
 
+nixl_status_t
+nixlAgent::prefetchRemoteMD (const std::string remote_name,
+                             const nixl_opt_args_t* extra_params) {
+    if (remote_name.empty())
+        return NIXL_ERR_INVALID_PARAM;
+
+    // Record the intent before initiating the fetch, so a fast completion
+    // cannot land before the commWorker knows a warmup is wanted
+    {
+        std::lock_guard<std::mutex> guard(data->prefetchLock);
+        data->prefetchPending.insert(remote_name);
+    }
+
+    nixl_status_t ret = fetchRemoteMD(remote_name, extra_params);
+    if (ret != NIXL_SUCCESS) {
+        std::lock_guard<std::mutex> guard(data->prefetchLock);
+        data->prefetchPending.erase(remote_name);
+    }
+    return ret;
+}
+
 nixl_status_t
 nixlAgent::invalidateLocalMD (const nixl_opt_args_t* extra_params) const {
     // If IP is provided, use socket-based communication
@@ -17,17 +17,24 @@
 
 #include <fcntl.h>
 #include "nixl.h"
-#include "common/nixl_time.h"
 #include "common/str_tools.h"
 #include "agent_data.h"
+#include "common/nixl_affinity.h"
 #include "common/nixl_log.h"
+#include "serdes/serdes.h"
 #if HAVE_ETCD
 #include <etcd/SyncClient.hpp>
 #include <etcd/Watcher.hpp>
 #include <future>
 #endif // HAVE_ETCD
 #include <absl/strings/str_format.h>
+#include <algorithm>
+#include <netinet/tcp.h>
 #include <poll.h>
+#include <sys/epoll.h>
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
 
 const std::string default_metadata_label = "metadata";
 
@@ -35,6 +42,41 @@ namespace {
 
 static const std::string invalid_label = "invalid";
 
+// Optional socket send buffer override (bytes), for pushing multi-megabyte
+// metadata blobs without the kernel default throttling the sender
+void applySndBufSize(int fd) {
+    const char* sndbuf_env = std::getenv("NIXL_COMM_SNDBUF");
+    if (!sndbuf_env || strlen(sndbuf_env) == 0) {
+        return;
+    }
+
+    int sndbuf = std::atoi(sndbuf_env);
+    if (sndbuf <= 0) {
+        NIXL_ERROR << "Ignoring invalid NIXL_COMM_SNDBUF value: " << sndbuf_env;
+        return;
+    }
+
+    if (setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf)) < 0) {
+        NIXL_PERROR << "setsockopt(SO_SNDBUF) failed for fd: " << fd;
+    }
+}
+
+// Peer sockets stay pooled in remoteSockets across metadata exchanges;
+// keepalive lets the kernel notice dead peers during long idle gaps, so
+// stale entries get dropped and re-established instead of hanging sends
+void applyKeepalive(int fd) {
+    int enable = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &enable, sizeof(enable)) < 0) {
+        NIXL_PERROR << "setsockopt(SO_KEEPALIVE) failed for fd: " << fd;
+        return;
+    }
+
+    int idle = 60, interval = 10, count = 3;
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPIDLE, &idle, sizeof(idle));
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPINTVL, &interval, sizeof(interval));
+    setsockopt(fd, IPPROTO_TCP, TCP_KEEPCNT, &count, sizeof(count));
+}
+
 int connectToIP(std::string ip_addr, int port) {
 
     struct sockaddr_in listenerAddr;
@@ -53,6 +95,9 @@ int connectToIP(std::string ip_addr, int port) {
         return -1;
     }
 
+    applySndBufSize(ret_fd);
+    applyKeepalive(ret_fd);
+
     // Connect will return immediately with EINPROGRESS
     int ret = connect(ret_fd, (struct sockaddr*)&listenerAddr, sizeof(listenerAddr));
     if (ret < 0 && errno != EINPROGRESS) {
@@ -96,6 +141,64 @@ int connectToIP(std::string ip_addr, int port) {
     return ret_fd;
 }
 
+// Serialized metadata is highly repetitive (repeated backend names,
+// uniform descriptor records) and goes out to every peer, so compressing
+// LOAD payloads cuts exchange bytes by roughly an order of magnitude.
+// Opt-in via NIXL_COMM_COMPRESS=1: compressed frames use the LODZ header,
+// which only peers built with zstd understand.
+#ifdef HAVE_ZSTD
+bool commCompressEnabled() {
+    static const bool enabled = [] {
+        const char *env = std::getenv("NIXL_COMM_COMPRESS");
+        return env && (std::atoi(env) != 0);
+    }();
+    return enabled;
+}
+
+std::string compressMD(const std::string &md) {
+    std::string out;
+    out.resize(ZSTD_compressBound(md.size()));
+    size_t ret = ZSTD_compress(out.data(), out.size(), md.data(), md.size(), 3);
+    if (ZSTD_isError(ret)) {
+        NIXL_ERROR << "Metadata compression failed: " << ZSTD_getErrorName(ret);
+        return {};
+    }
+    out.resize(ret);
+    return out;
+}
+
+bool decompressMD(const std::string &blob, std::string &md) {
+    unsigned long long size = ZSTD_getFrameContentSize(blob.data(), blob.size());
+    if ((size == ZSTD_CONTENTSIZE_ERROR) || (size == ZSTD_CONTENTSIZE_UNKNOWN)) {
+        NIXL_ERROR << "Received malformed compressed metadata frame";
+        return false;
+    }
+    md.resize(size);
+    size_t ret = ZSTD_decompress(md.data(), md.size(), blob.data(), blob.size());
+    if (ZSTD_isError(ret) || (ret != size)) {
+        NIXL_ERROR << "Metadata decompression failed: " << ZSTD_getErrorName(ret);
+        return false;
+    }
+    return true;
+}
+#endif // HAVE_ZSTD
+
+// Builds the metadata message, compressed when enabled and profitable.
+// Takes the blob by value so the uncompressed path can prepend the header
+// in place instead of copying metadata that can run to hundreds of MB.
+std::string makeLoadMsg(std::string md) {
+#ifdef HAVE_ZSTD
+    if (commCompressEnabled()) {
+        std::string z = compressMD(md);
+        if (!z.empty() && (z.size() < md.size())) {
+            return "NIXLCOMM:LODZ" + z;
+        }
+    }
+#endif
+    md.insert(0, "NIXLCOMM:LOAD");
+    return md;
+}
+
 void
 sendCommMessage(int fd, const std::string& msg) {
     size_t size = msg.size();
@@ -105,8 +208,14 @@ sendCommMessage(int fd, const std::string& msg) {
         {const_cast<char*>(msg.data()), msg.size()}
     };
 
-    for (size_t i = 0, offset = 0, sent = 0; i < iov_size;) {
-        auto bytes = send(fd, static_cast<char *>(iov[i].iov_base) + offset, iov[i].iov_len - offset, 0);
+    struct msghdr hdr = {};
+    hdr.msg_iov = iov;
+    hdr.msg_iovlen = iov_size;
+
+    // One sendmsg covers header and payload together; on a partial write
+    // advance the iovec and retry with the remainder
+    for (size_t sent = 0; hdr.msg_iovlen > 0;) {
+        auto bytes = sendmsg(fd, &hdr, 0);
         if (bytes < 0) {
             if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK) {
                 continue;
@@ -120,74 +229,180 @@ sendCommMessage(int fd, const std::string& msg) {
                                     errno));
         }
 
-        offset += bytes;
         sent += bytes;
-        if (offset == iov[i].iov_len) {
-            offset = 0;
-            ++i;
+        while (hdr.msg_iovlen > 0 &&
+               static_cast<size_t>(bytes) >= hdr.msg_iov[0].iov_len) {
+            bytes -= hdr.msg_iov[0].iov_len;
+            ++hdr.msg_iov;
+            --hdr.msg_iovlen;
+        }
+        if (hdr.msg_iovlen > 0 && bytes > 0) {
+            hdr.msg_iov[0].iov_base = static_cast<char*>(hdr.msg_iov[0].iov_base) + bytes;
+            hdr.msg_iov[0].iov_len -= bytes;
         }
     }
 }
 
-bool
-recvCommMessageType(int fd, void *data, size_t size, bool force = false) {
-    for (size_t received = 0; received < size;) {
-        auto bytes = recv(fd, static_cast<char *>(data) + received, size - received, 0);
-        if (bytes > 0) {
-            received += bytes;
-            continue;
+// Upper bound on a single comm message, bounding the receive buffer a
+// peer can make us allocate through the size header below. Metadata blobs
+// can legitimately run to hundreds of MB, so the default is deliberately
+// generous; NIXL_COMM_MAX_MSG (bytes) overrides it.
+size_t commMaxMsgSize() {
+    static const size_t max_size = [] {
+        constexpr size_t default_max = 1ULL << 30;
+        const char* env = std::getenv("NIXL_COMM_MAX_MSG");
+        if (!env || strlen(env) == 0) {
+            return default_max;
         }
-        if (bytes == 0 && received == 0 && !force) {
-            return false;
+
+        long long parsed = std::atoll(env);
+        if (parsed <= 0) {
+            NIXL_ERROR << "Ignoring invalid NIXL_COMM_MAX_MSG value: " << env;
+            return default_max;
         }
+        return static_cast<size_t>(parsed);
+    }();
+    return max_size;
+}
 
+// Per-connection receive state: a message is a size_t header followed by
+// the payload, and either part can arrive in fragments. Whatever fraction
+// has arrived is parked here between epoll wakeups, so a peer stalling
+// mid-message costs nothing beyond its own buffer instead of spinning the
+// comm thread on EAGAIN until the payload completes (which used to
+// head-of-line-block metadata service for every other peer).
+struct nixlCommRecvState {
+    size_t size_hdr;
+    size_t hdr_received = 0;
+    std::string payload;
+    size_t payload_received = 0;
+};
+
+// Advance the connection's receive state machine with whatever bytes are
+// available. Returns true when a complete message was assembled into msg
+// (the state re-arms for the next message), false when the socket drained
+// before the message completed. Throws on socket errors, on peer
+// shutdown, and on a size header exceeding commMaxMsgSize().
+bool
+recvCommMessage(int fd, nixlCommRecvState &state, std::string &msg) {
+    while (true) {
+        char *dst;
+        size_t want;
+        if (state.hdr_received < sizeof(state.size_hdr)) {
+            dst = reinterpret_cast<char *>(&state.size_hdr) + state.hdr_received;
+            want = sizeof(state.size_hdr) - state.hdr_received;
+        } else {
+            dst = state.payload.data() + state.payload_received;
+            want = state.size_hdr - state.payload_received;
+        }
+
+        auto bytes = recv(fd, dst, want, 0);
         if (bytes < 0) {
             if (errno == EINTR) {
                 continue;
             }
-
             if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                if (!force && received == 0) {
-                    return false; // nothing to read yet
-                }
+                return false; // socket drained; resume on next readiness
+            }
 
-                continue;
+            throw std::runtime_error(
+                    absl::StrFormat("recvCommMessage(fd=%d) %zu/%zu bytes failed errno=%d",
+                                    fd,
+                                    state.hdr_received + state.payload_received,
+                                    sizeof(state.size_hdr) + state.size_hdr,
+                                    errno));
+        }
+        if (bytes == 0) {
+            throw std::runtime_error(
+                    absl::StrFormat("recvCommMessage(fd=%d) peer closed connection", fd));
+        }
+
+        if (state.hdr_received < sizeof(state.size_hdr)) {
+            state.hdr_received += bytes;
+            if (state.hdr_received == sizeof(state.size_hdr)) {
+                if (state.size_hdr > commMaxMsgSize()) {
+                    throw std::runtime_error(
+                            absl::StrFormat("recvCommMessage(fd=%d) size header %zu exceeds "
+                                            "NIXL_COMM_MAX_MSG bound %zu",
+                                            fd,
+                                            state.size_hdr,
+                                            commMaxMsgSize()));
+                }
+                state.payload.resize(state.size_hdr);
             }
+        } else {
+            state.payload_received += bytes;
         }
 
-        throw std::runtime_error(
-                absl::StrFormat("recvCommMessage(fd=%d) %zu/%zu bytes failed ret=%d errno=%d",
-                                fd,
-                                received,
-                                size,
-                                bytes,
-                                errno));
+        if (state.hdr_received == sizeof(state.size_hdr) &&
+            state.payload_received == state.size_hdr) {
+            msg = std::move(state.payload);
+            state = nixlCommRecvState{};
+            return true;
+        }
     }
-
-    return true;
 }
 
-bool
-recvCommMessage(int fd, std::string &msg) {
-    size_t size;
-    if (!recvCommMessageType(fd, &size, sizeof(size))) {
-        return false;
-    }
-
-    msg.resize(size);
-    return recvCommMessageType(fd, msg.data(), size, true);
+#if HAVE_ETCD
+// Subscription mode for peer discovery: deployments where an agent knows
+// at startup it will talk to every agent in the namespace (e.g. decode
+// agents vs all prefill agents) can watch the whole namespace prefix and
+// load peer metadata as it is published, so the first transfer to a new
+// peer finds its metadata already loaded instead of paying a fetch round
+// trip
+bool etcdWatchNamespaceEnabled() {
+    static const bool enabled = [] {
+        const char *env = std::getenv("NIXL_ETCD_WATCH_NAMESPACE");
+        return env && (std::atoi(env) != 0);
+    }();
+    return enabled;
 }
 
-#if HAVE_ETCD
 class nixlEtcdClient {
 private:
     std::unique_ptr<etcd::SyncClient> etcd;
     std::string namespace_prefix;
+    std::string my_agent_name;
     std::vector<std::string> invalidated_agents;
     std::mutex invalidated_agents_mutex;
     std::unordered_map<std::string, std::unique_ptr<etcd::Watcher>,
                         std::hash<std::string>, strEqual> agentWatchers;
 
+    // Metadata publications picked up by the namespace watcher, loaded on
+    // the commWorker thread in processPublishedMD
+    std::vector<std::pair<std::string, nixl_blob_t>> publishedMD;
+    std::mutex published_md_mutex;
+    // Declared after the queue/mutex so it is torn down first and its
+    // callback cannot touch them mid-destruction
+    std::unique_ptr<etcd::Watcher> namespaceWatcher;
+
+    // Queues a published value for loading when its key is another
+    // agent's full-metadata key; custom-label partial metadata still goes
+    // through explicit fetches
+    void enqueuePublishedMD(const std::string &key, nixl_blob_t &&md) {
+        // Expected key shape: <namespace>/<agent>/<label>
+        const std::string prefix = namespace_prefix + "/";
+        if (key.compare(0, prefix.size(), prefix) != 0)
+            return;
+        size_t agent_end = key.find('/', prefix.size());
+        if (agent_end == std::string::npos ||
+            key.compare(agent_end + 1, std::string::npos, default_metadata_label) != 0)
+            return;
+        std::string agent = key.substr(prefix.size(), agent_end - prefix.size());
+        if (agent.empty() || agent == my_agent_name || md.empty())
+            return;
+        std::lock_guard<std::mutex> lock(published_md_mutex);
+        publishedMD.emplace_back(std::move(agent), std::move(md));
+    }
+
+    // In-flight metadata fetches; completed ones are drained on the
+    // commWorker thread in processCompletedFetches
+    struct pendingFetch {
+        std::string agent;
+        std::future<std::pair<nixl_status_t, nixl_blob_t>> result;
+    };
+    std::vector<pendingFetch> pendingFetches;
+
     // Helper function to create etcd key
     std::string makeKey(const std::string& agent_name,
                         const std::string& metadata_type) {
@@ -217,12 +432,81 @@ public:
 
         NIXL_DEBUG << "Using etcd namespace for agents: " << namespace_prefix;
 
+        this->my_agent_name = my_agent_name;
+
         std::string agent_prefix = makeKey(my_agent_name, "");
         etcd::Response response = etcd->put(agent_prefix, "");
         if (!response.is_ok()) {
             throw std::runtime_error("Failed to store agent " + my_agent_name +
                                      " prefix key in etcd: " + response.error_message());
         }
+
+        if (etcdWatchNamespaceEnabled())
+            startNamespaceWatch();
+    }
+
+    // Subscribe to every agent in the namespace: seed from the metadata
+    // already published, then watch the prefix for new publications
+    void startNamespaceWatch() {
+        const std::string prefix = namespace_prefix + "/";
+
+        try {
+            etcd::Response response = etcd->ls(prefix);
+            if (response.is_ok()) {
+                for (size_t i = 0; i < response.keys().size(); i++)
+                    enqueuePublishedMD(response.keys()[i],
+                                       response.values()[i].as_string());
+            } else {
+                NIXL_ERROR << "Failed to list etcd namespace " << prefix
+                           << " : " << response.error_message();
+            }
+
+            auto process_response = [this](etcd::Response response) -> void {
+                if (!response.is_ok()) {
+                    NIXL_ERROR << "Namespace watcher failed: " << response.error_message();
+                    return;
+                }
+                for (const auto &event : response.events()) {
+                    if (event.event_type() != etcd::Event::EventType::PUT)
+                        continue;
+                    enqueuePublishedMD(event.kv().key(), event.kv().as_string());
+                }
+            };
+            namespaceWatcher = std::make_unique<etcd::Watcher>(*etcd, prefix,
+                                                               process_response, true);
+            NIXL_DEBUG << "Watching etcd namespace " << prefix << " for agent metadata";
+        }
+        catch (const std::exception &e) {
+            NIXL_ERROR << "Error setting up etcd namespace watch: " << e.what();
+        }
+    }
+
+    // Load the metadata the namespace watcher picked up; runs on the
+    // commWorker thread, same as processCompletedFetches
+    void processPublishedMD(nixlAgent* my_agent) {
+        std::vector<std::pair<std::string, nixl_blob_t>> batch;
+        {
+            std::lock_guard<std::mutex> lock(published_md_mutex);
+            batch = std::move(publishedMD);
+        }
+
+        for (auto &[remote_agent, remote_metadata] : batch) {
+            std::string remote_agent_from_md;
+            nixl_status_t ret = my_agent->loadRemoteMD(remote_metadata,
+                                                       remote_agent_from_md);
+            if (ret != NIXL_SUCCESS) {
+                NIXL_ERROR << "Failed to load published metadata for agent: "
+                           << remote_agent << " : " << ret;
+                continue;
+            } else if (remote_agent_from_md != remote_agent) {
+                NIXL_ERROR << "Metadata mismatch for agent: " << remote_agent
+                           << " from md: " << remote_agent_from_md;
+                continue;
+            }
+            NIXL_DEBUG << "Loaded published metadata for agent: " << remote_agent;
+
+            setupAgentWatcher(remote_agent);
+        }
     }
 
     // Store metadata in etcd
@@ -369,6 +653,64 @@ public:
         return waitForMetadataFromEtcd(metadata_key, remote_metadata);
     }
 
+    // Launch a metadata fetch on its own thread, so the commWorker isn't
+    // blocked for a full etcd round trip (or watch timeout) per peer and
+    // fetches for many agents at startup proceed concurrently
+    void startFetch(const std::string &remote_agent,
+                    const std::string &metadata_label) {
+        pendingFetches.push_back(
+            {remote_agent,
+             std::async(std::launch::async, [this, remote_agent, metadata_label] {
+                 nixl_blob_t md;
+                 nixl_status_t ret = fetchOrWaitForMetadataFromEtcd(remote_agent,
+                                                                    metadata_label, md);
+                 return std::make_pair(ret, std::move(md));
+             })});
+    }
+
+    // Load the metadata of fetches that finished; runs on the commWorker
+    // thread, which is the only thread touching agentWatchers
+    void processCompletedFetches(nixlAgent* my_agent) {
+        for (auto it = pendingFetches.begin(); it != pendingFetches.end();) {
+            if (it->result.wait_for(std::chrono::seconds(0)) !=
+                std::future_status::ready) {
+                ++it;
+                continue;
+            }
+
+            const std::string remote_agent = it->agent;
+            auto [ret, remote_metadata] = it->result.get();
+            it = pendingFetches.erase(it);
+
+            if (ret != NIXL_SUCCESS) {
+                NIXL_ERROR << "Failed to fetch metadata from etcd: " << ret;
+                continue;
+            }
+
+            std::string remote_agent_from_md;
+            ret = my_agent->loadRemoteMD(remote_metadata, remote_agent_from_md);
+            if (ret != NIXL_SUCCESS) {
+                NIXL_ERROR << "Failed to load remote metadata: " << ret;
+                continue;
+            } else if (remote_agent_from_md != remote_agent) {
+                NIXL_ERROR << "Metadata mismatch for agent: " << remote_agent
+                           << " from md: " << remote_agent_from_md;
+                continue;
+            }
+            NIXL_DEBUG << "Successfully loaded metadata for agent: " << remote_agent;
+
+            setupAgentWatcher(remote_agent);
+        }
+    }
+
+    ~nixlEtcdClient() {
+        // Pending fetches capture this, wait for them before tearing down.
+        // Watch-based ones can take up to their timeout to resolve.
+        for (auto &fetch : pendingFetches) {
+            fetch.result.wait();
+        }
+    }
+
     // Setup a watcher for an agent's metadata invalidation if it doesn't already exist
     void setupAgentWatcher(const std::string &agent_name) {
         if (agentWatchers.find(agent_name) != agentWatchers.end()) {
@@ -404,22 +746,20 @@ public:
         agentWatchers[agent_name] = std::make_unique<etcd::Watcher>(*etcd, agent_prefix, process_response);
     }
 
-    // Process invalidated agents from watchers
-    void processInvalidatedAgents(nixlAgent* my_agent) {
-        std::vector<std::string> tmp_invalidated_agents;
+    // Drain the agents invalidated by watchers since the last sweep; the
+    // caller folds them into one batched invalidation epoch instead of
+    // tearing them down one lock acquisition at a time
+    std::vector<std::string> drainInvalidatedAgents() {
+        std::vector<std::string> agents;
         {
             std::lock_guard<std::mutex> lock(invalidated_agents_mutex);
-            tmp_invalidated_agents = std::move(invalidated_agents);
+            agents = std::move(invalidated_agents);
         }
-        for (const auto &agent : tmp_invalidated_agents) {
+        for (const auto &agent : agents) {
             NIXL_DEBUG << "Invalidated agent: " << agent;
             agentWatchers.erase(agent);
-            nixl_status_t ret = my_agent->invalidateRemoteMD(agent);
-            if (ret != NIXL_SUCCESS)
-                NIXL_ERROR << "Failed to invalidate remote metadata for agent: " << agent << ": " << ret;
-            else
-                NIXL_DEBUG << "Successfully invalidated remote metadata for agent: " << agent;
         }
+        return agents;
     }
 };
 #endif // HAVE_ETCD
@@ -427,6 +767,7 @@ public:
 } // unnamed namespace
 
 void nixlAgentData::commWorker(nixlAgent* myAgent){
+    nixlApplyThreadAffinity(config.threadCpuSet);
 
 #if HAVE_ETCD
     std::unique_ptr<nixlEtcdClient> etcdClient = nullptr;
@@ -436,7 +777,53 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
     }
 #endif // HAVE_ETCD
 
+    // The thread sleeps in epoll_wait until the doorbell rings (work was
+    // enqueued or shutdown requested), a peer connects, or a pooled socket
+    // becomes readable. Closed sockets leave the epoll set automatically,
+    // so the eviction paths below need no epoll bookkeeping.
+    int epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (epoll_fd == -1)
+        throw std::runtime_error("epoll_create1 failed for comm thread");
+
+    auto epollAdd = [&](int fd) {
+        struct epoll_event ev = {};
+        ev.events = EPOLLIN;
+        ev.data.fd = fd;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1)
+            NIXL_PERROR << "epoll_ctl(ADD) failed for fd: " << fd;
+    };
+
+    epollAdd(commDoorbell);
+    if (config.useListenThread)
+        epollAdd(listener->getListenFd());
+
+    // Partial receives parked per socket between wakeups; entries are
+    // dropped alongside the socket on every eviction path below
+    std::unordered_map<int, nixlCommRecvState> recvStates;
+
     while(!(commThreadStop)) {
+        // etcd fetches and watcher events complete on their own threads
+        // without a doorbell, so cap the sleep to keep draining them
+        int timeout_ms = -1;
+#if HAVE_ETCD
+        if (etcdClient)
+            timeout_ms = std::max<int>(1, config.lthrDelay / 1000);
+#endif // HAVE_ETCD
+
+        struct epoll_event events[32];
+        int nfds = epoll_wait(epoll_fd, events, 32, timeout_ms);
+        if (nfds == -1 && errno != EINTR) {
+            NIXL_PERROR << "epoll_wait failed in comm thread";
+            break;
+        }
+
+        for (int i = 0; i < nfds; i++) {
+            if (events[i].data.fd == commDoorbell) {
+                uint64_t val;
+                while (read(commDoorbell, &val, sizeof(val)) > 0);
+            }
+        }
+
         std::vector<nixl_comm_req_t> work_queue;
 
         // first, accept new connections
@@ -464,6 +851,8 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                     throw std::runtime_error("getpeername failed");
                 }
                 remoteSockets[accepted_client] = new_fd;
+                applySndBufSize(new_fd);
+                applyKeepalive(new_fd);
 
                 // make new socket nonblocking
                 int new_flags = fcntl(new_fd, F_GETFL, 0) | O_NONBLOCK;
@@ -471,16 +860,17 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                 if (fcntl(new_fd, F_SETFL, new_flags) == -1)
                     throw std::runtime_error("fcntl accept");
 
+                epollAdd(new_fd);
             }
         }
 
         // second, do agent commands
         getCommWork(work_queue);
 
-        for(const auto &request: work_queue) {
+        for(auto &request: work_queue) {
 
             // TODO: req_ip and req_port are relevant only for SOCK_*, need different request structure for ETCD_*
-            const auto &[req_command, req_ip, req_port, my_MD] = request;
+            auto &[req_command, req_ip, req_port, my_MD] = request;
 
             nixl_socket_peer_t req_sock = std::make_pair(req_ip, req_port);
 
@@ -498,23 +888,49 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                         continue;
                     }
                     remoteSockets[req_sock] = new_client;
+                    epollAdd(new_client);
                     client_fd = new_client;
                 } else {
                     client_fd = client->second;
                 }
             }
 
+            // Pooled connections can go stale (e.g. peer restarted); replace
+            // the socket and retry the send once before giving up
+            auto sendToPeer = [&](const std::string &msg) {
+                try {
+                    sendCommMessage(client_fd, msg);
+                    return;
+                } catch (const std::exception &e) {
+                    NIXL_ERROR << "Resetting connection to " << req_ip << ":" << req_port
+                               << " after send failure: " << e.what();
+                }
+                close(client_fd);
+                recvStates.erase(client_fd);
+                remoteSockets.erase(req_sock);
+                int new_client = connectToIP(req_ip, req_port);
+                if (new_client == -1) {
+                    NIXL_ERROR << "Listener thread could not reconnect to IP " << req_ip
+                               << " and port " << req_port;
+                    return;
+                }
+                remoteSockets[req_sock] = new_client;
+                epollAdd(new_client);
+                sendCommMessage(new_client, msg);
+            };
+
             switch(req_command) {
             case SOCK_SEND: {
-                sendCommMessage(client_fd, "NIXLCOMM:LOAD" + my_MD);
+                // work_queue entries are discarded after this loop
+                sendToPeer(makeLoadMsg(std::move(my_MD)));
                 break;
             }
             case SOCK_FETCH: {
-                sendCommMessage(client_fd, "NIXLCOMM:SEND");
+                sendToPeer("NIXLCOMM:SEND");
                 break;
             }
             case SOCK_INVAL: {
-                sendCommMessage(client_fd, "NIXLCOMM:INVL" + name);
+                sendToPeer("NIXLCOMM:INVL" + name);
                 break;
             }
 #if HAVE_ETCD
@@ -544,28 +960,9 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                     const std::string &metadata_label = req_ip;
                     const std::string &remote_agent = my_MD;
 
-                    // First try a direct get
-                    nixl_blob_t remote_metadata;
-                    nixl_status_t ret = etcdClient->fetchOrWaitForMetadataFromEtcd(remote_agent, metadata_label,
-                                                                                   remote_metadata);
-                    if (ret != NIXL_SUCCESS) {
-                        NIXL_ERROR << "Failed to fetch metadata from etcd: " << ret;
-                        break;
-                    }
-
-                    std::string remote_agent_from_md;
-                    ret = myAgent->loadRemoteMD(remote_metadata, remote_agent_from_md);
-                    if (ret != NIXL_SUCCESS) {
-                        NIXL_ERROR << "Failed to load remote metadata: " << ret;
-                        break;
-                    } else if (remote_agent_from_md != remote_agent) {
-                        NIXL_ERROR << "Metadata mismatch for agent: " << remote_agent
-                                   << " from md: " << remote_agent_from_md;
-                        break;
-                    }
-                    NIXL_DEBUG << "Successfully loaded metadata for agent: " << remote_agent;
-
-                    etcdClient->setupAgentWatcher(remote_agent);
+                    // Fetches run concurrently; results are loaded in
+                    // processCompletedFetches below
+                    etcdClient->startFetch(remote_agent, metadata_label);
                     break;
                 }
                 case ETCD_INVAL:
@@ -596,13 +993,26 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
             std::vector<std::string> command_list;
             nixl_status_t ret;
 
-            if (!recvCommMessage(socket_iter->second, commands)) {
-                socket_iter++;
+            try {
+                if (!recvCommMessage(socket_iter->second, recvStates[socket_iter->second],
+                                     commands)) {
+                    socket_iter++;
+                    continue;
+                }
+            } catch (const std::exception &e) {
+                // Drop the dead pooled connection; a later request to this
+                // peer re-establishes it
+                NIXL_ERROR << "Closing connection to peer " << socket_iter->first.first
+                           << ":" << socket_iter->first.second << ": " << e.what();
+                close(socket_iter->second);
+                recvStates.erase(socket_iter->second);
+                socket_iter = remoteSockets.erase(socket_iter);
                 continue;
             }
 
             command_list = str_split_substr(commands, "NIXLCOMM:");
 
+            bool peer_reset = false;
             for(const auto &command : command_list) {
 
                 if(command.size() < 4) continue;
@@ -610,8 +1020,23 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                 // always just 4 chars:
                 std::string header = command.substr(0, 4);
 
-                if(header == "LOAD") {
+                if(header == "LOAD" || header == "LODZ") {
                     std::string remote_md = command.substr(4);
+                    if (header == "LODZ") {
+#ifdef HAVE_ZSTD
+                        std::string raw_md;
+                        if (!decompressMD(remote_md, raw_md)) {
+                            continue;
+                        }
+                        remote_md = std::move(raw_md);
+#else
+                        NIXL_ERROR << "Received compressed metadata from peer "
+                                   << socket_iter->first.first << ":"
+                                   << socket_iter->first.second
+                                   << " but built without zstd support";
+                        continue;
+#endif
+                    }
                     std::string remote_agent;
                     ret = myAgent->loadRemoteMD(remote_md, remote_agent);
                     if(ret != NIXL_SUCCESS) {
@@ -625,7 +1050,15 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                     nixl_blob_t my_MD;
                     myAgent->getLocalMD(my_MD);
 
-                    sendCommMessage(socket_iter->second, std::string("NIXLCOMM:LOAD" + my_MD));
+                    try {
+                        sendCommMessage(socket_iter->second, makeLoadMsg(std::move(my_MD)));
+                    } catch (const std::exception &e) {
+                        NIXL_ERROR << "Metadata send to peer " << socket_iter->first.first
+                                   << ":" << socket_iter->first.second
+                                   << " failed: " << e.what();
+                        peer_reset = true;
+                        break;
+                    }
                 } else if(header == "INVL") {
                     std::string remote_agent = command.substr(4);
                     myAgent->invalidateRemoteMD(remote_agent);
@@ -636,31 +1069,87 @@ void nixlAgentData::commWorker(nixlAgent* myAgent){
                 }
             }
 
+            if (peer_reset) {
+                close(socket_iter->second);
+                recvStates.erase(socket_iter->second);
+                socket_iter = remoteSockets.erase(socket_iter);
+                continue;
+            }
+
             socket_iter++;
         }
 
 #if HAVE_ETCD
         if (etcdClient) {
-            etcdClient->processInvalidatedAgents(myAgent);
+            etcdClient->processPublishedMD(myAgent);
+            etcdClient->processCompletedFetches(myAgent);
+            // A node failure fires one watch event per dead agent; coalesce
+            // whatever accumulated into a single invalidation epoch so
+            // survivors stall on the agent lock once, not once per agent
+            const auto invalidated = etcdClient->drainInvalidatedAgents();
+            if (!invalidated.empty()) {
+                NIXL_LOCK_GUARD(lock);
+                nixl_status_t ret = invalidateRemoteDataBatch(invalidated);
+                if (ret != NIXL_SUCCESS)
+                    NIXL_ERROR << "Failed to invalidate remote metadata batch: " << ret;
+            }
         }
 #endif // HAVE_ETCD
 
-        nixlTime::us_t start = nixlTime::getUs();
-        while( (start + config.lthrDelay) > nixlTime::getUs()) {
-            std::this_thread::yield();
+        processPrefetches(myAgent);
+    }
+
+    close(epoll_fd);
+}
+
+// Runs on the commWorker thread after metadata handling: peers recorded by
+// prefetchRemoteMD whose fetched metadata has landed (their remote section
+// exists) get their connections warmed here, off the application threads
+void nixlAgentData::processPrefetches(nixlAgent* myAgent) {
+    std::vector<std::string> ready;
+    {
+        std::lock_guard<std::mutex> guard(prefetchLock);
+        if (prefetchPending.empty())
+            return;
+        NIXL_SHARED_LOCK_GUARD(lock);
+        for (auto it = prefetchPending.begin(); it != prefetchPending.end();) {
+            if (remoteSections.count(*it) != 0) {
+                ready.push_back(*it);
+                it = prefetchPending.erase(it);
+            } else {
+                ++it;
+            }
         }
     }
+
+    for (const auto &remote_agent : ready) {
+        // Best effort: a connection failure here surfaces again, on the
+        // regular error path, with the first real transfer to this peer
+        nixl_status_t ret = myAgent->prewarmConnections({remote_agent});
+        if (ret != NIXL_SUCCESS)
+            NIXL_WARN << "Prefetch warmup for agent " << remote_agent
+                      << " returned " << ret;
+    }
+}
+
+void nixlAgentData::wakeCommThread(){
+    // A failed write only means a wakeup is already pending
+    uint64_t one = 1;
+    [[maybe_unused]] ssize_t ret = write(commDoorbell, &one, sizeof(one));
 }
 
 void nixlAgentData::enqueueCommWork(nixl_comm_req_t request){
-    std::lock_guard<std::mutex> lock(commLock);
-    commQueue.push_back(std::move(request));
+    // Wait-free push, then ring the doorbell so the epoll loop dispatches
+    // the request now instead of on its next periodic wakeup
+    commQueue.push(std::move(request));
+    wakeCommThread();
 }
 
 void nixlAgentData::getCommWork(std::vector<nixl_comm_req_t> &req_list){
-    std::lock_guard<std::mutex> lock(commLock);
-    req_list = std::move(commQueue);
-    commQueue.clear();
+    // Single consumer: only the comm thread drains the queue
+    nixl_comm_req_t request;
+    while (commQueue.pop(request))
+        req_list.push_back(std::move(request));
 }
 
 nixl_status_t
@@ -694,6 +1183,7 @@ nixlAgentData::loadConnInfo(const std::string &remote_name,
     }
 
     remoteBackends[remote_name].emplace(backend, conn_info);
+    mdEpoch.fetch_add(1, std::memory_order_release);
     return NIXL_SUCCESS;
 }
 
@@ -712,6 +1202,39 @@ nixlAgentData::loadRemoteSections(const std::string &remote_name, nixlSerDes &sd
         return ret;
     }
 
+    mdEpoch.fetch_add(1, std::memory_order_release);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlAgentData::applyRemoteMDDiff(const std::string &remote_name, nixlSerDes &sd) {
+    uint64_t base_gen, new_gen;
+
+    nixl_status_t ret = sd.getBuf("BaseGen", &base_gen, sizeof(base_gen));
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+    ret = sd.getBuf("NewGen", &new_gen, sizeof(new_gen));
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+
+    auto gen_it = remoteMDGen.find(remote_name);
+    auto sec_it = remoteSections.find(remote_name);
+    if (gen_it == remoteMDGen.end() || sec_it == remoteSections.end() ||
+        gen_it->second != base_gen) {
+        // Our view of this agent doesn't match the diff's base; caller
+        // should re-fetch full metadata
+        return NIXL_ERR_MISMATCH;
+    }
+
+    ret = sec_it->second->applyDiff(&sd, backendEngines);
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+
+    gen_it->second = new_gen;
+    mdEpoch.fetch_add(1, std::memory_order_release);
     return NIXL_SUCCESS;
 }
 
@@ -729,6 +1252,10 @@ nixlAgentData::invalidateRemoteData(const std::string &remote_name) {
         remoteSections.erase(it_section);
         ret = NIXL_SUCCESS;
     }
+    remoteMDGen.erase(remote_name);
+    remoteMDHash.erase(remote_name);
+    clearRemoteSlot(remote_name);
+    flushDlistCache(remote_name);
 
     auto it_backends = remoteBackends.find(remote_name);
     if (it_backends != remoteBackends.end()) {
@@ -740,5 +1267,140 @@ nixlAgentData::invalidateRemoteData(const std::string &remote_name) {
         ret = NIXL_SUCCESS;
     }
 
+    if (ret == NIXL_SUCCESS)
+        mdEpoch.fetch_add(1, std::memory_order_release);
     return ret;
 }
+
+/*
+ * Batched counterpart of invalidateRemoteData for invalidation storms,
+ * e.g. a dead node taking out dozens of agents at once. Only the map
+ * surgery happens under the caller-held agent lock; the slow teardown
+ * (section unload, backend disconnects) is deferred to the reclamation
+ * thread so live traffic resumes as soon as the lock drops.
+ */
+nixl_status_t
+nixlAgentData::invalidateRemoteDataBatch(const std::vector<std::string> &remote_names) {
+    struct agentTeardown {
+        std::string name;
+        nixlRemoteSection *section = nullptr;
+        std::vector<nixlBackendEngine *> engines;
+    };
+    std::vector<agentTeardown> work;
+    work.reserve(remote_names.size());
+
+    nixl_status_t ret = NIXL_ERR_NOT_FOUND;
+    for (const auto &remote_name : remote_names) {
+        if (remote_name == name) {
+            NIXL_ERROR << "Agent " << name << " cannot invalidate itself";
+            continue;
+        }
+
+        agentTeardown td;
+        td.name = remote_name;
+
+        auto it_section = remoteSections.find(remote_name);
+        if (it_section != remoteSections.end()) {
+            td.section = it_section->second;
+            remoteSections.erase(it_section);
+            ret = NIXL_SUCCESS;
+        }
+        remoteMDGen.erase(remote_name);
+        remoteMDHash.erase(remote_name);
+        clearRemoteSlot(remote_name);
+        flushDlistCache(remote_name);
+
+        auto it_backends = remoteBackends.find(remote_name);
+        if (it_backends != remoteBackends.end()) {
+            for (auto &it : it_backends->second) {
+                td.engines.push_back(backendEngines[it.first]);
+            }
+            remoteBackends.erase(it_backends);
+            ret = NIXL_SUCCESS;
+        }
+
+        // Duplicate names in the batch find nothing and are skipped here
+        if (td.section || !td.engines.empty()) {
+            work.push_back(std::move(td));
+        }
+    }
+
+    if (!work.empty()) {
+        enqueueReclaimTask([work = std::move(work)]() {
+            for (auto &td : work) {
+                // Section unload first: its metadata holds per-connection
+                // state (e.g. rkeys) the disconnects below destroy
+                delete td.section;
+                for (auto *engine : td.engines) {
+                    engine->disconnect(td.name);
+                }
+            }
+        });
+    }
+
+    if (ret == NIXL_SUCCESS)
+        mdEpoch.fetch_add(1, std::memory_order_release);
+    return ret;
+}
+
+void
+nixlAgentData::touchRemoteAgent(const std::string &remote_name) {
+    if (config.maxRemoteAgents == 0 || remote_name == name) {
+        return;
+    }
+
+    // Agents without an interned slot have no loaded metadata to track
+    int32_t id = getAgentId(remote_name);
+    if (id >= 0) {
+        touchRemoteAgent((uint32_t) id);
+    }
+}
+
+void
+nixlAgentData::touchRemoteAgent(uint32_t agent_id) {
+    if (config.maxRemoteAgents == 0) {
+        return;
+    }
+
+    // The own loopback slot may be touched too; the eviction scan skips it
+    std::lock_guard<std::mutex> lock(remoteLRULock);
+    remoteSlots[agent_id].lruTick = ++remoteLRUClock;
+}
+
+void
+nixlAgentData::enforceRemoteAgentCap() {
+    if (config.maxRemoteAgents == 0) {
+        return;
+    }
+
+    while (true) {
+        // The agent's own loopback section backs compound transfers and is
+        // never counted against the cap nor evicted
+        size_t cached = remoteSections.size() - remoteSections.count(name);
+        if (cached <= config.maxRemoteAgents) {
+            return;
+        }
+
+        std::string victim;
+        uint64_t oldest = UINT64_MAX;
+        {
+            std::lock_guard<std::mutex> lock(remoteLRULock);
+            for (const auto &it : remoteSections) {
+                if (it.first == name) {
+                    continue;
+                }
+                // Agents loaded but never used rank oldest
+                const int32_t id = getAgentId(it.first);
+                const uint64_t tick = (id < 0) ? 0 : remoteSlots[id].lruTick;
+                if (tick <= oldest) {
+                    oldest = tick;
+                    victim = it.first;
+                }
+            }
+        }
+
+        NIXL_DEBUG << "Remote agent cache over cap of " << config.maxRemoteAgents
+                   << ", evicting metadata of LRU agent " << victim;
+        invalidateRemoteData(victim);
+    }
+}
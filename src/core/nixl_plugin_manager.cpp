@@ -18,15 +18,16 @@
 #include "plugin_manager.h"
 #include "nixl.h"
 #include "common/nixl_log.h"
+#ifndef NIXL_STATIC_PLUGINS_ONLY
 #include <dlfcn.h>
 #include <filesystem>
 #include <dirent.h>
 #include <unistd.h>  // For access() and F_OK
 #include <cstdlib>  // For getenv
 #include <fstream>
+#endif // NIXL_STATIC_PLUGINS_ONLY
 #include <string>
 #include <map>
-#include <dlfcn.h>
 
 using lock_guard = const std::lock_guard<std::mutex>;
 
@@ -36,6 +37,9 @@ nixlPluginHandle::nixlPluginHandle(void* handle, nixlBackendPlugin* plugin)
 }
 
 nixlPluginHandle::~nixlPluginHandle() {
+#ifndef NIXL_STATIC_PLUGINS_ONLY
+    // Static plugins are constructed with a null handle; only dynamically
+    // loaded plugins have a library to finalize and close
     if (handle_) {
         // Call the plugin's cleanup function
         typedef void (*fini_func_t)();
@@ -49,6 +53,7 @@ nixlPluginHandle::~nixlPluginHandle() {
         handle_ = nullptr;
         plugin_ = nullptr;
     }
+#endif // NIXL_STATIC_PLUGINS_ONLY
 }
 
 nixlBackendEngine* nixlPluginHandle::createEngine(const nixlBackendInitParams* init_params) const {
@@ -78,6 +83,8 @@ const char* nixlPluginHandle::getVersion() const {
     return "unknown";
 }
 
+#ifndef NIXL_STATIC_PLUGINS_ONLY
+
 std::map<nixl_backend_t, std::string> loadPluginList(const std::string& filename) {
     std::map<nixl_backend_t, std::string> plugins;
     std::ifstream file(filename);
@@ -164,9 +171,10 @@ void nixlPluginManager::loadPluginsFromList(const std::string& filename) {
         const std::string& name = pair.first;
         const std::string& path = pair.second;
 
-        auto plugin_handle = loadPluginFromPath(path);
-        if (plugin_handle) {
-            loaded_plugins_[name] = plugin_handle;
+        // Manifest entries are recorded for on-demand loading; the dlopen
+        // happens on the first loadPlugin call for the backend
+        if (loaded_plugins_.count(name) == 0) {
+            available_plugins_[name] = path;
         }
     }
 }
@@ -190,8 +198,27 @@ getPluginDir() {
 }
 } // namespace
 
+#else // NIXL_STATIC_PLUGINS_ONLY
+
+// Static-only builds resolve every backend from the compile-time registry;
+// the dynamic loading entry points stay linkable but reject their input so
+// a misconfigured caller gets a clear error instead of a silent no-op
+std::shared_ptr<const nixlPluginHandle> nixlPluginManager::loadPluginFromPath(const std::string& plugin_path) {
+    NIXL_ERROR << "Dynamic plugin loading is compiled out (static_plugins_only); "
+               << "cannot load " << plugin_path;
+    return nullptr;
+}
+
+void nixlPluginManager::loadPluginsFromList(const std::string& filename) {
+    NIXL_ERROR << "Dynamic plugin loading is compiled out (static_plugins_only); "
+               << "ignoring plugin list " << filename;
+}
+
+#endif // NIXL_STATIC_PLUGINS_ONLY
+
 // PluginManager implementation
 nixlPluginManager::nixlPluginManager() {
+#ifndef NIXL_STATIC_PLUGINS_ONLY
     // Force levels right before logging
 #ifdef NIXL_USE_PLUGIN_FILE
     NIXL_DEBUG << "Loading plugins from file: " << NIXL_USE_PLUGIN_FILE;
@@ -207,6 +234,7 @@ nixlPluginManager::nixlPluginManager() {
         plugin_dirs_.insert(plugin_dirs_.begin(), plugin_dir);
         discoverPluginsFromDir(plugin_dir);
     }
+#endif // NIXL_STATIC_PLUGINS_ONLY
 
     registerBuiltinPlugins();
 }
@@ -220,6 +248,10 @@ nixlPluginManager& nixlPluginManager::getInstance() {
 }
 
 void nixlPluginManager::addPluginDirectory(const std::string& directory) {
+#ifdef NIXL_STATIC_PLUGINS_ONLY
+    NIXL_ERROR << "Dynamic plugin loading is compiled out (static_plugins_only); "
+               << "ignoring plugin directory " << directory;
+#else
     if (directory.empty()) {
         NIXL_ERROR << "Cannot add empty plugin directory";
         return;
@@ -247,6 +279,7 @@ void nixlPluginManager::addPluginDirectory(const std::string& directory) {
     }
 
     discoverPluginsFromDir(directory);
+#endif // NIXL_STATIC_PLUGINS_ONLY
 }
 
 std::shared_ptr<const nixlPluginHandle> nixlPluginManager::loadPlugin(const std::string& plugin_name) {
@@ -259,6 +292,25 @@ std::shared_ptr<const nixlPluginHandle> nixlPluginManager::loadPlugin(const std:
         return it->second;
     }
 
+#ifdef NIXL_STATIC_PLUGINS_ONLY
+    // Every backend is preloaded from the compile-time registry; a miss
+    // means the binary was built without this plugin
+    NIXL_ERROR << "Backend '" << plugin_name
+               << "' is not in the compile-time static plugin registry";
+    return nullptr;
+#else
+    // Deferred discovery: dlopen the recorded path on first use
+    auto avail = available_plugins_.find(plugin_name);
+    if (avail != available_plugins_.end()) {
+        auto plugin_handle = loadPluginFromPath(avail->second);
+        if (plugin_handle) {
+            loaded_plugins_[plugin_name] = plugin_handle;
+            return plugin_handle;
+        }
+        // Recorded path no longer loads, fall through to the directory scan
+        available_plugins_.erase(avail);
+    }
+
     // Try to load the plugin from all registered directories
     for (const auto& dir : plugin_dirs_) {
         // Handle path joining correctly with or without trailing slash
@@ -287,9 +339,14 @@ std::shared_ptr<const nixlPluginHandle> nixlPluginManager::loadPlugin(const std:
     // Failed to load the plugin
     NIXL_ERROR << "Failed to load plugin '" << plugin_name << "' from any directory";
     return nullptr;
+#endif // NIXL_STATIC_PLUGINS_ONLY
 }
 
 void nixlPluginManager::discoverPluginsFromDir(const std::string& dirpath) {
+#ifdef NIXL_STATIC_PLUGINS_ONLY
+    NIXL_ERROR << "Dynamic plugin loading is compiled out (static_plugins_only); "
+               << "not scanning " << dirpath;
+#else
     std::filesystem::path dir_path(dirpath);
     std::error_code ec;
     std::filesystem::directory_iterator dir_iter(dir_path, ec);
@@ -310,13 +367,19 @@ void nixlPluginManager::discoverPluginsFromDir(const std::string& dirpath) {
             // Extract plugin name
             std::string plugin_name = filename.substr(10, filename.size() - 13);
 
-            // Try to load the plugin
-            auto plugin = loadPlugin(plugin_name);
-            if (plugin) {
-                NIXL_INFO << "Discovered and loaded plugin: " << plugin_name;
+            // Metadata-only discovery: record where the plugin lives and
+            // defer the dlopen (and its dependent libraries) to the first
+            // loadPlugin call for that backend. The most recently added
+            // directory was prioritized, so its path wins.
+            lock_guard lg(lock);
+            if (loaded_plugins_.count(plugin_name) == 0) {
+                available_plugins_[plugin_name] = entry.path().string();
+                NIXL_INFO << "Discovered plugin: " << plugin_name
+                          << " at " << entry.path();
             }
         }
     }
+#endif // NIXL_STATIC_PLUGINS_ONLY
 }
 
 void nixlPluginManager::unloadPlugin(const nixl_backend_t& plugin_name) {
@@ -342,6 +405,59 @@ std::shared_ptr<const nixlPluginHandle> nixlPluginManager::getPlugin(const nixl_
     return nullptr;
 }
 
+nixlBackendEngine* nixlPluginManager::lookupSharedEngine(const std::string& key,
+                                                         const nixl_backend_t& plugin_name) {
+    lock_guard lg(lock);
+
+    auto it = shared_engines_.find(key);
+    if (it == shared_engines_.end()) {
+        return nullptr;
+    }
+    if (it->second.engine->getType() != plugin_name) {
+        NIXL_ERROR << "Shared instance key '" << key << "' holds a "
+                   << it->second.engine->getType() << " engine, not " << plugin_name;
+        return nullptr;
+    }
+    it->second.refCount++;
+    return it->second.engine;
+}
+
+void nixlPluginManager::registerSharedEngine(const std::string& key, nixlBackendEngine* engine) {
+    lock_guard lg(lock);
+
+    // Keeping the plugin handle pins the library while the shared engine
+    // outlives the creating agent
+    auto plugin_it = loaded_plugins_.find(engine->getType());
+    shared_engines_[key] = {engine,
+                           plugin_it != loaded_plugins_.end() ? plugin_it->second : nullptr,
+                           1};
+}
+
+bool nixlPluginManager::releaseSharedEngine(nixlBackendEngine* engine,
+                                            const std::string& local_agent) {
+    lock_guard lg(lock);
+
+    for (auto it = shared_engines_.begin(); it != shared_engines_.end(); ++it) {
+        if (it->second.engine != engine) {
+            continue;
+        }
+        if (--it->second.refCount == 0) {
+            if (it->second.plugin) {
+                it->second.plugin->destroyEngine(engine);
+            } else {
+                delete engine;
+            }
+            shared_engines_.erase(it);
+        } else {
+            // The engine lives on for the remaining agents; drop this
+            // agent's connection namespace
+            engine->removeLocalAgent(local_agent);
+        }
+        return true;
+    }
+    return false;
+}
+
 nixl_b_params_t nixlPluginHandle::getBackendOptions() const {
     nixl_b_params_t params;
     if (plugin_ && plugin_->get_backend_options) {
@@ -365,6 +481,12 @@ std::vector<nixl_backend_t> nixlPluginManager::getLoadedPluginNames() {
     for (const auto& pair : loaded_plugins_) {
         names.push_back(pair.first);
     }
+    // Discovered plugins count as available even before their first load
+    for (const auto& pair : available_plugins_) {
+        if (loaded_plugins_.count(pair.first) == 0) {
+            names.push_back(pair.first);
+        }
+    }
     return names;
 }
 
@@ -390,43 +512,68 @@ const std::vector<nixlStaticPluginInfo>& nixlPluginManager::getStaticPlugins() {
     return static_plugins_;
 }
 
-void nixlPluginManager::registerBuiltinPlugins() {
+// Compile-time registry of built-in backends. The creators are resolved by
+// the linker and the table is built at compile time, so startup registers
+// every built-in plugin with direct factory calls — no string-keyed search
+// and, with -Dstatic_plugins_only=true, no dlopen/readdir at all.
 #ifdef STATIC_PLUGIN_UCX
-        extern nixlBackendPlugin* createStaticUcxPlugin();
-        registerStaticPlugin("UCX", createStaticUcxPlugin);
-#endif //STATIC_PLUGIN_UCX
-
+extern nixlBackendPlugin* createStaticUcxPlugin();
+#endif // STATIC_PLUGIN_UCX
 #ifdef STATIC_PLUGIN_UCX_MO
-        extern nixlBackendPlugin* createStaticUcxMoPlugin();
-        registerStaticPlugin("UCX_MO", createStaticUcxMoPlugin);
+extern nixlBackendPlugin* createStaticUcxMoPlugin();
 #endif // STATIC_PLUGIN_UCX_MO
-
-#ifdef STATIC_PLUGIN_GDS
-#ifndef DISABLE_GDS_BACKEND
-        extern nixlBackendPlugin* createStaticGdsPlugin();
-        registerStaticPlugin("GDS", createStaticGdsPlugin);
-#endif // DISABLE_GDS_BACKEND
+#if defined(STATIC_PLUGIN_GDS) && !defined(DISABLE_GDS_BACKEND)
+extern nixlBackendPlugin* createStaticGdsPlugin();
 #endif // STATIC_PLUGIN_GDS
-
 #ifdef STATIC_PLUGIN_POSIX
-        extern nixlBackendPlugin* createStaticPosixPlugin();
-        registerStaticPlugin("POSIX", createStaticPosixPlugin);
+extern nixlBackendPlugin* createStaticPosixPlugin();
 #endif // STATIC_PLUGIN_POSIX
-
-#ifdef STATIC_PLUGIN_GPUNETIO
-#ifndef DISABLE_GPUNETIO_BACKEND
-        extern nixlBackendPlugin* createStaticGpunetioPlugin();
-        registerStaticPlugin("GPUNETIO", createStaticGpunetioPlugin);
-#endif // DISABLE_GPUNETIO_BACKEND
+#ifdef STATIC_PLUGIN_SHM
+extern nixlBackendPlugin* createStaticShmPlugin();
+#endif // STATIC_PLUGIN_SHM
+#if defined(STATIC_PLUGIN_GPUNETIO) && !defined(DISABLE_GPUNETIO_BACKEND)
+extern nixlBackendPlugin* createStaticGpunetioPlugin();
 #endif // STATIC_PLUGIN_GPUNETIO
-
 #ifdef STATIC_PLUGIN_OBJ
-        extern nixlBackendPlugin *createStaticObjPlugin();
-        registerStaticPlugin ("OBJ", createStaticObjPlugin);
+extern nixlBackendPlugin *createStaticObjPlugin();
 #endif // STATIC_PLUGIN_OBJ
+#ifdef STATIC_PLUGIN_MOONCAKE
+extern nixlBackendPlugin *createStaticMooncakePlugin();
+#endif // STATIC_PLUGIN_MOONCAKE
 
+namespace {
+constexpr nixlStaticPluginInfo builtin_plugins[] = {
+#ifdef STATIC_PLUGIN_UCX
+    {"UCX", createStaticUcxPlugin},
+#endif // STATIC_PLUGIN_UCX
+#ifdef STATIC_PLUGIN_UCX_MO
+    {"UCX_MO", createStaticUcxMoPlugin},
+#endif // STATIC_PLUGIN_UCX_MO
+#if defined(STATIC_PLUGIN_GDS) && !defined(DISABLE_GDS_BACKEND)
+    {"GDS", createStaticGdsPlugin},
+#endif // STATIC_PLUGIN_GDS
+#ifdef STATIC_PLUGIN_POSIX
+    {"POSIX", createStaticPosixPlugin},
+#endif // STATIC_PLUGIN_POSIX
+#ifdef STATIC_PLUGIN_SHM
+    {"SHM", createStaticShmPlugin},
+#endif // STATIC_PLUGIN_SHM
+#if defined(STATIC_PLUGIN_GPUNETIO) && !defined(DISABLE_GPUNETIO_BACKEND)
+    {"GPUNETIO", createStaticGpunetioPlugin},
+#endif // STATIC_PLUGIN_GPUNETIO
+#ifdef STATIC_PLUGIN_OBJ
+    {"OBJ", createStaticObjPlugin},
+#endif // STATIC_PLUGIN_OBJ
 #ifdef STATIC_PLUGIN_MOONCAKE
-        extern nixlBackendPlugin *createStaticMooncakePlugin();
-        registerStaticPlugin("MOONCAKE", createStaticMooncakePlugin);
+    {"MOONCAKE", createStaticMooncakePlugin},
 #endif // STATIC_PLUGIN_MOONCAKE
+    // Sentinel keeps the table well-formed when no plugin is built in
+    {nullptr, nullptr},
+};
+} // namespace
+
+void nixlPluginManager::registerBuiltinPlugins() {
+    for (const nixlStaticPluginInfo* info = builtin_plugins; info->name; ++info) {
+        registerStaticPlugin(info->name, info->createFunc);
+    }
 }
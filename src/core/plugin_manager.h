@@ -64,10 +64,24 @@ struct nixlStaticPluginInfo {
 class nixlPluginManager {
 private:
     std::map<nixl_backend_t, std::shared_ptr<const nixlPluginHandle>> loaded_plugins_;
+    // Discovered but not yet loaded plugins (backend name -> .so path);
+    // the dlopen is deferred to the first loadPlugin call for that backend
+    std::map<nixl_backend_t, std::string> available_plugins_;
     std::vector<std::string> plugin_dirs_;
     std::vector<nixlStaticPluginInfo> static_plugins_;
     std::mutex lock;
 
+    // Engines shared across agents in the process (see the
+    // "shared_instance" backend parameter): keyed by the user-chosen
+    // share key, refcounted, created by the first agent and destroyed
+    // through the owning plugin handle on last release
+    struct nixlSharedEngineEntry {
+        nixlBackendEngine* engine;
+        std::shared_ptr<const nixlPluginHandle> plugin;
+        size_t refCount;
+    };
+    std::map<std::string, nixlSharedEngineEntry> shared_engines_;
+
     void registerBuiltinPlugins();
     void registerStaticPlugin(const char* name, nixlStaticPluginCreatorFunc creator);
 
@@ -89,7 +103,8 @@ public:
     // Load a specific plugin
     std::shared_ptr<const nixlPluginHandle> loadPlugin(const nixl_backend_t& plugin_name);
 
-    // Search a directory for plugins
+    // Search a directory for plugins; metadata-only, records plugin paths
+    // for on-demand loading
     void discoverPluginsFromDir(const std::string& dirpath);
 
     // Unload a plugin
@@ -107,6 +122,17 @@ public:
     // Add a plugin directory
     void addPluginDirectory(const std::string& directory);
 
+    // Shared engine instances: lookup takes a reference on the engine
+    // registered under the key (nullptr if absent or of another backend
+    // type), registerSharedEngine publishes a newly created engine with
+    // one reference, and releaseSharedEngine drops one, destroying the
+    // engine on the last. release returns false for engines that were
+    // never shared, so callers can fall back to their own teardown.
+    nixlBackendEngine* lookupSharedEngine(const std::string& key,
+                                          const nixl_backend_t& plugin_name);
+    void registerSharedEngine(const std::string& key, nixlBackendEngine* engine);
+    bool releaseSharedEngine(nixlBackendEngine* engine, const std::string& local_agent);
+
     // Static Plugin Helpers
     const std::vector<nixlStaticPluginInfo>& getStaticPlugins();
 };
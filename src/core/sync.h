@@ -27,6 +27,9 @@ class nixlLock {
             switch (sync_mode) {
             case nixl_thread_sync_t::NIXL_THREAD_SYNC_NONE:
                 lock_cb = unlock_cb = lock_shared_cb = unlock_shared_cb = []() {};
+                try_lock_shared_cb = []() {
+                    return true;
+                };
                 break;
             case nixl_thread_sync_t::NIXL_THREAD_SYNC_STRICT:
                 lock_cb = lock_shared_cb = [this]() {
@@ -35,6 +38,9 @@ class nixlLock {
                 unlock_cb = unlock_shared_cb = [this]() {
                     m.Unlock();
                 };
+                try_lock_shared_cb = [this]() {
+                    return m.TryLock();
+                };
                 break;
             case nixl_thread_sync_t::NIXL_THREAD_SYNC_RW:
                 lock_cb = [this]() {
@@ -49,6 +55,9 @@ class nixlLock {
                 unlock_shared_cb = [this]() {
                     m.ReaderUnlock();
                 };
+                try_lock_shared_cb = [this]() {
+                    return m.ReaderTryLock();
+                };
                 break;
             }
         }
@@ -61,6 +70,10 @@ class nixlLock {
             lock_shared_cb();
         }
 
+        bool try_lock_shared() {
+            return try_lock_shared_cb();
+        }
+
         void unlock() {
             unlock_cb();
         }
@@ -74,6 +87,7 @@ class nixlLock {
         std::function<void()> unlock_cb;
         std::function<void()> lock_shared_cb;
         std::function<void()> unlock_shared_cb;
+        std::function<bool()> try_lock_shared_cb;
 
         absl::Mutex m;
 };
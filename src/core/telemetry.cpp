@@ -23,7 +23,9 @@
 #include <cstring>
 #include <algorithm>
 
+#include "common/mem_budget.h"
 #include "common/nixl_log.h"
+#include "common/nixl_time.h"
 #include "telemetry.h"
 #include "telemetry_event.h"
 #include "util.h"
@@ -33,12 +35,25 @@ namespace fs = std::filesystem;
 
 constexpr std::chrono::milliseconds DEFAULT_TELEMETRY_RUN_INTERVAL = 100ms;
 constexpr size_t DEFAULT_TELEMETRY_BUFFER_SIZE = 4096;
+constexpr std::chrono::milliseconds DEFAULT_TELEMETRY_STALL_THRESHOLD = 5000ms;
+// Minimum samples before latency drift is graded: per flush window, and
+// accumulated in the baseline histogram
+constexpr uint64_t HEALTH_MIN_WINDOW_SAMPLES = 16;
+constexpr uint64_t HEALTH_MIN_BASELINE_SAMPLES = 64;
+// Cap after which the baseline histogram is halved, so old behaviour
+// ages out and the comparison stays rolling
+constexpr uint64_t HEALTH_BASELINE_DECAY_CAP = 1 << 16;
 
-nixlTelemetry::nixlTelemetry(const std::string &name, backend_map_t &backend_map)
-    : pool_(1),
+nixlTelemetry::nixlTelemetry(const std::string &name,
+                             backend_map_t &backend_map,
+                             nixlMemBudget *mem_budget,
+                             uint32_t category_mask)
+    : categoryMask_(category_mask),
+      pool_(1),
       writeTask_(pool_.get_executor(), DEFAULT_TELEMETRY_RUN_INTERVAL),
       file_(name),
-      backendMap_(backend_map) {
+      backendMap_(backend_map),
+      memBudget_(mem_budget) {
     if (name.empty()) {
         throw std::invalid_argument("Telemetry file name cannot be empty");
     }
@@ -80,6 +95,41 @@ nixlTelemetry::initializeTelemetry() {
     buffer_ = std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(
         full_file_path, true, TELEMETRY_VERSION, buffer_size);
 
+    const char* agg_env = std::getenv(TELEMETRY_AGGREGATION_VAR);
+    aggregate_ = agg_env && std::string(agg_env) != "0";
+    if (const char* rate_env = std::getenv(TELEMETRY_SAMPLE_RATE_VAR)) {
+        sampleRate_ = std::stoul(rate_env);
+    }
+    if (aggregate_) {
+        NIXL_INFO << "Telemetry aggregation enabled"
+                  << (sampleRate_ ? ", sampling 1-in-" + std::to_string(sampleRate_) : "");
+    }
+
+    const char *tune_env = std::getenv(TELEMETRY_AUTO_TUNE_VAR);
+    autoTune_ = tune_env && std::string(tune_env) != "0";
+    if (autoTune_) {
+        NIXL_INFO << "Telemetry-driven backend auto-tuning enabled";
+    }
+
+    // Per-class SLO breach thresholds in microseconds, comma separated in
+    // size-class order (<=64K, <=1M, <=64M, larger); unset or 0 entries
+    // aggregate without generating breaches
+    if (const char *slo_env = std::getenv(TELEMETRY_SLO_VAR)) {
+        std::stringstream slo_ss(slo_env);
+        std::string tok;
+        size_t idx = 0;
+        while (idx < sloThresholdUs_.size() && std::getline(slo_ss, tok, ',')) {
+            sloThresholdUs_[idx++] = std::stoul(tok);
+        }
+        NIXL_INFO << "Telemetry SLO thresholds (us): " << slo_env;
+    }
+
+    auto stall_threshold = std::getenv(TELEMETRY_STALL_THRESHOLD_VAR) ?
+        std::chrono::milliseconds(std::stoul(std::getenv(TELEMETRY_STALL_THRESHOLD_VAR))) :
+        DEFAULT_TELEMETRY_STALL_THRESHOLD;
+    stallThresholdUs_ =
+        std::chrono::duration_cast<std::chrono::microseconds>(stall_threshold).count();
+
     auto run_interval = std::getenv(TELEMETRY_RUN_INTERVAL_VAR) ?
         std::chrono::milliseconds(std::stoul(std::getenv(TELEMETRY_RUN_INTERVAL_VAR))) :
         DEFAULT_TELEMETRY_RUN_INTERVAL;
@@ -90,28 +140,100 @@ nixlTelemetry::initializeTelemetry() {
     registerPeriodicTask(writeTask_);
 }
 
+nixlTelemetry::eventShard &
+nixlTelemetry::myShard() {
+    // Same modulus in every instance, so a plain static index is fine
+    static thread_local size_t shard_idx =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) % numShards_;
+    return shards_[shard_idx];
+}
+
+void
+nixlTelemetry::recordEvent(eventShard &shard,
+                           uint64_t timestamp_us,
+                           nixl_telemetry_category_t category,
+                           const std::string &event_name,
+                           uint64_t value) {
+    if (!aggregate_) {
+        shard.events_.emplace_back(timestamp_us, category, event_name, value);
+        return;
+    }
+
+    aggState &agg = shard.aggregates_[std::make_pair(category, event_name)];
+    agg.count++;
+    agg.sum += value;
+    size_t bucket = value ? 64 - __builtin_clzll(value) : 0;
+    agg.buckets[std::min<size_t>(bucket, agg.buckets.size() - 1)]++;
+
+    // Optional raw-event passthrough for spot-checking the aggregates
+    if (sampleRate_ && (++shard.sampleCounter_ % sampleRate_ == 0)) {
+        shard.events_.emplace_back(timestamp_us, category, event_name, value);
+    }
+}
+
 bool
 nixlTelemetry::writeEventHelper() {
     std::vector<nixlTelemetryEvent> next_queue;
     // assume next buffer will be the same size as the current one
     next_queue.reserve(buffer_->capacity());
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        events_.swap(next_queue);
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex_);
+        next_queue.insert(next_queue.end(),
+                          std::make_move_iterator(shard.events_.begin()),
+                          std::make_move_iterator(shard.events_.end()));
+        shard.events_.clear();
     }
+    // shards fill independently, restore the global time order
+    std::sort(next_queue.begin(),
+              next_queue.end(),
+              [](const nixlTelemetryEvent &a, const nixlTelemetryEvent &b) {
+                  return a.timestampUs_ < b.timestampUs_;
+              });
     for (auto &event : next_queue) {
         // if full, ignore
         buffer_->push(event);
     }
+
+    if (aggregate_) {
+        std::map<agg_key_t, aggState> merged;
+        for (auto &shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex_);
+            for (auto &[key, agg] : shard.aggregates_) {
+                aggState &dst = merged[key];
+                dst.count += agg.count;
+                dst.sum += agg.sum;
+                for (size_t i = 0; i < agg.buckets.size(); ++i) {
+                    dst.buckets[i] += agg.buckets[i];
+                }
+            }
+            shard.aggregates_.clear();
+        }
+
+        // Emit per-interval deltas; consumers accumulate across flushes
+        auto now = nixlTime::getUsFast();
+        for (auto &[key, agg] : merged) {
+            buffer_->push(nixlTelemetryEvent(now, key.first, key.second + ".count", agg.count));
+            buffer_->push(nixlTelemetryEvent(now, key.first, key.second + ".sum", agg.sum));
+            for (size_t i = 0; i < agg.buckets.size(); ++i) {
+                if (agg.buckets[i]) {
+                    buffer_->push(nixlTelemetryEvent(
+                        now, key.first, key.second + ".b" + std::to_string(i), agg.buckets[i]));
+                }
+            }
+        }
+    }
+
     // collect all events and sort them by timestamp
     std::vector<nixlTelemetryEvent> all_events;
-    for (auto &backend : backendMap_) {
-        auto backend_events = backend.second->getTelemetryEvents();
-        for (auto &event : backend_events) {
-            // don't trust enum value coming from backend,
-            // as it might be different from the one in agent
-            event.category_ = nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND;
-            all_events.push_back(event);
+    if (categoryEnabled(nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND)) {
+        for (auto &backend : backendMap_) {
+            auto backend_events = backend.second->getTelemetryEvents();
+            for (auto &event : backend_events) {
+                // don't trust enum value coming from backend,
+                // as it might be different from the one in agent
+                event.category_ = nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND;
+                all_events.push_back(event);
+            }
         }
     }
     std::sort(all_events.begin(),
@@ -122,9 +244,236 @@ nixlTelemetry::writeEventHelper() {
     for (auto &event : all_events) {
         buffer_->push(event);
     }
+
+    // One usage gauge per flush interval; the warning fires once per
+    // crossing of the soft watermark and re-arms when usage drops back
+    if (memBudget_) {
+        if (categoryEnabled(nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY))
+            buffer_->push(nixlTelemetryEvent(nixlTime::getUsFast(),
+                                             nixl_telemetry_category_t::NIXL_TELEMETRY_MEMORY,
+                                             "agent_pool_mem_used",
+                                             memBudget_->used()));
+        if (memBudget_->aboveSoft()) {
+            if (!softWarnLogged_) {
+                NIXL_WARN << "Backend pool memory " << memBudget_->used()
+                          << " bytes above the soft watermark "
+                          << memBudget_->softWatermark();
+                softWarnLogged_ = true;
+            }
+        } else {
+            softWarnLogged_ = false;
+        }
+    }
+
+    // The tuner reads the same per-flush window histograms the health
+    // checker rolls into its baseline, so it must run first
+    autoTuneBackends();
+    checkBackendHealth();
+    publishSloStats();
     return true;
 }
 
+void
+nixlTelemetry::autoTuneBackends() {
+    if (!autoTune_) {
+        return;
+    }
+
+    for (const auto &[type, engine] : backendMap_) {
+        // The latency score for this flush window; skip backends without
+        // enough fresh samples to grade a step, and stalled ones, where a
+        // knob adjustment would only muddy the stall diagnosis
+        size_t score;
+        {
+            const std::lock_guard<std::mutex> lock(healthLock_);
+            const auto hit = health_.find(engine);
+            if (hit == health_.end() || hit->second.recentCount < HEALTH_MIN_WINDOW_SAMPLES ||
+                hit->second.state == NIXL_BACKEND_STALLED) {
+                continue;
+            }
+            score = medianBucket(hit->second.recent, hit->second.recentCount);
+        }
+
+        auto [iter, inserted] = tuners_.try_emplace(engine);
+        tunerState &state = iter->second;
+        if (inserted) {
+            std::vector<nixl_tunable_param_t> params;
+            if (engine->getTunableParams(params) == NIXL_SUCCESS) {
+                for (auto &param : params) {
+                    if (param.min_value < param.max_value) {
+                        state.params.push_back({std::move(param), true});
+                    }
+                }
+            }
+        }
+        if (state.params.empty()) {
+            continue;
+        }
+
+        tunerParam &param = state.params[state.active];
+        // The previous step made the median bucket worse: walk the other
+        // way. Equal buckets count as a plateau and keep the direction,
+        // so the log2 granularity does not make the tuner thrash.
+        if (state.primed && score > state.lastScore) {
+            param.increasing = !param.increasing;
+        }
+
+        const uint64_t next = param.increasing ?
+            std::min(param.bounds.max_value,
+                     param.bounds.current ? param.bounds.current * 2 : uint64_t(1)) :
+            std::max(param.bounds.min_value, param.bounds.current / 2);
+        if (next == param.bounds.current) {
+            // Pinned against a bound: reverse and move on to the next
+            // parameter, rebaselining the score for it
+            param.increasing = !param.increasing;
+            state.active = (state.active + 1) % state.params.size();
+            state.primed = false;
+            continue;
+        }
+
+        if (engine->retune(param.bounds.name, next) == NIXL_SUCCESS) {
+            param.bounds.current = next;
+            updateData("backend_" + type + "_retune_" + param.bounds.name,
+                       nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND,
+                       next);
+        }
+        state.lastScore = score;
+        state.primed = true;
+    }
+}
+
+size_t
+nixlTelemetry::medianBucket(const std::array<uint64_t, 64> &buckets, uint64_t count) {
+    uint64_t half = (count + 1) / 2, seen = 0;
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        seen += buckets[i];
+        if (seen >= half) return i;
+    }
+    return buckets.size() - 1;
+}
+
+void
+nixlTelemetry::checkBackendHealth() {
+    auto now = nixlTime::getUsFast();
+    std::lock_guard<std::mutex> lock(healthLock_);
+    for (auto &[backend, bh] : health_) {
+        // Stall: requests in flight but no completion for too long
+        if (stallThresholdUs_ && bh.inFlight > 0 &&
+            static_cast<uint64_t>(now) - bh.lastProgressUs > stallThresholdUs_) {
+            if (bh.state != NIXL_BACKEND_STALLED) {
+                bh.state = NIXL_BACKEND_STALLED;
+                NIXL_WARN << "Backend " << backend->getType() << " stalled: " << bh.inFlight
+                          << " requests in flight with no completion for "
+                          << (now - bh.lastProgressUs) / 1000 << "ms";
+            }
+            buffer_->push(nixlTelemetryEvent(now,
+                                             nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND,
+                                             "backend_" + backend->getType() + "_stall_us",
+                                             now - bh.lastProgressUs));
+            continue;
+        }
+
+        // Latency drift: compare this window's median bucket against the
+        // decayed baseline; two buckets up means a 4x latency shift
+        if (bh.recentCount >= HEALTH_MIN_WINDOW_SAMPLES &&
+            bh.baselineCount >= HEALTH_MIN_BASELINE_SAMPLES) {
+            size_t recent_med = medianBucket(bh.recent, bh.recentCount);
+            size_t baseline_med = medianBucket(bh.baseline, bh.baselineCount);
+            auto next = (recent_med >= baseline_med + 2) ? NIXL_BACKEND_DEGRADED :
+                                                           NIXL_BACKEND_HEALTHY;
+            if (next != bh.state) {
+                if (next == NIXL_BACKEND_DEGRADED) {
+                    NIXL_WARN << "Backend " << backend->getType()
+                              << " degraded: median completion latency moved from ~"
+                              << (1ULL << baseline_med) << "us to ~" << (1ULL << recent_med)
+                              << "us";
+                } else {
+                    NIXL_INFO << "Backend " << backend->getType() << " back to healthy";
+                }
+                bh.state = next;
+            }
+        }
+
+        // Roll the window into the baseline
+        for (size_t i = 0; i < bh.recent.size(); ++i) {
+            bh.baseline[i] += bh.recent[i];
+            bh.recent[i] = 0;
+        }
+        bh.baselineCount += bh.recentCount;
+        bh.recentCount = 0;
+        if (bh.baselineCount > HEALTH_BASELINE_DECAY_CAP) {
+            bh.baselineCount = 0;
+            for (auto &bucket : bh.baseline) {
+                bucket >>= 1;
+                bh.baselineCount += bucket;
+            }
+        }
+    }
+}
+
+void
+nixlTelemetry::addBackendPost(const nixlBackendEngine *backend) {
+    auto now = nixlTime::getUsFast();
+    std::lock_guard<std::mutex> lock(healthLock_);
+    backendHealth &bh = health_[backend];
+    // The stall clock starts at the first post of an idle backend, so an
+    // unanswered very first request is detected too
+    if (bh.inFlight++ == 0) {
+        bh.lastProgressUs = now;
+    }
+}
+
+void
+nixlTelemetry::addBackendXfer(const nixlBackendEngine *backend,
+                              std::chrono::microseconds xfer_time,
+                              bool in_flight) {
+    uint64_t us = xfer_time.count();
+    auto now = nixlTime::getUsFast();
+    {
+        std::lock_guard<std::mutex> lock(healthLock_);
+        backendHealth &bh = health_[backend];
+        if (in_flight && bh.inFlight > 0) {
+            bh.inFlight--;
+        }
+        bh.lastProgressUs = now;
+        size_t bucket = us ? 64 - __builtin_clzll(us) : 0;
+        bh.recent[std::min<size_t>(bucket, bh.recent.size() - 1)]++;
+        bh.recentCount++;
+        if (bh.state == NIXL_BACKEND_HEALTH_UNKNOWN) {
+            bh.state = NIXL_BACKEND_HEALTHY;
+        } else if (bh.state == NIXL_BACKEND_STALLED) {
+            // Progress resumed; the next flush grades latency drift
+            bh.state = NIXL_BACKEND_HEALTHY;
+            NIXL_INFO << "Backend " << backend->getType() << " resumed completion progress";
+        }
+    }
+    // With aggregation enabled this collapses into the per-backend
+    // ".count"/".sum"/".b<k>" histogram events in the shared buffer
+    updateData("backend_" + backend->getType() + "_xfer_time",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_BACKEND,
+               us);
+}
+
+void
+nixlTelemetry::abortBackendXfer(const nixlBackendEngine *backend) {
+    auto now = nixlTime::getUsFast();
+    std::lock_guard<std::mutex> lock(healthLock_);
+    backendHealth &bh = health_[backend];
+    if (bh.inFlight > 0) {
+        bh.inFlight--;
+    }
+    // A canceled or released request is not completion progress, but its
+    // absence must not trip the stall detector either
+    bh.lastProgressUs = now;
+}
+
+nixl_backend_health_t
+nixlTelemetry::getBackendHealth(const nixlBackendEngine *backend) const {
+    std::lock_guard<std::mutex> lock(healthLock_);
+    auto it = health_.find(backend);
+    return it == health_.end() ? NIXL_BACKEND_HEALTH_UNKNOWN : it->second.state;
+}
+
 void
 nixlTelemetry::registerPeriodicTask(periodicTask &task) {
     task.timer_.expires_after(task.interval_);
@@ -158,14 +507,16 @@ void
 nixlTelemetry::updateData(const std::string &event_name,
                           nixl_telemetry_category_t category,
                           uint64_t value) {
+    if (!categoryEnabled(category))
+        return;
     // agent can be multi-threaded
-    std::lock_guard<std::mutex> lock(mutex_);
-    events_.emplace_back(std::chrono::duration_cast<std::chrono::microseconds>(
-                             std::chrono::system_clock::now().time_since_epoch())
-                             .count(),
-                         category,
-                         event_name,
-                         value);
+    eventShard &shard = myShard();
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    recordEvent(shard,
+                nixlTime::getUsFast(),
+                category,
+                event_name,
+                value);
 }
 
 // The next 4 methods might be removed, as addXferTime covers them.
@@ -193,6 +544,20 @@ nixlTelemetry::updateRxRequestsNum(uint32_t rx_requests_num) {
                rx_requests_num);
 }
 
+void
+nixlTelemetry::updateDeadlineMissCount() {
+    updateData("agent_deadline_misses",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               1);
+}
+
+void
+nixlTelemetry::updateRateLimitedCount() {
+    updateData("agent_rate_limited_posts",
+               nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+               1);
+}
+
 void
 nixlTelemetry::updateErrorCount(nixl_status_t error_type) {
     updateData(
@@ -215,6 +580,13 @@ nixlTelemetry::updateMemoryDeregistered(uint64_t memory_deregistered) {
 
 void
 nixlTelemetry::addXferTime(std::chrono::microseconds xfer_time, bool is_write, uint64_t bytes) {
+    const bool perf_on = categoryEnabled(
+        nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE);
+    const bool xfer_on = categoryEnabled(
+        nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER);
+    if (!perf_on && !xfer_on)
+        return;
+
     std::string bytes_name;
     std::string requests_name;
 
@@ -225,18 +597,21 @@ nixlTelemetry::addXferTime(std::chrono::microseconds xfer_time, bool is_write, u
         bytes_name = "agent_rx_bytes";
         requests_name = "agent_rx_requests_num";
     }
-    auto time = std::chrono::duration_cast<std::chrono::microseconds>(
-                    std::chrono::system_clock::now().time_since_epoch())
-                    .count();
-    std::lock_guard<std::mutex> lock(mutex_);
-    events_.emplace_back(time,
-                         nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
-                         "agent_xfer_time",
-                         xfer_time.count());
-    events_.emplace_back(
-        time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, bytes_name.c_str(), bytes);
-    events_.emplace_back(
-        time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, requests_name.c_str(), 1);
+    auto time = nixlTime::getUsFast();
+    eventShard &shard = myShard();
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    if (perf_on)
+        recordEvent(shard,
+                    time,
+                    nixl_telemetry_category_t::NIXL_TELEMETRY_PERFORMANCE,
+                    "agent_xfer_time",
+                    xfer_time.count());
+    if (xfer_on) {
+        recordEvent(
+            shard, time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, bytes_name, bytes);
+        recordEvent(
+            shard, time, nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER, requests_name, 1);
+    }
 }
 
 void
@@ -246,17 +621,138 @@ nixlTelemetry::addPostTime(std::chrono::microseconds post_time) {
                post_time.count());
 }
 
+// Input and merged counts are reported separately so the merge ratio can
+// be derived from the aggregated sums
+void
+nixlTelemetry::addDescMerge(uint32_t in_descs, uint32_t out_descs) {
+    if (!categoryEnabled(nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER))
+        return;
+    auto time = nixlTime::getUsFast();
+    eventShard &shard = myShard();
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    recordEvent(shard,
+                time,
+                nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+                "agent_xfer_descs_in",
+                in_descs);
+    recordEvent(shard,
+                time,
+                nixl_telemetry_category_t::NIXL_TELEMETRY_TRANSFER,
+                "agent_xfer_descs_merged",
+                in_descs - out_descs);
+}
+
+// Upper bounds of the SLO size classes; the last class is open-ended
+static const std::array<std::string, 4> slo_class_names = {"64K", "1M", "64M", "inf"};
+
+size_t
+nixlTelemetry::sloClassIndex(uint64_t bytes) {
+    if (bytes <= 64 * 1024) return 0;
+    if (bytes <= 1024 * 1024) return 1;
+    if (bytes <= 64 * 1024 * 1024) return 2;
+    return 3;
+}
+
+void
+nixlTelemetry::addXferClassTime(const nixlBackendEngine *backend,
+                                const std::string &remote_agent,
+                                std::chrono::microseconds xfer_time,
+                                uint64_t bytes) {
+    if (!categoryEnabled(nixl_telemetry_category_t::NIXL_TELEMETRY_SLO))
+        return;
+
+    const size_t cls = sloClassIndex(bytes);
+    const uint64_t us = xfer_time.count();
+
+    const std::lock_guard<std::mutex> lock(sloLock_);
+    sloClassStats &stats = sloStats_[{backend, remote_agent, cls}];
+    stats.count++;
+    stats.sumUs += us;
+    if (us > stats.maxUs) {
+        stats.maxUs = us;
+    }
+
+    if (sloThresholdUs_[cls] == 0 || us <= sloThresholdUs_[cls]) {
+        return;
+    }
+    stats.breaches++;
+    sloBreachMsgs_.push_back("NIXL_SLO_BREACH:" + (backend ? backend->getType() : "COMPOUND") +
+                             ":" + remote_agent + ":" + slo_class_names[cls] + ":" +
+                             std::to_string(us) + ":" + std::to_string(sloThresholdUs_[cls]));
+}
+
+void
+nixlTelemetry::drainSloBreaches(const std::string &agent_name, notif_list_t &notif_list) {
+    const std::lock_guard<std::mutex> lock(sloLock_);
+    for (auto &msg : sloBreachMsgs_) {
+        notif_list.push_back({agent_name, std::move(msg)});
+    }
+    sloBreachMsgs_.clear();
+}
+
+void
+nixlTelemetry::publishSloStats() {
+    std::map<slo_key_t, sloClassStats> window;
+    {
+        const std::lock_guard<std::mutex> lock(sloLock_);
+        if (sloStats_.empty()) {
+            return;
+        }
+        window.swap(sloStats_);
+    }
+
+    // Peers collapse into one event set per (backend, class); the breach
+    // messages already carry the peer for anyone chasing a specific link
+    std::map<std::pair<const nixlBackendEngine *, size_t>, sloClassStats> per_class;
+    for (const auto &[key, stats] : window) {
+        sloClassStats &agg = per_class[{std::get<0>(key), std::get<2>(key)}];
+        agg.count += stats.count;
+        agg.sumUs += stats.sumUs;
+        if (stats.maxUs > agg.maxUs) {
+            agg.maxUs = stats.maxUs;
+        }
+        agg.breaches += stats.breaches;
+    }
+
+    for (const auto &[key, agg] : per_class) {
+        const std::string suffix =
+            slo_class_names[key.second] + "." + (key.first ? key.first->getType() : "COMPOUND");
+        updateData("agent_slo_avg_us_" + suffix,
+                   nixl_telemetry_category_t::NIXL_TELEMETRY_SLO,
+                   agg.sumUs / agg.count);
+        updateData(
+            "agent_slo_max_us_" + suffix, nixl_telemetry_category_t::NIXL_TELEMETRY_SLO, agg.maxUs);
+        if (agg.breaches) {
+            updateData("agent_slo_breaches_" + suffix,
+                       nixl_telemetry_category_t::NIXL_TELEMETRY_SLO,
+                       agg.breaches);
+        }
+    }
+}
+
+std::string
+nixlEnumStrings::backendHealthStr(const nixl_backend_health_t &health) {
+    static std::array<std::string, 4> nixl_backend_health_str = {"NIXL_BACKEND_HEALTH_UNKNOWN",
+                                                                 "NIXL_BACKEND_HEALTHY",
+                                                                 "NIXL_BACKEND_DEGRADED",
+                                                                 "NIXL_BACKEND_STALLED"};
+    size_t health_int = static_cast<size_t>(health);
+    if (health_int >= nixl_backend_health_str.size()) return "BAD_HEALTH";
+    return nixl_backend_health_str[health_int];
+}
+
 std::string
 nixlEnumStrings::telemetryCategoryStr(const nixl_telemetry_category_t &category) {
-    static std::array<std::string, 9> nixl_telemetry_category_str = {"NIXL_TELEMETRY_MEMORY",
-                                                                     "NIXL_TELEMETRY_TRANSFER",
-                                                                     "NIXL_TELEMETRY_CONNECTION",
-                                                                     "NIXL_TELEMETRY_BACKEND",
-                                                                     "NIXL_TELEMETRY_ERROR",
-                                                                     "NIXL_TELEMETRY_PERFORMANCE",
-                                                                     "NIXL_TELEMETRY_SYSTEM",
-                                                                     "NIXL_TELEMETRY_CUSTOM",
-                                                                     "NIXL_TELEMETRY_MAX"};
+    static std::array<std::string, 10> nixl_telemetry_category_str = {"NIXL_TELEMETRY_MEMORY",
+                                                                      "NIXL_TELEMETRY_TRANSFER",
+                                                                      "NIXL_TELEMETRY_CONNECTION",
+                                                                      "NIXL_TELEMETRY_BACKEND",
+                                                                      "NIXL_TELEMETRY_ERROR",
+                                                                      "NIXL_TELEMETRY_PERFORMANCE",
+                                                                      "NIXL_TELEMETRY_SYSTEM",
+                                                                      "NIXL_TELEMETRY_CUSTOM",
+                                                                      "NIXL_TELEMETRY_SLO",
+                                                                      "NIXL_TELEMETRY_MAX"};
     size_t category_int = static_cast<size_t>(category);
     if (category_int >= nixl_telemetry_category_str.size()) return "BAD_CATEGORY";
     return nixl_telemetry_category_str[category_int];
@@ -22,7 +22,11 @@
 #include "mem_section.h"
 #include "nixl_types.h"
 
+#include <array>
+#include <map>
 #include <string>
+#include <tuple>
+#include <utility>
 #include <vector>
 #include <mutex>
 #include <memory>
@@ -31,6 +35,13 @@
 
 #include <asio.hpp>
 
+// Build-time telemetry category mask (see the telemetry_category_mask
+// build option): one bit per nixl_telemetry_category_t value, with
+// everything compiled in by default
+#ifndef NIXL_TELEMETRY_CATEGORY_MASK
+#define NIXL_TELEMETRY_CATEGORY_MASK 0xFFFFFFFFu
+#endif
+
 struct periodicTask {
     asio::steady_timer timer_;
     std::function<bool()> callback_;
@@ -41,9 +52,14 @@ struct periodicTask {
           interval_(interval) {}
 };
 
+class nixlMemBudget;
+
 class nixlTelemetry {
 public:
-    nixlTelemetry(const std::string &name, backend_map_t &backend_map);
+    nixlTelemetry(const std::string &name,
+                  backend_map_t &backend_map,
+                  nixlMemBudget *mem_budget = nullptr,
+                  uint32_t category_mask = 0xFFFFFFFFu);
 
     ~nixlTelemetry();
 
@@ -57,6 +73,12 @@ public:
     updateRxRequestsNum(uint32_t num);
     void
     updateErrorCount(nixl_status_t error_type);
+    // Completion observed past its nixl_opt_args_t::deadlineUs
+    void
+    updateDeadlineMissCount();
+    // Post denied by a per-peer token bucket (see setXferRateLimit)
+    void
+    updateRateLimitedCount();
     void
     updateMemoryRegistered(uint64_t memory_registered);
     void
@@ -65,6 +87,36 @@ public:
     addXferTime(std::chrono::microseconds transaction_time, bool is_write, uint64_t bytes);
     void
     addPostTime(std::chrono::microseconds post_time);
+    void
+    addDescMerge(uint32_t in_descs, uint32_t out_descs);
+    // Size-class latency accounting for SLO tracking: bytes selects the
+    // class (<=64K, <=1M, <=64M, larger) and a completion past the class
+    // threshold from NIXL_TELEMETRY_SLO_US queues a breach message
+    void
+    addXferClassTime(const nixlBackendEngine *backend,
+                     const std::string &remote_agent,
+                     std::chrono::microseconds xfer_time,
+                     uint64_t bytes);
+    // Moves pending SLO breach messages into notif_list, keyed by the
+    // agent's own name so they surface through the regular getNotifs drain
+    void
+    drainSloBreaches(const std::string &agent_name, notif_list_t &notif_list);
+
+    // Backend health tracking (see nixl_backend_health_t): posts and
+    // completions feed per-backend rolling latency histograms and the
+    // stall detector run from the periodic flush task. in_flight tells
+    // whether the completion was counted in flight by an earlier post
+    // (false for transfers that completed inline at post time).
+    void
+    addBackendPost(const nixlBackendEngine *backend);
+    void
+    addBackendXfer(const nixlBackendEngine *backend,
+                   std::chrono::microseconds xfer_time,
+                   bool in_flight);
+    void
+    abortBackendXfer(const nixlBackendEngine *backend);
+    nixl_backend_health_t
+    getBackendHealth(const nixlBackendEngine *backend) const;
 
 private:
     void
@@ -76,12 +128,121 @@ private:
     bool
     writeEventHelper();
     std::unique_ptr<sharedRingBuffer<nixlTelemetryEvent>> buffer_;
-    std::vector<nixlTelemetryEvent> events_;
-    std::mutex mutex_;
+    // With NIXL_TELEMETRY_AGGREGATION set, per-operation events collapse
+    // into per-(category, name) count/sum plus a log2-bucketed value
+    // histogram, flushed each interval as synthetic ".count"/".sum"/".b<k>"
+    // events; NIXL_TELEMETRY_SAMPLE_RATE=N additionally passes through
+    // every Nth raw event
+    struct aggState {
+        uint64_t count = 0;
+        uint64_t sum = 0;
+        std::array<uint64_t, 64> buckets = {};
+    };
+    using agg_key_t = std::pair<nixl_telemetry_category_t, std::string>;
+    // Posting threads append to a per-thread shard instead of serializing
+    // on one mutex; the flush task merges all shards by timestamp
+    static constexpr size_t numShards_ = 16;
+    struct eventShard {
+        std::mutex mutex_;
+        std::vector<nixlTelemetryEvent> events_;
+        std::map<agg_key_t, aggState> aggregates_;
+        uint64_t sampleCounter_ = 0;
+    };
+    std::array<eventShard, numShards_> shards_;
+    eventShard &
+    myShard();
+    // Caller holds the shard's mutex
+    void
+    recordEvent(eventShard &shard,
+                uint64_t timestamp_us,
+                nixl_telemetry_category_t category,
+                const std::string &event_name,
+                uint64_t value);
+    // Per-backend health: completions land in a log2 latency histogram
+    // (same bucketing as aggState) compared each flush against a decayed
+    // long-run baseline, and in-flight requests with no completion
+    // progress past the stall threshold mark the backend stalled
+    struct backendHealth {
+        uint64_t inFlight = 0;
+        uint64_t lastProgressUs = 0;
+        std::array<uint64_t, 64> recent = {};
+        uint64_t recentCount = 0;
+        std::array<uint64_t, 64> baseline = {};
+        uint64_t baselineCount = 0;
+        nixl_backend_health_t state = NIXL_BACKEND_HEALTH_UNKNOWN;
+    };
+    mutable std::mutex healthLock_;
+    std::map<const nixlBackendEngine *, backendHealth> health_;
+    uint64_t stallThresholdUs_ = 0;
+    // Runs on the flush task: detects stalls and grades latency drift
+    void
+    checkBackendHealth();
+    // Size-class SLO tracking (NIXL_TELEMETRY_SLO_US): completions land in
+    // a per-(backend, peer, class) window published each flush, so a
+    // small-transfer latency regression is visible even while the bulk
+    // classes hold their aggregates
+    struct sloClassStats {
+        uint64_t count = 0;
+        uint64_t sumUs = 0;
+        uint64_t maxUs = 0;
+        uint64_t breaches = 0;
+    };
+    using slo_key_t = std::tuple<const nixlBackendEngine *, std::string, size_t>;
+    static constexpr size_t numSloClasses_ = 4;
+    // Per-class breach thresholds in microseconds; 0 keeps the class
+    // aggregating without generating breaches
+    std::array<uint64_t, numSloClasses_> sloThresholdUs_ = {};
+    mutable std::mutex sloLock_;
+    std::map<slo_key_t, sloClassStats> sloStats_;
+    std::vector<std::string> sloBreachMsgs_;
+    static size_t
+    sloClassIndex(uint64_t bytes);
+    // Runs on the flush task: collapses the window into per-class events
+    void
+    publishSloStats();
+    // Auto-tuner (NIXL_TELEMETRY_AUTO_TUNE): a bounded multiplicative hill
+    // climb over the parameters each backend declares via getTunableParams,
+    // one parameter per backend at a time, scored by the median bucket of
+    // the same per-flush latency histogram the health checker grades
+    struct tunerParam {
+        nixl_tunable_param_t bounds;
+        bool increasing = true;
+    };
+    struct tunerState {
+        std::vector<tunerParam> params;
+        size_t active = 0;
+        size_t lastScore = 0;
+        bool primed = false;
+    };
+    bool autoTune_ = false;
+    std::map<nixlBackendEngine *, tunerState> tuners_;
+    // Runs on the flush task, before the window histograms are rolled
+    void
+    autoTuneBackends();
+    static size_t
+    medianBucket(const std::array<uint64_t, 64> &buckets, uint64_t count);
+    // Single-branch category filter for write sites: the build-time mask
+    // is a constant, so a site whose (constant) category is compiled out
+    // folds away entirely, and the runtime mask from nixlAgentConfig is
+    // one AND+test. Keeps error/connection events always-on while noisy
+    // transfer categories are masked off.
+    bool
+    categoryEnabled(nixl_telemetry_category_t category) const {
+        const uint32_t bit = 1u << static_cast<uint32_t>(category);
+        return (NIXL_TELEMETRY_CATEGORY_MASK & categoryMask_ & bit) != 0;
+    }
+    uint32_t categoryMask_ = 0xFFFFFFFFu;
+    bool aggregate_ = false;
+    uint64_t sampleRate_ = 0;
     asio::thread_pool pool_;
     periodicTask writeTask_;
     std::string file_;
     backend_map_t &backendMap_;
+    // Agent pool-memory budget (see nixlMemBudget): the flush task
+    // publishes its usage each interval and warns once past the soft
+    // watermark
+    nixlMemBudget *memBudget_ = nullptr;
+    bool softWarnLogged_ = false;
 };
 
 #endif // _TELEMETRY_H
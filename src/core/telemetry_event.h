@@ -25,6 +25,11 @@
 constexpr char TELEMETRY_BUFFER_SIZE_VAR[] = "NIXL_TELEMETRY_BUFFER_SIZE";
 constexpr char TELEMETRY_DIR_VAR[] = "NIXL_TELEMETRY_DIR";
 constexpr char TELEMETRY_RUN_INTERVAL_VAR[] = "NIXL_TELEMETRY_RUN_INTERVAL";
+constexpr char TELEMETRY_AGGREGATION_VAR[] = "NIXL_TELEMETRY_AGGREGATION";
+constexpr char TELEMETRY_SAMPLE_RATE_VAR[] = "NIXL_TELEMETRY_SAMPLE_RATE";
+constexpr char TELEMETRY_STALL_THRESHOLD_VAR[] = "NIXL_TELEMETRY_STALL_THRESHOLD_MS";
+constexpr char TELEMETRY_AUTO_TUNE_VAR[] = "NIXL_TELEMETRY_AUTO_TUNE";
+constexpr char TELEMETRY_SLO_VAR[] = "NIXL_TELEMETRY_SLO_US";
 
 constexpr int TELEMETRY_VERSION = 1;
 constexpr size_t MAX_EVENT_NAME_LEN = 32;
@@ -42,6 +47,7 @@ enum class nixl_telemetry_category_t {
     NIXL_TELEMETRY_PERFORMANCE = 5, // Performance metrics
     NIXL_TELEMETRY_SYSTEM = 6, // System-level events
     NIXL_TELEMETRY_CUSTOM = 7, // Custom/user-defined events
+    NIXL_TELEMETRY_SLO = 8, // Size-class latency SLO stats and breaches
 };
 
 namespace nixlEnumStrings {
@@ -0,0 +1,52 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_telemetry_reader.h"
+
+#include "common/cyclic_buffer.h"
+
+nixlTelemetryReader::nixlTelemetryReader(const std::string &file_path)
+    : buffer_(std::make_unique<sharedRingBuffer<nixlTelemetryEvent>>(file_path,
+                                                                     false,
+                                                                     TELEMETRY_VERSION)) {}
+
+nixlTelemetryReader::~nixlTelemetryReader() = default;
+
+bool
+nixlTelemetryReader::pop(nixlTelemetryEvent &event) {
+    return buffer_->pop(event);
+}
+
+size_t
+nixlTelemetryReader::size() const {
+    return buffer_->size();
+}
+
+size_t
+nixlTelemetryReader::capacity() const {
+    return buffer_->capacity();
+}
+
+uint32_t
+nixlTelemetryReader::version() const {
+    return buffer_->version();
+}
+
+std::string
+nixlTelemetryReader::eventName(const nixlTelemetryEvent &event) {
+    return std::string(event.eventName_,
+                       strnlen(event.eventName_, MAX_EVENT_NAME_LEN));
+}
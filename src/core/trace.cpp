@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include "common/nixl_log.h"
+#include "common/nixl_time.h"
+#include "trace.h"
+
+namespace fs = std::filesystem;
+
+constexpr size_t DEFAULT_TRACE_BUFFER_SIZE = 4096;
+
+// Wire frame prepended to a traced notification: magic + raw 16-byte id,
+// followed by the untouched application payload. The magic keeps untraced
+// notifications (which never carry it) distinguishable on the receive side.
+constexpr char TRACE_NOTIF_MAGIC[] = "NIXLTRC1";
+constexpr size_t TRACE_NOTIF_MAGIC_LEN = sizeof(TRACE_NOTIF_MAGIC) - 1;
+
+namespace nixlEnumStrings {
+std::string
+tracePointStr(const nixl_trace_point_t &point) {
+    switch (point) {
+    case nixl_trace_point_t::NIXL_TRACE_XFER_CREATED:
+        return "XFER_CREATED";
+    case nixl_trace_point_t::NIXL_TRACE_XFER_POSTED:
+        return "XFER_POSTED";
+    case nixl_trace_point_t::NIXL_TRACE_XFER_COMPLETED:
+        return "XFER_COMPLETED";
+    case nixl_trace_point_t::NIXL_TRACE_XFER_FAILED:
+        return "XFER_FAILED";
+    case nixl_trace_point_t::NIXL_TRACE_NOTIF_SENT:
+        return "NOTIF_SENT";
+    case nixl_trace_point_t::NIXL_TRACE_NOTIF_RECEIVED:
+        return "NOTIF_RECEIVED";
+    }
+    return "BAD_POINT";
+}
+} // namespace nixlEnumStrings
+
+nixlTracer::nixlTracer(const std::string &name) {
+    auto buffer_size = std::getenv(TRACE_BUFFER_SIZE_VAR) ?
+        std::stoul(std::getenv(TRACE_BUFFER_SIZE_VAR)) :
+        DEFAULT_TRACE_BUFFER_SIZE;
+    if (buffer_size == 0) {
+        throw std::invalid_argument("Trace buffer size cannot be 0");
+    }
+
+    // The tracer is only constructed when tracing is enabled, so the
+    // directory variable is expected to be there
+    auto folder_path = std::getenv(TRACE_DIR_VAR) ? std::getenv(TRACE_DIR_VAR) : "/tmp";
+    auto full_file_path = fs::path(folder_path) / (name + ".trace");
+
+    NIXL_INFO << "Request tracing enabled, using buffer path: " << full_file_path
+              << " with size: " << buffer_size;
+
+    buffer_ = std::make_unique<sharedRingBuffer<nixlTraceEvent>>(
+        full_file_path, true, TRACE_VERSION, buffer_size);
+}
+
+bool
+nixlTracer::idSet(const nixl_trace_id_t &id) {
+    return std::any_of(id.begin(), id.end(), [](uint8_t b) { return b != 0; });
+}
+
+nixl_blob_t
+nixlTracer::wrapNotif(const nixl_trace_id_t &id, const nixl_blob_t &msg) {
+    if (!idSet(id)) return msg;
+
+    nixl_blob_t wrapped;
+    wrapped.reserve(TRACE_NOTIF_MAGIC_LEN + id.size() + msg.size());
+    wrapped.append(TRACE_NOTIF_MAGIC, TRACE_NOTIF_MAGIC_LEN);
+    wrapped.append(reinterpret_cast<const char *>(id.data()), id.size());
+    wrapped.append(msg);
+    return wrapped;
+}
+
+bool
+nixlTracer::unwrapNotif(nixl_blob_t &msg, nixl_trace_id_t &id) {
+    if (msg.size() < TRACE_NOTIF_MAGIC_LEN + id.size() ||
+        memcmp(msg.data(), TRACE_NOTIF_MAGIC, TRACE_NOTIF_MAGIC_LEN) != 0)
+        return false;
+
+    memcpy(id.data(), msg.data() + TRACE_NOTIF_MAGIC_LEN, id.size());
+    msg.erase(0, TRACE_NOTIF_MAGIC_LEN + id.size());
+    return true;
+}
+
+void
+nixlTracer::record(const nixl_trace_id_t &id, nixl_trace_point_t point, uint64_t value) {
+    nixlTraceEvent event(nixlTime::getUsFast(), id, point, value);
+    std::lock_guard<std::mutex> lock(lock_);
+    if (!buffer_->push(event)) {
+        NIXL_DEBUG << "Trace buffer full, dropping event";
+    }
+}
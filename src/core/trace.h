@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_TRACE_H
+#define _NIXL_TRACE_H
+
+#include "common/cyclic_buffer.h"
+#include "trace_event.h"
+#include "nixl_types.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * Per-agent request tracer: lifecycle points of requests carrying a
+ * nonzero trace id (see nixl_opt_args_t::traceId) land in a binary
+ * per-agent ring buffer at "<NIXL_TRACE_DIR>/<agent>.trace", reusing the
+ * telemetry sharedRingBuffer format so external readers can follow it
+ * live. The trace id also rides in notification payloads (see wrapNotif /
+ * unwrapNotif), so the target agent's buffer carries the same id and the
+ * trace_reader tool can merge both sides into one timeline. Constructed
+ * only when NIXL_TRACE_DIR is set; untraced requests never reach it.
+ */
+class nixlTracer {
+public:
+    nixlTracer(const std::string &name);
+
+    /** True for an id a caller actually set (any nonzero byte). */
+    static bool
+    idSet(const nixl_trace_id_t &id);
+
+    /**
+     * Frame a notification message with the trace context for the wire.
+     * Returns msg unchanged when the id is unset, so call sites don't
+     * need their own guard.
+     */
+    static nixl_blob_t
+    wrapNotif(const nixl_trace_id_t &id, const nixl_blob_t &msg);
+
+    /**
+     * Strip the trace frame off a received notification, if present.
+     * Returns true and fills id when msg carried one; msg is left as the
+     * original application payload either way.
+     */
+    static bool
+    unwrapNotif(nixl_blob_t &msg, nixl_trace_id_t &id);
+
+    void
+    record(const nixl_trace_id_t &id, nixl_trace_point_t point, uint64_t value);
+
+private:
+    std::mutex lock_;
+    std::unique_ptr<sharedRingBuffer<nixlTraceEvent>> buffer_;
+};
+
+#endif // _NIXL_TRACE_H
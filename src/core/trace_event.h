@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_TRACE_EVENT_H
+#define _NIXL_TRACE_EVENT_H
+
+#include <cstdint>
+
+#include "nixl_types.h"
+
+constexpr char TRACE_DIR_VAR[] = "NIXL_TRACE_DIR";
+constexpr char TRACE_BUFFER_SIZE_VAR[] = "NIXL_TRACE_BUFFER_SIZE";
+
+constexpr int TRACE_VERSION = 1;
+
+/**
+ * @enum nixl_trace_point_t
+ * @brief Points in a request's lifecycle recorded into the trace buffer
+ */
+enum class nixl_trace_point_t : uint32_t {
+    NIXL_TRACE_XFER_CREATED = 0, // Transfer handle created (value: total bytes)
+    NIXL_TRACE_XFER_POSTED = 1, // Transfer posted to the backend (value: total bytes)
+    NIXL_TRACE_XFER_COMPLETED = 2, // Transfer reached NIXL_SUCCESS (value: total bytes)
+    NIXL_TRACE_XFER_FAILED = 3, // Transfer reached an error status (value: -status)
+    NIXL_TRACE_NOTIF_SENT = 4, // Traced notification handed to the backend (value: msg len)
+    NIXL_TRACE_NOTIF_RECEIVED = 5, // Traced notification drained by getNotifs (value: msg len)
+};
+
+namespace nixlEnumStrings {
+std::string
+tracePointStr(const nixl_trace_point_t &point);
+}
+
+/**
+ * @struct nixlTraceEvent
+ * @brief A fixed-size trace record for cyclic buffer storage, one per
+ *        lifecycle point of a traced request
+ */
+struct nixlTraceEvent {
+    uint64_t timestampUs_;
+    nixl_trace_id_t traceId_; // Request trace context (see nixl_opt_args_t::traceId)
+    nixl_trace_point_t point_;
+    uint32_t pad_ = 0;
+    uint64_t value_; // Point-specific value (bytes, message length, status)
+    nixlTraceEvent() = default;
+
+    nixlTraceEvent(uint64_t timestamp_us,
+                   const nixl_trace_id_t &trace_id,
+                   nixl_trace_point_t point,
+                   uint64_t value)
+        : timestampUs_(timestamp_us),
+          traceId_(trace_id),
+          point_(point),
+          value_(value) {}
+};
+
+#endif // _NIXL_TRACE_EVENT_H
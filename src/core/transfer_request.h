@@ -17,14 +17,32 @@
 #ifndef __TRANSFER_REQUEST_H_
 #define __TRANSFER_REQUEST_H_
 
+#include <atomic>
 #include <chrono>
+#include <cstdlib>
+#include <functional>
 #include <string>
 #include <unordered_map>
 #include <memory>
+#include <vector>
 
 #include "nixl_types.h"
 #include "backend_engine.h"
 #include "telemetry.h"
+#ifdef NIXL_XFER_TIMELINE
+#include "common/nixl_time.h"
+#endif
+
+// Stamps a per-stage timestamp into a transfer request handle; compiles
+// to a no-op unless the library is built with -Dxfer_timeline=true, so
+// the default path pays nothing. Uses the calibrated cycle-counter clock
+// so a stamp costs a few ns and sub-microsecond stage deltas are credible
+#ifdef NIXL_XFER_TIMELINE
+#define NIXL_XFER_STAMP(req_hndl, stage) \
+    do { (req_hndl)->timeline.stage = nixlTime::getUsFast(); } while (0)
+#else
+#define NIXL_XFER_STAMP(req_hndl, stage) do { } while (0)
+#endif
 
 using chrono_point_t = std::chrono::steady_clock::time_point;
 using std::chrono::microseconds;
@@ -32,7 +50,142 @@ using std::chrono::microseconds;
 enum nixl_telemetry_stat_status_t {
     NIXL_TELEMETRY_POST = 0,
     NIXL_TELEMETRY_POST_AND_FINISH = 1,
-    NIXL_TELEMETRY_FINISH = 2
+    NIXL_TELEMETRY_FINISH = 2,
+    // In-flight request ended without completing (error, cancel or
+    // release); only rebalances the backend's in-flight accounting
+    NIXL_TELEMETRY_ABORT = 3
+};
+
+// Agent-managed compound transfer: when no single backend serves both
+// sides (e.g. remote VRAM to a local file), the request is split into a
+// network leg against the remote agent and a storage leg against our own
+// loopback section, pipelined through a registered DRAM staging pool with
+// chunked double-buffering so both legs overlap. Created and driven by
+// nixlAgent (see createCompoundXfer), one buffer cycles
+// idle -> first leg -> second leg -> idle per chunk.
+class nixlCompoundXferState {
+    public:
+        struct stagingBuf {
+            void*              addr      = nullptr;
+            nixlBackendMD*     netMD     = nullptr;
+            nixlBackendMD*     storageMD = nullptr;
+
+            // Flattened byte range of the chunk this buffer carries
+            size_t             chunkOffset = 0;
+            size_t             chunkLen    = 0;
+
+            // Leg currently in flight on this buffer (0 = idle)
+            int                leg       = 0;
+            nixlBackendEngine* legEngine = nullptr;
+            nixlBackendReqH*   legHandle = nullptr;
+        };
+
+        nixlCompoundXferState(const nixl_mem_t &remote_mem,
+                              const nixl_mem_t &storage_mem)
+            : remoteDescs(remote_mem), storageDescs(storage_mem) { }
+
+        ~nixlCompoundXferState() {
+            for (auto & buf : bufs) {
+                if (buf.legHandle)
+                    buf.legEngine->releaseReqH(buf.legHandle);
+                if (buf.netMD)
+                    netEngine->deregisterMem(buf.netMD);
+                if (buf.storageMD)
+                    storageEngine->deregisterMem(buf.storageMD);
+                free(buf.addr);
+            }
+        }
+
+        // Advance the pipeline: reap finished legs, chain second legs and
+        // refill idle buffers; NIXL_SUCCESS once all chunks are written out
+        nixl_status_t progress();
+
+        // Rewind the chunk cursor so the request can be reposted
+        inline void restart() {
+            nextOffset = 0;
+            doneBytes  = 0;
+        }
+
+        nixlBackendEngine*      netEngine     = nullptr;
+        nixlBackendEngine*      storageEngine = nullptr;
+
+        // Full populated descriptor lists; per-chunk slices are carved out
+        // of these at leg post time
+        nixl_meta_dlist_t       remoteDescs;
+        nixl_meta_dlist_t       storageDescs;
+
+        std::vector<stagingBuf> bufs;
+        size_t                  chunkSize  = 0;
+        size_t                  totalBytes = 0;
+        // Next flattened byte offset without a first leg posted yet
+        size_t                  nextOffset = 0;
+        size_t                  doneBytes  = 0;
+        nixl_xfer_op_t          op;
+        std::string             remoteAgent;
+        std::string             localAgent;
+
+    private:
+        nixl_status_t postLeg(stagingBuf &buf, int leg);
+        nixl_status_t completeLeg(stagingBuf &buf);
+};
+
+// Agent-managed broadcast: one source descriptor list written to N
+// destination agents. Peers cannot relay data on the initiator's behalf
+// (there is no remote forwarding protocol), so the schedule is a
+// root-driven chain: the source is cut into chunks and each destination
+// leg trails its predecessor by at least one chunk. The in-flight set is
+// a wavefront of one chunk per leg instead of N concurrent full-list
+// posts, and every leg's progress is tracked individually. Created by
+// nixlAgent::createBroadcastXferReq and driven through getXferStatus
+// like compound transfers.
+class nixlBcastXferState {
+    public:
+        struct destLeg {
+            std::string        agent;
+            nixlBackendEngine* engine = nullptr;
+
+            // Populated against the leg's backend at creation time;
+            // per-chunk slices are carved out of these at post time
+            nixl_meta_dlist_t  localDescs;
+            nixl_meta_dlist_t  remoteDescs;
+
+            // Chunk currently in flight on this leg (nullptr when idle)
+            nixlBackendReqH*   handle     = nullptr;
+            size_t             chunkLen   = 0;
+            // Flattened byte offset of the next chunk to post
+            size_t             nextOffset = 0;
+            size_t             doneBytes  = 0;
+            nixl_status_t      status     = NIXL_ERR_NOT_POSTED;
+
+            destLeg(const nixl_mem_t &local_mem, const nixl_mem_t &remote_mem)
+                : localDescs(local_mem), remoteDescs(remote_mem) { }
+        };
+
+        ~nixlBcastXferState() {
+            for (auto & leg : legs)
+                if (leg.handle)
+                    leg.engine->releaseReqH(leg.handle);
+        }
+
+        // Advance the wavefront: reap finished chunks and post the next
+        // ones; NIXL_SUCCESS once every leg received the full list
+        nixl_status_t progress();
+
+        // Rewind all legs so the request can be reposted
+        inline void restart() {
+            for (auto & leg : legs) {
+                leg.nextOffset = 0;
+                leg.doneBytes  = 0;
+                leg.status     = NIXL_ERR_NOT_POSTED;
+            }
+        }
+
+        std::vector<destLeg> legs;
+        size_t               chunkSize  = 0;
+        size_t               totalBytes = 0;
+
+    private:
+        nixl_status_t postChunk(destLeg &leg);
 };
 
 // Contains pointers to corresponding backend engine and its handler, and populated
@@ -49,16 +202,130 @@ class nixlXferReqH {
         nixl_blob_t        notifMsg;
         bool               hasNotif       = false;
 
+        // Completion signal written into the remote agent's registered
+        // memory by the backend (see nixl_opt_args_t::hasSignal);
+        // signalMD is owned by the remote section
+        bool               hasSignal      = false;
+        uint64_t           signalAddr     = 0;
+        uint64_t           signalValue    = 0;
+        nixlBackendMD*     signalMD       = nullptr;
+
         nixl_xfer_op_t     backendOp;
-        nixl_status_t      status;
+        // Authoritative request state. Atomic so a status check on a
+        // request that already reached a terminal status is a single load
+        // (see getXferStatus's fast path): terminal values never change
+        // until the handle is reposted or recycled, and the assignment
+        // publishing them carries release semantics
+        std::atomic<nixl_status_t> status{NIXL_ERR_NOT_POSTED};
+
+        // Priority class the backend bound the request to at prep time
+        // (see nixl_opt_args_t::priority)
+        nixl_xfer_priority_t priority = NIXL_XFER_PRIO_NORMAL;
+
+        // Trace context from creation time (see nixl_opt_args_t::traceId);
+        // all-zero for untraced requests
+        nixl_trace_id_t    traceId{};
+
+        // Completion deadline from post time (see
+        // nixl_opt_args_t::deadlineUs); 0 when none was given
+        uint64_t           deadlineUs = 0;
+
+        // Backend candidates this request was not bound to, in selection
+        // order; recorded when failover is armed (see
+        // nixl_opt_args_t::enableFailover) and consumed front to back by
+        // failoverXferReq on post errors or stall timeouts
+        std::vector<nixlBackendEngine*> backupEngines;
+
+        // Stall detection for failover: in-flight longer than
+        // failoverTimeout past postedTime triggers a cancel-and-repost
+        // on the next candidate; zero timeout disables it
+        microseconds       failoverTimeout = microseconds(0);
+        chrono_point_t     postedTime;
+
+        // Set instead of engine/backendHandle for agent-managed two-leg
+        // transfers (see nixlCompoundXferState)
+        std::unique_ptr<nixlCompoundXferState> compound;
+
+        // Set instead of engine/backendHandle for agent-managed broadcast
+        // transfers (see nixlBcastXferState)
+        std::unique_ptr<nixlBcastXferState> broadcast;
+
+        // One-shot registration made on the request's behalf (see
+        // nixl_opt_args_t::tempReg), handed to the reclamation thread for
+        // deregistration when the handle is recycled
+        std::unique_ptr<nixl_reg_dlist_t> tempRegDescs;
+
+        // Set while this request waits behind a chained predecessor (see
+        // nixl_opt_args_t::chainAfter); the predecessor's completion
+        // continuation clears it and performs the actual post, so the
+        // handle must not be recycled while it is set
+        bool               chainPending   = false;
+
+        // Status word published by the agent's completion poller (see
+        // backgroundPolling); while polled is set, status checks read this
+        // instead of entering the backend
+        std::atomic<nixl_status_t> pollStatus{NIXL_ERR_NOT_POSTED};
+        bool               polled         = false;
+
+        // Armed by onXferCompletion and fired once by the poller when the
+        // request reaches a terminal status; guarded by the agent's
+        // pollerLock
+        std::function<void(nixl_status_t)> doneCb;
+
+        // Set at creation (see nixl_opt_args_t::completionCb) and re-armed
+        // into doneCb by every post that leaves the request in flight, so
+        // each async completion is pushed through the poller
+        std::function<void(nixl_status_t)> completionCb;
 
         struct {
             chrono_point_t startTime;
             microseconds postDuration_ = microseconds(0);
             microseconds xferDuration_ = microseconds(0);
             size_t totalBytes;
+            // Counted in the backend's in-flight health accounting; a
+            // finish or abort stat hands the count back
+            bool posted_ = false;
         } telemetry;
 
+#ifdef NIXL_XFER_TIMELINE
+        // Per-stage timestamps retrievable via getXferTimeline
+        nixl_xfer_timeline_t timeline;
+#endif
+
+        // Clears per-transfer state for reuse from the agent's handle pool,
+        // keeping the descriptor list objects (and their storage) alive
+        inline void reset() {
+            if (backendHandle != nullptr) {
+                engine->releaseReqH(backendHandle);
+                backendHandle = nullptr;
+            }
+            engine = nullptr;
+            compound.reset();
+            broadcast.reset();
+            remoteAgent.clear();
+            notifMsg.clear();
+            hasNotif = false;
+            hasSignal = false;
+            signalMD = nullptr;
+            priority = NIXL_XFER_PRIO_NORMAL;
+            traceId = nixl_trace_id_t{};
+            deadlineUs = 0;
+            backupEngines.clear();
+            failoverTimeout = microseconds(0);
+            status = NIXL_ERR_NOT_POSTED;
+            polled = false;
+            chainPending = false;
+            doneCb = nullptr;
+            completionCb = nullptr;
+#ifdef NIXL_XFER_TIMELINE
+            timeline = nixl_xfer_timeline_t();
+#endif
+            if (initiatorDescs)
+                initiatorDescs->clear();
+            if (targetDescs)
+                targetDescs->clear();
+        }
+
     public:
         inline nixlXferReqH() { }
 
@@ -75,6 +342,21 @@ class nixlXferReqH {
                            nixl_telemetry_stat_status_t stat_status);
 
         friend class nixlAgent;
+        friend class nixlAgentData;
+};
+
+// Owns the notification batches drained by getNotifsView; the views handed
+// to the user point into these strings, so the handle must outlive them.
+// Batches are whole moved notif_list_t vectors: growing the outer vector
+// never relocates the strings the views refer to.
+class nixlNotifsH {
+    private:
+        std::vector<notif_list_t> batches;
+
+    public:
+        inline nixlNotifsH() { }
+
+    friend class nixlAgent;
 };
 
 class nixlDlistH {
@@ -84,6 +366,11 @@ class nixlDlistH {
         std::string        remoteAgent;
         bool               isLocal;
 
+        // Set when the handle lives in the agent's prepped-dlist cache;
+        // releasedDlistH then drops a reference instead of deleting
+        bool               cached   = false;
+        uint64_t           cacheKey = 0;
+
     public:
         inline nixlDlistH() { }
 
@@ -23,11 +23,16 @@
 #include <array>
 #include <string>
 #include <set>
+#include <tuple>
+#include <mutex>
+#include "absl/container/flat_hash_map.h"
 #include "nixl_descriptors.h"
 #include "nixl.h"
 #include "backend/backend_engine.h"
 
 using section_key_t = std::pair<nixl_mem_t, nixlBackendEngine*>;
+// Key for the exact-match descriptor index: (mem type, backend, addr, len, devId)
+using exact_key_t = std::tuple<nixl_mem_t, nixlBackendEngine*, uintptr_t, size_t, uint64_t>;
 using backend_set_t = std::set<nixlBackendEngine*>;
 using backend_map_t = std::unordered_map<nixl_backend_t, nixlBackendEngine*>;
 
@@ -40,6 +45,10 @@ using backend_map_t = std::unordered_map<nixl_backend_t, nixlBackendEngine*>;
 class nixlSectionDesc : public nixlMetaDesc {
 public:
     nixl_blob_t metaBlob;
+    // Reserved VA length behind a reserve-commit registration (see
+    // nixl_reg_hints_t::reserveLen); 0 for plain registrations. The
+    // backend MD covers this much, len is what commitMem has made usable.
+    size_t reservedLen = 0;
 
     using nixlMetaDesc::nixlMetaDesc;
 
@@ -65,6 +74,51 @@ class nixlMemSection {
     protected:
         std::array<backend_set_t, FILE_SEG+1>         memToBackend;
         section_map_t                                 sectionMap;
+        // Flat mirror of sectionMap for the per-transfer lookup path:
+        // one contiguous (backend, dlist) array per memory type, scanned
+        // linearly (a type rarely maps to more than a couple of
+        // backends) instead of walking std::map nodes on every populate;
+        // the descriptor lists it points at are themselves flat sorted
+        // arrays. Rebuilt on every registration change, read-only in
+        // between.
+        struct flatSectionEntry {
+            nixlBackendEngine *backend;
+            nixl_sec_dlist_t  *dlist;
+        };
+        std::array<std::vector<flatSectionEntry>, FILE_SEG+1> flatSections;
+        // Most populate queries repeat a registered block verbatim; this index
+        // resolves those in O(1) before falling back to the range search
+        absl::flat_hash_map<exact_key_t, nixlBackendMD*> exactIndex;
+        // Memoized sub-range resolutions: successive transfer requests
+        // resolve overlapping descriptor sets, so ranges the range search
+        // located moments ago answer from here on the next request.
+        // Entries carry the generation of resolveGen at insertion and are
+        // disregarded once any registration change bumps it, so a cached
+        // pointer can never outlive the metadata it resolves to. Guarded
+        // by resolveLock, usable by concurrent populate readers
+        struct resolvedEntry {
+            nixlBackendMD *md;
+            uint64_t       gen;
+        };
+        static constexpr size_t resolveCacheCap = 4096;
+        mutable absl::flat_hash_map<exact_key_t, resolvedEntry> resolveCache;
+        mutable std::mutex                            resolveLock;
+        // Bumped on every descriptor add/removal (under sectionLock)
+        uint64_t                                      resolveGen = 0;
+        // Guards sectionMap/memToBackend/exactIndex when multiple backends
+        // register concurrently; each backend's own desc list stays exclusive
+        // to the thread registering with that backend
+        std::mutex                                    sectionLock;
+
+        void addExact (const section_key_t &sec_key, const nixlSectionDesc &desc);
+        void remExact (const section_key_t &sec_key, const nixlSectionDesc &desc);
+
+        // Rebuild flatSections from sectionMap; call after any sectionMap
+        // change, with the same exclusivity the change itself required
+        void rebuildFlatSections ();
+        // Lookup on the flat mirror, nullptr when the pair has no section
+        nixl_sec_dlist_t* findSection (const nixl_mem_t &mem,
+                                       nixlBackendEngine* backend) const;
 
     public:
         nixlMemSection () {};
@@ -75,20 +129,106 @@ class nixlMemSection {
                                 nixlBackendEngine* backend,
                                 nixl_meta_dlist_t &resp) const;
 
+        // Same resolution over a non-owning view, so selecting a window of
+        // a large list does not copy descriptors just to query them
+        nixl_status_t populate (const nixl_xfer_dlist_view_t &query,
+                                nixlBackendEngine* backend,
+                                nixl_meta_dlist_t &resp) const;
+
+        // Resumable populate: resolves from `cursor` onward and, when a
+        // descriptor has no registration behind it, keeps the resolved
+        // prefix in resp, points cursor at the failing index and returns
+        // NIXL_ERR_NOT_FOUND. After the missing metadata arrives (e.g. via
+        // fetchRemoteMD) a retry continues from the saved cursor instead
+        // of redoing the whole list. cursor holds descCount() on success.
+        nixl_status_t populatePartial (const nixl_xfer_dlist_t &query,
+                                       nixlBackendEngine* backend,
+                                       nixl_meta_dlist_t &resp,
+                                       int &cursor) const;
+
+        nixl_status_t populatePartial (const nixl_xfer_dlist_view_t &query,
+                                       nixlBackendEngine* backend,
+                                       nixl_meta_dlist_t &resp,
+                                       int &cursor) const;
+
+        // Batched existence check resolved purely against the section's
+        // indices (no backend calls): covered[i] is set when query[i] is an
+        // exact match or falls within a registered region. A null backend
+        // checks every backend serving the query's memory type.
+        nixl_status_t queryCoverage (const nixl_xfer_dlist_t &query,
+                                     nixlBackendEngine* backend,
+                                     std::vector<bool> &covered) const;
+
+        // Per-memory-type registration totals summed across backends, for
+        // monitoring snapshots (see nixlAgent::getAgentSnapshot)
+        void statsPerMemType (std::array<size_t, FILE_SEG+1> &counts,
+                              std::array<size_t, FILE_SEG+1> &bytes) const;
 
         virtual ~nixlMemSection () = 0; // Making the class abstract
 };
 
 
 class nixlLocalSection : public nixlMemSection {
+    private:
+        // Change journal backing incremental metadata (serializeDiff): every
+        // successful add/remove batch of a remote-capable backend bumps the
+        // generation and appends one entry per descriptor
+        struct mdChange {
+            uint64_t       gen;
+            bool           added;
+            nixl_backend_t backend;
+            nixl_mem_t     mem;
+            nixl_blob_t    descBlob; // basic desc, plus public MD blob for adds
+        };
+        static constexpr size_t journalCapacity = 16384;
+        uint64_t                generation = 0;
+        // Oldest generation a diff can be based on; older peers get full MD
+        uint64_t                journalBaseGen = 0;
+        std::vector<mdChange>   journal;
+
+        void journalRecord (bool added, const nixl_backend_t &backend,
+                            nixl_mem_t mem, nixl_blob_t &&desc_blob);
+
+        // Registrations fully contained in an already registered block
+        // (e.g. tensors inside an allocator slab) share the enclosing
+        // block's backend MD instead of re-pinning the same pages; the MD
+        // is deregistered when its last user is removed. Guarded by
+        // sectionLock.
+        std::unordered_map<nixlBackendMD*, int> mdRefs;
+
+        // Decrements an MD's refcount, returning true when the caller
+        // should deregister it
+        bool releaseMDRef (nixlBackendMD *md);
+
     public:
+        uint64_t getGeneration () const { return generation; }
+
+        // With imported set, each descriptor's metaInfo carries an
+        // exported registration handle (see nixlAgent::exportMem) and the
+        // backend resolves it through importMem instead of pinning
         nixl_status_t addDescList (const nixl_reg_dlist_t &mem_elms,
                                    nixlBackendEngine* backend,
-                                   nixl_sec_dlist_t &remote_self);
+                                   nixl_sec_dlist_t &remote_self,
+                                   const nixl_reg_hints_t &hints
+                                       = nixl_reg_hints_t(),
+                                   bool imported = false);
+
+        // Extends the usable length of reserve-commit registrations
+        // (commitMem) in place: each desc names a registered addr/devId
+        // with its new committed len, which must grow and stay within the
+        // reserve. The backend MD already covers the reserved range, so
+        // only the advertised descriptors, the exact index and the
+        // metadata journal change — no backend call, no re-pin.
+        nixl_status_t growDescList (const nixl_reg_dlist_t &mem_elms,
+                                    nixlBackendEngine *backend);
 
-        // Each nixlBasicDesc should be same as original registration region
+        // Each nixlBasicDesc should be same as original registration region.
+        // When detached is given, backend MDs are handed back to the caller
+        // instead of being deregistered inline (deferred teardown).
         nixl_status_t remDescList (const nixl_reg_dlist_t &mem_elms,
-                                   nixlBackendEngine* backend);
+                                   nixlBackendEngine* backend,
+                                   std::vector<std::pair<nixlBackendEngine*, nixlBackendMD*>>
+                                       *detached = nullptr);
 
         nixl_status_t serialize(nixlSerDes* serializer) const;
 
@@ -96,6 +236,19 @@ class nixlLocalSection : public nixlMemSection {
                                        const backend_set_t &backends,
                                        const nixl_reg_dlist_t &mem_elms) const;
 
+        // Overload for a set of per-memory-type lists (a registration
+        // group), serialized together as one section group
+        nixl_status_t serializePartial(nixlSerDes* serializer,
+                                       const backend_set_t &backends,
+                                       const std::vector<const nixl_reg_dlist_t*>
+                                           &mem_elms) const;
+
+        // Serialize only the descriptors added/removed after since_gen.
+        // Returns NIXL_ERR_NOT_FOUND when the journal no longer reaches back
+        // that far, in which case the caller should serialize full metadata.
+        nixl_status_t serializeDiff(nixlSerDes* serializer,
+                                    uint64_t since_gen) const;
+
         ~nixlLocalSection();
 };
 
@@ -113,9 +266,18 @@ class nixlRemoteSection : public nixlMemSection {
         nixl_status_t loadRemoteData (nixlSerDes* deserializer,
                                       backend_map_t &backendToEngineMap);
 
+        // Apply an incremental update produced by nixlLocalSection::serializeDiff
+        nixl_status_t applyDiff (nixlSerDes* deserializer,
+                                 backend_map_t &backendToEngineMap);
+
         // When adding self as a remote agent for local operations
         nixl_status_t loadLocalData (const nixl_sec_dlist_t& mem_elms,
                                      nixlBackendEngine* backend);
+
+        // Mirrors nixlLocalSection::growDescList into the self remote
+        // section, so local-to-local operations see the committed length
+        nixl_status_t growLocalData (const nixl_reg_dlist_t &mem_elms,
+                                     nixlBackendEngine* backend);
         ~nixlRemoteSection();
 };
 
@@ -15,9 +15,17 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <cassert>
+#include <cstdlib>
 #include <functional>
+#include <mutex>
+#include <numeric>
 #include <stdexcept>
 #include <iostream>
+#include <unordered_map>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include "nixl.h"
 #include "nixl_descriptors.h"
 #include "mem_section.h"
@@ -25,6 +33,72 @@
 #include "serdes/serdes.h"
 #include "common/nixl_log.h"
 
+/*** Out-of-core descriptor storage (see nixlDescAllocator) ***/
+
+namespace {
+    // Byte size at which a spilled descriptor block moves to a file-backed
+    // mapping; 0 (the default, without the env var) keeps everything on
+    // the heap
+    size_t oocThreshold() {
+        static const size_t threshold = []() -> size_t {
+            const char *env = std::getenv("NIXL_OOC_DESC_THRESHOLD");
+            return env ? std::strtoull(env, nullptr, 10) : 0;
+        }();
+        return threshold;
+    }
+
+    // Blocks handed out by nixlOocAlloc, so nixlOocFree knows their
+    // mapping lengths and which frees belong to the heap instead
+    std::mutex oocLock;
+    std::unordered_map<void*, size_t> oocBlocks;
+}
+
+void* nixlOocAlloc(size_t bytes) {
+    const size_t threshold = oocThreshold();
+    if (threshold == 0 || bytes < threshold)
+        return nullptr;
+
+    const char *dir = std::getenv("NIXL_OOC_DESC_DIR");
+    if (!dir)
+        dir = "/tmp";
+
+    // Unlinked right away: the file exists only as backing store for the
+    // mapping and disappears with the process no matter how it exits
+    std::string path = std::string(dir) + "/nixl-desc-XXXXXX";
+    int fd = mkstemp(&path[0]);
+    if (fd < 0)
+        return nullptr;
+    unlink(path.c_str());
+
+    if (ftruncate(fd, bytes) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    void *addr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED,
+                      fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+        return nullptr;
+
+    std::lock_guard<std::mutex> guard(oocLock);
+    oocBlocks[addr] = bytes;
+    return addr;
+}
+
+bool nixlOocFree(void* addr) {
+    size_t bytes;
+    {
+        std::lock_guard<std::mutex> guard(oocLock);
+        auto it = oocBlocks.find(addr);
+        if (it == oocBlocks.end())
+            return false;
+        bytes = it->second;
+        oocBlocks.erase(it);
+    }
+    munmap(addr, bytes);
+    return true;
+}
+
 /*** Class nixlBasicDesc implementation ***/
 
 // No Virtual function in nixlBasicDesc class or its children, as we want
@@ -48,6 +122,16 @@ nixlBasicDesc::nixlBasicDesc(const nixl_blob_t &blob) {
     }
 }
 
+nixlBasicDesc::nixlBasicDesc(const std::string_view &blob) {
+    if (blob.size()==sizeof(nixlBasicDesc)) {
+        blob.copy(reinterpret_cast<char*>(this), sizeof(nixlBasicDesc));
+    } else { // Error indicator, not possible by descList deserializer call
+        addr  = 0;
+        len   = 0;
+        devId = 0;
+    }
+}
+
 bool nixlBasicDesc::operator<(const nixlBasicDesc &desc) const {
     if (devId != desc.devId)
         return (devId < desc.devId);
@@ -128,6 +212,23 @@ nixlBlobDesc::nixlBlobDesc(const nixl_blob_t &blob) {
     }
 }
 
+nixlBlobDesc::nixlBlobDesc(const std::string_view &blob) {
+    size_t meta_size = blob.size() - sizeof(nixlBasicDesc);
+    if (meta_size > 0) {
+        metaInfo.resize(meta_size);
+        blob.copy(reinterpret_cast<char*>(this), sizeof(nixlBasicDesc));
+        blob.copy(reinterpret_cast<char*>(&metaInfo[0]),
+                 meta_size, sizeof(nixlBasicDesc));
+    } else if (meta_size == 0) {
+        blob.copy(reinterpret_cast<char*>(this), sizeof(nixlBasicDesc));
+    } else { // Error
+        addr  = 0;
+        len   = 0;
+        devId = 0;
+        metaInfo.resize(0);
+    }
+}
+
 bool operator==(const nixlBlobDesc &lhs, const nixlBlobDesc &rhs) {
     return (((nixlBasicDesc)lhs == (nixlBasicDesc)rhs) &&
                   (lhs.metaInfo == rhs.metaInfo));
@@ -146,6 +247,106 @@ void nixlBlobDesc::print(const std::string &suffix) const {
 // The template is used to select from nixlBasicDesc/nixlMetaDesc/nixlBlobDesc
 // There are no virtual functions, so the object is all data, no pointers.
 
+namespace {
+    // LEB128 varints with zigzag for signed deltas, used by the compact
+    // descriptor-list encoding below
+    inline void putVarint(std::string &buf, uint64_t v) {
+        while (v >= 0x80) {
+            buf.push_back(char(v | 0x80));
+            v >>= 7;
+        }
+        buf.push_back(char(v));
+    }
+
+    inline bool getVarint(const std::string_view &buf, size_t &pos, uint64_t &v) {
+        v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            if (pos >= buf.size())
+                return false;
+            const uint8_t byte = buf[pos++];
+            v |= uint64_t(byte & 0x7f) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false; // Over-long varint
+    }
+
+    inline uint64_t zigzagEnc(int64_t v) {
+        return (uint64_t(v) << 1) ^ uint64_t(v >> 63);
+    }
+
+    inline int64_t zigzagDec(uint64_t v) {
+        return int64_t(v >> 1) ^ -int64_t(v & 1);
+    }
+
+    // Registered lists are near-uniform (ascending addresses, one len, one
+    // devId), so the basic fields go as three compact streams — zigzag-varint
+    // address deltas, then run-length (value, count) pairs for lens and
+    // devIds — a few bytes per descriptor instead of the 24-byte struct
+    template <class Vec>
+    void encodeCompactDescs(const Vec &descs, std::string &buf) {
+        const size_t n_desc = descs.size();
+        buf.reserve(n_desc * 4);
+        int64_t prev_addr = 0;
+        for (auto &elm : descs) {
+            putVarint(buf, zigzagEnc(int64_t(elm.addr) - prev_addr));
+            prev_addr = int64_t(elm.addr);
+        }
+        for (size_t i=0; i<n_desc; ) {
+            size_t j = i + 1;
+            while ((j < n_desc) && (descs[j].len == descs[i].len))
+                ++j;
+            putVarint(buf, descs[i].len);
+            putVarint(buf, j - i);
+            i = j;
+        }
+        for (size_t i=0; i<n_desc; ) {
+            size_t j = i + 1;
+            while ((j < n_desc) && (descs[j].devId == descs[i].devId))
+                ++j;
+            putVarint(buf, descs[i].devId);
+            putVarint(buf, j - i);
+            i = j;
+        }
+    }
+
+    template <class Vec>
+    bool decodeCompactDescs(const std::string_view &view,
+                            Vec &descs, size_t n_desc) {
+        size_t pos = 0;
+        uint64_t raw, val, run;
+        int64_t addr = 0;
+        // The count comes from an untrusted header: every descriptor takes
+        // at least one payload byte for its address delta, so bound it
+        // against the view before the resize can allocate off a corrupt
+        // count
+        if (n_desc > view.size())
+            return false;
+        descs.resize(n_desc);
+        for (size_t i=0; i<n_desc; ++i) {
+            if (!getVarint(view, pos, raw))
+                return false;
+            addr += zigzagDec(raw);
+            descs[i].addr = uintptr_t(addr);
+        }
+        for (size_t i=0; i<n_desc; ) {
+            if (!getVarint(view, pos, val) || !getVarint(view, pos, run) ||
+                (run == 0) || (run > n_desc - i))
+                return false;
+            for (; run > 0; --run, ++i)
+                descs[i].len = size_t(val);
+        }
+        for (size_t i=0; i<n_desc; ) {
+            if (!getVarint(view, pos, val) || !getVarint(view, pos, run) ||
+                (run == 0) || (run > n_desc - i))
+                return false;
+            for (; run > 0; --run, ++i)
+                descs[i].devId = val;
+        }
+        return pos == view.size();
+    }
+}
+
 template <class T>
 nixlDescList<T>::nixlDescList (const nixl_mem_t &type,
                                const bool &sorted,
@@ -179,35 +380,74 @@ nixlDescList<T>::nixlDescList(nixlSerDes* deserializer) {
         return;
 
     if (std::is_same<nixlBasicDesc, T>::value) {
-        // Contiguous in memory, so no need for per elm deserialization
-        if (str!="nixlBDList")
-            return;
-        str = deserializer->getStr("");
-        if (str.size()!= n_desc * sizeof(nixlBasicDesc))
-            return;
-        // If size is proper, deserializer cannot fail
-        descs.resize(n_desc);
-        str.copy(reinterpret_cast<char*>(descs.data()), str.size());
-
-    } else if (std::is_same<nixlBlobDesc, T>::value) {
-        if (str!="nixlSDList")
-            return;
-        for (size_t i=0; i<n_desc; ++i) {
-            str = deserializer->getStr("");
+        if (str=="nixlBVList") {
+            // Compact form (see encodeCompactDescs), decoded straight off
+            // a view into the deserializer buffer
+            std::string_view view = deserializer->getStrView("");
+            if (!decodeCompactDescs(view, descs, n_desc))
+                descs.clear();
+        } else if (str=="nixlBDList") {
+            // Contiguous struct form written by older peers
+            std::string_view view = deserializer->getStrView("");
+            if (view.size()!= n_desc * sizeof(nixlBasicDesc))
+                return;
             // If size is proper, deserializer cannot fail
-            // Allowing empty strings, might change later
-            if (str.size() < sizeof(nixlBasicDesc)) {
+            descs.resize(n_desc);
+            view.copy(reinterpret_cast<char*>(descs.data()), view.size());
+        } else {
+            return;
+        }
+    } else if constexpr (std::is_same<nixlBlobDesc, T>::value) {
+        if (str=="nixlSVList") {
+            // Compact basic fields up front, then one meta blob per element
+            std::string_view view = deserializer->getStrView("");
+            if (!decodeCompactDescs(view, descs, n_desc)) {
                 descs.clear();
                 return;
             }
-            T elm(str);
-            descs.push_back(elm);
+            for (size_t i=0; i<n_desc; ++i) {
+                // Allowing empty strings, might change later
+                std::string_view meta = deserializer->getStrView("");
+                descs[i].metaInfo.assign(meta.data(), meta.size());
+            }
+        } else if (str=="nixlSDList") {
+            // Per-element struct-plus-meta form written by older peers
+            descs.reserve(n_desc);
+            for (size_t i=0; i<n_desc; ++i) {
+                // View into the deserializer buffer, each descriptor is
+                // constructed in place from it without a temporary string
+                std::string_view view = deserializer->getStrView("");
+                // If size is proper, deserializer cannot fail
+                // Allowing empty strings, might change later
+                if (view.size() < sizeof(nixlBasicDesc)) {
+                    descs.clear();
+                    return;
+                }
+                descs.emplace_back(view);
+            }
+        } else {
+            return;
         }
     } else {
         return; // Unknown type, error
     }
 }
 
+template <class T>
+nixlDescList<T>::nixlDescList(const nixlDescListView<T> &view) {
+    static_assert (std::is_base_of<nixlBasicDesc, T>::value);
+    this->type   = view.getType();
+    this->sorted = view.isSorted();
+    descs.reserve(view.descCount());
+    for (auto & elm : view)
+        descs.push_back(elm);
+#ifndef NDEBUG
+    if (sorted)
+        for (const T* p = view.begin(); p + 1 < view.end(); ++p)
+            assert(!(*(p + 1) < *p));
+#endif
+}
+
 // Getter
 template <class T>
 inline const T& nixlDescList<T>::operator[](unsigned int index) const {
@@ -224,11 +464,47 @@ inline T& nixlDescList<T>::operator[](unsigned int index) {
     // if (index >= descs.size())
     //     throw std::out_of_range("Index is out of range");
     // sorted = false;
+    invalidateIndex();
     return descs[index];
 }
 
+template <class T>
+void nixlDescList<T>::buildIndex() const {
+    queryIndex.resize(descs.size());
+    std::iota(queryIndex.begin(), queryIndex.end(), 0);
+    std::sort(queryIndex.begin(), queryIndex.end(),
+              [this](const int &a, const int &b) { return descs[a] < descs[b]; });
+
+    prefixMaxEnd.resize(descs.size());
+    uintptr_t max_end = 0;
+    for (size_t i = 0; i < queryIndex.size(); ++i) {
+        const T &d = descs[queryIndex[i]];
+        if ((i > 0) && (d.devId != descs[queryIndex[i-1]].devId))
+            max_end = 0;
+        max_end = std::max(max_end, d.addr + d.len);
+        prefixMaxEnd[i] = max_end;
+    }
+
+    indexValid = true;
+}
+
+template <class T>
+void nixlDescList<T>::buildSoA() const {
+    const size_t size = descs.size();
+    soaDevId.resize(size);
+    soaAddr.resize(size);
+    soaLen.resize(size);
+    for (size_t i=0; i<size; ++i) {
+        soaDevId[i] = descs[i].devId;
+        soaAddr[i]  = descs[i].addr;
+        soaLen[i]   = descs[i].len;
+    }
+    soaValid = true;
+}
+
 template <class T>
 void nixlDescList<T>::addDesc (const T &desc) {
+    invalidateIndex();
     if (!sorted) {
         descs.push_back(desc);
     } else {
@@ -241,12 +517,105 @@ void nixlDescList<T>::addDesc (const T &desc) {
     }
 }
 
+template <class T>
+void nixlDescList<T>::assignSorted (const T *batch, const size_t &count) {
+    invalidateIndex();
+#ifndef NDEBUG
+    for (size_t i=0; i+1<count; ++i)
+        assert(!(batch[i+1] < batch[i]));
+#endif
+    descs.clear();
+    descs.reserve(count);
+    for (size_t i=0; i<count; ++i)
+        descs.push_back(batch[i]);
+    sorted = true;
+}
+
+template <class T>
+void nixlDescList<T>::addDescs (const T *batch, const size_t &count) {
+    if (count == 0)
+        return;
+    invalidateIndex();
+#ifndef NDEBUG
+    if (sorted)
+        for (size_t i=0; i+1<count; ++i)
+            assert(!(batch[i+1] < batch[i]));
+#endif
+    size_t old_size = descs.size();
+    descs.resize(old_size + count);
+    if (!sorted || (old_size == 0)) {
+        std::copy(batch, batch + count, descs.begin() + old_size);
+        return;
+    }
+
+    // Both runs are sorted; one backward merge places every element with a
+    // single move, instead of shifting the tail once per inserted descriptor
+    size_t dst = old_size + count;
+    size_t src = old_size;
+    size_t bat = count;
+    while (bat > 0) {
+        if ((src > 0) && (batch[bat-1] < descs[src-1]))
+            descs[--dst] = std::move(descs[--src]);
+        else
+            descs[--dst] = batch[--bat];
+    }
+}
+
+template <class T>
+void nixlDescList<T>::addStridedDescs (const T &base_desc, const size_t &stride,
+                                       const size_t &count) {
+    if (count == 0)
+        return;
+    assert(stride >= base_desc.len);
+    invalidateIndex();
+    size_t old_size = descs.size();
+    if (!sorted || (old_size == 0) || (descs[old_size-1] < base_desc)) {
+        // A strided run is ascending by construction, so when it lands past
+        // the current tail (always, for the common build-from-scratch case)
+        // it can be written out directly in one resize + fill pass
+        descs.resize(old_size + count);
+        T elm = base_desc;
+        for (size_t i=0; i<count; ++i) {
+            descs[old_size + i] = elm;
+            elm.addr += stride;
+        }
+        return;
+    }
+
+    // Run starts inside the existing sorted range; materialize it and let
+    // the single backward merge of addDescs place it
+    std::vector<T> batch(count, base_desc);
+    for (size_t i=1; i<count; ++i)
+        batch[i].addr = batch[i-1].addr + stride;
+    addDescs(batch.data(), count);
+}
+
 template <class T>
 bool nixlDescList<T>::overlaps (const T &desc, int &index) const {
     if (!sorted) {
-        for (size_t i=0; i<descs.size(); ++i) {
-            if (descs[i].overlaps(desc)) {
-                index = i;
+        if (!indexValid)
+            buildIndex();
+        // Binary search over the index; descriptors at or past the
+        // insertion point have a start address at or past the query's, so
+        // the first of them is the only forward candidate
+        auto itr = std::upper_bound(queryIndex.begin(), queryIndex.end(), desc,
+                                    [this](const nixlBasicDesc &q, const int &idx)
+                                    { return q < descs[idx]; });
+        if ((itr != queryIndex.end()) && (descs[*itr].overlaps(desc))) {
+            index = *itr;
+            return true;
+        }
+        // Lists are not guaranteed internally disjoint, so an earlier
+        // descriptor can span past its sorted successors and still reach
+        // the query; walk back while the prefix max-end says some earlier
+        // range on this device extends past the query address
+        for (auto rit = itr; rit != queryIndex.begin();) {
+            --rit;
+            if ((descs[*rit].devId != desc.devId) ||
+                (prefixMaxEnd[rit - queryIndex.begin()] <= desc.addr))
+                break;
+            if (descs[*rit].overlaps(desc)) {
+                index = *rit;
                 return true;
             }
         }
@@ -272,10 +641,23 @@ bool nixlDescList<T>::hasOverlaps () const {
         return false;
 
     if (!sorted) {
+        // If any two descriptors overlap, some pair that is adjacent in the
+        // sorted order overlaps too, so one linear pass over the index suffices
+        if (!indexValid)
+            buildIndex();
         for (size_t i=0; i<descs.size()-1; ++i)
-            for (size_t j=i+1; j<descs.size(); ++j)
-                if (descs[i].overlaps(descs[j]))
-                    return true;
+            if (descs[queryIndex[i]].overlaps(descs[queryIndex[i+1]]))
+                return true;
+    } else if (descs.size() >= SOA_THRESHOLD) {
+        // Same check over the SoA mirror: contiguous integer compares that
+        // vectorize, instead of striding over full descriptors
+        if (!soaValid)
+            buildSoA();
+        for (size_t i=0; i<descs.size()-1; ++i)
+            if ((soaDevId[i] == soaDevId[i+1]) &&
+                (soaAddr[i] + soaLen[i] > soaAddr[i+1]) &&
+                (soaAddr[i+1] + soaLen[i+1] > soaAddr[i]))
+                return true;
     } else {
         for (size_t i=0; i<descs.size()-1; ++i)
             if (descs[i].overlaps(descs[i+1]))
@@ -290,6 +672,7 @@ void nixlDescList<T>::remDesc (const int &index){
     if (((size_t) index >= descs.size()) || (index < 0))
         throw std::out_of_range("Index is out of range");
     descs.erase(descs.begin() + index);
+    invalidateIndex();
 }
 
 template <class T>
@@ -298,6 +681,20 @@ void nixlDescList<T>::resize (const size_t &count) {
     // if (count > descs.size())
     //     sorted = false;
     descs.resize(count);
+    invalidateIndex();
+}
+
+template <class T>
+void nixlDescList<T>::reinit (const nixl_mem_t &type,
+                              const bool &sorted,
+                              const size_t &init_size) {
+    this->type   = type;
+    this->sorted = sorted;
+    // clear + resize keeps the vector capacity, so reuse from the pool
+    // does not reallocate in steady state
+    descs.clear();
+    descs.resize(init_size);
+    invalidateIndex();
 }
 
 template <class T>
@@ -310,6 +707,28 @@ bool nixlDescList<T>::verifySorted() {
         return true;
     }
 
+    if ((size_t) size >= SOA_THRESHOLD) {
+        // Replicates nixlBasicDesc (<) over the SoA mirror in a loop the
+        // compiler can vectorize
+        if (!soaValid)
+            buildSoA();
+        for (int i=0; i<size-1; ++i) {
+            bool lt = (soaDevId[i+1] < soaDevId[i]) ||
+                      ((soaDevId[i+1] == soaDevId[i]) &&
+                       ((soaAddr[i+1] < soaAddr[i]) ||
+                        ((soaAddr[i+1] == soaAddr[i]) && (soaLen[i+1] < soaLen[i]))));
+            if (lt) {
+                if (sorted) {
+                    NIXL_WARN << "Descs are not sorted although sorted=True was passed, this may affect performance";
+                }
+                sorted = false;
+                return false;
+            }
+        }
+        sorted = true;
+        return true;
+    }
+
     for (int i=0; i<size-1; ++i) {
         if (descs[i+1] < descs[i]) {
             if (sorted) {
@@ -345,10 +764,17 @@ nixlDescList<nixlBasicDesc> nixlDescList<T>::trim() const {
 template <class T>
 int nixlDescList<T>::getIndex(const nixlBasicDesc &query) const {
     if (!sorted) {
-        auto itr = std::find(descs.begin(), descs.end(), query);
-        if (itr == descs.end())
+        if (!indexValid)
+            buildIndex();
+        auto itr = std::lower_bound(queryIndex.begin(), queryIndex.end(), query,
+                                    [this](const int &idx, const nixlBasicDesc &q)
+                                    { return descs[idx] < q; });
+        if (itr == queryIndex.end())
             return NIXL_ERR_NOT_FOUND; // not found
-        return itr - descs.begin();
+        // As desired, becomes nixlBasicDesc on both sides
+        if (descs[*itr] == query)
+            return *itr;
+        return NIXL_ERR_NOT_FOUND;
     } else {
         auto itr = std::lower_bound(descs.begin(), descs.end(), query);
         if (itr == descs.end())
@@ -360,6 +786,61 @@ int nixlDescList<T>::getIndex(const nixlBasicDesc &query) const {
     return NIXL_ERR_NOT_FOUND;
 }
 
+template <class T>
+int nixlDescList<T>::findCovering(const nixlBasicDesc &query, int hint) const {
+    const int size = (int) descs.size();
+    if ((hint < 0) || (hint >= size))
+        hint = 0;
+
+    if (!sorted) {
+        for (int i=0; i<size; ++i)
+            if (descs[i].covers(query))
+                return i;
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    if ((size_t) size >= SOA_THRESHOLD) {
+        // Hot/cold split: the search walks the SoA mirror only — three
+        // contiguous scalar arrays — instead of dragging each probed
+        // descriptor's cold metadata fields through cache; the full
+        // descriptor is touched once, by the caller, at the found index
+        if (!soaValid)
+            buildSoA();
+        int lo = hint, hi = size;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            // Replicates nixlBasicDesc (<) over the mirror
+            bool lt = (soaDevId[mid] < query.devId) ||
+                      ((soaDevId[mid] == query.devId) &&
+                       ((soaAddr[mid] < query.addr) ||
+                        ((soaAddr[mid] == query.addr) && (soaLen[mid] < query.len))));
+            if (lt)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        // Same start address case, then the previous entry
+        for (int idx = lo; (idx >= lo - 1) && (idx >= hint); --idx) {
+            if ((idx < size) &&
+                (soaDevId[idx] == query.devId) &&
+                (soaAddr[idx] <= query.addr) &&
+                (soaAddr[idx] + soaLen[idx] >= query.addr + query.len))
+                return idx;
+        }
+        return NIXL_ERR_NOT_FOUND;
+    }
+
+    auto itr = std::lower_bound(descs.begin() + hint, descs.end(), query);
+    if ((itr != descs.end()) && (itr->covers(query)))
+        return itr - descs.begin();
+    if (itr != descs.begin() + hint) {
+        itr = std::prev(itr, 1);
+        if (itr->covers(query))
+            return itr - descs.begin();
+    }
+    return NIXL_ERR_NOT_FOUND;
+}
+
 template <class T>
 nixl_status_t nixlDescList<T>::serialize(nixlSerDes* serializer) const {
 
@@ -373,10 +854,10 @@ nixl_status_t nixlDescList<T>::serialize(nixlSerDes* serializer) const {
     // For now very few descriptor types, if needed can add a name method to each
     // descriptor. std::string_view(typeid(T).name()) is compiler dependent
     if (std::is_same<nixlBasicDesc, T>::value)
-        ret = serializer->addStr("nixlDList", "nixlBDList");
+        ret = serializer->addStr("nixlDList", "nixlBVList");
     // We serialize SectionDesc the same as BlobDesc so it will be deserialized as BlobDesc on the other side
     else if (std::is_same<nixlBlobDesc, T>::value || std::is_same<nixlSectionDesc, T>::value)
-        ret = serializer->addStr("nixlDList", "nixlSDList");
+        ret = serializer->addStr("nixlDList", "nixlSVList");
     else
         return NIXL_ERR_INVALID_PARAM;
 
@@ -394,16 +875,24 @@ nixl_status_t nixlDescList<T>::serialize(nixlSerDes* serializer) const {
     if (n_desc==0)
         return NIXL_SUCCESS; // Unusual, but supporting it
 
-    // Optimization for nixlBasicDesc,
-    // contiguous in memory, so no need for per elm serialization
-    if (std::is_same<nixlBasicDesc, T>::value) {
-        ret = serializer->addStr("", std::string(
-                                 reinterpret_cast<const char*>(descs.data()),
-                                 n_desc * sizeof(nixlBasicDesc)));
-        if (ret) return ret;
-    } else { // already checked it can be only nixlBlobDesc or nixlSectionDesc
+    // Basic fields go as one compact blob (see encodeCompactDescs), which
+    // halves the metadata size on uniform lists and lets the other side
+    // decode without a serdes header parse per element
+    std::string buf;
+    encodeCompactDescs(descs, buf);
+    ret = serializer->addStr("", buf);
+    if (ret) return ret;
+
+    // Meta blobs stay per element; for sections these are the public MD
+    // blobs and differ per descriptor, so there is nothing to run-length
+    if constexpr (std::is_same<nixlBlobDesc, T>::value) {
+        for (auto & elm : descs) {
+            ret = serializer->addStr("", elm.metaInfo);
+            if (ret) return ret;
+        }
+    } else if constexpr (std::is_same<nixlSectionDesc, T>::value) {
         for (auto & elm : descs) {
-            ret = serializer->addStr("", elm.serialize());
+            ret = serializer->addStr("", elm.metaBlob);
             if (ret) return ret;
         }
     }
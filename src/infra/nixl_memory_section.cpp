@@ -28,6 +28,46 @@
 // It's pure virtual, but base also class needs a destructor due to its members.
 nixlMemSection::~nixlMemSection () {}
 
+void nixlMemSection::addExact (const section_key_t &sec_key, const nixlSectionDesc &desc) {
+    std::lock_guard<std::mutex> guard(sectionLock);
+    auto ins = exactIndex.try_emplace(exact_key_t(sec_key.first, sec_key.second,
+                                                  desc.addr, desc.len, desc.devId),
+                                      desc.metadataP);
+    // A brand-new registration cannot stale memoized resolutions of other
+    // ranges, so only an overwrite (remote metadata update of the same
+    // range) flushes them; this keeps the resolved prefix of a partially
+    // populated list answerable from the cache after the missing metadata
+    // is loaded and the populate is retried
+    if (!ins.second) {
+        ins.first->second = desc.metadataP;
+        resolveGen++;
+    }
+}
+
+void nixlMemSection::remExact (const section_key_t &sec_key, const nixlSectionDesc &desc) {
+    std::lock_guard<std::mutex> guard(sectionLock);
+    exactIndex.erase(exact_key_t(sec_key.first, sec_key.second,
+                                 desc.addr, desc.len, desc.devId));
+    resolveGen++;
+}
+
+void nixlMemSection::rebuildFlatSections () {
+    for (auto &entries : flatSections)
+        entries.clear();
+    for (auto &[sec_key, dlist] : sectionMap)
+        flatSections[sec_key.first].push_back({sec_key.second, dlist});
+}
+
+nixl_sec_dlist_t* nixlMemSection::findSection (const nixl_mem_t &mem,
+                                               nixlBackendEngine* backend) const {
+    if (mem < DRAM_SEG || mem > FILE_SEG)
+        return nullptr;
+    for (const auto &entry : flatSections[mem])
+        if (entry.backend == backend)
+            return entry.dlist;
+    return nullptr;
+}
+
 backend_set_t* nixlMemSection::queryBackends (const nixl_mem_t &mem) {
     if (mem<DRAM_SEG || mem>FILE_SEG)
         return nullptr;
@@ -38,6 +78,12 @@ backend_set_t* nixlMemSection::queryBackends (const nixl_mem_t &mem) {
 nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
                                         nixlBackendEngine* backend,
                                         nixl_meta_dlist_t &resp) const {
+    return populate(query.view(), backend, resp);
+}
+
+nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_view_t &query,
+                                        nixlBackendEngine* backend,
+                                        nixl_meta_dlist_t &resp) const {
 
     if (query.getType() != resp.getType())
         return NIXL_ERR_INVALID_PARAM;
@@ -45,26 +91,64 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
     if (query.isSorted() != resp.isSorted())
         return NIXL_ERR_INVALID_PARAM;
 
-    section_key_t sec_key = std::make_pair(query.getType(), backend);
-    auto it = sectionMap.find(sec_key);
-    if (it==sectionMap.end())
+    nixl_sec_dlist_t* base = findSection(query.getType(), backend);
+    if (base == nullptr)
         return NIXL_ERR_NOT_FOUND;
 
     nixlBasicDesc *p;
-    nixl_sec_dlist_t* base = it->second;
     resp.resize(query.descCount());
 
+    // Registrations are stable while a populate reader runs, so one gen
+    // read tags every cache access of this call
+    const uint64_t gen = resolveGen;
+
+    // Exact match of a registered block, the common case in practice,
+    // then the sub-ranges memoized from recent resolutions
+    auto exactLookup = [&](const nixlBasicDesc &q, nixlMetaDesc &r) -> bool {
+        auto hit = exactIndex.find(exact_key_t(query.getType(), backend,
+                                               q.addr, q.len, q.devId));
+        if (hit != exactIndex.end()) {
+            static_cast<nixlBasicDesc&>(r) = q;
+            r.metadataP = hit->second;
+            return true;
+        }
+
+        std::lock_guard<std::mutex> guard(resolveLock);
+        auto mem = resolveCache.find(exact_key_t(query.getType(), backend,
+                                                 q.addr, q.len, q.devId));
+        if (mem == resolveCache.end() || mem->second.gen != gen)
+            return false;
+        static_cast<nixlBasicDesc&>(r) = q;
+        r.metadataP = mem->second.md;
+        return true;
+    };
+
+    // Memoize a range-search result for the next overlapping request; a
+    // full cache is flushed wholesale, recurring ranges re-enter quickly
+    auto cacheResolved = [&](const nixlBasicDesc &q, nixlBackendMD *md) {
+        std::lock_guard<std::mutex> guard(resolveLock);
+        if (resolveCache.size() >= resolveCacheCap)
+            resolveCache.clear();
+        resolveCache[exact_key_t(query.getType(), backend,
+                                 q.addr, q.len, q.devId)] = {md, gen};
+    };
+
     if (!base->isSorted()) {
         int count = 0;
-        for (int i=0; i<query.descCount(); ++i)
-            for (const auto & elm : *base)
-                if (elm.covers(query[i])){
-                    p = &resp[i];
-                    *p = query[i];
-                    resp[i].metadataP = elm.metadataP;
-                    count++;
-                    break;
-                }
+        for (int i=0; i<query.descCount(); ++i) {
+            if (exactLookup(query[i], resp[i])) {
+                count++;
+                continue;
+            }
+            int idx = base->findCovering(query[i]);
+            if (idx >= 0) {
+                p = &resp[i];
+                *p = query[i];
+                resp[i].metadataP = (*base)[idx].metadataP;
+                cacheResolved(query[i], resp[i].metadataP);
+                count++;
+            }
+        }
 
         if (query.descCount()==count) {
             return NIXL_SUCCESS;
@@ -74,7 +158,7 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
         }
     } else {
         const nixlBasicDesc *q;
-        bool found, q_sorted = query.isSorted();
+        bool q_sorted = query.isSorted();
 
         if (q_sorted) {
             int s_index, q_index, size;
@@ -85,12 +169,17 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
             q_index = 0;
 
             while (q_index<query.descCount()){
+                if (exactLookup(query[q_index], resp[q_index])) {
+                    q_index++;
+                    continue;
+                }
                 s = &(*base)[s_index];
                 q = &query[q_index];
                 if (s->covers(*q)) {
                     p = &resp[q_index];
                     *p = *q;
                     resp[q_index].metadataP = s->metadataP;
+                    cacheResolved(*q, s->metadataP);
                     q_index++;
                 } else {
                     s_index++;
@@ -108,32 +197,18 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
             return NIXL_SUCCESS;
 
         } else {
-            int last_found = 0;
             for (int i=0; i<query.descCount(); ++i) {
-                found = false;
+                if (exactLookup(query[i], resp[i]))
+                    continue;
                 q = &query[i];
-                auto itr = std::lower_bound(base->begin() + last_found,
-                                            base->end(), *q);
-
-                // Same start address case
-                if (itr != base->end()){
-                    if (itr->covers(*q)) {
-                        found = true;
-                    }
-                }
-
-                // query starts starts later, try previous entry
-                if ((!found) && (itr != base->begin())){
-                    itr = std::prev(itr , 1);
-                    if (itr->covers(*q)) {
-                        found = true;
-                    }
-                }
-
-                if (found) {
+                // Binary search over the hot addr/len/devId mirror on large
+                // lists; the full descriptor is read once, at the hit
+                int idx = base->findCovering(*q);
+                if (idx >= 0) {
                     p = &resp[i];
                     *p = *q;
-                    resp[i].metadataP = itr->metadataP;
+                    resp[i].metadataP = (*base)[idx].metadataP;
+                    cacheResolved(*q, resp[i].metadataP);
                 } else {
                     resp.clear();
                     return NIXL_ERR_UNKNOWN;
@@ -144,12 +219,143 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
     }
 }
 
+nixl_status_t nixlMemSection::populatePartial (const nixl_xfer_dlist_t &query,
+                                               nixlBackendEngine* backend,
+                                               nixl_meta_dlist_t &resp,
+                                               int &cursor) const {
+    return populatePartial(query.view(), backend, resp, cursor);
+}
+
+nixl_status_t nixlMemSection::populatePartial (const nixl_xfer_dlist_view_t &query,
+                                               nixlBackendEngine* backend,
+                                               nixl_meta_dlist_t &resp,
+                                               int &cursor) const {
+
+    if (query.getType() != resp.getType())
+        return NIXL_ERR_INVALID_PARAM;
+    if (query.isSorted() != resp.isSorted())
+        return NIXL_ERR_INVALID_PARAM;
+
+    nixl_sec_dlist_t* base = findSection(query.getType(), backend);
+    if (base == nullptr)
+        return NIXL_ERR_NOT_FOUND;
+
+    if (cursor < 0)
+        cursor = 0;
+    if (resp.descCount() != query.descCount())
+        resp.resize(query.descCount());
+
+    const uint64_t gen = resolveGen;
+
+    // Same lookup order as populate: the exact index, then recent
+    // memoized resolutions, then the range search (hinted with the
+    // previous hit, as resumed lists are typically address-ordered)
+    int hint = 0;
+    for (int i = cursor; i < query.descCount(); ++i) {
+        const nixlBasicDesc &q = query[i];
+        auto exact = exactIndex.find(exact_key_t(query.getType(), backend,
+                                                 q.addr, q.len, q.devId));
+        if (exact != exactIndex.end()) {
+            static_cast<nixlBasicDesc&>(resp[i]) = q;
+            resp[i].metadataP = exact->second;
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(resolveLock);
+            auto mem = resolveCache.find(exact_key_t(query.getType(), backend,
+                                                     q.addr, q.len, q.devId));
+            if (mem != resolveCache.end() && mem->second.gen == gen) {
+                static_cast<nixlBasicDesc&>(resp[i]) = q;
+                resp[i].metadataP = mem->second.md;
+                continue;
+            }
+        }
+
+        int idx = base->findCovering(q, hint);
+        if (idx < 0) {
+            // Resolved prefix stays in resp; the caller fetches metadata
+            // for query[cursor] and resumes from here
+            cursor = i;
+            return NIXL_ERR_NOT_FOUND;
+        }
+        hint = idx;
+        static_cast<nixlBasicDesc&>(resp[i]) = q;
+        resp[i].metadataP = (*base)[idx].metadataP;
+
+        std::lock_guard<std::mutex> guard(resolveLock);
+        if (resolveCache.size() >= resolveCacheCap)
+            resolveCache.clear();
+        resolveCache[exact_key_t(query.getType(), backend,
+                                 q.addr, q.len, q.devId)] = {resp[i].metadataP,
+                                                             gen};
+    }
+
+    cursor = query.descCount();
+    return NIXL_SUCCESS;
+}
+
+void nixlMemSection::statsPerMemType (std::array<size_t, FILE_SEG+1> &counts,
+                                      std::array<size_t, FILE_SEG+1> &bytes) const {
+    counts.fill(0);
+    bytes.fill(0);
+    for (const auto &[sec_key, dlist] : sectionMap) {
+        const nixl_mem_t mem = sec_key.first;
+        counts[mem] += dlist->descCount();
+        for (int i = 0; i < dlist->descCount(); ++i)
+            bytes[mem] += (*dlist)[i].len;
+    }
+}
+
+nixl_status_t nixlMemSection::queryCoverage (const nixl_xfer_dlist_t &query,
+                                             nixlBackendEngine* backend,
+                                             std::vector<bool> &covered) const {
+    nixl_mem_t nixl_mem = query.getType();
+    if (nixl_mem < DRAM_SEG || nixl_mem > FILE_SEG)
+        return NIXL_ERR_INVALID_PARAM;
+
+    covered.assign(query.descCount(), false);
+
+    backend_set_t single;
+    const backend_set_t *backends;
+    if (backend) {
+        single.insert(backend);
+        backends = &single;
+    } else {
+        backends = &memToBackend[nixl_mem];
+    }
+
+    for (const auto &bknd : *backends) {
+        const nixl_sec_dlist_t *base = findSection(nixl_mem, bknd);
+        if (base == nullptr)
+            continue;
+
+        for (int i = 0; i < query.descCount(); ++i) {
+            if (covered[i])
+                continue;
+
+            // Exact match of a registered block, the common case in practice
+            if (exactIndex.count(exact_key_t(nixl_mem, bknd, query[i].addr,
+                                             query[i].len, query[i].devId)) != 0) {
+                covered[i] = true;
+                continue;
+            }
+
+            if (base->findCovering(query[i]) >= 0)
+                covered[i] = true;
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
 /*** Class nixlLocalSection implementation ***/
 
 // Calls into backend engine to register the memories in the desc list
 nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
                                              nixlBackendEngine* backend,
-                                             nixl_sec_dlist_t &remote_self) {
+                                             nixl_sec_dlist_t &remote_self,
+                                             const nixl_reg_hints_t &hints,
+                                             bool imported) {
 
     if (!backend)
         return NIXL_ERR_INVALID_PARAM;
@@ -157,31 +363,82 @@ nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
     nixl_mem_t     nixl_mem     = mem_elms.getType();
     section_key_t  sec_key      = std::make_pair(nixl_mem, backend);
 
-    auto it = sectionMap.find(sec_key);
-    if (it==sectionMap.end()) { // New desc list
-        sectionMap[sec_key] = new nixl_sec_dlist_t(nixl_mem, true);
-        memToBackend[nixl_mem].insert(backend);
+    nixl_sec_dlist_t *target;
+    {
+        std::lock_guard<std::mutex> guard(sectionLock);
+        auto it = sectionMap.find(sec_key);
+        if (it==sectionMap.end()) { // New desc list
+            sectionMap[sec_key] = new nixl_sec_dlist_t(nixl_mem, true);
+            memToBackend[nixl_mem].insert(backend);
+            rebuildFlatSections();
+        }
+        target = sectionMap[sec_key];
     }
-    nixl_sec_dlist_t *target = sectionMap[sec_key];
 
     // Add entries to the target list
     nixlSectionDesc local_sec, self_sec;
     nixlBasicDesc *lp = &local_sec;
     nixlBasicDesc *rp = &self_sec;
+    std::vector<nixl_blob_t> added_blobs;
     nixl_status_t ret;
 
+    // Sub-ranges of an already registered block reuse the enclosing
+    // registration's MD instead of re-pinning the same physical pages;
+    // only plain memory segments, where covers() implies identical pages,
+    // are deduplicated this way
+    const bool dedup = (nixl_mem == DRAM_SEG) || (nixl_mem == VRAM_SEG);
+    auto findEnclosing = [&](const nixlBasicDesc &query) -> nixlBackendMD* {
+        auto itr = std::lower_bound(target->begin(), target->end(), query);
+        if (itr != target->end() && itr->covers(query))
+            return itr->metadataP;
+        if (itr != target->begin() && std::prev(itr, 1)->covers(query))
+            return std::prev(itr, 1)->metadataP;
+        return nullptr;
+    };
+
     int i;
     for (i = 0; i < mem_elms.descCount(); ++i) {
-        // TODO: For now trusting the user, but there can be a more checks mode
-        //       where we find overlaps and split the memories or warn the user
-        ret = backend->registerMem(mem_elms[i], nixl_mem, local_sec.metadataP);
-        if (ret != NIXL_SUCCESS)
-            break;
+        // A reserve-commit registration (see nixl_reg_hints_t::reserveLen)
+        // pins its own reserved range and can't share an enclosing MD,
+        // which would cap a later commit at the enclosing block
+        const bool reserve = (hints.reserveLen > mem_elms[i].len);
+        nixlBackendMD *shared_md =
+            (dedup && !reserve) ? findEnclosing(mem_elms[i]) : nullptr;
+        if (shared_md) {
+            local_sec.metadataP = shared_md;
+        } else {
+            // TODO: For now trusting the user on partial overlaps; ranges are
+            //       only reused when fully contained in a registered block
+            if (imported) {
+                ret = backend->importMem(mem_elms[i], nixl_mem,
+                                         mem_elms[i].metaInfo,
+                                         local_sec.metadataP);
+            } else if (reserve) {
+                // Register the whole reserved VA up front; the section
+                // advertises only the committed length (see commitMem)
+                nixlBlobDesc reserve_elm = mem_elms[i];
+                reserve_elm.len = hints.reserveLen;
+                ret = backend->registerMem(reserve_elm, nixl_mem, hints,
+                                           local_sec.metadataP);
+            } else {
+                ret = backend->registerMem(mem_elms[i], nixl_mem, hints,
+                                           local_sec.metadataP);
+            }
+            if (ret != NIXL_SUCCESS)
+                break;
+        }
+        local_sec.reservedLen = reserve ? hints.reserveLen : 0;
+
+        {
+            std::lock_guard<std::mutex> guard(sectionLock);
+            mdRefs[local_sec.metadataP]++;
+        }
 
         if (backend->supportsLocal()) {
             ret = backend->loadLocalMD(local_sec.metadataP, self_sec.metadataP);
             if (ret != NIXL_SUCCESS) {
-                backend->deregisterMem(local_sec.metadataP);
+                if (releaseMDRef(local_sec.metadataP))
+                    backend->deregisterMem(local_sec.metadataP);
                 break;
             }
         }
@@ -192,7 +449,8 @@ nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
                 // side of a transfer, so no need for unloadMD in that case.
                 if (backend->supportsLocal() && self_sec.metadataP != local_sec.metadataP)
                     backend->unloadMD(self_sec.metadataP);
-                backend->deregisterMem(local_sec.metadataP);
+                if (releaseMDRef(local_sec.metadataP))
+                    backend->deregisterMem(local_sec.metadataP);
                 break;
             }
         }
@@ -203,6 +461,9 @@ nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
             lp->len = SIZE_MAX; // File has no range limit
 
         target->addDesc(local_sec);
+        addExact(sec_key, local_sec);
+        if (backend->supportsRemote())
+            added_blobs.push_back(local_sec.serialize());
 
         if (backend->supportsLocal()) {
             *rp = *lp;
@@ -221,24 +482,101 @@ nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
                 if (self_index >= 0 && remote_self[self_index].metadataP != (*target)[index].metadataP)
                     backend->unloadMD(remote_self[self_index].metadataP);
             }
-            backend->deregisterMem((*target)[index].metadataP);
+            if (releaseMDRef((*target)[index].metadataP))
+                backend->deregisterMem((*target)[index].metadataP);
+            remExact(sec_key, (*target)[index]);
             target->remDesc(index);
         }
         remote_self.clear();
     }
+
+    if (ret == NIXL_SUCCESS && !added_blobs.empty()) {
+        std::lock_guard<std::mutex> guard(sectionLock);
+        generation++;
+        for (auto &blob : added_blobs)
+            journalRecord(true, backend->getType(), nixl_mem, std::move(blob));
+    }
     return ret;
 }
 
+nixl_status_t nixlLocalSection::growDescList (const nixl_reg_dlist_t &mem_elms,
+                                              nixlBackendEngine *backend) {
+    if (!backend)
+        return NIXL_ERR_INVALID_PARAM;
+    nixl_mem_t    nixl_mem = mem_elms.getType();
+    section_key_t sec_key  = std::make_pair(nixl_mem, backend);
+    nixl_sec_dlist_t *target;
+    {
+        std::lock_guard<std::mutex> guard(sectionLock);
+        auto it = sectionMap.find(sec_key);
+        if (it==sectionMap.end())
+            return NIXL_ERR_NOT_FOUND;
+        target = it->second;
+    }
+
+    // Validate the whole batch before mutating anything: every desc must
+    // name a reserved registration by addr/devId, grow its length and
+    // stay within the reserve
+    std::vector<int> indices(mem_elms.descCount(), -1);
+    for (int i = 0; i < mem_elms.descCount(); ++i) {
+        for (int j = 0; j < target->descCount(); ++j) {
+            if (((*target)[j].addr  == mem_elms[i].addr) &&
+                ((*target)[j].devId == mem_elms[i].devId)) {
+                indices[i] = j;
+                break;
+            }
+        }
+        if (indices[i] < 0)
+            return NIXL_ERR_NOT_FOUND;
+        const nixlSectionDesc &cur = (*target)[indices[i]];
+        if (mem_elms[i].len <= cur.len)
+            return NIXL_ERR_INVALID_PARAM;
+        if (mem_elms[i].len > cur.reservedLen)
+            return NIXL_ERR_NOT_ALLOWED;
+    }
+
+    // Peers learn the new length through the journal as a remove of the
+    // old advertisement plus an add of the grown one, replayed in order
+    // by applyDiff
+    std::vector<nixl_blob_t> removed_blobs, added_blobs;
+    for (int i = 0; i < mem_elms.descCount(); ++i) {
+        nixlSectionDesc &desc = (*target)[indices[i]];
+        if (backend->supportsRemote())
+            removed_blobs.push_back(desc.nixlBasicDesc::serialize());
+        remExact(sec_key, desc);
+        desc.len = mem_elms[i].len;
+        addExact(sec_key, desc);
+        if (backend->supportsRemote())
+            added_blobs.push_back(desc.serialize());
+    }
+
+    if (!removed_blobs.empty()) {
+        std::lock_guard<std::mutex> guard(sectionLock);
+        generation++;
+        for (auto &blob : removed_blobs)
+            journalRecord(false, backend->getType(), nixl_mem, std::move(blob));
+        for (auto &blob : added_blobs)
+            journalRecord(true, backend->getType(), nixl_mem, std::move(blob));
+    }
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
-                                             nixlBackendEngine *backend) {
+                                             nixlBackendEngine *backend,
+                                             std::vector<std::pair<nixlBackendEngine*,
+                                                                   nixlBackendMD*>> *detached) {
     if (!backend)
         return NIXL_ERR_INVALID_PARAM;
     nixl_mem_t     nixl_mem     = mem_elms.getType();
     section_key_t sec_key = std::make_pair(nixl_mem, backend);
-    auto it = sectionMap.find(sec_key);
-    if (it==sectionMap.end())
-        return NIXL_ERR_NOT_FOUND;
-    nixl_sec_dlist_t *target = it->second;
+    nixl_sec_dlist_t *target;
+    {
+        std::lock_guard<std::mutex> guard(sectionLock);
+        auto it = sectionMap.find(sec_key);
+        if (it==sectionMap.end())
+            return NIXL_ERR_NOT_FOUND;
+        target = it->second;
+    }
 
     // First check if the mem_elms are present in the list,
     // don't deregister anything in case any is missing.
@@ -248,17 +586,37 @@ nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
             return NIXL_ERR_NOT_FOUND;
     }
 
+    std::vector<nixl_blob_t> removed_blobs;
     for (auto & elm : mem_elms) {
         int index = target->getIndex(elm);
         // Already checked, elm should always be found. Can add a check in debug mode.
-        backend->deregisterMem((*target)[index].metadataP);
+        // Contained registrations share their enclosing block's MD; only
+        // the last user actually deregisters it
+        if (releaseMDRef((*target)[index].metadataP)) {
+            if (detached)
+                detached->emplace_back(backend, (*target)[index].metadataP);
+            else
+                backend->deregisterMem((*target)[index].metadataP);
+        }
+        if (backend->supportsRemote())
+            removed_blobs.push_back((*target)[index].nixlBasicDesc::serialize());
+        remExact(sec_key, (*target)[index]);
         target->remDesc(index);
     }
 
+    if (!removed_blobs.empty()) {
+        std::lock_guard<std::mutex> guard(sectionLock);
+        generation++;
+        for (auto &blob : removed_blobs)
+            journalRecord(false, backend->getType(), nixl_mem, std::move(blob));
+    }
+
     if (target->descCount()==0) {
+        std::lock_guard<std::mutex> guard(sectionLock);
         delete target;
         sectionMap.erase(sec_key);
         memToBackend[nixl_mem].erase(backend);
+        rebuildFlatSections();
     }
 
     return NIXL_SUCCESS;
@@ -341,11 +699,123 @@ nixl_status_t nixlLocalSection::serializePartial(nixlSerDes* serializer,
     return ret;
 }
 
+nixl_status_t nixlLocalSection::serializePartial(nixlSerDes* serializer,
+                                                 const backend_set_t &backends,
+                                                 const std::vector<const nixl_reg_dlist_t*>
+                                                     &mem_elms) const {
+    nixl_status_t ret = NIXL_SUCCESS;
+    section_map_t mem_elms_to_serialize;
+
+    // Same selection as the single-list variant, accumulated across the
+    // lists so every memory type of the group lands in one section group
+    for (const auto *elms : mem_elms) {
+        nixl_mem_t nixl_mem = elms->getType();
+        if (elms->descCount() == 0)
+            continue;
+
+        for (const auto &backend : backends) {
+            section_key_t sec_key = std::make_pair(nixl_mem, backend);
+            auto it = sectionMap.find(sec_key);
+            if (it == sectionMap.end())
+                continue;
+
+            const nixl_sec_dlist_t *base = it->second;
+            nixl_sec_dlist_t *resp = new nixl_sec_dlist_t(nixl_mem, elms->isSorted());
+            for (const auto &desc : *elms) {
+                int index = base->getIndex(desc);
+                if (index < 0) {
+                    ret = NIXL_ERR_NOT_FOUND;
+                    break;
+                }
+                resp->addDesc((*base)[index]);
+            }
+            if (ret != NIXL_SUCCESS) {
+                delete resp;
+                break;
+            }
+            mem_elms_to_serialize.emplace(sec_key, resp);
+        }
+        if (ret != NIXL_SUCCESS)
+            break;
+    }
+
+    if (ret == NIXL_SUCCESS)
+        ret = serializeSections(serializer, mem_elms_to_serialize);
+
+    for (auto &[sec_key, m_desc] : mem_elms_to_serialize)
+        delete m_desc;
+    return ret;
+}
+
+// Caller holds sectionLock and has bumped the generation for this batch
+void nixlLocalSection::journalRecord (bool added, const nixl_backend_t &backend,
+                                      nixl_mem_t mem, nixl_blob_t &&desc_blob) {
+    if (journal.size() >= journalCapacity) {
+        // Drop roughly the older half, but only whole generations, so a
+        // diff base never lands in the middle of a batch
+        const uint64_t cut_gen = journal[journal.size() / 2].gen;
+        auto it = journal.begin();
+        while (it != journal.end() && it->gen <= cut_gen)
+            ++it;
+        journal.erase(journal.begin(), it);
+        journalBaseGen = cut_gen;
+    }
+    journal.push_back({generation, added, backend, mem, std::move(desc_blob)});
+}
+
+nixl_status_t nixlLocalSection::serializeDiff (nixlSerDes* serializer,
+                                               uint64_t since_gen) const {
+    if (since_gen < journalBaseGen || since_gen > generation)
+        return NIXL_ERR_NOT_FOUND;
+
+    size_t count = 0;
+    for (const auto &chg : journal)
+        if (chg.gen > since_gen)
+            count++;
+
+    nixl_status_t ret = serializer->addBuf("BaseGen", &since_gen, sizeof(since_gen));
+    if (ret) return ret;
+    ret = serializer->addBuf("NewGen", &generation, sizeof(generation));
+    if (ret) return ret;
+    ret = serializer->addBuf("DiffElms", &count, sizeof(count));
+    if (ret) return ret;
+
+    for (const auto &chg : journal) {
+        if (chg.gen <= since_gen)
+            continue;
+        uint8_t op = chg.added ? 1 : 0;
+        ret = serializer->addBuf("op", &op, sizeof(op));
+        if (ret) return ret;
+        ret = serializer->addStr("bknd", chg.backend);
+        if (ret) return ret;
+        ret = serializer->addBuf("mem", &chg.mem, sizeof(chg.mem));
+        if (ret) return ret;
+        ret = serializer->addStr("desc", chg.descBlob);
+        if (ret) return ret;
+    }
+    return NIXL_SUCCESS;
+}
+
+bool nixlLocalSection::releaseMDRef (nixlBackendMD *md) {
+    std::lock_guard<std::mutex> guard(sectionLock);
+    auto ref = mdRefs.find(md);
+    if (ref == mdRefs.end())
+        return true;
+    if (--ref->second > 0)
+        return false;
+    mdRefs.erase(ref);
+    return true;
+}
+
 nixlLocalSection::~nixlLocalSection() {
     for (auto &[sec_key, dlist] : sectionMap) {
         nixlBackendEngine* eng = sec_key.second;
+        // Entries may share an enclosing block's MD; deregister each
+        // distinct MD once
+        std::set<nixlBackendMD*> seen;
         for (auto & elm : *dlist)
-            eng->deregisterMem(elm.metadataP);
+            if (seen.insert(elm.metadataP).second)
+                eng->deregisterMem(elm.metadataP);
         delete dlist;
     }
     // nixlMemSection destructor will clean up the rest
@@ -368,28 +838,24 @@ nixl_status_t nixlRemoteSection::addDescList (
     // Without it, its corrupt data, we keep the last option without raising an error
     nixl_mem_t nixl_mem   = mem_elms.getType();
     section_key_t sec_key = std::make_pair(nixl_mem, backend);
-    if (sectionMap.count(sec_key) == 0)
+    if (sectionMap.count(sec_key) == 0) {
         sectionMap[sec_key] = new nixl_sec_dlist_t(nixl_mem, true);
+        rebuildFlatSections();
+    }
     memToBackend[nixl_mem].insert(backend); // Fine to overwrite, it's a set
     nixl_sec_dlist_t *target = sectionMap[sec_key];
 
 
-    // Add entries to the target list.
-    nixlSectionDesc out;
-    nixlBasicDesc *p = &out;
-    nixl_status_t ret;
+    // Find the entries missing from the target list, and load them in one
+    // batch so backends can amortize their per-descriptor costs
+    nixl_reg_dlist_t to_load(nixl_mem, false);
+    std::vector<int> to_load_idx;
     for (int i=0; i<mem_elms.descCount(); ++i) {
         // TODO: Can add overlap checks (erroneous)
         int idx = target->getIndex(mem_elms[i]);
         if (idx < 0) {
-            ret = backend->loadRemoteMD(mem_elms[i], nixl_mem, agentName, out.metadataP);
-            // In case of errors, no need to remove the previous entries
-            // Agent will delete the full object.
-            if (ret<0)
-                return ret;
-            *p = mem_elms[i]; // Copy the basic desc part
-            out.metaBlob = mem_elms[i].metaInfo;
-            target->addDesc(out);
+            to_load.addDesc(mem_elms[i]);
+            to_load_idx.push_back(i);
         } else {
             const nixl_blob_t &prev_meta_info = (*target)[idx].metaBlob;
             // TODO: Support metadata updates
@@ -397,6 +863,27 @@ nixl_status_t nixlRemoteSection::addDescList (
                 return NIXL_ERR_NOT_ALLOWED;
         }
     }
+
+    if (to_load.descCount() == 0)
+        return NIXL_SUCCESS;
+
+    // In case of errors, no need to remove the previous entries
+    // Agent will delete the full object.
+    std::vector<nixlBackendMD*> loaded;
+    nixl_status_t ret = backend->loadRemoteMDBatch(to_load, nixl_mem, agentName, loaded);
+    if (ret<0)
+        return ret;
+
+    nixlSectionDesc out;
+    nixlBasicDesc *p = &out;
+    for (size_t j=0; j<to_load_idx.size(); ++j) {
+        const nixlBlobDesc &elm = mem_elms[to_load_idx[j]];
+        out.metadataP = loaded[j];
+        *p = elm; // Copy the basic desc part
+        out.metaBlob = elm.metaInfo;
+        target->addDesc(out);
+        addExact(sec_key, out);
+    }
     return NIXL_SUCCESS;
 }
 
@@ -409,6 +896,19 @@ nixl_status_t nixlRemoteSection::loadRemoteData (nixlSerDes* deserializer,
     ret = deserializer->getBuf("nixlSecElms", &seg_count, sizeof(seg_count));
     if (ret) return ret;
 
+    // Phase 1: bulk-parse every section into scratch before any backend
+    // work. The loads behind addDescList unpack rkeys and touch driver
+    // state, and interleaving them with serdes parsing serializes the two;
+    // with the descriptors parsed up front the load loop runs back to back
+    // and can warm the next section's key blobs while the backend digests
+    // the current one.
+    struct parsedSection {
+        nixlBackendEngine *backend;
+        nixl_reg_dlist_t   descs;
+    };
+    std::vector<parsedSection> sections;
+    sections.reserve(seg_count);
+
     for (size_t i=0; i<seg_count; ++i) {
         // In case of errors, no need to remove the previous entries
         // Agent will delete the full object.
@@ -418,9 +918,80 @@ nixl_status_t nixlRemoteSection::loadRemoteData (nixlSerDes* deserializer,
         nixl_reg_dlist_t s_desc(deserializer);
         if (s_desc.descCount()==0) // can be used for entry removal in future
             return NIXL_ERR_NOT_FOUND;
-        if (backendToEngineMap.count(nixl_backend) != 0) {
-            ret = addDescList(s_desc, backendToEngineMap[nixl_backend]);
+        // Same policy as before: sections for backends this agent doesn't
+        // have are skipped, not an error
+        if (backendToEngineMap.count(nixl_backend) != 0)
+            sections.push_back({backendToEngineMap[nixl_backend],
+                                std::move(s_desc)});
+    }
+
+    // Phase 2: back-to-back backend loads, prefetching the following
+    // section's metadata blobs ahead of its turn
+    for (size_t i=0; i<sections.size(); ++i) {
+        if (i + 1 < sections.size()) {
+            const nixl_reg_dlist_t &next = sections[i+1].descs;
+            for (int j=0; j<next.descCount(); ++j) {
+                const nixl_blob_t &blob = next[j].metaInfo;
+                for (size_t off=0; off<blob.size(); off += 64)
+                    __builtin_prefetch(blob.data() + off, 0, 1);
+            }
+        }
+        ret = addDescList(sections[i].descs, sections[i].backend);
+        if (ret) return ret;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlRemoteSection::applyDiff (nixlSerDes* deserializer,
+                                            backend_map_t &backendToEngineMap) {
+    size_t count;
+    nixl_status_t ret = deserializer->getBuf("DiffElms", &count, sizeof(count));
+    if (ret) return ret;
+
+    for (size_t i=0; i<count; ++i) {
+        uint8_t op;
+        ret = deserializer->getBuf("op", &op, sizeof(op));
+        if (ret) return ret;
+        nixl_backend_t nixl_backend = deserializer->getStr("bknd");
+        if (nixl_backend.size()==0)
+            return NIXL_ERR_INVALID_PARAM;
+        nixl_mem_t nixl_mem;
+        ret = deserializer->getBuf("mem", &nixl_mem, sizeof(nixl_mem));
+        if (ret) return ret;
+        nixl_blob_t desc_blob = deserializer->getStr("desc");
+        if (desc_blob.size()==0)
+            return NIXL_ERR_MISMATCH;
+
+        // Same policy as loadRemoteData: entries for backends this agent
+        // doesn't have are skipped, not an error
+        if (backendToEngineMap.count(nixl_backend) == 0)
+            continue;
+        nixlBackendEngine *eng = backendToEngineMap[nixl_backend];
+        nixlBlobDesc desc(desc_blob);
+
+        if (op) {
+            nixl_reg_dlist_t added(nixl_mem, true);
+            added.addDesc(desc);
+            ret = addDescList(added, eng);
             if (ret) return ret;
+        } else {
+            section_key_t sec_key = std::make_pair(nixl_mem, eng);
+            auto it = sectionMap.find(sec_key);
+            if (it == sectionMap.end())
+                continue; // Was never loaded on this side
+            nixl_sec_dlist_t *target = it->second;
+            int index = target->getIndex(desc);
+            if (index < 0)
+                continue;
+            eng->unloadMD((*target)[index].metadataP);
+            remExact(sec_key, (*target)[index]);
+            target->remDesc(index);
+            if (target->descCount()==0) {
+                delete target;
+                sectionMap.erase(sec_key);
+                memToBackend[nixl_mem].erase(eng);
+                rebuildFlatSections();
+            }
         }
     }
     return NIXL_SUCCESS;
@@ -436,14 +1007,49 @@ nixl_status_t nixlRemoteSection::loadLocalData (
     nixl_mem_t     nixl_mem     = mem_elms.getType();
     section_key_t sec_key = std::make_pair(nixl_mem, backend);
 
-    if (sectionMap.count(sec_key) == 0)
+    if (sectionMap.count(sec_key) == 0) {
         sectionMap[sec_key] = new nixl_sec_dlist_t(nixl_mem, true);
+        rebuildFlatSections();
+    }
     memToBackend[nixl_mem].insert(backend); // Fine to overwrite, it's a set
     nixl_sec_dlist_t *target = sectionMap[sec_key];
 
-    for (auto & elm: mem_elms)
+    for (auto & elm: mem_elms) {
         target->addDesc(elm);
+        addExact(sec_key, elm);
+    }
+
+    return NIXL_SUCCESS;
+}
 
+nixl_status_t nixlRemoteSection::growLocalData (
+                                 const nixl_reg_dlist_t &mem_elms,
+                                 nixlBackendEngine* backend) {
+
+    nixl_mem_t    nixl_mem = mem_elms.getType();
+    section_key_t sec_key  = std::make_pair(nixl_mem, backend);
+    auto it = sectionMap.find(sec_key);
+    if (it==sectionMap.end())
+        return NIXL_ERR_NOT_FOUND;
+    nixl_sec_dlist_t *target = it->second;
+
+    // Bounds were already validated against the local section's reserve
+    for (int i = 0; i < mem_elms.descCount(); ++i) {
+        int index = -1;
+        for (int j = 0; j < target->descCount(); ++j) {
+            if (((*target)[j].addr  == mem_elms[i].addr) &&
+                ((*target)[j].devId == mem_elms[i].devId)) {
+                index = j;
+                break;
+            }
+        }
+        if (index < 0)
+            return NIXL_ERR_NOT_FOUND;
+        nixlSectionDesc &desc = (*target)[index];
+        remExact(sec_key, desc);
+        desc.len = mem_elms[i].len;
+        addExact(sec_key, desc);
+    }
     return NIXL_SUCCESS;
 }
 
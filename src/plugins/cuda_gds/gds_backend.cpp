@@ -15,11 +15,16 @@
  * limitations under the License.
  */
 #include <cassert>
+#include <cerrno>
+#include <cstring>
 #include <cufile.h>
 #include "gds_backend.h"
 #include "gds_utils.h"
 #include "common/nixl_log.h"
 #include "file/file_utils.h"
+#include <map>
+#include <mutex>
+#include <sys/stat.h>
 #include <unordered_map>
 #include <memory>
 #include <cuda_runtime.h>
@@ -31,6 +36,91 @@
 /** Create a batch pool of size 16 */
 #define DEFAULT_BATCH_POOL_SIZE 16
 
+// Process-wide cuFile handle cache keyed by inode, shared by every agent's
+// GDS engine in the process: N replicas registering the same checkpoint
+// file do one cuFileHandleRegister, not N. The cache dups the first
+// registrant's descriptor so the handle stays valid after that caller
+// closes its own fd, and refcounts registrations so the handle (and the
+// pooled fd) is released when the last one deregisters.
+class gdsFileHandleCache {
+    public:
+        static gdsFileHandleCache& getInstance() {
+            static gdsFileHandleCache cache;
+            return cache;
+        }
+
+        nixl_status_t acquire(gdsUtil* utils, int fd, size_t size,
+                              const std::string& meta, gdsFileHandle& out) {
+            struct stat st;
+            if (fstat(fd, &st) != 0) {
+                NIXL_ERROR << "fstat failed for fd " << fd << ": "
+                           << strerror(errno);
+                return NIXL_ERR_INVALID_PARAM;
+            }
+            const file_key_t key = {st.st_dev, st.st_ino};
+
+            std::lock_guard<std::mutex> lock(cache_lock);
+            auto it = entries.find(key);
+            if (it != entries.end()) {
+                it->second.refs++;
+                out = it->second.handle;
+                // Callers keep seeing their own descriptor and sizes; only
+                // the cuFile handle is shared
+                out.fd = fd;
+                out.size = size;
+                out.metadata = meta;
+                return NIXL_SUCCESS;
+            }
+
+            int pooled_fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+            if (pooled_fd < 0) {
+                NIXL_ERROR << "fd dup failed for fd " << fd << ": "
+                           << strerror(errno);
+                return NIXL_ERR_BACKEND;
+            }
+
+            gdsFileHandle fh;
+            nixl_status_t status = utils->registerFileHandle(pooled_fd, size,
+                                                             meta, fh);
+            if (status != NIXL_SUCCESS) {
+                close(pooled_fd);
+                return status;
+            }
+            entries[key] = {fh, 1};
+            handle_keys[fh.cu_fhandle] = key;
+            out = fh;
+            out.fd = fd;
+            return NIXL_SUCCESS;
+        }
+
+        void release(gdsUtil* utils, const gdsFileHandle& handle) {
+            std::lock_guard<std::mutex> lock(cache_lock);
+            auto key_it = handle_keys.find(handle.cu_fhandle);
+            if (key_it == handle_keys.end())
+                return;  // Not cache-managed, nothing to do
+            auto it = entries.find(key_it->second);
+            if ((it == entries.end()) || (--it->second.refs > 0))
+                return;
+            utils->deregisterFileHandle(it->second.handle);
+            close(it->second.handle.fd);
+            handle_keys.erase(key_it);
+            entries.erase(it);
+        }
+
+    private:
+        using file_key_t = std::pair<dev_t, ino_t>;
+        struct cacheEntry {
+            gdsFileHandle handle;  // Its fd is the cache-owned dup
+            int refs;
+        };
+
+        gdsFileHandleCache() = default;
+
+        std::mutex cache_lock;
+        std::map<file_key_t, cacheEntry> entries;
+        std::unordered_map<CUfileHandle_t, file_key_t> handle_keys;
+};
+
 nixlGdsEngine::nixlGdsEngine(const nixlBackendInitParams* init_params)
     : nixlBackendEngine(init_params)
 {
@@ -78,17 +168,91 @@ nixlGdsEngine::nixlGdsEngine(const nixlBackendInitParams* init_params)
         }
     }
 
+    // Every GPU pool starts from the default batch limit, overridable
+    // per GPU with "batch_limit_<devId>" parameters
+    for (auto& pool : batch_pools) {
+        pool.batch_limit = batch_limit;
+    }
+    if (custom_params) {
+        const std::string prefix = "batch_limit_";
+        for (const auto& [key, value] : *custom_params) {
+            if (key.compare(0, prefix.size(), prefix) != 0)
+                continue;
+            try {
+                int dev_id = std::stoi(key.substr(prefix.size()));
+                batch_pools[poolIndexOf(dev_id)].batch_limit = std::stoi(value);
+            } catch (const std::exception& e) {
+                NIXL_ERROR << "Invalid " << key << " parameter: " << e.what();
+                this->initErr = true;
+                return;
+            }
+        }
+    }
+
     this->initErr = false;
     if (gds_utils->openGdsDriver() == NIXL_ERR_BACKEND) {
         this->initErr = true;
         return;
     }
 
-    // Initialize the batch pool
-    for (unsigned int i = 0; i < batch_pool_size; i++) {
-        batch_pool.push_back(new nixlGdsIOBatch(batch_limit));
+    // Batch pools are primed per GPU when its memory gets registered,
+    // so only pools for devices actually in use pre-create handles
+}
+
+nixl_status_t nixlGdsEngine::getTunableParams(std::vector<nixl_tunable_param_t> &params) const
+{
+    params.push_back({"batch_limit", 1, DEFAULT_BATCH_LIMIT, batch_limit});
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlGdsEngine::retune(const std::string &param, uint64_t value)
+{
+    if (param != "batch_limit")
+        return NIXL_ERR_INVALID_PARAM;
+
+    batch_limit = value;
+    // A primed pool's batch handles were created with its old limit and
+    // keep it; the new limit applies to pools primed from here on and to
+    // batches created outside the pools
+    for (auto& pool : batch_pools) {
+        if (!pool.primed.load(std::memory_order_acquire))
+            pool.batch_limit = value;
     }
+    return NIXL_SUCCESS;
+}
+
+// Pre-creates the cuFile batch handles of one GPU's pool, once, at
+// registration time; the freelist is published slot by slot afterwards
+void nixlGdsEngine::primePool(int dev_id)
+{
+    gdsBatchPool& pool = batch_pools[poolIndexOf(dev_id)];
+    if (pool.primed.exchange(true))
+        return;
+
+    // Approximate footprint of one pre-created batch, reported against the
+    // agent memory budget; the pool stops growing where the budget ends
+    // instead of overshooting the node's SLO (the data path then rides a
+    // smaller freelist, trading concurrency for footprint)
+    const size_t batch_bytes = sizeof(nixlGdsIOBatch) +
+        pool.batch_limit * (sizeof(CUfileIOParams_t) + sizeof(CUfileIOEvents_t));
 
+    pool.batches.reserve(batch_pool_size);
+    for (unsigned int i = 0; i < batch_pool_size; i++) {
+        if (!reserveBudget(batch_bytes)) {
+            NIXL_WARN << "GDS batch pool for dev " << dev_id << " capped at "
+                      << i << "/" << batch_pool_size
+                      << " batches by the agent memory budget";
+            break;
+        }
+        auto batch = std::make_unique<nixlGdsIOBatch>(pool.batch_limit);
+        batch->pool_index = i;
+        batch->pool_dev = dev_id;
+        pool.batches.push_back(std::move(batch));
+        pool.accounted_bytes += batch_bytes;
+    }
+    for (auto& batch : pool.batches) {
+        returnBatchToPool(batch.get());
+    }
 }
 
 nixl_status_t nixlGdsEngine::registerMem(const nixlBlobDesc &mem,
@@ -102,17 +266,11 @@ nixl_status_t nixlGdsEngine::registerMem(const nixlBlobDesc &mem,
 
     switch (nixl_mem) {
         case FILE_SEG: {
-            // Check if we already have a file handle for this devId
-            auto it = gds_file_map.find(mem.devId);
-            if (it != gds_file_map.end()) {
-                md->handle = it->second;
-                md->handle.size = mem.len;
-                md->handle.metadata = mem.metaInfo;
-                break;
-            }
-
-            status = gds_utils->registerFileHandle(mem.devId, mem.len,
-                                                   mem.metaInfo, md->handle);
+            // Inode-keyed process-wide cache: repeat registrations of the
+            // same file — from this agent or any other in the process —
+            // share one refcounted cuFile handle
+            status = gdsFileHandleCache::getInstance().acquire(
+                gds_utils, mem.devId, mem.len, mem.metaInfo, md->handle);
             if (status == NIXL_SUCCESS) {
                 gds_file_map[mem.devId] = md->handle;
             }
@@ -154,6 +312,11 @@ nixl_status_t nixlGdsEngine::registerMem(const nixlBlobDesc &mem,
         return status;
     }
 
+    // Registration hints which GPU pools will see traffic; pre-create
+    // their batch handles outside the data path
+    if ((nixl_mem == VRAM_SEG) || (nixl_mem == DRAM_SEG))
+        primePool(mem.devId);
+
     out = (nixlBackendMD*)md;
     return status;
 }
@@ -162,9 +325,10 @@ nixl_status_t nixlGdsEngine::deregisterMem (nixlBackendMD* meta)
 {
     nixlGdsMetadata *md = (nixlGdsMetadata *)meta;
     if (md->type == FILE_SEG) {
-        gds_utils->deregisterFileHandle(md->handle);
+        // Drops one cache reference; the cuFile handle and the pooled fd go
+        // away with the last registration. The caller's own fd stays theirs
+        gdsFileHandleCache::getInstance().release(gds_utils, md->handle);
         gds_file_map.erase(md->handle.fd);
-        // No need to close fd since we're not opening files
     } else {
         gds_utils->deregisterBufHandle(md->buf.base);
     }
@@ -208,6 +372,7 @@ nixl_status_t nixlGdsEngine::prepXfer (const nixl_xfer_op_t &operation,
         void* base_addr;
         size_t total_size;
         size_t base_offset;
+        int mem_dev_id;
         gdsFileHandle fh;
 
         // Get transfer parameters based on whether local is file or memory
@@ -219,6 +384,7 @@ nixl_status_t nixlGdsEngine::prepXfer (const nixl_xfer_op_t &operation,
             }
             total_size = remote[i].len;
             base_offset = (size_t)local[i].addr;
+            mem_dev_id = (int)remote[i].devId;
 
             auto it = gds_file_map.find(local[i].devId);
             if (it == gds_file_map.end()) {
@@ -235,6 +401,7 @@ nixl_status_t nixlGdsEngine::prepXfer (const nixl_xfer_op_t &operation,
             }
             total_size = local[i].len;
             base_offset = (size_t)remote[i].addr;
+            mem_dev_id = (int)local[i].devId;
 
             auto it = gds_file_map.find(remote[i].devId);
             if (it == gds_file_map.end()) {
@@ -259,6 +426,7 @@ nixl_status_t nixlGdsEngine::prepXfer (const nixl_xfer_op_t &operation,
             req.file_offset = base_offset + current_offset;
             req.fh = fh.cu_fhandle;
             req.op = (operation == NIXL_READ) ? CUFILE_READ : CUFILE_WRITE;
+            req.dev_id = mem_dev_id;
 
             gds_handle->request_list.push_back(req);
 
@@ -278,23 +446,38 @@ nixl_status_t nixlGdsEngine::prepXfer (const nixl_xfer_op_t &operation,
     return NIXL_SUCCESS;
 }
 
-nixlGdsIOBatch* nixlGdsEngine::getBatchFromPool(unsigned int size) const {
-    const std::lock_guard<std::mutex> lock(batch_pool_lock);
-    // Use a pre-allocated batch if available
-    if (!batch_pool.empty()) {
-        nixlGdsIOBatch* batch = batch_pool.back();
-        batch_pool.pop_back();
-        batch->reset();
-        return batch;
+nixlGdsIOBatch* nixlGdsEngine::getBatchFromPool(int dev_id) const {
+    gdsBatchPool& pool = batch_pools[poolIndexOf(dev_id)];
+
+    // Lock-free pop: the tag in the upper half changes on every push, so
+    // a slot recycled between the load and the CAS fails the exchange
+    uint64_t old_head = pool.head.load(std::memory_order_acquire);
+    while ((uint32_t)old_head != gdsBatchPool::null_idx) {
+        nixlGdsIOBatch* batch = pool.batches[(uint32_t)old_head].get();
+        uint64_t new_head = (old_head & 0xffffffff00000000ULL) |
+                            batch->pool_next.load(std::memory_order_relaxed);
+        if (pool.head.compare_exchange_weak(old_head, new_head,
+                                            std::memory_order_acq_rel,
+                                            std::memory_order_acquire)) {
+            batch->reset();
+            return batch;
+        }
     }
     // Return nullptr if pool is empty - don't create new batches in the data path
     return nullptr;
 }
 
 void nixlGdsEngine::returnBatchToPool(nixlGdsIOBatch* batch) const {
-    const std::lock_guard<std::mutex> lock(batch_pool_lock);
-    // Only keep up to batch_pool_size batches
-        batch_pool.push_back(batch);
+    gdsBatchPool& pool = batch_pools[poolIndexOf(batch->pool_dev)];
+
+    uint64_t old_head = pool.head.load(std::memory_order_relaxed);
+    uint64_t new_head;
+    do {
+        batch->pool_next.store((uint32_t)old_head, std::memory_order_relaxed);
+        new_head = (((old_head >> 32) + 1) << 32) | batch->pool_index;
+    } while (!pool.head.compare_exchange_weak(old_head, new_head,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
 }
 
 nixl_status_t nixlGdsEngine::postXfer(const nixl_xfer_op_t &operation,
@@ -312,13 +495,27 @@ nixl_status_t nixlGdsEngine::postXfer(const nixl_xfer_op_t &operation,
         return NIXL_ERR_INVALID_PARAM;
     }
 
+    // With a user stream the I/O goes stream-ordered through the cuFile
+    // async API instead of CPU-polled batches
+    if (opt_args && opt_args->cudaStream)
+        return postXferAsync(gds_handle, (cudaStream_t)opt_args->cudaStream);
+
     // Process requests in batches
     const auto& request_list = gds_handle->request_list;
     size_t current_req = 0;
 
     while (current_req < request_list.size()) {
-        size_t batch_size = std::min(request_list.size() - current_req,
-                                     (size_t)batch_limit);
+        // A batch stays on one GPU's pool: take the run of requests with
+        // the same devId, capped at that pool's own batch limit
+        int dev_id = request_list[current_req].dev_id;
+        size_t limit = batch_pools[poolIndexOf(dev_id)].batch_limit;
+        size_t run_end = current_req + 1;
+        while ((run_end < request_list.size()) &&
+               (request_list[run_end].dev_id == dev_id) &&
+               ((run_end - current_req) < limit))
+            run_end++;
+
+        size_t batch_size = run_end - current_req;
         nixl_status_t status = createAndSubmitBatch(request_list, current_req,
                                                     batch_size, gds_handle->batch_io_list);
 
@@ -337,13 +534,55 @@ nixl_status_t nixlGdsEngine::postXfer(const nixl_xfer_op_t &operation,
     return NIXL_IN_PROG;
 }
 
+// Submits every request with cuFileReadAsync/cuFileWriteAsync on the given
+// stream, so the I/O is ordered with the caller's compute and completion is
+// observable via stream events; checkXfer then queries the stream
+nixl_status_t nixlGdsEngine::postXferAsync(nixlGdsBackendReqH* gds_handle,
+                                           cudaStream_t stream) const
+{
+    const auto& request_list = gds_handle->request_list;
+
+    gds_handle->async_io_list.assign(request_list.size(),
+                                     nixlGdsBackendReqH::GdsAsyncIO());
+    gds_handle->stream = stream;
+
+    for (size_t i = 0; i < request_list.size(); i++) {
+        const auto& req = request_list[i];
+        auto& io = gds_handle->async_io_list[i];
+        io.size = req.size;
+        io.file_offset = (off_t)req.file_offset;
+
+        CUfileError_t err;
+        if (req.op == CUFILE_READ) {
+            err = cuFileReadAsync(req.fh, req.addr, &io.size, &io.file_offset,
+                                  &io.buf_offset, &io.result, stream);
+        } else {
+            err = cuFileWriteAsync(req.fh, req.addr, &io.size, &io.file_offset,
+                                   &io.buf_offset, &io.result, stream);
+        }
+        if (err.err != CU_FILE_SUCCESS) {
+            NIXL_ERROR << "cuFile async submission failed with error "
+                       << err.err;
+            // Earlier submissions are already on the stream; let them
+            // drain before their parameter blocks can be reused
+            cudaStreamSynchronize(stream);
+            gds_handle->async_io_list.clear();
+            gds_handle->stream = nullptr;
+            return NIXL_ERR_BACKEND;
+        }
+    }
+
+    return NIXL_IN_PROG;
+}
+
 nixl_status_t nixlGdsEngine::createAndSubmitBatch(const std::vector<GdsTransferRequestH>& requests,
                                                   size_t start_idx, size_t batch_size,
                                                   std::vector<nixlGdsIOBatch*>& batch_list) const
 {
-    nixlGdsIOBatch* batch = getBatchFromPool(batch_size);
+    nixlGdsIOBatch* batch = getBatchFromPool(requests[start_idx].dev_id);
     if (!batch) {
-        NIXL_ERROR << "GDS batch pool exhausted";
+        NIXL_ERROR << "GDS batch pool exhausted for devId "
+                   << requests[start_idx].dev_id;
         return NIXL_ERR_BACKEND;
     }
 
@@ -377,6 +616,31 @@ nixl_status_t nixlGdsEngine::checkXfer(nixlBackendReqH* handle) const
 {
     nixlGdsBackendReqH *gds_handle = (nixlGdsBackendReqH *)handle;
 
+    // Stream-ordered mode completes in stream order; query rather than sync
+    if (gds_handle->stream) {
+        cudaError_t query = cudaStreamQuery(gds_handle->stream);
+        if (query == cudaErrorNotReady)
+            return NIXL_IN_PROG;
+
+        nixl_status_t status = NIXL_SUCCESS;
+        if (query != cudaSuccess) {
+            NIXL_ERROR << "cudaStreamQuery returned " << cudaGetErrorString(query);
+            status = NIXL_ERR_BACKEND;
+        } else {
+            for (const auto& io : gds_handle->async_io_list) {
+                if (io.result < 0) {
+                    NIXL_ERROR << "cuFile async I/O failed with error " << io.result;
+                    status = NIXL_ERR_BACKEND;
+                    break;
+                }
+            }
+        }
+        gds_handle->async_io_list.clear();
+        gds_handle->stream = nullptr;
+        gds_handle->needs_prep = true;
+        return status;
+    }
+
     if (gds_handle->batch_io_list.empty()) {
         gds_handle->needs_prep = true;
         return NIXL_SUCCESS;
@@ -413,13 +677,9 @@ nixl_status_t nixlGdsEngine::releaseReqH(nixlBackendReqH* handle) const
 }
 
 nixlGdsEngine::~nixlGdsEngine() {
-    // Clean up the batch pool
-    for (auto* batch : batch_pool) {
-        if (batch) {
-            delete batch;
-        }
-    }
-    batch_pool.clear();
+    // The pools own their batches; dropping the vectors releases them
+    for (auto& pool : batch_pools)
+        releaseBudget(pool.accounted_bytes);
 
     if (gds_utils) {
         gds_utils->closeGdsDriver();
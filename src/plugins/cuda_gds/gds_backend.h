@@ -23,9 +23,11 @@
 #include <cuda_runtime.h>
 #include <unistd.h>
 #include <fcntl.h>
-#include <list>
+#include <array>
+#include <atomic>
+#include <memory>
 #include <vector>
-#include <mutex>
+#include <unordered_map>
 #include "gds_utils.h"
 #include "backend/backend_engine.h"
 
@@ -46,6 +48,7 @@ class GdsTransferRequestH {
         size_t          file_offset;
         CUfileHandle_t  fh;
         CUfileOpcode_t  op;
+        int             dev_id;        // devId of the memory side
 
         // Default constructor
         GdsTransferRequestH() {
@@ -54,16 +57,19 @@ class GdsTransferRequestH {
             file_offset = 0;
             fh = nullptr;
             op = CUFILE_READ;
+            dev_id = 0;
         }
 
         // Constructor with parameters
         GdsTransferRequestH(void* a, size_t s, size_t offset,
-			    CUfileHandle_t handle, CUfileOpcode_t operation) {
+			    CUfileHandle_t handle, CUfileOpcode_t operation,
+			    int dev) {
             addr = a;
             size = s;
             file_offset = offset;
             fh = handle;
             op = operation;
+            dev_id = dev;
         }
 };
 
@@ -73,10 +79,25 @@ class nixlGdsBackendReqH : public nixlBackendReqH {
         std::vector<nixlGdsIOBatch*> batch_io_list;
         bool needs_prep;
 
+        // Stream-ordered mode (cuFileReadAsync/cuFileWriteAsync): the async
+        // calls take pointers whose storage must outlive the submission, so
+        // each request keeps its parameter block here until the stream is done
+        struct GdsAsyncIO {
+            size_t  size = 0;
+            off_t   file_offset = 0;
+            off_t   buf_offset = 0;
+            ssize_t result = 0;
+        };
+        std::vector<GdsAsyncIO> async_io_list;
+        cudaStream_t stream = nullptr;
+
         nixlGdsBackendReqH() {
             needs_prep = true;
         }
         ~nixlGdsBackendReqH() {
+            // In-flight stream I/O references the parameter blocks above
+            if (stream)
+                cudaStreamSynchronize(stream);
             for (auto* batch : batch_io_list) {
                 delete batch;
             }
@@ -89,14 +110,36 @@ class nixlGdsEngine : public nixlBackendEngine {
         gdsUtil *gds_utils;
         std::unordered_map<int, gdsFileHandle> gds_file_map;
 
-        mutable std::mutex batch_pool_lock;
-        mutable std::list<nixlGdsIOBatch*> batch_pool;
-        unsigned int batch_pool_size;  // Renamed from pool_size
-        unsigned int batch_limit;      // Added for configurable batch limit
+        // Per-GPU batch pools, indexed by devId: lock-free freelists of
+        // pre-created cuFile batch handles with independently tunable batch
+        // limits ("batch_limit_<devId>" custom params), so requests from
+        // different GPUs do not serialize on one shared pool lock. The
+        // freelist head packs {tag, slot-in-batches} into one atomic word;
+        // the tag makes the pop CAS immune to ABA reuse of a slot.
+        struct gdsBatchPool {
+            static constexpr uint32_t null_idx = UINT32_MAX;
+            std::vector<std::unique_ptr<nixlGdsIOBatch>> batches;
+            std::atomic<uint64_t> head{(uint64_t)null_idx};
+            std::atomic<bool> primed{false};
+            unsigned int batch_limit{0};
+            // Bytes reported to the agent memory budget at prime time,
+            // given back when the engine goes away
+            size_t accounted_bytes{0};
+        };
+        static constexpr unsigned int GDS_DEV_POOLS = 64;
+        mutable std::array<gdsBatchPool, GDS_DEV_POOLS> batch_pools;
+        unsigned int batch_pool_size;  // Batches pre-created per GPU pool
+        unsigned int batch_limit;      // Default per-GPU batch limit
         unsigned int max_request_size; // Added for configurable request size
 
-        nixlGdsIOBatch* getBatchFromPool(unsigned int size) const;
+        static unsigned int poolIndexOf(int dev_id) {
+            return (unsigned int)dev_id % GDS_DEV_POOLS;
+        }
+        void primePool(int dev_id);
+        nixlGdsIOBatch* getBatchFromPool(int dev_id) const;
         void returnBatchToPool(nixlGdsIOBatch* batch) const;
+        nixl_status_t postXferAsync(nixlGdsBackendReqH* gds_handle,
+                                    cudaStream_t stream) const;
         nixl_status_t createAndSubmitBatch(const std::vector<GdsTransferRequestH>& requests,
                                            size_t start_idx, size_t batch_size,
                                            std::vector<nixlGdsIOBatch*>& batch_list) const;
@@ -175,5 +218,10 @@ class nixlGdsEngine : public nixlBackendEngine {
         nixl_status_t
         queryMem(const nixl_reg_dlist_t &descs,
                  std::vector<nixl_query_resp_t> &resp) const override;
+
+        nixl_status_t
+        getTunableParams(std::vector<nixl_tunable_param_t> &params) const override;
+        nixl_status_t
+        retune(const std::string &param, uint64_t value) override;
 };
 #endif
@@ -19,6 +19,8 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <atomic>
+#include <cstdint>
 #include <nixl.h>
 #include <cufile.h>
 
@@ -50,6 +52,13 @@ class nixlGdsIOBatch {
         nixl_status_t cancelBatch();
         void reset();
 
+        // Bookkeeping for the engine's per-GPU lock-free batch freelists
+        // (see nixlGdsEngine): slot in the owning pool, link to the next
+        // free slot, and the devId the pool is keyed by
+        uint32_t pool_index = 0;
+        std::atomic<uint32_t> pool_next{0};
+        int pool_dev = 0;
+
     private:
         CUfileBatchHandle_t batch_handle;
         CUfileIOEvents_t *io_batch_events = nullptr;
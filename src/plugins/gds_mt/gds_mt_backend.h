@@ -21,6 +21,7 @@
 #include <nixl.h>
 #include <nixl_types.h>
 #include <backend/backend_engine.h>
+#include <atomic>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -34,7 +35,7 @@ public:
     // Note: The destructor of the TaskFlow executor runs wait_for_all() to
     // wait for all submitted taskflows to complete and then notifies all worker
     // threads to stop and join these threads.
-    ~nixlGdsMtEngine() = default;
+    ~nixlGdsMtEngine();
 
     nixlGdsMtEngine (const nixlGdsMtEngine &) = delete;
     nixlGdsMtEngine &
@@ -115,6 +116,16 @@ private:
     gdsMtUtil gds_mt_utils_;
     std::unordered_map<int, std::weak_ptr<gdsMtFileHandle>> gds_mt_file_map_;
     size_t thread_count_;
+    // Descriptors above this size become parallel chunk tasks so a single
+    // large file spreads over the executor's workers; 0 disables splitting
+    size_t split_threshold_;
     std::unique_ptr<tf::Executor> executor_;
+    // Alignment statistics: segments whose address, file offset or length
+    // are not sector aligned take cuFile's internal staging path, so these
+    // counters show how much traffic hits it (prepXfer is const, and the
+    // executor's workers may prep concurrently)
+    mutable std::atomic<uint64_t> aligned_segs_{0};
+    mutable std::atomic<uint64_t> unaligned_segs_{0};
+    mutable std::atomic<uint64_t> unaligned_bytes_{0};
 };
 #endif
@@ -77,9 +77,22 @@ nixlDocaEngine::nixlDocaEngine (const nixlBackendInitParams *init_params) :
     if (custom_params->count ("cuda_streams") != 0 && (*custom_params)["cuda_streams"] != "")
         nstreams = std::stoi ((*custom_params)["cuda_streams"]);
     if (nstreams == 0) nstreams = DOCA_POST_STREAM_NUM;
+    if (nstreams > (int)DOCA_POST_STREAM_NUM) {
+        NIXL_WARN << "cuda_streams capped to " << DOCA_POST_STREAM_NUM;
+        nstreams = DOCA_POST_STREAM_NUM;
+    }
 
     NIXL_INFO << "CUDA streams used for pool mode: " << nstreams;
 
+    persistentKernel = false;
+    if (custom_params->count ("persistent_kernel") != 0 &&
+        (*custom_params)["persistent_kernel"] != "") {
+        const char c = (*custom_params)["persistent_kernel"][0];
+        persistentKernel = (c == 'y' || c == 'Y' || c == '1');
+    }
+    if (persistentKernel)
+        NIXL_INFO << "Persistent kernel mode: xfer ring serviced by device-side polling";
+
     /* Open DOCA device */
     result = open_doca_device_with_ibdev_name (
             (const uint8_t *)(ndevs[0].c_str()), ndevs[0].size(), &(ddev));
@@ -98,9 +111,10 @@ nixlDocaEngine::nixlDocaEngine (const nixlBackendInitParams *init_params) :
     doca_devinfo_get_ipv4_addr (
             doca_dev_as_devinfo (ddev), (uint8_t *)ipv4_addr, DOCA_DEVINFO_IPV4_ADDR_SIZE);
 
+    // One ring shard per post stream
     // DOCA_GPU_MEM_TYPE_GPU_CPU == GDRCopy
     result = doca_gpu_mem_alloc(gdevs[0].second,
-                                 sizeof (struct docaXferReqGpu) * DOCA_XFER_REQ_MAX,
+                                 sizeof (struct docaXferReqGpu) * DOCA_XFER_REQ_MAX * nstreams,
                                  4096,
                                  DOCA_GPU_MEM_TYPE_GPU_CPU,
                                  (void **)&xferReqRingGpu,
@@ -110,7 +124,7 @@ nixlDocaEngine::nixlDocaEngine (const nixlBackendInitParams *init_params) :
                    << doca_error_get_descr (result);
         NIXL_ERROR << "Allocating memory with DOCA_GPU_MEM_TYPE_CPU_GPU";
         result = doca_gpu_mem_alloc(gdevs[0].second,
-                                     sizeof (struct docaXferReqGpu) * DOCA_XFER_REQ_MAX,
+                                     sizeof (struct docaXferReqGpu) * DOCA_XFER_REQ_MAX * nstreams,
                                      4096,
                                      DOCA_GPU_MEM_TYPE_CPU_GPU,
                                      (void **)&xferReqRingGpu,
@@ -122,7 +136,7 @@ nixlDocaEngine::nixlDocaEngine (const nixlBackendInitParams *init_params) :
         }
     }
 
-    nixlDocaEngineCheckCudaError(cudaMemset(xferReqRingGpu, 0, sizeof (struct docaXferReqGpu) * DOCA_XFER_REQ_MAX), "Failed to memset GPU memory");
+    nixlDocaEngineCheckCudaError(cudaMemset(xferReqRingGpu, 0, sizeof (struct docaXferReqGpu) * DOCA_XFER_REQ_MAX * nstreams), "Failed to memset GPU memory");
 
     result = doca_gpu_mem_alloc(gdevs[0].second,
                                  sizeof (uint64_t),
@@ -153,8 +167,9 @@ nixlDocaEngine::nixlDocaEngine (const nixlBackendInitParams *init_params) :
         nixlDocaEngineCheckCudaError(cudaStreamCreateWithFlags (&post_stream[i], cudaStreamNonBlocking), "Failed to create CUDA stream");
     xferStream = 0;
 
+    // One completion list shard per post stream
     result = doca_gpu_mem_alloc(gdevs[0].second,
-                                 sizeof (struct docaXferCompletion) * DOCA_MAX_COMPLETION_INFLIGHT,
+                                 sizeof (struct docaXferCompletion) * DOCA_MAX_COMPLETION_INFLIGHT * nstreams,
                                  4096,
                                  DOCA_GPU_MEM_TYPE_CPU_GPU,
                                  (void **)&completion_list_gpu,
@@ -165,7 +180,7 @@ nixlDocaEngine::nixlDocaEngine (const nixlBackendInitParams *init_params) :
 
     memset (completion_list_cpu,
             0,
-            sizeof (struct docaXferCompletion) * DOCA_MAX_COMPLETION_INFLIGHT);
+            sizeof (struct docaXferCompletion) * DOCA_MAX_COMPLETION_INFLIGHT * nstreams);
 
     // DOCA_GPU_MEM_TYPE_GPU_CPU == GDRCopy
     result = doca_gpu_mem_alloc(gdevs[0].second,
@@ -204,16 +219,16 @@ nixlDocaEngine::nixlDocaEngine (const nixlBackendInitParams *init_params) :
     }
 
     result = doca_gpu_mem_alloc(gdevs[0].second,
-                                 sizeof (struct docaNotifRecv),
+                                 sizeof (struct docaNotifRing),
                                  4096,
                                  DOCA_GPU_MEM_TYPE_CPU_GPU,
-                                 (void **)&notif_progress_gpu,
-                                 (void **)&notif_progress_cpu);
-    if (result != DOCA_SUCCESS || notif_progress_gpu == nullptr || notif_progress_cpu == nullptr) {
+                                 (void **)&notif_ring_gpu,
+                                 (void **)&notif_ring_cpu);
+    if (result != DOCA_SUCCESS || notif_ring_gpu == nullptr || notif_ring_cpu == nullptr) {
         NIXL_ERROR << "Function doca_gpu_mem_alloc return " << doca_error_get_descr (result);
     }
 
-    memset (notif_progress_cpu, 0, sizeof (struct docaNotifRecv));
+    memset (notif_ring_cpu, 0, sizeof (struct docaNotifRing));
 
     result = doca_gpu_mem_alloc(gdevs[0].second,
                                  sizeof (struct docaNotifSend),
@@ -231,24 +246,33 @@ nixlDocaEngine::nixlDocaEngine (const nixlBackendInitParams *init_params) :
     // Warmup
     doca_kernel_progress (wait_stream,
                           nullptr,
+                          (uint32_t)nstreams,
+                          persistentKernel ? xferReqRingGpu : nullptr,
                           notif_fill_gpu,
-                          notif_progress_gpu,
+                          notif_ring_gpu,
                           notif_send_gpu,
                           wait_exit_gpu);
     nixlDocaEngineCheckCudaError(cudaStreamSynchronize(wait_stream), "stream synchronize");
     doca_kernel_progress (wait_stream,
                           completion_list_gpu,
+                          (uint32_t)nstreams,
+                          persistentKernel ? xferReqRingGpu : nullptr,
                           notif_fill_gpu,
-                          notif_progress_gpu,
+                          notif_ring_gpu,
                           notif_send_gpu,
                           wait_exit_gpu);
 
-    // We may need a GPU warmup with relevant DOCA engine kernels
-    doca_kernel_write (0, nullptr, nullptr, 0);
-    doca_kernel_read (0, nullptr, nullptr, 0);
+    // We may need a GPU warmup with relevant DOCA engine kernels; with the
+    // persistent kernel the per-post kernels are never launched
+    if (!persistentKernel) {
+        doca_kernel_write (0, nullptr, nullptr, 0);
+        doca_kernel_read (0, nullptr, nullptr, 0);
+    }
 
-    lastPostedReq = 0;
-    xferRingPos = 0;
+    for (int i = 0; i < nstreams; i++) {
+        lastPostedReq[i] = 0;
+        xferRingPos[i] = 0;
+    }
 
     progressThreadStart();
 }
@@ -290,7 +314,7 @@ nixlDocaEngine::~nixlDocaEngine() {
         nixlDocaDestroyNotif(gdevs[0].second, notif.second);
 
     doca_gpu_mem_free(gdevs[0].second, notif_fill_gpu);
-    doca_gpu_mem_free(gdevs[0].second, notif_progress_gpu);
+    doca_gpu_mem_free(gdevs[0].second, notif_ring_gpu);
     doca_gpu_mem_free(gdevs[0].second, notif_send_gpu);
     doca_gpu_mem_free(gdevs[0].second, completion_list_gpu);
 
@@ -338,6 +362,11 @@ nixlDocaEngine::nixlDocaInitNotif (const std::string &remote_agent,
         goto exit_success;
     }
 
+    if (notifQpPeers.size() >= DOCA_ENG_MAX_CONN) {
+        NIXL_ERROR << "Can't register more than " << DOCA_ENG_MAX_CONN << " notif QPs";
+        return NIXL_ERR_BACKEND;
+    }
+
     notif = new struct nixlDocaNotif;
 
     notif->elems_num = DOCA_MAX_NOTIF_INFLIGHT;
@@ -392,6 +421,15 @@ nixlDocaEngine::nixlDocaInitNotif (const std::string &remote_agent,
     while (((volatile struct docaNotifRecv *)notif_fill_cpu)->rdma_qp != nullptr)
         ;
 
+    // Publish the QP into the GPU-visible event ring; the notif service
+    // block starts sweeping it autonomously from now on
+    ((volatile struct docaNotifRing *)notif_ring_cpu)->qps[notifQpPeers.size()] =
+            qpMap[remote_agent]->rdma_gpu_notif;
+    std::atomic_thread_fence (std::memory_order_release);
+    ((volatile struct docaNotifRing *)notif_ring_cpu)->num_qps =
+            (uint32_t)(notifQpPeers.size() + 1);
+    notifQpPeers.push_back (remote_agent);
+
     NIXL_INFO << "nixlDocaInitNotif added new qp for " << remote_agent << std::endl;
 
 exit_success:
@@ -1255,15 +1293,20 @@ nixlDocaEngine::prepXfer (const nixl_xfer_op_t &operation,
 
     if (lcnt == 0) return NIXL_ERR_INVALID_PARAM;
 
+    // Requests always land in a stream shard of the ring; external streams
+    // passed through customParam round-robin over the shards as well
+    stream_id = (xferStream.fetch_add (1) & (nstreams - 1));
     if (opt_args->customParam.empty()) {
-        stream_id = (xferStream.fetch_add (1) & (nstreams - 1));
         treq->stream = post_stream[stream_id];
     } else {
         treq->stream = (cudaStream_t) * ((uintptr_t *)opt_args->customParam.data());
     }
+    treq->stream_id = stream_id;
 
-    treq->start_pos = (xferRingPos.fetch_add (1) & (DOCA_XFER_REQ_MAX - 1));
-    pos = treq->start_pos;
+    const uint32_t shard_base = stream_id * DOCA_XFER_REQ_MAX;
+    uint32_t seq = xferRingPos[stream_id].fetch_add (1);
+    treq->start_pos = seq;
+    pos = shard_base + (seq & DOCA_XFER_REQ_MASK);
 
     do {
         for (uint32_t idx = 0; idx < lcnt && idx < DOCA_XFER_REQ_SIZE; idx++) {
@@ -1288,13 +1331,17 @@ nixlDocaEngine::prepXfer (const nixl_xfer_op_t &operation,
 
         if (lcnt > DOCA_XFER_REQ_SIZE) {
             lcnt -= DOCA_XFER_REQ_SIZE;
-            pos = (xferRingPos.fetch_add (1) & (DOCA_XFER_REQ_MAX - 1));
+            seq = xferRingPos[stream_id].fetch_add (1);
+            pos = shard_base + (seq & DOCA_XFER_REQ_MASK);
         } else {
             lcnt = 0;
         }
     } while (lcnt > 0);
 
-    treq->end_pos = xferRingPos;
+    // start_pos/end_pos are shard sequence numbers; masking into the shard
+    // happens at use so multi-entry requests survive ring wrap-around
+    treq->end_pos = seq + 1;
+    const uint32_t last_idx = pos;
 
     if (opt_args && opt_args->hasNotif) {
         struct nixlDocaNotif *notif;
@@ -1311,26 +1358,26 @@ nixlDocaEngine::prepXfer (const nixl_xfer_op_t &operation,
         std::string newMsg = msg_tag_start + std::to_string (opt_args->notifMsg.size()) +
                 msg_tag_end + opt_args->notifMsg;
 
-        xferReqRingCpu[treq->end_pos - 1].has_notif_msg_idx =
+        xferReqRingCpu[last_idx].has_notif_msg_idx =
                 (notif->send_pi.fetch_add (1) & (notif->elems_num - 1));
-        xferReqRingCpu[treq->end_pos - 1].msg_sz = newMsg.size();
-        xferReqRingCpu[treq->end_pos - 1].notif_barr_gpu = notif->send_barr->barr_gpu;
+        xferReqRingCpu[last_idx].msg_sz = newMsg.size();
+        xferReqRingCpu[last_idx].notif_barr_gpu = notif->send_barr->barr_gpu;
 
         memcpy (notif->send_addr +
-                        (xferReqRingCpu[treq->end_pos - 1].has_notif_msg_idx * notif->elems_size),
+                        (xferReqRingCpu[last_idx].has_notif_msg_idx * notif->elems_size),
                 newMsg.c_str(),
                 newMsg.size());
 
         NIXL_DEBUG << "DOCA prepXfer with notif to " << remote_agent << " at "
-                   << xferReqRingCpu[treq->end_pos - 1].has_notif_msg_idx << " msg " << newMsg
+                   << xferReqRingCpu[last_idx].has_notif_msg_idx << " msg " << newMsg
                    << " to " << remote_agent;
 
     } else {
-        xferReqRingCpu[treq->end_pos - 1].has_notif_msg_idx = DOCA_NOTIF_NULL;
+        xferReqRingCpu[last_idx].has_notif_msg_idx = DOCA_NOTIF_NULL;
     }
 
     NIXL_DEBUG << "DOCA REQUEST from " << treq->start_pos << " to " << treq->end_pos - 1
-               << " stream " << stream_id << std::endl;
+               << " stream " << stream_id << " shard base " << shard_base << std::endl;
 
     treq->backendHandleGpu = 0;
 
@@ -1347,20 +1394,34 @@ nixlDocaEngine::postXfer (const nixl_xfer_op_t &operation,
                           nixlBackendReqH *&handle,
                           const nixl_opt_b_args_t *opt_args) const {
     nixlDocaBckndReq *treq = (nixlDocaBckndReq *)handle;
-
-    for (uint32_t idx = treq->start_pos; idx < treq->end_pos; idx++) {
-        xferReqRingCpu[idx].id =
-                (lastPostedReq.fetch_add (1) & (DOCA_MAX_COMPLETION_INFLIGHT_MASK));
+    const uint32_t shard_base = treq->stream_id * DOCA_XFER_REQ_MAX;
+    const uint32_t compl_base = treq->stream_id * DOCA_MAX_COMPLETION_INFLIGHT;
+
+    for (uint32_t seq = treq->start_pos; seq < treq->end_pos; seq++) {
+        uint32_t idx = shard_base + (seq & DOCA_XFER_REQ_MASK);
+        xferReqRingCpu[idx].id = compl_base +
+                (lastPostedReq[treq->stream_id].fetch_add (1) &
+                 (DOCA_MAX_COMPLETION_INFLIGHT_MASK));
         completion_list_cpu[xferReqRingCpu[idx].id].xferReqRingGpu = xferReqRingGpu + idx;
         completion_list_cpu[xferReqRingCpu[idx].id].completed = 0;
 
         switch (operation) {
         case NIXL_READ:
-            doca_kernel_read (treq->stream, xferReqRingCpu[idx].rdma_gpu_data, xferReqRingGpu, idx);
-            break;
         case NIXL_WRITE:
-            doca_kernel_write (
-                    treq->stream, xferReqRingCpu[idx].rdma_gpu_data, xferReqRingGpu, idx);
+            if (persistentKernel) {
+                // The poster block walks the shard in sequence order, so
+                // publishing the doorbell is all a post costs; the entry
+                // contents must be visible before it
+                std::atomic_thread_fence (std::memory_order_release);
+                *((volatile uint8_t *)&xferReqRingCpu[idx].post_op) =
+                        (operation == NIXL_READ) ? DOCA_XFER_POST_READ : DOCA_XFER_POST_WRITE;
+            } else if (operation == NIXL_READ) {
+                doca_kernel_read (
+                        treq->stream, xferReqRingCpu[idx].rdma_gpu_data, xferReqRingGpu, idx);
+            } else {
+                doca_kernel_write (
+                        treq->stream, xferReqRingCpu[idx].rdma_gpu_data, xferReqRingGpu, idx);
+            }
             break;
         default:
             return NIXL_ERR_INVALID_PARAM;
@@ -1373,12 +1434,26 @@ nixlDocaEngine::postXfer (const nixl_xfer_op_t &operation,
 nixl_status_t
 nixlDocaEngine::checkXfer (nixlBackendReqH *handle) const {
     nixlDocaBckndReq *treq = (nixlDocaBckndReq *)handle;
+    const uint32_t shard_base = treq->stream_id * DOCA_XFER_REQ_MAX;
     uint32_t completion_index;
 
-    for (uint32_t idx = treq->start_pos; idx < treq->end_pos; idx++) {
-        completion_index = xferReqRingCpu[idx].id & (DOCA_MAX_COMPLETION_INFLIGHT_MASK);
+    for (uint32_t seq = treq->start_pos; seq < treq->end_pos; seq++) {
+        uint32_t idx = shard_base + (seq & DOCA_XFER_REQ_MASK);
+        // id is already absolute into the sharded completion list
+        completion_index = xferReqRingCpu[idx].id;
 
         if (((volatile docaXferCompletion *)completion_list_cpu)[completion_index].completed == 1) {
+            if (*((volatile uint8_t *)&xferReqRingCpu[idx].in_use) == 1) {
+                // First observation of this completion: account the
+                // device-side issue-to-completion latency stamped by the
+                // posting and progress kernels (no-op unless telemetry is on)
+                std::atomic_thread_fence (std::memory_order_acquire);
+                if (xferReqRingCpu[idx].dev_comp_ns > xferReqRingCpu[idx].dev_issue_ns)
+                    const_cast<nixlDocaEngine *> (this)->addTelemetryEvent (
+                            "gpunetio.dev_xfer_lat_ns",
+                            xferReqRingCpu[idx].dev_comp_ns -
+                                    xferReqRingCpu[idx].dev_issue_ns);
+            }
             *((volatile uint8_t *)&xferReqRingCpu[idx].in_use) = 0;
             NIXL_DEBUG << "DOCA checkXfer pos " << idx << " compl_idx " << completion_index
                        << " COMPLETED!\n";
@@ -1392,7 +1467,9 @@ nixlDocaEngine::checkXfer (nixlBackendReqH *handle) const {
 
 nixl_status_t
 nixlDocaEngine::releaseReqH (nixlBackendReqH *handle) const {
-    uint32_t tmp = xferRingPos.load() & (DOCA_XFER_REQ_MAX - 1);
+    nixlDocaBckndReq *treq = (nixlDocaBckndReq *)handle;
+    uint32_t tmp = (treq->stream_id * DOCA_MAX_COMPLETION_INFLIGHT) +
+            (xferRingPos[treq->stream_id].load() & DOCA_XFER_REQ_MASK);
     if (((volatile docaXferCompletion *)completion_list_cpu)[tmp].completed > 0)
         return NIXL_SUCCESS;
     else
@@ -1410,24 +1487,38 @@ nixlDocaEngine::getNotifs (notif_list_t &notif_list) {
     // Lock required to prevent inconsistency if another notifyQp (new peer) is added
     // while getNotifs is running
     std::lock_guard<std::mutex> lock(notifLock);
-    for (auto &notif : notifMap) {
-        ((volatile struct docaNotifRecv *)notif_progress_cpu)->rdma_qp =
-                qpMap[notif.first]->rdma_gpu_notif;
-        std::atomic_thread_fence (std::memory_order_release);
-        while (((volatile struct docaNotifRecv *)notif_progress_cpu)->rdma_qp != nullptr)
-            ;
-        num_msg = ((volatile struct docaNotifRecv *)notif_progress_cpu)->num_msg;
+
+    // One acquire read per poll: every event the notif service block
+    // published since the last call is drained in a single batch, with no
+    // per-QP handshake with the kernel
+    volatile struct docaNotifRing *ring = (volatile struct docaNotifRing *)notif_ring_cpu;
+    uint64_t head = ring->head;
+    if (head == notifRingTail)
+        return NIXL_SUCCESS;
+    std::atomic_thread_fence (std::memory_order_acquire);
+
+    while (notifRingTail != head) {
+        const struct docaNotifEvent &event =
+                notif_ring_cpu->events[notifRingTail & DOCA_NOTIF_RING_MASK];
+        const std::string &peer = notifQpPeers[event.qp_idx];
+        auto searchNotif = notifMap.find (peer);
+        if (searchNotif == notifMap.end()) {
+            notifRingTail++;
+            continue;
+        }
+        struct nixlDocaNotif *notif = searchNotif->second;
+
+        num_msg = event.num_msg;
         while (num_msg > 0) {
             NIXL_DEBUG << "CPU num_msg " << num_msg;
 
-            recv_idx = notif.second->recv_pi.load() & (DOCA_MAX_NOTIF_INFLIGHT - 1);
-            addr = (char *)(notif.second->recv_addr + (recv_idx * notif.second->elems_size));
+            recv_idx = notif->recv_pi.load() & (DOCA_MAX_NOTIF_INFLIGHT - 1);
+            addr = (char *)(notif->recv_addr + (recv_idx * notif->elems_size));
             msg_src = addr;
             position = msg_src.find (msg_tag_start);
 
             NIXL_DEBUG << "getNotifs idx " << recv_idx << "addr "
-                       << (void *)((notif.second->recv_addr +
-                                    (recv_idx * notif.second->elems_size)))
+                       << (void *)((notif->recv_addr + (recv_idx * notif->elems_size)))
                        << " msg " << msg_src << " position " << position << std::endl;
 
             if (position != std::string::npos && position == 0) {
@@ -1439,21 +1530,26 @@ nixlDocaEngine::getNotifs (notif_list_t &notif_list) {
                 std::string msg (addr + last + msg_tag_end.size(),
                                  addr + last + msg_tag_end.size() + sz);
 
-                NIXL_DEBUG << "getNotifs propagating notif from " << notif.first << " msg " << msg
+                NIXL_DEBUG << "getNotifs propagating notif from " << peer << " msg " << msg
                            << " size " << sz << " num " << num_msg << std::endl;
 
-                notif_list.push_back (std::pair (notif.first, msg));
+                notif_list.push_back (std::pair (peer, msg));
                 // Tag cleanup
                 memset (addr, 0, msg_tag_start.size());
-                recv_idx = notif.second->recv_pi.fetch_add (1);
+                recv_idx = notif->recv_pi.fetch_add (1);
                 num_msg--;
             } else {
                 NIXL_ERROR << "getNotifs error message at " << num_msg;
                 break;
             }
         }
+        notifRingTail++;
     }
 
+    // Single tail flush hands the consumed slots back to the GPU
+    std::atomic_thread_fence (std::memory_order_release);
+    ring->tail = notifRingTail;
+
     return NIXL_SUCCESS;
 }
 
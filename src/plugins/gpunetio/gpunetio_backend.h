@@ -121,6 +121,11 @@ private:
     std::string msg_tag_end = "DOCAE";
     std::vector<struct nixlDocaRdmaQp> rdma_qp_v;
     int nstreams;
+    /* Persistent-kernel mode ("persistent_kernel" param): the progress
+     * kernel gets one poster block per stream shard and postXfer rings a
+     * doorbell in the ring entry instead of launching a kernel per post
+     */
+    bool persistentKernel;
 
     uint32_t local_port;
     int noSyncIters;
@@ -131,11 +136,16 @@ private:
     cudaStream_t post_stream[DOCA_POST_STREAM_NUM];
     cudaStream_t wait_stream;
     mutable std::atomic<uint32_t> xferStream;
-    mutable std::atomic<uint32_t> lastPostedReq;
 
+    /* Xfer request ring and completion list are sharded per post stream:
+     * shard s owns entries [s * DOCA_XFER_REQ_MAX, (s + 1) * DOCA_XFER_REQ_MAX)
+     * (resp. DOCA_MAX_COMPLETION_INFLIGHT) with its own positions, so
+     * transfer kernels on independent streams never contend on ring slots
+     */
     struct docaXferReqGpu *xferReqRingGpu;
     struct docaXferReqGpu *xferReqRingCpu;
-    mutable std::atomic<uint32_t> xferRingPos;
+    mutable std::atomic<uint32_t> xferRingPos[DOCA_POST_STREAM_NUM];
+    mutable std::atomic<uint32_t> lastPostedReq[DOCA_POST_STREAM_NUM];
 
     struct docaXferCompletion *completion_list_gpu;
     struct docaXferCompletion *completion_list_cpu;
@@ -144,8 +154,13 @@ private:
     int oob_sock_client;
     struct docaNotifRecv *notif_fill_gpu;
     struct docaNotifRecv *notif_fill_cpu;
-    struct docaNotifRecv *notif_progress_gpu;
-    struct docaNotifRecv *notif_progress_cpu;
+    /* Notification event ring (see docaNotifRing), with the CPU shadow of
+     * the consumed position and the peer names in QP registration order
+     */
+    struct docaNotifRing *notif_ring_gpu;
+    struct docaNotifRing *notif_ring_cpu;
+    uint64_t notifRingTail = 0;
+    std::vector<std::string> notifQpPeers;
 
     struct docaNotifSend *notif_send_gpu;
     struct docaNotifSend *notif_send_cpu;
@@ -162,6 +177,7 @@ private:
     private:
     public:
         cudaStream_t stream;
+        uint32_t stream_id; /* Ring/completion shard the request was placed in */
         uint32_t devId;
         uint32_t start_pos;
         uint32_t end_pos;
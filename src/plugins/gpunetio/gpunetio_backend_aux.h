@@ -53,6 +53,10 @@ constexpr uint32_t RDMA_SEND_QUEUE_SIZE = 2048;
 constexpr uint32_t RDMA_RECV_QUEUE_SIZE = (RDMA_SEND_QUEUE_SIZE * 2);
 constexpr uint32_t DOCA_POST_STREAM_NUM = 4;
 constexpr uint32_t DOCA_XFER_REQ_SIZE = 512;
+/* Per-stream shard sizes: the xfer request ring and the completion list are
+ * allocated once per post stream, so kernels on different streams never
+ * share ring slots or completion slots (no false ordering between streams)
+ */
 constexpr uint32_t DOCA_XFER_REQ_MAX = 32;
 constexpr uint32_t DOCA_XFER_REQ_MASK = (DOCA_XFER_REQ_MAX - 1);
 constexpr uint32_t DOCA_ENG_MAX_CONN = 20;
@@ -65,6 +69,14 @@ constexpr uint32_t DOCA_RDMA_CM_LOCAL_PORT_SERVER = 6544;
 constexpr uint32_t DOCA_MAX_NOTIF_INFLIGHT = RDMA_RECV_QUEUE_SIZE;
 constexpr uint32_t DOCA_MAX_NOTIF_MESSAGE_SIZE = 8192;
 constexpr uint32_t DOCA_NOTIF_NULL = 0xFFFFFFFF;
+/* Doorbell values for persistent-kernel mode: postXfer publishes the
+ * operation into the ring entry's post_op and the per-shard poster block
+ * of the progress kernel issues the RDMA work device-side, instead of a
+ * dedicated kernel launch per post
+ */
+constexpr uint8_t DOCA_XFER_POST_NONE = 0;
+constexpr uint8_t DOCA_XFER_POST_READ = 1;
+constexpr uint8_t DOCA_XFER_POST_WRITE = 2;
 
 #ifndef ACCESS_ONCE
 #define ACCESS_ONCE(x) (*(volatile uint8_t *)&(x))
@@ -108,6 +120,7 @@ struct docaXferReqGpu {
     size_t size[DOCA_XFER_REQ_SIZE];
     uint16_t num;
     uint8_t in_use;
+    uint8_t post_op; /* DOCA_XFER_POST_*, rung by the CPU in persistent-kernel mode */
     uint32_t conn_idx;
     uint32_t has_notif_msg_idx;
     size_t msg_sz;
@@ -115,6 +128,8 @@ struct docaXferReqGpu {
     uint64_t *last_rsvd;
     uint64_t *last_posted;
     nixl_xfer_op_t backendOp; /* Needed only in case of GPU device transfer */
+    uint64_t dev_issue_ns; /* %globaltimer right before the WQEs are committed */
+    uint64_t dev_comp_ns; /* %globaltimer when the progress kernel sees the completion */
     struct doca_gpu_dev_rdma *rdma_gpu_data; /* DOCA RDMA instance GPU handler */
     struct doca_gpu_dev_rdma *rdma_gpu_notif; /* DOCA RDMA instance GPU handler */
 };
@@ -153,6 +168,32 @@ struct docaNotifRecv {
     int num_msg;
 };
 
+/* GPU-visible notification event ring: the notif service block of the
+ * progress kernel sweeps every registered notif QP autonomously and
+ * publishes one event per (QP, drained batch), instead of being driven
+ * with one CPU handshake per QP per poll. head is advanced by the GPU
+ * after the event contents are visible; tail is advanced by the consumer
+ * once per poll cycle. getNotifs mirrors its consumed position in a CPU
+ * shadow and flushes the tail once per call; device code doing
+ * GPU-driven scheduling can consume the same events through the GPU
+ * mapping of this structure.
+ */
+constexpr uint32_t DOCA_NOTIF_RING_SIZE = 2048;
+constexpr uint32_t DOCA_NOTIF_RING_MASK = (DOCA_NOTIF_RING_SIZE - 1);
+
+struct docaNotifEvent {
+    uint32_t qp_idx; /* Registration-order index of the notif QP */
+    uint32_t num_msg; /* Messages drained from that QP in one sweep */
+};
+
+struct docaNotifRing {
+    struct doca_gpu_dev_rdma *qps[DOCA_ENG_MAX_CONN]; /* Registered notif QPs */
+    uint32_t num_qps;
+    struct docaNotifEvent events[DOCA_NOTIF_RING_SIZE];
+    uint64_t head; /* GPU producer position */
+    uint64_t tail; /* Consumer position */
+};
+
 struct docaNotifSend {
     struct doca_gpu_dev_rdma *rdma_qp;
     struct doca_gpu_buf_arr *barr_gpu;
@@ -240,8 +281,10 @@ doca_kernel_read (cudaStream_t stream,
 doca_error_t
 doca_kernel_progress (cudaStream_t stream,
                       struct docaXferCompletion *completion_list,
+                      uint32_t num_shards,
+                      struct docaXferReqGpu *xfer_ring,
                       struct docaNotifRecv *notif_fill,
-                      struct docaNotifRecv *notif_progress,
+                      struct docaNotifRing *notif_ring,
                       struct docaNotifSend *notif_send_gpu,
                       uint32_t *exit_flag);
 
@@ -24,6 +24,18 @@
 
 #define ENABLE_DEBUG 0
 
+/* Issue/completion stamps use %globaltimer (wall-clock nanoseconds,
+ * coherent across SMs and kernels on one GPU) rather than clock64(),
+ * which counts per-SM cycles and cannot be compared between the posting
+ * kernel and the progress kernel
+ */
+__device__ uint64_t
+globaltimer_ns() {
+    uint64_t t;
+    asm volatile("mov.u64 %0, %%globaltimer;" : "=l"(t));
+    return t;
+}
+
 __device__ uint32_t
 reserve_position (struct docaXferReqGpu *xferReqRing, uint32_t pos) {
     cuda::atomic_ref<uint64_t, cuda::thread_scope_device> index (*xferReqRing[pos].last_rsvd);
@@ -46,6 +58,7 @@ wait_post (struct doca_gpu_dev_rdma *rdma_gpu, struct docaXferReqGpu *xferReqRin
         continue;
     // prevents the compiler from reordering
     asm volatile("fence.acquire.gpu;");
+    xferReqRing[pos].dev_issue_ns = globaltimer_ns();
     doca_gpu_dev_rdma_commit_weak (rdma_gpu, 0, xferReqRing[pos].num);
     asm volatile("fence.release.gpu;");
 
@@ -182,9 +195,11 @@ kernel_write (struct doca_gpu_dev_rdma *rdma_gpu,
 }
 
 __global__ void
-kernel_progress (struct docaXferCompletion *completion_list,
+kernel_progress (struct docaXferCompletion *completion_list_all,
+                 uint32_t num_shards,
+                 struct docaXferReqGpu *xfer_ring_all,
                  struct docaNotifRecv *notif_fill,
-                 struct docaNotifRecv *notif_progress,
+                 struct docaNotifRing *notif_ring,
                  struct docaNotifSend *notif_send_gpu,
                  uint32_t *exit_flag) {
     doca_error_t result;
@@ -195,10 +210,17 @@ kernel_progress (struct docaXferCompletion *completion_list,
     struct doca_gpu_dev_rdma_r *rdma_gpu_r;
 
     // Warmup
-    if (completion_list == nullptr) return;
+    if (completion_list_all == nullptr) return;
 
-    // Wait Xfer & notify
-    if (blockIdx.x == 0) {
+    // The service blocks below are single-threaded polling loops; the extra
+    // threads launched for the persistent-kernel poster blocks stay out
+    if (blockIdx.x < num_shards + 2 && threadIdx.x != 0) return;
+
+    // Wait Xfer & notify: one block per stream shard, so completions on one
+    // stream never wait behind an earlier post from another stream
+    if (blockIdx.x < num_shards) {
+        struct docaXferCompletion *completion_list =
+                completion_list_all + (blockIdx.x * DOCA_MAX_COMPLETION_INFLIGHT);
         while (DOCA_GPUNETIO_VOLATILE (*exit_flag) == 0) {
             // Check xfer completion and send notif
             if (DOCA_GPUNETIO_VOLATILE (completion_list[index].xferReqRingGpu) != nullptr) {
@@ -256,6 +278,9 @@ kernel_progress (struct docaXferCompletion *completion_list,
                             printf ("Notif correctly sent %d\n", num_msg_notif);
 #endif
                         }
+                        completion_list[index].xferReqRingGpu->dev_comp_ns = globaltimer_ns();
+                        // Stamp must be visible before the completion flag
+                        asm volatile("fence.release.sys;");
                         DOCA_GPUNETIO_VOLATILE (completion_list[index].completed) = 1;
                         num_msg--;
                         index = (index + 1) & DOCA_MAX_COMPLETION_INFLIGHT_MASK;
@@ -265,12 +290,18 @@ kernel_progress (struct docaXferCompletion *completion_list,
         }
     }
 
-    // Receive notif: fill recv in new queue and progress queue
-    if (blockIdx.x == 1) {
+    // Receive notif: autonomous sweep of every registered QP into the
+    // GPU-visible event ring, plus the initial recv fill for new QPs
+    if (blockIdx.x == num_shards) {
+        uint64_t head = DOCA_GPUNETIO_VOLATILE (notif_ring->head);
         while (DOCA_GPUNETIO_VOLATILE (*exit_flag) == 0) {
-            // Check received notifications
-            if (DOCA_GPUNETIO_VOLATILE (notif_progress->rdma_qp) != nullptr) {
-                doca_gpu_dev_rdma_get_recv (notif_progress->rdma_qp, &rdma_gpu_r);
+            uint32_t num_qps = DOCA_GPUNETIO_VOLATILE (notif_ring->num_qps);
+            for (uint32_t qp_idx = 0; qp_idx < num_qps; qp_idx++) {
+                // Ring full: leave the CQEs in place for a later sweep
+                if (head - DOCA_GPUNETIO_VOLATILE (notif_ring->tail) >= DOCA_NOTIF_RING_SIZE)
+                    break;
+
+                doca_gpu_dev_rdma_get_recv (notif_ring->qps[qp_idx], &rdma_gpu_r);
                 result = doca_gpu_dev_rdma_recv_wait_all (
                         rdma_gpu_r, DOCA_GPU_RDMA_RECV_WAIT_FLAG_NB, &num_msg, nullptr, nullptr);
                 if (result != DOCA_SUCCESS) {
@@ -278,16 +309,21 @@ kernel_progress (struct docaXferCompletion *completion_list,
                     DOCA_GPUNETIO_VOLATILE (*exit_flag) = 1;
                 }
 
+                if (num_msg == 0) continue;
+
 #if ENABLE_DEBUG == 1
-                if (num_msg > 0) {
-                    printf ("kernel received %d notifications\n", num_msg);
-                }
+                printf ("kernel received %d notifications from qp %d\n", num_msg, qp_idx);
 #endif
 
+                // Recycle the consumed recv buffers right away
                 doca_gpu_dev_rdma_recv_commit_weak (rdma_gpu_r, num_msg);
-                DOCA_GPUNETIO_VOLATILE (notif_progress->num_msg) = num_msg;
+
+                notif_ring->events[head & DOCA_NOTIF_RING_MASK].qp_idx = qp_idx;
+                notif_ring->events[head & DOCA_NOTIF_RING_MASK].num_msg = num_msg;
+                // Event contents must be visible before the head moves
                 asm volatile("fence.release.sys;");
-                DOCA_GPUNETIO_VOLATILE (notif_progress->rdma_qp) = nullptr;
+                head++;
+                DOCA_GPUNETIO_VOLATILE (notif_ring->head) = head;
             }
 
             if (DOCA_GPUNETIO_VOLATILE (notif_fill->rdma_qp) != nullptr) {
@@ -314,7 +350,7 @@ kernel_progress (struct docaXferCompletion *completion_list,
     }
 
     // Send standalone notifications
-    if (blockIdx.x == 2) {
+    if (blockIdx.x == num_shards + 1) {
         while (DOCA_GPUNETIO_VOLATILE (*exit_flag) == 0) {
             if (DOCA_GPUNETIO_VOLATILE (notif_send_gpu->rdma_qp) != nullptr) {
 #if ENABLE_DEBUG == 1
@@ -351,6 +387,82 @@ kernel_progress (struct docaXferCompletion *completion_list,
             }
         }
     }
+
+    // Persistent-kernel mode: one full block per stream shard walks its
+    // xfer ring slice in sequence order and issues the RDMA work when the
+    // CPU rings the slot's post_op doorbell, so a post is one host store
+    // instead of a kernel launch
+    if (xfer_ring_all != nullptr && blockIdx.x >= num_shards + 2) {
+        struct docaXferReqGpu *xferReqRing =
+                xfer_ring_all + ((blockIdx.x - (num_shards + 2)) * DOCA_XFER_REQ_MAX);
+        struct doca_gpu_buf *lbuf;
+        struct doca_gpu_buf *rbuf;
+        __shared__ uint32_t s_op;
+        __shared__ uint32_t base_position;
+        uint32_t pos = 0;
+
+        while (true) {
+            if (threadIdx.x == 0) {
+                s_op = DOCA_XFER_POST_NONE;
+                while (DOCA_GPUNETIO_VOLATILE (*exit_flag) == 0) {
+                    uint8_t op = DOCA_GPUNETIO_VOLATILE (xferReqRing[pos].post_op);
+                    if (op != DOCA_XFER_POST_NONE) {
+                        s_op = op;
+                        break;
+                    }
+                }
+                if (s_op != DOCA_XFER_POST_NONE) {
+                    // The doorbell is stored after the entry contents
+                    asm volatile("fence.acquire.sys;");
+                    base_position = reserve_position (xferReqRing, pos);
+                }
+            }
+            __syncthreads();
+
+            if (s_op == DOCA_XFER_POST_NONE) break;
+
+            if (threadIdx.x < xferReqRing[pos].num) {
+                doca_gpu_dev_buf_get_buf (
+                        (struct doca_gpu_buf_arr *)xferReqRing[pos].larr[threadIdx.x], 0, &lbuf);
+                doca_gpu_dev_buf_get_buf (
+                        (struct doca_gpu_buf_arr *)xferReqRing[pos].rarr[threadIdx.x], 0, &rbuf);
+
+                if (s_op == DOCA_XFER_POST_READ)
+                    result = doca_gpu_dev_rdma_read_weak (xferReqRing[pos].rdma_gpu_data,
+                                                          0,
+                                                          rbuf,
+                                                          0,
+                                                          lbuf,
+                                                          0,
+                                                          xferReqRing[pos].size[threadIdx.x],
+                                                          xferReqRing[pos].conn_idx,
+                                                          (base_position + threadIdx.x) & 0xFFFF);
+                else
+                    result = doca_gpu_dev_rdma_write_weak (xferReqRing[pos].rdma_gpu_data,
+                                                           0,
+                                                           rbuf,
+                                                           0,
+                                                           lbuf,
+                                                           0,
+                                                           xferReqRing[pos].size[threadIdx.x],
+                                                           xferReqRing[pos].conn_idx,
+                                                           DOCA_GPU_RDMA_WRITE_FLAG_NONE,
+                                                           (base_position + threadIdx.x) & 0xFFFF);
+                if (result != DOCA_SUCCESS)
+                    printf ("Error %d persistent poster rdma weak op\n", result);
+            }
+            __syncthreads();
+
+            if (threadIdx.x == 0) {
+                wait_post (xferReqRing[pos].rdma_gpu_data, xferReqRing, pos);
+                DOCA_GPUNETIO_VOLATILE (xferReqRing[pos].in_use) = 1;
+                DOCA_GPUNETIO_VOLATILE (xferReqRing[pos].post_op) = DOCA_XFER_POST_NONE;
+            }
+            __syncthreads();
+
+            pos = (pos + 1) & DOCA_XFER_REQ_MASK;
+        }
+    }
 }
 
 doca_error_t
@@ -420,8 +532,10 @@ doca_kernel_read (cudaStream_t stream,
 doca_error_t
 doca_kernel_progress (cudaStream_t stream,
                       struct docaXferCompletion *completion_list,
+                      uint32_t num_shards,
+                      struct docaXferReqGpu *xfer_ring,
                       struct docaNotifRecv *notif_fill,
-                      struct docaNotifRecv *notif_progress,
+                      struct docaNotifRing *notif_ring,
                       struct docaNotifSend *notif_send_gpu,
                       uint32_t *exit_flag) {
     cudaError_t result = cudaSuccess;
@@ -437,8 +551,15 @@ doca_kernel_progress (cudaStream_t stream,
         return DOCA_ERROR_BAD_STATE;
     }
 
-    kernel_progress<<<3, 1, 0, stream>>> (
-            completion_list, notif_fill, notif_progress, notif_send_gpu, exit_flag);
+    /* Poster blocks exist only in persistent-kernel mode (xfer_ring given)
+     * and need a full block to post up to DOCA_XFER_REQ_SIZE descriptors;
+     * the service blocks keep using one thread each
+     */
+    uint32_t num_blocks = num_shards + 2 + ((xfer_ring != nullptr) ? num_shards : 0);
+    uint32_t num_threads = (xfer_ring != nullptr) ? DOCA_XFER_REQ_SIZE : 1;
+    kernel_progress<<<num_blocks, num_threads, 0, stream>>> (
+            completion_list, num_shards, xfer_ring, notif_fill, notif_ring,
+            notif_send_gpu, exit_flag);
     result = cudaGetLastError();
     if (result != cudaSuccess) {
         fprintf (stderr,
@@ -56,6 +56,7 @@ get_backend_options() {
     params["network_devices"] = "";
     params["gpu_devices"] = "";
     params["cuda_streams"] = "";
+    params["persistent_kernel"] = "";
     return params;
 }
 
@@ -17,6 +17,7 @@
 #include <cassert>
 #include <cctype>
 #include <atomic>
+#include <chrono>
 #include <errno.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
@@ -25,9 +26,11 @@
 #include "hf3fs_log.h"
 #include "common/str_tools.h"
 #include "common/nixl_log.h"
+#include "cuda/staging_pool.h"
 #include "file/file_utils.h"
 
 #define NUM_CQES 1024
+#define DEFAULT_IOR_DEPTH 1024
 
 long nixlHf3fsEngine::page_size = sysconf(_SC_PAGESIZE);
 
@@ -35,6 +38,7 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
     : nixlBackendEngine(init_params),
       mem_config(NIXL_HF3FS_MEM_CONFIG_AUTO) {
     hf3fs_utils = new hf3fsUtil();
+    int ior_depth = DEFAULT_IOR_DEPTH;
 
     this->initErr = false;
     if (hf3fs_utils->openHf3fsDriver() == NIXL_ERR_BACKEND) {
@@ -45,6 +49,12 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
 
     // Get mount point from parameters if available
     std::string mount_point = "/mnt/3fs/"; // default
+    if (init_params) {
+        // Non-null when the backend was created with staging_pool=1;
+        // usrbio IOVs are host shared memory, so VRAM descriptors bounce
+        // through the pool's pinned buffers instead of being rejected
+        staging_pool = init_params->stagingPool;
+    }
     if (init_params && init_params->customParams) {
         if (init_params->customParams->count("mount_point") > 0) {
             mount_point = init_params->customParams->at("mount_point");
@@ -61,6 +71,9 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
                 return;
             }
         }
+        if (init_params->customParams->count("ior_depth") > 0) {
+            ior_depth = std::stoi(init_params->customParams->at("ior_depth"));
+        }
     }
 
     char mount_point_cstr[256];
@@ -72,7 +85,33 @@ nixlHf3fsEngine::nixlHf3fsEngine(const nixlBackendInitParams *init_params)
 
     hf3fs_utils->mount_point = mount_point_cstr;
 
-    NIXL_DEBUG << "HF3FS: Page size: " << page_size;
+    // Persistent rings shared by all requests, so per-request submissions
+    // batch into one hf3fs_submit and completions are reaped by a single
+    // thread instead of one thread per request
+    read_ior = new hf3fs_ior();
+    if (hf3fs_utils->createIOR(read_ior, ior_depth, true) != NIXL_SUCCESS) {
+        NIXL_ERROR << "Error creating shared read IOR";
+        delete read_ior;
+        read_ior = nullptr;
+        this->initErr = true;
+        return;
+    }
+    write_ior = new hf3fs_ior();
+    if (hf3fs_utils->createIOR(write_ior, ior_depth, false) != NIXL_SUCCESS) {
+        NIXL_ERROR << "Error creating shared write IOR";
+        hf3fs_utils->destroyIOR(read_ior);
+        delete read_ior;
+        read_ior = nullptr;
+        delete write_ior;
+        write_ior = nullptr;
+        this->initErr = true;
+        return;
+    }
+
+    poller_thread = std::thread(&nixlHf3fsEngine::completionThread, this);
+
+    NIXL_DEBUG << "HF3FS: Page size: " << page_size
+               << " IOR depth: " << ior_depth;
 }
 
 
@@ -115,6 +154,17 @@ nixl_status_t nixlHf3fsEngine::registerMem (const nixlBlobDesc &mem,
                    << ", len: " << mem.len << ")";
         break;
     }
+    case VRAM_SEG: {
+        if (staging_pool == nullptr) {
+            HF3FS_LOG_RETURN(NIXL_ERR_NOT_SUPPORTED,
+                             "Error: VRAM registration requires the staging pool "
+                             "(create the backend with staging_pool=1)");
+        }
+        out = new nixlHf3fsVramMetadata();
+        NIXL_DEBUG << "HF3FS: Registered VRAM memory(addr: " << std::hex << mem.addr
+                   << ", len: " << mem.len << ")";
+        break;
+    }
     case FILE_SEG: {
         int fd = mem.devId;
 
@@ -151,7 +201,8 @@ nixl_status_t nixlHf3fsEngine::deregisterMem (nixlBackendMD* meta)
         nixlHf3fsFileMetadata *file_md = (nixlHf3fsFileMetadata *)md;
         hf3fs_file_set.erase(file_md->handle.fd);
         hf3fs_utils->deregisterFileHandle(file_md->handle.fd);
-    } else if (md->type != NIXL_HF3FS_MEM_TYPE_DRAM && md->type != NIXL_HF3FS_MEM_TYPE_DRAM_ZC) {
+    } else if (md->type != NIXL_HF3FS_MEM_TYPE_DRAM && md->type != NIXL_HF3FS_MEM_TYPE_DRAM_ZC &&
+               md->type != NIXL_HF3FS_MEM_TYPE_VRAM) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND, "Error - invalid metadata type");
     }
     delete md;
@@ -161,7 +212,8 @@ nixl_status_t nixlHf3fsEngine::deregisterMem (nixlBackendMD* meta)
 void nixlHf3fsEngine::cleanupIOList(nixlHf3fsBackendReqH *handle) const
 {
     for (auto prev_io : handle->io_list) {
-        if (prev_io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) {
+        if (prev_io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM ||
+            prev_io->mem_type == NIXL_HF3FS_MEM_TYPE_VRAM) {
             hf3fs_utils->destroyIOV(&prev_io->iov);
         }
         delete prev_io;
@@ -170,20 +222,6 @@ void nixlHf3fsEngine::cleanupIOList(nixlHf3fsBackendReqH *handle) const
     handle->io_list.clear();
 }
 
-void nixlHf3fsEngine::cleanupIOThread(nixlHf3fsBackendReqH *handle) const
-{
-    if (handle->io_status.thread != nullptr) {
-        handle->io_status.stop_thread = true;
-        handle->io_status.thread->join();
-
-        delete handle->io_status.thread;
-        handle->io_status.thread = nullptr;
-        handle->io_status.error_status = NIXL_SUCCESS;
-        handle->io_status.error_message = "";
-        handle->io_status.stop_thread = false;
-    }
-}
-
 nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
                                          const nixl_meta_dlist_t &local,
                                          const nixl_meta_dlist_t &remote,
@@ -222,12 +260,7 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
     hf3fs_handle = new nixlHf3fsBackendReqH();
 
     bool is_read = (operation == NIXL_READ);
-
-    auto status = hf3fs_utils->createIOR(&hf3fs_handle->ior, file_cnt, is_read);
-    if (status != NIXL_SUCCESS) {
-        delete hf3fs_handle;
-        HF3FS_LOG_RETURN(status, "Error: Failed to create IOR");
-    }
+    nixl_status_t status;
 
     for (int i = 0; i < file_cnt; i++) {
         // Get file descriptor from the proper list
@@ -271,7 +304,20 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
             // TODO: Should the data copy in postXfer? User could still modify the data after
             // prepXfer
             if (!is_read) {
-                memcpy(io->iov.base, addr, size);
+                if (mem_md->type == NIXL_HF3FS_MEM_TYPE_VRAM) {
+                    // Drain device memory into the IOV through the pinned
+                    // staging pool; the IOV itself is host shared memory
+                    status = staging_pool->copyFromDev(io->iov.base, addr, size);
+                    if (status != NIXL_SUCCESS) {
+                        hf3fs_utils->destroyIOV(&io->iov);
+                        delete io;
+                        nixl_err = status;
+                        nixl_mesg = "Error: Failed to stage VRAM into IOV";
+                        goto cleanup_handle;
+                    }
+                } else {
+                    memcpy(io->iov.base, addr, size);
+                }
             }
         }
         // Store original memory address for later use during READ operations
@@ -280,6 +326,7 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
         io->is_read = is_read;
         io->offset = offset;
         io->mem_type = mem_md->type;
+        io->req = hf3fs_handle;
 
         io->fd = file_descriptor;
         hf3fs_handle->io_list.push_back(io);
@@ -312,87 +359,136 @@ nixl_status_t nixlHf3fsEngine::postXfer (const nixl_xfer_op_t &operation,
     if (UINT_MAX - hf3fs_handle->num_ios < hf3fs_handle->io_list.size()) {
         HF3FS_LOG_RETURN(NIXL_ERR_NOT_ALLOWED, "Error: more than UINT_MAX ios");
     }
-    for (auto it = hf3fs_handle->io_list.begin(); it != hf3fs_handle->io_list.end(); ++it) {
-        nixlHf3fsIO* io = *it;
-        void *addr = (io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) ? io->iov.base : io->addr;
 
-        status = hf3fs_utils->prepIO(
-            &hf3fs_handle->ior, &io->iov, addr, io->offset, io->size, io->fd, io->is_read, io);
-        if (status != NIXL_SUCCESS) {
-            HF3FS_LOG_RETURN(status, "Error: Failed to prepare IO");
+    bool is_read = hf3fs_handle->io_list.front()->is_read;
+    hf3fs_ior *ior = is_read ? read_ior : write_ior;
+
+    // Prep the whole request into the shared ring and submit it with one
+    // hf3fs_submit call; prepped entries stay in the shared ring on a
+    // mid-batch prep or post failure (a later submit flushes them), so
+    // the count is credited before returning the error and releaseReqH
+    // waits for them to drain instead of freeing IOs the completion
+    // thread will still touch
+    uint32_t prepped = 0;
+    nixl_status_t prep_err = NIXL_SUCCESS;
+    nixl_status_t post_err = NIXL_SUCCESS;
+    {
+        std::lock_guard<std::mutex> lock(submit_lock);
+        for (auto it = hf3fs_handle->io_list.begin(); it != hf3fs_handle->io_list.end(); ++it) {
+            nixlHf3fsIO* io = *it;
+            void *addr = (io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM ||
+                          io->mem_type == NIXL_HF3FS_MEM_TYPE_VRAM) ?
+                io->iov.base :
+                io->addr;
+
+            status = hf3fs_utils->prepIO(
+                ior, &io->iov, addr, io->offset, io->size, io->fd, io->is_read, io);
+            if (status != NIXL_SUCCESS) {
+                prep_err = status;
+                break;
+            }
+            prepped++;
+        }
+
+        if (prepped > 0) {
+            status = hf3fs_utils->postIOR(ior);
+            if (status != NIXL_SUCCESS)
+                post_err = status;
         }
     }
 
-    status = hf3fs_utils->postIOR(&hf3fs_handle->ior);
-    if (status != NIXL_SUCCESS) {
-        HF3FS_LOG_RETURN(status, "Error: Failed to post IOR");
+    if (prepped > 0) {
+        hf3fs_handle->num_ios += prepped;
+        if (is_read)
+            inflight_reads += prepped;
+        else
+            inflight_writes += prepped;
+        poller_cv.notify_one();
     }
 
-    // postXfer may be called multiple times, so we need to check if the thread is already running
-    if (hf3fs_handle->io_status.thread == nullptr) {
-        hf3fs_handle->io_status.thread = new std::thread(waitForIOsThread, hf3fs_handle,
-                                                         hf3fs_utils);
-        if (hf3fs_handle->io_status.thread == nullptr) {
-            HF3FS_LOG_RETURN(NIXL_ERR_BACKEND, "Error: Failed to create io thread");
-        }
+    if (post_err != NIXL_SUCCESS) {
+        HF3FS_LOG_RETURN(post_err, "Error: Failed to post IOR");
     }
 
-    hf3fs_handle->num_ios += hf3fs_handle->io_list.size();
+    if (prep_err != NIXL_SUCCESS) {
+        HF3FS_LOG_RETURN(prep_err, "Error: Failed to prepare IO");
+    }
 
     return NIXL_IN_PROG;
 }
 
-void nixlHf3fsEngine::waitForIOsThread(void* handle, void *utils)
+void nixlHf3fsEngine::reapCompletions(hf3fs_ior *ior,
+                                      std::atomic<uint32_t> &inflight,
+                                      hf3fs_cqe *cqes)
 {
-    nixlHf3fsBackendReqH* hf3fs_handle = (nixlHf3fsBackendReqH*)handle;
-    hf3fsUtil* hf3fs_utils = (hf3fsUtil*)utils;
-    nixlH3fsThreadStatus* io_status = &hf3fs_handle->io_status;
-    hf3fs_cqe* cqes = new hf3fs_cqe[NUM_CQES];
+    // Use a short timeout so the thread keeps checking the stop condition
+    // and the other ring
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    ts.tv_nsec += 10 * 1000 * 1000; // 10 milliseconds
+    if (ts.tv_nsec >= 1000000000) {
+        ts.tv_sec += 1;
+        ts.tv_nsec -= 1000000000;
+    }
 
-    while (!io_status->stop_thread && io_status->error_status == NIXL_SUCCESS) {
-        // Check if we've processed all IOs
-        if (hf3fs_handle->completed_ios >= hf3fs_handle->num_ios) {
-            // User may call postXfer multiple times, so we could not exit yet,
-            // so we must wait for stop condition
-            sched_yield();
-            continue;
-        }
+    int num_completed = 0;
+    nixl_status_t status = hf3fs_utils->waitForIOs(ior, cqes, NUM_CQES, 1, &ts,
+                                                   &num_completed);
+    if (status != NIXL_SUCCESS) {
+        NIXL_ERROR << "HF3FS: Failed to wait for IOs on shared ring";
+        return;
+    }
 
-        // Use a short timeout to allow thread to check stop condition
-        struct timespec ts;
-        clock_gettime(CLOCK_MONOTONIC, &ts);
-        ts.tv_nsec += 10 * 1000 * 1000; // 10 milliseconds
-        if (ts.tv_nsec >= 1000000000) {
-            ts.tv_sec += 1;
-            ts.tv_nsec -= 1000000000;
-        }
+    if (num_completed <= 0) {
+        return;
+    }
 
-        int num_completed = 0;
-        nixl_status_t status = hf3fs_utils->waitForIOs(&hf3fs_handle->ior, cqes, NUM_CQES, 1, &ts,
-                                                       &num_completed);
-        if (status != NIXL_SUCCESS) {
-            io_status->error_status = status;
-            io_status->error_message = "Error: Failed to wait for IOs";
-            break;
+    for (int i = 0; i < num_completed; i++) {
+        nixlHf3fsIO* io = (nixlHf3fsIO*)cqes[i].userdata;
+        nixlHf3fsBackendReqH* req = io->req;
+
+        if (cqes[i].result < 0) {
+            req->error_message = absl::StrFormat(
+                "Error: I/O operation completed with error: %d", cqes[i].result);
+            req->error_status.store(NIXL_ERR_BACKEND, std::memory_order_release);
+        } else if (io->is_read && io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) {
+            memcpy(io->addr, io->iov.base, io->size);
+        } else if (io->is_read && io->mem_type == NIXL_HF3FS_MEM_TYPE_VRAM) {
+            // Read landed in the IOV; fill the device buffer through the
+            // pinned staging pool before crediting the completion
+            nixl_status_t copy_status =
+                staging_pool->copyToDev(io->addr, io->iov.base, io->size);
+            if (copy_status != NIXL_SUCCESS) {
+                req->error_message = "Error: Failed to stage IOV into VRAM";
+                req->error_status.store(copy_status, std::memory_order_release);
+            }
         }
 
-        if (num_completed > 0) {
-            for (int i = 0; i < num_completed; i++) {
-                if (cqes[i].result < 0) {
-                    io_status->error_status = NIXL_ERR_BACKEND;
-                    io_status->error_message = absl::StrFormat(
-                        "Error: I/O operation completed with error: %d", cqes[i].result);
-                    break;
-                }
+        // Failed IOs are counted too, so completed_ios always converges to
+        // num_ios and releaseReqH can wait on it
+        req->completed_ios++;
+    }
 
-                nixlHf3fsIO* io = (nixlHf3fsIO*)cqes[i].userdata;
-                if (io->is_read && io->mem_type == NIXL_HF3FS_MEM_TYPE_DRAM) {
-                    memcpy(io->addr, io->iov.base, io->size);
-                }
+    inflight -= num_completed;
+}
 
-                hf3fs_handle->completed_ios++;
-            }
+void nixlHf3fsEngine::completionThread()
+{
+    hf3fs_cqe* cqes = new hf3fs_cqe[NUM_CQES];
+
+    while (!poller_stop) {
+        if (inflight_reads == 0 && inflight_writes == 0) {
+            // Nothing in flight; sleep until postXfer submits work. The
+            // timeout covers a submit racing with the wait.
+            std::unique_lock<std::mutex> lock(poller_lock);
+            poller_cv.wait_for(lock, std::chrono::milliseconds(10));
+            continue;
         }
+
+        if (inflight_reads > 0)
+            reapCompletions(read_ior, inflight_reads, cqes);
+        if (inflight_writes > 0)
+            reapCompletions(write_ior, inflight_writes, cqes);
     }
 
     delete[] cqes;
@@ -406,29 +502,17 @@ nixl_status_t nixlHf3fsEngine::checkXfer(nixlBackendReqH* handle) const
 
     nixlHf3fsBackendReqH *hf3fs_handle = (nixlHf3fsBackendReqH *) handle;
 
-    // Check if IOR is initialized
-    if (&hf3fs_handle->ior == nullptr) {
-        HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
-            "Error: IOR is not initialized in checkXfer");
-    }
-
-    if (hf3fs_handle->io_status.thread == nullptr) {
-        HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
-            "Error: io thread is not initialized in checkXfer");
-    }
-
-    if (hf3fs_handle->io_status.error_status != NIXL_SUCCESS) {
-        nixl_status_t error_status = hf3fs_handle->io_status.error_status;
-        std::string error_message = hf3fs_handle->io_status.error_message;
-        cleanupIOThread(hf3fs_handle);
-        HF3FS_LOG_RETURN(error_status, error_message);
+    nixl_status_t error_status =
+        hf3fs_handle->error_status.load(std::memory_order_acquire);
+    if (error_status != NIXL_SUCCESS) {
+        HF3FS_LOG_RETURN(error_status, hf3fs_handle->error_message);
     }
 
-    if (hf3fs_handle->completed_ios < hf3fs_handle->num_ios) {
+    if (hf3fs_handle->completed_ios.load(std::memory_order_acquire) <
+        hf3fs_handle->num_ios) {
         return NIXL_IN_PROG;
     }
 
-    cleanupIOThread(hf3fs_handle);
     return NIXL_SUCCESS;
 }
 
@@ -436,14 +520,35 @@ nixl_status_t nixlHf3fsEngine::releaseReqH(nixlBackendReqH* handle) const
 {
     nixlHf3fsBackendReqH *hf3fs_handle = (nixlHf3fsBackendReqH *) handle;
 
-    cleanupIOThread(hf3fs_handle);
+    // Outstanding IOs of this request still sit in the shared rings and
+    // reference its IO objects; wait for the completion thread to drain
+    // them before freeing (failed IOs are counted as completed as well)
+    while (hf3fs_handle->completed_ios.load(std::memory_order_acquire) <
+           hf3fs_handle->num_ios) {
+        sched_yield();
+    }
+
     cleanupIOList(hf3fs_handle);
-    hf3fs_utils->destroyIOR(&hf3fs_handle->ior);
     delete hf3fs_handle;
     return NIXL_SUCCESS;
 }
 
 nixlHf3fsEngine::~nixlHf3fsEngine() {
+    if (poller_thread.joinable()) {
+        poller_stop = true;
+        poller_cv.notify_one();
+        poller_thread.join();
+    }
+
+    if (read_ior) {
+        hf3fs_utils->destroyIOR(read_ior);
+        delete read_ior;
+    }
+    if (write_ior) {
+        hf3fs_utils->destroyIOR(write_ior);
+        delete write_ior;
+    }
+
     hf3fs_utils->closeHf3fsDriver();
     delete hf3fs_utils;
 }
@@ -23,7 +23,10 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include "common/uuid_v4.h"
+#include <atomic>
+#include <condition_variable>
 #include <list>
+#include <mutex>
 #include <unordered_set>
 #include <thread>
 #include "hf3fs_utils.h"
@@ -38,6 +41,7 @@ enum nixl_hf3fs_mem_type {
     NIXL_HF3FS_MEM_TYPE_FILE = 0,
     NIXL_HF3FS_MEM_TYPE_DRAM = 1,
     NIXL_HF3FS_MEM_TYPE_DRAM_ZC = 2,
+    NIXL_HF3FS_MEM_TYPE_VRAM = 3,
 };
 
 enum nixl_hf3fs_mem_config {
@@ -65,6 +69,15 @@ public:
     nixlHf3fsDramMetadata() : nixlHf3fsMetadata(NIXL_HF3FS_MEM_TYPE_DRAM) {}
 };
 
+// VRAM registrations ride the same IOV bounce path as plain DRAM; the
+// device<->IOV copies go through the agent's pinned staging pool (usrbio
+// has no GPU-registered buffer support), so the backend only accepts
+// VRAM when the pool was requested at creation time (staging_pool=1)
+class nixlHf3fsVramMetadata : public nixlHf3fsMetadata {
+public:
+    nixlHf3fsVramMetadata() : nixlHf3fsMetadata(NIXL_HF3FS_MEM_TYPE_VRAM) {}
+};
+
 class nixlHf3fsDramZCMetadata : public nixlHf3fsMetadata {
 public:
     std::string shm_name;
@@ -77,6 +90,8 @@ public:
     ~nixlHf3fsDramZCMetadata();
 };
 
+class nixlHf3fsBackendReqH;
+
 class nixlHf3fsIO {
     public:
         hf3fs_iov iov;
@@ -86,27 +101,23 @@ class nixlHf3fsIO {
         bool is_read = false; // Whether this is a read operation
         size_t offset;    // Offset in the file
         nixl_hf3fs_mem_type mem_type;
+        // Owning request, credited by the completion thread through the
+        // cqe userdata pointer
+        nixlHf3fsBackendReqH *req = nullptr;
 
         nixlHf3fsIO() = default;
 };
 
-class nixlH3fsThreadStatus {
-    public:
-        std::thread *thread = nullptr;
-        nixl_status_t error_status = NIXL_SUCCESS;
-        std::string error_message = "";
-        bool stop_thread = false;
-
-        nixlH3fsThreadStatus() = default;
-};
-
 class nixlHf3fsBackendReqH : public nixlBackendReqH {
     public:
         std::list<nixlHf3fsIO *> io_list;
-        hf3fs_ior ior;
-        uint32_t completed_ios = 0; // Number of completed IOs
+        // Completions are counted by the engine's completion thread while
+        // checkXfer reads, so the counter and error word are atomic; the
+        // error message is written before the error status is published
+        std::atomic<uint32_t> completed_ios{0}; // Number of completed IOs
         uint32_t num_ios = 0; // Number of submitted IOs
-        nixlH3fsThreadStatus io_status;
+        std::atomic<nixl_status_t> error_status{NIXL_SUCCESS};
+        std::string error_message;
 
         nixlHf3fsBackendReqH() = default;
 };
@@ -118,10 +129,33 @@ class nixlHf3fsEngine : public nixlBackendEngine {
         std::unordered_set<int> hf3fs_file_set;
         nixl_hf3fs_mem_config mem_config;
         static long page_size;
+        // Agent-owned pinned staging pool, non-null when the backend was
+        // created with staging_pool=1; enables the VRAM bounce path
+        nixlStagingPool *staging_pool = nullptr;
+
+        // Persistent submission/completion rings shared across requests
+        // (usrbio keeps reads and writes on separate rings), sized by the
+        // ior_depth custom param; prepIO fails when a ring is full, which
+        // bounds the IOs in flight per engine
+        hf3fs_ior *read_ior = nullptr;
+        hf3fs_ior *write_ior = nullptr;
+        // Serializes prepIO batches and their hf3fs_submit on the rings
+        mutable std::mutex submit_lock;
+
+        // One completion thread per engine reaps both rings and credits
+        // each request through the cqe userdata; it sleeps while nothing
+        // is in flight and is woken by postXfer
+        std::thread poller_thread;
+        std::atomic<bool> poller_stop{false};
+        mutable std::atomic<uint32_t> inflight_reads{0};
+        mutable std::atomic<uint32_t> inflight_writes{0};
+        mutable std::mutex poller_lock;
+        mutable std::condition_variable poller_cv;
 
         void cleanupIOList(nixlHf3fsBackendReqH *handle) const;
-        void cleanupIOThread(nixlHf3fsBackendReqH *handle) const;
-        static void waitForIOsThread(void* handle, void *utils);
+        void completionThread();
+        void reapCompletions(hf3fs_ior *ior, std::atomic<uint32_t> &inflight,
+                             hf3fs_cqe *cqes);
     public:
         nixlHf3fsEngine(const nixlBackendInitParams* init_params);
         ~nixlHf3fsEngine();
@@ -146,6 +180,9 @@ class nixlHf3fsEngine : public nixlBackendEngine {
             nixl_mem_list_t mems;
             mems.push_back(FILE_SEG);
             mems.push_back(DRAM_SEG);
+            if (staging_pool != nullptr) {
+                mems.push_back(VRAM_SEG);
+            }
             return mems;
         }
 
@@ -217,7 +217,13 @@ struct nixlMooncakeBackendReqH : public nixlBackendReqH {
 
     virtual ~nixlMooncakeBackendReqH() {}
     uint64_t batch_id;
+    size_t batch_capacity;
     size_t request_count;
+    // Index of the first entry checkXfer has not yet seen complete; entries
+    // below it are never polled again, so each entry costs one status query
+    // over the life of the batch instead of one per checkXfer call.
+    size_t completed_count;
+    bool has_failed;
 };
 
 nixl_status_t
@@ -250,17 +256,23 @@ nixlMooncakeEngine::postXfer(const nixl_xfer_op_t &operation,
     }
     if (local.descCount() != remote.descCount()) return NIXL_ERR_INVALID_PARAM;
 
-    const static size_t kMaxRequestCount = 1024;
+    size_t request_count = local.descCount();
     if (priv->batch_id == INVALID_BATCH) {
-        uint64_t batch_id = allocateBatchID(engine_, kMaxRequestCount);
+        // Size the batch to this post, so every descriptor goes through one
+        // batch handle no matter how large the descriptor list is.
+        uint64_t batch_id = allocateBatchID(engine_, request_count);
         if (batch_id == INVALID_BATCH) {
             return NIXL_ERR_BACKEND;
         }
         priv->batch_id = batch_id;
+        priv->batch_capacity = request_count;
         priv->request_count = 0;
+        priv->completed_count = 0;
+        priv->has_failed = false;
+    } else if (priv->request_count + request_count > priv->batch_capacity) {
+        return NIXL_ERR_BACKEND;
     }
 
-    size_t request_count = local.descCount();
     transfer_request_t *request = new transfer_request_t[request_count];
     for (size_t index = 0; index < request_count; ++index) {
         if (local[index].len != remote[index].len) return NIXL_ERR_INVALID_PARAM;
@@ -271,7 +283,7 @@ nixlMooncakeEngine::postXfer(const nixl_xfer_op_t &operation,
         request[index].target_id = segment_id;
     }
     int rc = 0;
-    if (opt_args->hasNotif) {
+    if (opt_args && opt_args->hasNotif) {
         notify_msg_t notify_msg;
         notify_msg.name = const_cast<char *>(local_agent_name_.c_str());
         notify_msg.msg = const_cast<char *>(opt_args->notifMsg.c_str());
@@ -288,23 +300,23 @@ nixlMooncakeEngine::postXfer(const nixl_xfer_op_t &operation,
 nixl_status_t
 nixlMooncakeEngine::checkXfer(nixlBackendReqH *handle) const {
     auto priv = (nixlMooncakeBackendReqH *)handle;
-    bool has_failed = false;
-    for (size_t index = 0; index < priv->request_count; ++index) {
+    while (priv->completed_count < priv->request_count) {
         transfer_status_t status;
-        int rc = getTransferStatus(engine_, priv->batch_id, index, &status);
+        int rc = getTransferStatus(engine_, priv->batch_id, priv->completed_count, &status);
         if (rc || status.status == STATUS_FAILED)
-            has_failed = true;
+            priv->has_failed = true;
         else if (status.status == STATUS_PENDING || status.status == STATUS_WAITING)
             return NIXL_IN_PROG;
+        priv->completed_count++;
     }
-    if (!has_failed) {
+    if (!priv->has_failed) {
         // Each batch_id has the batch size, and cannot process more requests
         // than the batch size. So, free the batch id here to workaround the issue
         // where the same nixlBackendReqH could be used to post multiple transfer.
         freeBatchID(engine_, priv->batch_id);
         priv->batch_id = INVALID_BATCH;
     }
-    return has_failed ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
+    return priv->has_failed ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
 }
 
 nixl_status_t
@@ -322,6 +334,7 @@ nixlMooncakeEngine::getNotifs(notif_list_t &notif_list) {
     if (notif_list.size() != 0) return NIXL_ERR_INVALID_PARAM;
     int size = 0;
     notify_msg_t *notify_msgs = getNotifsFromEngine(engine_, &size);
+    if (notify_msgs == nullptr) return size ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
     for (int i = 0; i < size; i++) {
         notif_list.push_back(std::make_pair(notify_msgs[i].name, notify_msgs[i].msg));
     }
@@ -342,5 +355,7 @@ nixlMooncakeEngine::genNotif(const std::string &remote_agent, const std::string
     notify_msg.name = const_cast<char *>(local_agent_name_.c_str());
     notify_msg.msg = const_cast<char *>(msg.c_str());
     int ret = genNotifyInEngine(engine_, segment_id, notify_msg);
-    return nixl_status_t(ret);
+    // The engine reports its own error codes; don't leak them as
+    // nixl_status_t values
+    return ret ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
 }
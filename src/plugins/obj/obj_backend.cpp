@@ -16,18 +16,26 @@
  */
 
 #include "obj_backend.h"
+#ifdef HAVE_AWS_S3_CRT
+#include "obj_s3_crt_client.h"
+#endif
 #include "common/nixl_log.h"
 #include "nixl_types.h"
 #include <absl/strings/str_format.h>
 #include <memory>
 #include <future>
 #include <optional>
+#include <stdexcept>
+#include <tuple>
 #include <vector>
 #include <chrono>
 #include <algorithm>
 
 namespace {
 
+constexpr std::size_t default_obj_part_size = 16 * 1024 * 1024;
+constexpr std::size_t default_obj_max_concurrent_parts = 16;
+
 std::size_t
 getNumThreads(nixl_b_params_t *custom_params) {
     return custom_params && custom_params->count("num_threads") > 0 ?
@@ -35,6 +43,56 @@ getNumThreads(nixl_b_params_t *custom_params) {
         std::max(1u, std::thread::hardware_concurrency() / 2);
 }
 
+std::size_t
+getPartSize(nixl_b_params_t *custom_params) {
+    return custom_params && custom_params->count("obj_part_size") > 0 ?
+        std::stoul(custom_params->at("obj_part_size")) :
+        default_obj_part_size;
+}
+
+std::size_t
+getMaxConcurrentParts(nixl_b_params_t *custom_params) {
+    return custom_params && custom_params->count("obj_max_concurrent_parts") > 0 ?
+        std::stoul(custom_params->at("obj_max_concurrent_parts")) :
+        default_obj_max_concurrent_parts;
+}
+
+bool
+getUseCrtClient(nixl_b_params_t *custom_params) {
+    if (!custom_params) return false;
+
+    auto crt_it = custom_params->find("use_crt_client");
+    if (crt_it != custom_params->end()) {
+        const std::string &value = crt_it->second;
+        if (value == "true")
+            return true;
+        else if (value == "false")
+            return false;
+        else
+            throw std::runtime_error("Invalid value for use_crt_client: '" + value +
+                                     "'. Must be 'true' or 'false'");
+    }
+
+    return false;
+}
+
+std::shared_ptr<iS3Client>
+createS3Client(nixl_b_params_t *custom_params,
+               const std::shared_ptr<asioThreadPoolExecutor> &executor) {
+    if (getUseCrtClient(custom_params)) {
+#ifdef HAVE_AWS_S3_CRT
+        // The CRT client multiplexes every request as a non-blocking state
+        // machine on its own event-loop threads, so a burst of concurrent
+        // object operations does not occupy one executor thread each
+        return std::make_shared<awsS3CrtClient>(custom_params);
+#else
+        throw std::runtime_error("use_crt_client=true requires the plugin to be built against "
+                                 "aws-cpp-sdk-s3-crt");
+#endif
+    }
+    return std::make_shared<awsS3Client>(custom_params, executor);
+}
+
 bool
 isValidPrepXferParams(const nixl_xfer_op_t &operation,
                       const nixl_meta_dlist_t &local,
@@ -117,7 +175,9 @@ public:
 nixlObjEngine::nixlObjEngine(const nixlBackendInitParams *init_params)
     : nixlBackendEngine(init_params),
       executor_(std::make_shared<asioThreadPoolExecutor>(getNumThreads(init_params->customParams))),
-      s3Client_(std::make_shared<awsS3Client>(init_params->customParams, executor_)) {
+      s3Client_(createS3Client(init_params->customParams, executor_)),
+      partSize_(getPartSize(init_params->customParams)),
+      maxConcurrentParts_(getMaxConcurrentParts(init_params->customParams)) {
     NIXL_INFO << "Object storage backend initialized with S3 client wrapper";
 }
 
@@ -126,7 +186,9 @@ nixlObjEngine::nixlObjEngine(const nixlBackendInitParams *init_params,
                              std::shared_ptr<iS3Client> s3_client)
     : nixlBackendEngine(init_params),
       executor_(std::make_shared<asioThreadPoolExecutor>(std::thread::hardware_concurrency())),
-      s3Client_(s3_client) {
+      s3Client_(s3_client),
+      partSize_(getPartSize(init_params->customParams)),
+      maxConcurrentParts_(getMaxConcurrentParts(init_params->customParams)) {
     s3Client_->setExecutor(executor_);
     NIXL_INFO << "Object storage backend initialized with injected S3 client";
 }
@@ -170,15 +232,27 @@ nixl_status_t
 nixlObjEngine::queryMem(const nixl_reg_dlist_t &descs, std::vector<nixl_query_resp_t> &resp) const {
     resp.reserve(descs.descCount());
 
-    try {
-        for (auto &desc : descs)
-            resp.emplace_back(s3Client_->checkObjectExists(desc.metaInfo) ?
-                                  nixl_query_resp_t{nixl_b_params_t{}} :
-                                  std::nullopt);
+    // Issue all HeadObject checks up front so they overlap on the connection
+    // pool, instead of paying one full round trip per key.
+    std::vector<std::future<std::pair<nixl_status_t, bool>>> futures;
+    futures.reserve(descs.descCount());
+    for (auto &desc : descs) {
+        auto result_promise = std::make_shared<std::promise<std::pair<nixl_status_t, bool>>>();
+        futures.push_back(result_promise->get_future());
+        s3Client_->checkObjectExistsAsync(desc.metaInfo,
+                                          [result_promise](nixl_status_t status, bool exists) {
+                                              result_promise->set_value({status, exists});
+                                          });
     }
-    catch (const std::runtime_error &e) {
-        NIXL_ERROR << "Failed to query memory: " << e.what();
-        return NIXL_ERR_BACKEND;
+
+    for (auto &future : futures) {
+        auto [status, exists] = future.get();
+        if (status != NIXL_SUCCESS) {
+            NIXL_ERROR << "Failed to query memory: "
+                       << nixlEnumStrings::statusStr(status);
+            return status;
+        }
+        resp.emplace_back(exists ? nixl_query_resp_t{nixl_b_params_t{}} : std::nullopt);
     }
 
     return NIXL_SUCCESS;
@@ -208,36 +282,89 @@ nixlObjEngine::postXfer(const nixl_xfer_op_t &operation,
                         const nixl_opt_b_args_t *opt_args) const {
     nixlObjBackendReqH *req_h = static_cast<nixlObjBackendReqH *>(handle);
 
-    for (int i = 0; i < local.descCount(); ++i) {
-        const auto &local_desc = local[i];
-        const auto &remote_desc = remote[i];
+    // Gather the per-descriptor operations, then coalesce runs that are
+    // contiguous both in the object (remote offset) and in local memory into
+    // a single ranged operation instead of one S3 request per descriptor.
+    struct objXferOp {
+        uint64_t devId;
+        uintptr_t dataPtr;
+        size_t dataLen;
+        size_t offset;
+    };
+    std::vector<objXferOp> ops;
+    ops.reserve(local.descCount());
+    for (int i = 0; i < local.descCount(); ++i)
+        ops.push_back({remote[i].devId,
+                       local[i].addr,
+                       local[i].len,
+                       static_cast<size_t>(remote[i].addr)});
+
+    std::sort(ops.begin(), ops.end(), [](const objXferOp &a, const objXferOp &b) {
+        return std::tie(a.devId, a.offset) < std::tie(b.devId, b.offset);
+    });
+
+    std::vector<objXferOp> coalesced;
+    coalesced.reserve(ops.size());
+    for (const auto &op : ops) {
+        if (!coalesced.empty() && coalesced.back().devId == op.devId &&
+            coalesced.back().offset + coalesced.back().dataLen == op.offset &&
+            coalesced.back().dataPtr + coalesced.back().dataLen == op.dataPtr)
+            coalesced.back().dataLen += op.dataLen;
+        else
+            coalesced.push_back(op);
+    }
 
-        auto obj_key_search = devIdToObjKey_.find(remote_desc.devId);
+    for (const auto &op : coalesced) {
+        auto obj_key_search = devIdToObjKey_.find(op.devId);
         if (obj_key_search == devIdToObjKey_.end()) {
-            NIXL_ERROR << "The object segment key " << remote_desc.devId
+            NIXL_ERROR << "The object segment key " << op.devId
                        << " is not registered with the backend";
             return NIXL_ERR_INVALID_PARAM;
         }
-
-        auto status_promise = std::make_shared<std::promise<nixl_status_t>>();
-        req_h->statusFutures_.push_back(status_promise->get_future());
-
-        uintptr_t data_ptr = local_desc.addr;
-        size_t data_len = local_desc.len;
-        size_t offset = remote_desc.addr;
+        const std::string &obj_key = obj_key_search->second;
 
         // S3 client interface signals completion via a callback, but NIXL API polls request handle
         // for the status code. Use future/promise pair to bridge the gap.
-        if (operation == NIXL_WRITE)
-            s3Client_->putObjectAsync(
-                obj_key_search->second, data_ptr, data_len, offset, [status_promise](bool success) {
-                    status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
-                });
-        else
-            s3Client_->getObjectAsync(
-                obj_key_search->second, data_ptr, data_len, offset, [status_promise](bool success) {
-                    status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
-                });
+        if (operation == NIXL_WRITE) {
+            auto status_promise = std::make_shared<std::promise<nixl_status_t>>();
+            req_h->statusFutures_.push_back(status_promise->get_future());
+            auto on_done = [status_promise](bool success) {
+                status_promise->set_value(success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
+            };
+
+            // Whole-object writes above the part size go through multipart
+            // upload; sub-object writes keep the single-shot path, as plain
+            // S3 PutObject cannot update a byte range anyway
+            if (partSize_ != 0 && op.offset == 0 && op.dataLen > partSize_)
+                s3Client_->putObjectMultipartAsync(
+                    obj_key, op.dataPtr, op.dataLen, partSize_, maxConcurrentParts_, on_done);
+            else
+                s3Client_->putObjectAsync(obj_key, op.dataPtr, op.dataLen, op.offset, on_done);
+        } else {
+            // Large reads split into part-size chunks fetched as parallel
+            // ranged GETs; their concurrency is bounded by the executor pool
+            size_t num_chunks = (partSize_ != 0 && op.dataLen > partSize_) ?
+                (op.dataLen + partSize_ - 1) / partSize_ :
+                1;
+            size_t chunk_size = num_chunks > 1 ? partSize_ : op.dataLen;
+
+            for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+                size_t chunk_offset = chunk * chunk_size;
+                size_t chunk_len = std::min(chunk_size, op.dataLen - chunk_offset);
+
+                auto status_promise = std::make_shared<std::promise<nixl_status_t>>();
+                req_h->statusFutures_.push_back(status_promise->get_future());
+
+                s3Client_->getObjectAsync(obj_key,
+                                          op.dataPtr + chunk_offset,
+                                          chunk_len,
+                                          op.offset + chunk_offset,
+                                          [status_promise](bool success) {
+                                              status_promise->set_value(success ? NIXL_SUCCESS :
+                                                                                  NIXL_ERR_BACKEND);
+                                          });
+            }
+        }
     }
 
     return NIXL_IN_PROG;
@@ -111,6 +111,11 @@ private:
     std::shared_ptr<asioThreadPoolExecutor> executor_;
     std::shared_ptr<iS3Client> s3Client_;
     std::unordered_map<uint64_t, std::string> devIdToObjKey_;
+    // Transfers larger than partSize_ split into parallel multipart parts
+    // (writes) or ranged GETs (reads); 0 disables splitting. At most
+    // maxConcurrentParts_ part uploads stay in flight per object.
+    size_t partSize_;
+    size_t maxConcurrentParts_;
 };
 
 #endif // OBJ_BACKEND_H
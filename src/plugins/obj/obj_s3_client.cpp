@@ -16,16 +16,29 @@
  */
 
 #include "obj_s3_client.h"
+#include <algorithm>
+#include <atomic>
+#include <future>
 #include <optional>
 #include <string>
 #include <stdexcept>
 #include <cstdlib>
+#include <vector>
 #include <aws/s3/model/PutObjectRequest.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/PutObjectResult.h>
 #include <aws/s3/model/GetObjectResult.h>
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <aws/s3/model/HeadObjectResult.h>
+#include <aws/s3/model/HeadBucketRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompletedMultipartUpload.h>
+#include <aws/s3/model/CompletedPart.h>
+#include <aws/s3/model/ChecksumAlgorithm.h>
+#include <aws/s3/model/ChecksumMode.h>
 #include <aws/core/http/Scheme.h>
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/auth/AWSCredentials.h>
@@ -36,13 +49,10 @@
 #include <absl/strings/str_format.h>
 #include "nixl_types.h"
 
-namespace {
-
-Aws::Client::ClientConfiguration
-createClientConfiguration(nixl_b_params_t *custom_params) {
-    Aws::Client::ClientConfiguration config;
-
-    if (!custom_params) return config;
+void
+applyCommonClientConfiguration(nixl_b_params_t *custom_params,
+                               Aws::Client::ClientConfiguration &config) {
+    if (!custom_params) return;
 
     auto endpoint_override_it = custom_params->find("endpoint_override");
     if (endpoint_override_it != custom_params->end())
@@ -61,6 +71,22 @@ createClientConfiguration(nixl_b_params_t *custom_params) {
     auto region_it = custom_params->find("region");
     if (region_it != custom_params->end()) config.region = region_it->second;
 
+    auto max_connections_it = custom_params->find("max_connections");
+    if (max_connections_it != custom_params->end())
+        config.maxConnections = std::stoul(max_connections_it->second);
+
+    auto tcp_keepalive_it = custom_params->find("enable_tcp_keepalive");
+    if (tcp_keepalive_it != custom_params->end()) {
+        const std::string &value = tcp_keepalive_it->second;
+        if (value == "true")
+            config.enableTcpKeepAlive = true;
+        else if (value == "false")
+            config.enableTcpKeepAlive = false;
+        else
+            throw std::runtime_error("Invalid value for enable_tcp_keepalive: '" + value +
+                                     "'. Must be 'true' or 'false'");
+    }
+
     auto req_checksum_it = custom_params->find("req_checksum");
     if (req_checksum_it != custom_params->end()) {
         if (req_checksum_it->second == "required")
@@ -73,8 +99,6 @@ createClientConfiguration(nixl_b_params_t *custom_params) {
             throw std::runtime_error("Invalid value for req_checksum: '" + req_checksum_it->second +
                                      "'. Must be 'required' or 'supported'");
     }
-
-    return config;
 }
 
 std::optional<Aws::Auth::AWSCredentials>
@@ -118,6 +142,25 @@ getUseVirtualAddressing(nixl_b_params_t *custom_params) {
     return false;
 }
 
+bool
+getChecksumEnabled(nixl_b_params_t *custom_params) {
+    if (!custom_params) return false;
+
+    auto checksum_it = custom_params->find("checksum");
+    if (checksum_it != custom_params->end()) {
+        const std::string &value = checksum_it->second;
+        if (value == "true" || value == "crc32c")
+            return true;
+        else if (value == "false")
+            return false;
+        else
+            throw std::runtime_error("Invalid value for checksum: '" + value +
+                                     "'. Must be 'true', 'crc32c' or 'false'");
+    }
+
+    return false;
+}
+
 std::string
 getBucketName(nixl_b_params_t *custom_params) {
     if (custom_params) {
@@ -133,6 +176,140 @@ getBucketName(nixl_b_params_t *custom_params) {
                              "set AWS_DEFAULT_BUCKET environment variable");
 }
 
+namespace {
+
+std::size_t
+getPrewarmConnections(nixl_b_params_t *custom_params) {
+    if (!custom_params) return 0;
+
+    auto prewarm_it = custom_params->find("prewarm_connections");
+    if (prewarm_it != custom_params->end()) return std::stoul(prewarm_it->second);
+
+    return 0;
+}
+
+// Shared state of one in-flight multipart upload. A window of at most
+// max_parallel part uploads is kept in flight; each part completion either
+// starts the next pending part or, when it is the last outstanding one,
+// completes (or aborts) the upload and fires the user callback exactly once.
+struct multipartUploadState {
+    Aws::S3::S3Client *client;
+    Aws::String bucket;
+    Aws::String key;
+    Aws::String uploadId;
+    uintptr_t dataPtr;
+    size_t partSize;
+    size_t numParts;
+    size_t dataLen;
+    size_t maxParallel;
+    bool checksum;
+    std::atomic<size_t> nextPart{0};
+    std::atomic<size_t> inflight{0};
+    std::atomic<bool> failed{false};
+    // Indexed by part; distinct slots are written by distinct part handlers,
+    // and all writes are ordered before the final read by the inflight counter.
+    // With checksums enabled each part's CRC32C rides along with its ETag,
+    // as CompleteMultipartUpload must echo both back.
+    std::vector<Aws::String> etags;
+    std::vector<Aws::String> checksums;
+    put_object_callback_t callback;
+};
+
+void
+submitPart(const std::shared_ptr<multipartUploadState> &state, size_t part);
+
+void
+finishMultipartUpload(const std::shared_ptr<multipartUploadState> &state) {
+    if (state->failed.load()) {
+        Aws::S3::Model::AbortMultipartUploadRequest abort_request;
+        abort_request.WithBucket(state->bucket).WithKey(state->key).WithUploadId(state->uploadId);
+        state->client->AbortMultipartUpload(abort_request);
+        state->callback(false);
+        return;
+    }
+
+    Aws::S3::Model::CompletedMultipartUpload completed_upload;
+    for (size_t part = 0; part < state->numParts; ++part) {
+        auto completed_part = Aws::S3::Model::CompletedPart()
+                                  .WithPartNumber(static_cast<int>(part + 1))
+                                  .WithETag(state->etags[part]);
+        if (state->checksum)
+            completed_part.WithChecksumCRC32C(state->checksums[part]);
+        completed_upload.AddParts(completed_part);
+    }
+
+    Aws::S3::Model::CompleteMultipartUploadRequest request;
+    request.WithBucket(state->bucket)
+        .WithKey(state->key)
+        .WithUploadId(state->uploadId)
+        .WithMultipartUpload(completed_upload);
+
+    state->client->CompleteMultipartUploadAsync(
+        request,
+        [state](const Aws::S3::S3Client *client,
+                const Aws::S3::Model::CompleteMultipartUploadRequest &req,
+                const Aws::S3::Model::CompleteMultipartUploadOutcome &outcome,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            state->callback(outcome.IsSuccess());
+        },
+        nullptr);
+}
+
+void
+onPartDone(const std::shared_ptr<multipartUploadState> &state) {
+    if (!state->failed.load()) {
+        size_t part = state->nextPart.fetch_add(1);
+        if (part < state->numParts) {
+            // Keep the window full: this slot moves on to the next part
+            submitPart(state, part);
+            return;
+        }
+    }
+
+    if (state->inflight.fetch_sub(1) == 1) finishMultipartUpload(state);
+}
+
+void
+submitPart(const std::shared_ptr<multipartUploadState> &state, size_t part) {
+    size_t part_offset = part * state->partSize;
+    size_t part_len = std::min(state->partSize, state->dataLen - part_offset);
+
+    auto preallocated_stream_buf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(
+        "UploadPartStreamBuf",
+        reinterpret_cast<unsigned char *>(state->dataPtr + part_offset),
+        part_len);
+    auto data_stream =
+        Aws::MakeShared<Aws::IOStream>("UploadPartInputStream", preallocated_stream_buf.get());
+
+    Aws::S3::Model::UploadPartRequest request;
+    request.WithBucket(state->bucket)
+        .WithKey(state->key)
+        .WithUploadId(state->uploadId)
+        .WithPartNumber(static_cast<int>(part + 1))
+        .WithContentLength(static_cast<long long>(part_len));
+    if (state->checksum)
+        request.SetChecksumAlgorithm(Aws::S3::Model::ChecksumAlgorithm::CRC32C);
+    request.SetBody(data_stream);
+
+    state->client->UploadPartAsync(
+        request,
+        [state, part, preallocated_stream_buf, data_stream](
+            const Aws::S3::S3Client *client,
+            const Aws::S3::Model::UploadPartRequest &req,
+            const Aws::S3::Model::UploadPartOutcome &outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            if (outcome.IsSuccess()) {
+                state->etags[part] = outcome.GetResult().GetETag();
+                if (state->checksum)
+                    state->checksums[part] = outcome.GetResult().GetChecksumCRC32C();
+            } else {
+                state->failed.store(true);
+            }
+            onPartDone(state);
+        },
+        nullptr);
+}
+
 } // namespace
 
 awsS3Client::awsS3Client(nixl_b_params_t *custom_params,
@@ -147,12 +324,14 @@ awsS3Client::awsS3Client(nixl_b_params_t *custom_params,
               Aws::ShutdownAPI(*opts);
               delete opts;
           }) {
-    auto config = ::createClientConfiguration(custom_params);
+    Aws::Client::ClientConfiguration config;
+    applyCommonClientConfiguration(custom_params, config);
     if (executor) config.executor = executor;
 
     auto credentials_opt = ::createAWSCredentials(custom_params);
     bool use_virtual_addressing = ::getUseVirtualAddressing(custom_params);
     bucketName_ = Aws::String(::getBucketName(custom_params));
+    checksumEnabled_ = ::getChecksumEnabled(custom_params);
 
     if (credentials_opt.has_value())
         s3Client_ = std::make_unique<Aws::S3::S3Client>(
@@ -165,6 +344,37 @@ awsS3Client::awsS3Client(nixl_b_params_t *custom_params,
             config,
             Aws::Client::AWSAuthV4Signer::PayloadSigningPolicy::RequestDependent,
             use_virtual_addressing);
+
+    prewarmConnections(::getPrewarmConnections(custom_params));
+}
+
+void
+awsS3Client::prewarmConnections(size_t count) {
+    if (count == 0) return;
+
+    auto remaining = std::make_shared<std::atomic<size_t>>(count);
+    auto all_done = std::make_shared<std::promise<void>>();
+    auto done_future = all_done->get_future();
+
+    Aws::S3::Model::HeadBucketRequest request;
+    request.WithBucket(bucketName_);
+
+    // Concurrent requests force the HTTP client to open one connection each;
+    // with keep-alive they stay in the pool for the transfers that follow.
+    // Outcomes are ignored: a failed probe just means no warm connection.
+    for (size_t i = 0; i < count; ++i)
+        s3Client_->HeadBucketAsync(
+            request,
+            [remaining, all_done](
+                const Aws::S3::S3Client *client,
+                const Aws::S3::Model::HeadBucketRequest &req,
+                const Aws::S3::Model::HeadBucketOutcome &outcome,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+                if (remaining->fetch_sub(1) == 1) all_done->set_value();
+            },
+            nullptr);
+
+    done_future.wait();
 }
 
 void
@@ -188,6 +398,11 @@ awsS3Client::putObjectAsync(std::string_view key,
     Aws::S3::Model::PutObjectRequest request;
     request.WithBucket(bucketName_).WithKey(Aws::String(key));
 
+    // The SDK computes the CRC32C inline with the upload pass over the
+    // buffer; S3 stores it with the object and rejects a corrupted body
+    if (checksumEnabled_)
+        request.SetChecksumAlgorithm(Aws::S3::Model::ChecksumAlgorithm::CRC32C);
+
     auto preallocated_stream_buf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(
         "PutObjectStreamBuf", reinterpret_cast<unsigned char *>(data_ptr), data_len);
     auto data_stream =
@@ -206,32 +421,117 @@ awsS3Client::putObjectAsync(std::string_view key,
         nullptr);
 }
 
+void
+awsS3Client::putObjectMultipartAsync(std::string_view key,
+                                     uintptr_t data_ptr,
+                                     size_t data_len,
+                                     size_t part_size,
+                                     size_t max_parallel,
+                                     put_object_callback_t callback) {
+    // Note: S3 requires every part except the last to be at least 5 MiB
+    if (part_size == 0 || data_len <= part_size) {
+        putObjectAsync(key, data_ptr, data_len, 0, callback);
+        return;
+    }
+
+    auto state = std::make_shared<multipartUploadState>();
+    state->client = s3Client_.get();
+    state->bucket = bucketName_;
+    state->key = Aws::String(key);
+    state->dataPtr = data_ptr;
+    state->partSize = part_size;
+    state->numParts = (data_len + part_size - 1) / part_size;
+    state->dataLen = data_len;
+    state->maxParallel = std::max<size_t>(1, max_parallel);
+    state->checksum = checksumEnabled_;
+    state->etags.resize(state->numParts);
+    if (checksumEnabled_) state->checksums.resize(state->numParts);
+    state->callback = std::move(callback);
+
+    Aws::S3::Model::CreateMultipartUploadRequest request;
+    request.WithBucket(bucketName_).WithKey(state->key);
+    if (checksumEnabled_)
+        request.SetChecksumAlgorithm(Aws::S3::Model::ChecksumAlgorithm::CRC32C);
+
+    s3Client_->CreateMultipartUploadAsync(
+        request,
+        [state](const Aws::S3::S3Client *client,
+                const Aws::S3::Model::CreateMultipartUploadRequest &req,
+                const Aws::S3::Model::CreateMultipartUploadOutcome &outcome,
+                const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            if (!outcome.IsSuccess()) {
+                state->callback(false);
+                return;
+            }
+            state->uploadId = outcome.GetResult().GetUploadId();
+
+            size_t initial = std::min(state->maxParallel, state->numParts);
+            state->inflight.store(initial);
+            for (size_t part = 0; part < initial; ++part)
+                submitPart(state, state->nextPart.fetch_add(1));
+        },
+        nullptr);
+}
+
+std::shared_ptr<zeroCopyResponseBuf>
+awsS3Client::acquireResponseBuf() {
+    std::lock_guard<std::mutex> lock(responseBufLock_);
+    if (!responseBufPool_.empty()) {
+        auto buf = std::move(responseBufPool_.back());
+        responseBufPool_.pop_back();
+        return buf;
+    }
+    return std::make_shared<zeroCopyResponseBuf>();
+}
+
+void
+awsS3Client::releaseResponseBuf(std::shared_ptr<zeroCopyResponseBuf> buf) {
+    std::lock_guard<std::mutex> lock(responseBufLock_);
+    responseBufPool_.push_back(std::move(buf));
+}
+
 void
 awsS3Client::getObjectAsync(std::string_view key,
                             uintptr_t data_ptr,
                             size_t data_len,
                             size_t offset,
                             get_object_callback_t callback) {
-    auto preallocated_stream_buf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf>(
-        "GetObjectStreamBuf", reinterpret_cast<unsigned char *>(data_ptr), data_len);
-    auto stream_factory = Aws::MakeShared<Aws::IOStreamFactory>(
-        "GetObjectStreamFactory", [preallocated_stream_buf]() -> Aws::IOStream * {
-            return new Aws::IOStream(preallocated_stream_buf.get()); // AWS SDK owns the stream
-        });
+    // The response body lands directly in the registered destination
+    // region; the buffer comes from the free list so a multipart restore
+    // does not allocate a streambuf and stream pair per part
+    auto response_buf = acquireResponseBuf();
+    response_buf->seat(reinterpret_cast<char *>(data_ptr), data_len);
 
     Aws::S3::Model::GetObjectRequest request;
     request.WithBucket(bucketName_)
         .WithKey(Aws::String(key))
         .WithRange(absl::StrFormat("bytes=%d-%d", offset, offset + data_len - 1));
-    request.SetResponseStreamFactory(*stream_factory.get());
+
+    // The SDK validates the response body against the stored CRC32C when
+    // the service returns one for the requested range (a whole object or
+    // an aligned part); for other ranges the mode is a no-op
+    if (checksumEnabled_)
+        request.SetChecksumMode(Aws::S3::Model::ChecksumMode::ENABLED);
+
+    // The factory runs once per attempt; rewinding restarts a retried
+    // body at the region base. The SDK owns the stream object, the
+    // buffer stays with this client
+    zeroCopyResponseBuf *raw_buf = response_buf.get();
+    request.SetResponseStreamFactory([raw_buf]() -> Aws::IOStream * {
+        raw_buf->rewind();
+        return new Aws::IOStream(raw_buf); // AWS SDK owns the stream
+    });
 
     s3Client_->GetObjectAsync(
         request,
-        [callback,
-         stream_factory](const Aws::S3::S3Client *client,
-                         const Aws::S3::Model::GetObjectRequest &req,
-                         const Aws::S3::Model::GetObjectOutcome &outcome,
-                         const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+        [this, callback, response_buf](
+            const Aws::S3::S3Client *client,
+            const Aws::S3::Model::GetObjectRequest &req,
+            const Aws::S3::Model::GetObjectOutcome &outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            // The response stream is fully written by the time the outcome
+            // is delivered, so the buffer can serve the next part
+            releaseResponseBuf(response_buf);
             callback(outcome.IsSuccess());
         },
         nullptr);
@@ -251,3 +551,25 @@ awsS3Client::checkObjectExists(std::string_view key) {
         throw std::runtime_error("Failed to check if object exists: " +
                                  outcome.GetError().GetMessage());
 }
+
+void
+awsS3Client::checkObjectExistsAsync(std::string_view key, head_object_callback_t callback) {
+    Aws::S3::Model::HeadObjectRequest request;
+    request.WithBucket(bucketName_).WithKey(Aws::String(key));
+
+    s3Client_->HeadObjectAsync(
+        request,
+        [callback](const Aws::S3::S3Client *client,
+                   const Aws::S3::Model::HeadObjectRequest &req,
+                   const Aws::S3::Model::HeadObjectOutcome &outcome,
+                   const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            if (outcome.IsSuccess())
+                callback(NIXL_SUCCESS, true);
+            else if (outcome.GetError().GetResponseCode() ==
+                     Aws::Http::HttpResponseCode::NOT_FOUND)
+                callback(NIXL_SUCCESS, false);
+            else
+                callback(NIXL_ERR_BACKEND, false);
+        },
+        nullptr);
+}
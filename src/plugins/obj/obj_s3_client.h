@@ -20,15 +20,44 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <streambuf>
+#include <string>
 #include <string_view>
+#include <vector>
 #include <cstdint>
 #include <aws/s3/S3Client.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/Aws.h>
+#include <aws/core/auth/AWSCredentials.h>
+#include <aws/core/client/ClientConfiguration.h>
 #include "nixl_types.h"
 
 using put_object_callback_t = std::function<void(bool success)>;
 using get_object_callback_t = std::function<void(bool success)>;
+using head_object_callback_t = std::function<void(nixl_status_t status, bool exists)>;
+
+/**
+ * Shared parameter parsing for the SDK client variants. The fields set here
+ * live in the common Aws::Client::ClientConfiguration base, so both the
+ * classic and the CRT client configurations can be passed in.
+ */
+void
+applyCommonClientConfiguration(nixl_b_params_t *custom_params,
+                               Aws::Client::ClientConfiguration &config);
+
+std::optional<Aws::Auth::AWSCredentials>
+createAWSCredentials(nixl_b_params_t *custom_params);
+
+bool
+getUseVirtualAddressing(nixl_b_params_t *custom_params);
+
+bool
+getChecksumEnabled(nixl_b_params_t *custom_params);
+
+std::string
+getBucketName(nixl_b_params_t *custom_params);
 
 /**
  * Abstract interface for S3 client operations.
@@ -60,6 +89,26 @@ public:
                    size_t offset,
                    put_object_callback_t callback) = 0;
 
+    /**
+     * Asynchronously put an object to S3 as a multipart upload.
+     * The data is split into parts of part_size bytes (the last part may be
+     * shorter) that are uploaded concurrently, with at most max_parallel part
+     * uploads in flight at a time.
+     * @param key The object key
+     * @param data_ptr Pointer to the data to upload
+     * @param data_len Length of the data in bytes
+     * @param part_size Size of each part in bytes
+     * @param max_parallel Maximum number of concurrent part uploads
+     * @param callback Callback function to handle the overall result
+     */
+    virtual void
+    putObjectMultipartAsync(std::string_view key,
+                            uintptr_t data_ptr,
+                            size_t data_len,
+                            size_t part_size,
+                            size_t max_parallel,
+                            put_object_callback_t callback) = 0;
+
     /**
      * Asynchronously get an object from S3.
      * @param key The object key
@@ -82,6 +131,90 @@ public:
      */
     virtual bool
     checkObjectExists(std::string_view key) = 0;
+
+    /**
+     * Asynchronously check if the object exists, so several existence checks
+     * can be pipelined instead of paying one round trip each.
+     * @param key The object key
+     * @param callback Callback receiving the request status and, on success,
+     *                 whether the object exists
+     */
+    virtual void
+    checkObjectExistsAsync(std::string_view key, head_object_callback_t callback) = 0;
+};
+
+/**
+ * Response stream buffer seated directly over the registered destination
+ * memory, so the HTTP client parses each body byte in place instead of
+ * into an SDK-owned buffer that is copied out afterwards. Unlike the
+ * SDK's PreallocatedStreamBuf it can be reseated onto a new region, so
+ * awsS3Client pools instances across ranged GETs instead of allocating a
+ * streambuf and stream pair per part.
+ */
+class zeroCopyResponseBuf : public std::streambuf {
+public:
+    zeroCopyResponseBuf() = default;
+
+    /** Point the buffer at a new destination region. */
+    void
+    seat(char *base, size_t len) {
+        base_ = base;
+        len_ = len;
+        rewind();
+    }
+
+    /**
+     * Rewind the put area to the region base. The response stream factory
+     * runs once per attempt and calls this, so a retried request restarts
+     * its body at the start of the region instead of appending.
+     */
+    void
+    rewind() {
+        setp(base_, base_ + len_);
+        setg(base_, base_, base_ + len_);
+    }
+
+protected:
+    // Seek support mirrors the SDK's PreallocatedStreamBuf, which the
+    // HTTP client relies on to reposition a response body
+    pos_type
+    seekoff(off_type off,
+            std::ios_base::seekdir dir,
+            std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override {
+        off_type base;
+        switch (dir) {
+        case std::ios_base::beg:
+            base = 0;
+            break;
+        case std::ios_base::cur:
+            base = (which & std::ios_base::out) ? (pptr() - base_) : (gptr() - base_);
+            break;
+        case std::ios_base::end:
+            base = static_cast<off_type>(len_);
+            break;
+        default:
+            return pos_type(off_type(-1));
+        }
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type
+    seekpos(pos_type pos,
+            std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override {
+        if ((off_type(pos) < 0) || (off_type(pos) > static_cast<off_type>(len_)))
+            return pos_type(off_type(-1));
+        if (which & std::ios_base::out) {
+            setp(base_, base_ + len_);
+            pbump(static_cast<int>(off_type(pos)));
+        }
+        if (which & std::ios_base::in)
+            setg(base_, base_ + off_type(pos), base_ + len_);
+        return pos;
+    }
+
+private:
+    char *base_ = nullptr;
+    size_t len_ = 0;
 };
 
 /**
@@ -107,6 +240,14 @@ public:
                    size_t offset,
                    put_object_callback_t callback) override;
 
+    void
+    putObjectMultipartAsync(std::string_view key,
+                            uintptr_t data_ptr,
+                            size_t data_len,
+                            size_t part_size,
+                            size_t max_parallel,
+                            put_object_callback_t callback) override;
+
     void
     getObjectAsync(std::string_view key,
                    uintptr_t data_ptr,
@@ -117,10 +258,39 @@ public:
     bool
     checkObjectExists(std::string_view key) override;
 
+    void
+    checkObjectExistsAsync(std::string_view key, head_object_callback_t callback) override;
+
 private:
+    /**
+     * Establish the HTTP connection pool up front by issuing count concurrent
+     * HeadBucket requests, so the first transfer burst does not pay TLS
+     * handshake latency per connection. Blocks until the requests complete.
+     */
+    void
+    prewarmConnections(size_t count);
+
+    /** Pop a pooled response buffer, growing the pool under load. */
+    std::shared_ptr<zeroCopyResponseBuf>
+    acquireResponseBuf();
+
+    /** Return a buffer whose GET completed to the free list. */
+    void
+    releaseResponseBuf(std::shared_ptr<zeroCopyResponseBuf> buf);
+
     std::unique_ptr<Aws::SDKOptions, std::function<void(Aws::SDKOptions *)>> awsOptions_;
     std::unique_ptr<Aws::S3::S3Client> s3Client_;
     Aws::String bucketName_;
+
+    // With the "checksum" parameter set, puts carry a CRC32C the SDK
+    // computes inline with the upload pass and S3 stores and validates,
+    // and gets ask the SDK to validate the response against it
+    bool checksumEnabled_ = false;
+
+    // Free list of response stream buffers reused across ranged GETs; a
+    // multipart restore holds at most one per in-flight part
+    std::mutex responseBufLock_;
+    std::vector<std::shared_ptr<zeroCopyResponseBuf>> responseBufPool_;
 };
 
 #endif // OBJ_S3_CLIENT_H
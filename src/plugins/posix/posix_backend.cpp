@@ -16,12 +16,22 @@
  */
 
 #include <iostream>
+#include <algorithm>
 #include <cmath>
+#include <map>
+#include <sstream>
+#include <tuple>
 #include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/xattr.h>
 #include <stdexcept>
 #include "posix_backend.h"
 #include <absl/log/log.h>
 #include <absl/strings/str_format.h>
+#include "common/block_cache.h"
+#include "common/nixl_crc32c.h"
 #include "common/nixl_log.h"
 #include "queue_factory_impl.h"
 #include "nixl_types.h"
@@ -107,6 +117,20 @@ namespace {
         }
         return queue_t::AIO;
     }
+
+    static bool getChecksumEnabled(const nixl_b_params_t* custom_params) {
+        if (custom_params && custom_params->count("checksum") > 0) {
+            const auto& value = custom_params->at("checksum");
+            return value == "true" || value == "1" || value == "crc32c";
+        }
+        return false;
+    }
+
+    static size_t getReadaheadChunks(const nixl_b_params_t* custom_params) {
+        if (custom_params && custom_params->count("readahead_chunks") > 0)
+            return strtoul(custom_params->at("readahead_chunks").c_str(), nullptr, 10);
+        return 4;
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -117,14 +141,21 @@ nixlPosixBackendReqH::nixlPosixBackendReqH(const nixl_xfer_op_t &op,
                                            const nixl_meta_dlist_t &loc,
                                            const nixl_meta_dlist_t &rem,
                                            const nixl_opt_b_args_t* args,
-                                           const nixl_b_params_t* params)
+                                           const nixl_b_params_t* params,
+                                           nixlPosixRingPool* ring_pool,
+                                           nixlBlockCache* block_cache)
     : operation(op)
     , local(loc)
     , remote(rem)
     , opt_args(args)
     , custom_params_(params)
-    , queue_depth_(loc.descCount())
-    , queue_type_(getQueueType(params)) {
+    , ios_(serveCachedReads(coalesceIOs(loc, rem), op, block_cache))
+    , raIos_(buildReadahead(ios_, op, params, block_cache, raBufs_))
+    , queue_depth_(static_cast<int>(ios_.size() + raIos_.size()))
+    , queue_type_(getQueueType(params))
+    , ring_pool_(ring_pool)
+    , checksum_(getChecksumEnabled(params))
+    , blockCache_(block_cache) {
     if (queue_type_ == nixlPosixQueue::queue_t::UNSUPPORTED) {
         throw exception(absl::StrFormat("Unsupported queue type"), NIXL_ERR_NOT_SUPPORTED);
     }
@@ -135,6 +166,11 @@ nixlPosixBackendReqH::nixlPosixBackendReqH(const nixl_xfer_op_t &op,
             NIXL_ERR_INVALID_PARAM);
     }
 
+    // Every read was served from the cache: nothing to queue, the
+    // request completes at the first checkXfer
+    if (ios_.empty())
+        return;
+
     nixl_status_t status = initQueues();
     if (status != NIXL_SUCCESS) {
         throw exception(absl::StrFormat("Failed to initialize queues: %s", to_string(queue_type_)),
@@ -150,7 +186,7 @@ nixl_status_t nixlPosixBackendReqH::initQueues() {
                 queue = QueueFactory::createAioQueue(queue_depth_, operation);
                 break;
             case nixlPosixQueue::queue_t::URING:
-                queue = QueueFactory::createUringQueue(queue_depth_, operation);
+                queue = QueueFactory::createUringQueue(queue_depth_, operation, ring_pool_);
                 break;
             default:
                 NIXL_ERROR << absl::StrFormat("Invalid queue type: %s", to_string(queue_type_));
@@ -166,31 +202,211 @@ nixl_status_t nixlPosixBackendReqH::initQueues() {
     }
 }
 
-nixl_status_t nixlPosixBackendReqH::prepXfer() {
-    for (auto [local_it, remote_it] = std::make_pair(local.begin(), remote.begin());
-         local_it != local.end() && remote_it != remote.end();
-         ++local_it, ++remote_it) {
-        nixl_status_t status = queue->prepIO(
-            remote_it->devId,
-            reinterpret_cast<void*>(local_it->addr),
-            remote_it->len,
-            remote_it->addr
-        );
+std::vector<nixlPosixBackendReqH::mergedIO>
+nixlPosixBackendReqH::coalesceIOs(const nixl_meta_dlist_t &local,
+                                  const nixl_meta_dlist_t &remote) {
+    std::vector<mergedIO> ios;
+    ios.reserve(local.descCount());
+    for (int i = 0; i < local.descCount(); ++i)
+        ios.push_back({static_cast<int>(remote[i].devId),
+                       reinterpret_cast<void*>(local[i].addr),
+                       local[i].len,
+                       static_cast<off_t>(remote[i].addr)});
+
+    std::sort(ios.begin(), ios.end(), [](const mergedIO &a, const mergedIO &b) {
+        return std::tie(a.fd, a.offset) < std::tie(b.fd, b.offset);
+    });
+
+    // A run is mergeable only when both sides are adjacent: the file
+    // ranges back to back and the local buffers forming one flat region
+    std::vector<mergedIO> merged;
+    merged.reserve(ios.size());
+    for (const auto &io : ios) {
+        if (!merged.empty() && merged.back().fd == io.fd &&
+            merged.back().offset + static_cast<off_t>(merged.back().len) == io.offset &&
+            static_cast<char*>(merged.back().buf) + merged.back().len == io.buf)
+            merged.back().len += io.len;
+        else
+            merged.push_back(io);
+    }
+
+    if (merged.size() != ios.size())
+        NIXL_DEBUG << absl::StrFormat("Coalesced %zu descriptors into %zu queue entries",
+                                      ios.size(), merged.size());
+    return merged;
+}
+
+std::vector<nixlPosixBackendReqH::mergedIO>
+nixlPosixBackendReqH::serveCachedReads(std::vector<mergedIO> ios,
+                                       const nixl_xfer_op_t &op,
+                                       nixlBlockCache *cache) {
+    if (!cache || op != NIXL_READ)
+        return ios;
+
+    // Hits complete right here as local copies; only the misses go on to
+    // the I/O queue and land in the cache once they complete
+    std::vector<mergedIO> misses;
+    misses.reserve(ios.size());
+    for (const auto &io : ios)
+        if (!cache->lookup(io.fd, io.offset, io.len, io.buf))
+            misses.push_back(io);
+
+    if (misses.size() != ios.size())
+        NIXL_DEBUG << absl::StrFormat("Served %zu of %zu queue entries from the block cache",
+                                      ios.size() - misses.size(), ios.size());
+    return misses;
+}
+
+std::vector<nixlPosixBackendReqH::mergedIO>
+nixlPosixBackendReqH::buildReadahead(const std::vector<mergedIO> &ios,
+                                     const nixl_xfer_op_t &op,
+                                     const nixl_b_params_t *params,
+                                     nixlBlockCache *cache,
+                                     std::vector<std::unique_ptr<char[]>> &bufs) {
+    std::vector<mergedIO> ra;
+    if (op != NIXL_READ || !cache || ios.empty() || !params ||
+        params->count("readahead_fds") == 0 || params->count("readahead_chunks") == 0)
+        return ra;
+
+    const size_t chunks = strtoul(params->at("readahead_chunks").c_str(), nullptr, 10);
+    std::set<int> seq_fds;
+    std::stringstream fd_ss(params->at("readahead_fds"));
+    std::string tok;
+    while (std::getline(fd_ss, tok, ','))
+        seq_fds.insert(atoi(tok.c_str()));
+
+    // The window continues from the furthest range the request touches on
+    // each sequential fd, in chunks of that range's size, so the next
+    // request's coalesced entries hit the exact cache geometry
+    std::map<int, mergedIO> tails;
+    for (const auto &io : ios) {
+        if (seq_fds.count(io.fd) == 0)
+            continue;
+        auto [it, inserted] = tails.emplace(io.fd, io);
+        if (!inserted &&
+            io.offset + static_cast<off_t>(io.len) >
+                it->second.offset + static_cast<off_t>(it->second.len))
+            it->second = io;
+    }
+
+    for (const auto &[fd, tail] : tails) {
+        struct stat st;
+        if (tail.len == 0 || fstat(fd, &st) < 0 || !S_ISREG(st.st_mode))
+            continue;
+        off_t off = tail.offset + static_cast<off_t>(tail.len);
+        for (size_t i = 0; i < chunks && off < st.st_size; ++i) {
+            // The last chunk of the file may be short; it is cached with
+            // its own geometry, which a short tail read will look up
+            const size_t len = std::min(tail.len, static_cast<size_t>(st.st_size - off));
+            auto buf = std::make_unique<char[]>(len);
+            // A chunk an earlier window already staged needs no new I/O
+            if (!cache->lookup(fd, off, len, buf.get())) {
+                ra.push_back({fd, buf.get(), len, off});
+                bufs.push_back(std::move(buf));
+            }
+            off += static_cast<off_t>(len);
+        }
+    }
+
+    if (!ra.empty())
+        NIXL_DEBUG << absl::StrFormat("Queued %zu read-ahead entries", ra.size());
+    return ra;
+}
 
+nixl_status_t nixlPosixBackendReqH::prepXfer() {
+    for (const auto &io : ios_) {
+        nixl_status_t status = queue->prepIO(io.fd, io.buf, io.len, io.offset);
         if (status != NIXL_SUCCESS) {
             NIXL_ERROR << "Error preparing I/O operation";
             return status;
         }
     }
 
+    // Read-ahead entries ride the same queue as the requested ranges, so
+    // the device sees one deep submission instead of idling between batches
+    for (const auto &io : raIos_) {
+        nixl_status_t status = queue->prepIO(io.fd, io.buf, io.len, io.offset);
+        if (status != NIXL_SUCCESS) {
+            NIXL_ERROR << "Error preparing read-ahead operation";
+            return status;
+        }
+    }
+
     return NIXL_SUCCESS;
 }
 
 nixl_status_t nixlPosixBackendReqH::checkXfer() {
-    return queue->checkCompleted();
+    nixl_status_t status = queue ? queue->checkCompleted() : NIXL_SUCCESS;
+
+    // Reads that had to go to the device become cache content for the
+    // next transfer touching the same blocks
+    if (status == NIXL_SUCCESS && blockCache_ && operation == NIXL_READ && !cacheInserted_) {
+        cacheInserted_ = true;
+        for (const auto &io : ios_)
+            blockCache_->insert(io.fd, io.offset, io.len, io.buf);
+        // Read-ahead staging becomes the window the next request's
+        // serveCachedReads consumes
+        for (const auto &io : raIos_)
+            blockCache_->insert(io.fd, io.offset, io.len, io.buf);
+    }
+
+    if (status != NIXL_SUCCESS || !checksum_ || checksumDone_)
+        return status;
+
+    checksumDone_ = true;
+    return runChecksumPass();
+}
+
+// With the "checksum" backend parameter set, a completed transfer gets one
+// CRC32C pass over its local buffers while they are still cache-hot from
+// the kernel copy - far cheaper than a later verification that has to read
+// the data back from storage. Writes persist the per-entry checksum in an
+// extended attribute next to the data; reads verify against it when one is
+// present. The attribute name carries the file range, so a read only
+// checks against a checksum written for the same range.
+nixl_status_t nixlPosixBackendReqH::runChecksumPass() {
+    for (const auto &io : ios_) {
+        const uint32_t crc = nixl::crc32c(io.buf, io.len);
+        const std::string name = absl::StrFormat("user.nixl.crc32c.%lld.%zu",
+                                                 static_cast<long long>(io.offset), io.len);
+        if (operation == NIXL_WRITE) {
+            // Best effort: a filesystem without xattr support loses the
+            // checksum, not the data
+            if (fsetxattr(io.fd, name.c_str(), &crc, sizeof(crc), 0) < 0)
+                NIXL_WARN << absl::StrFormat("Failed to store checksum on fd %d: %s",
+                                             io.fd, strerror(errno));
+        } else {
+            uint32_t stored;
+            ssize_t got = fgetxattr(io.fd, name.c_str(), &stored, sizeof(stored));
+            if (got < 0)
+                continue; // No checksum recorded for this range
+            if (got != sizeof(stored) || stored != crc) {
+                NIXL_ERROR << absl::StrFormat(
+                    "Checksum mismatch on fd %d range [%lld, +%zu): stored %08x, computed %08x",
+                    io.fd, static_cast<long long>(io.offset), io.len, stored, crc);
+                return NIXL_ERR_MISMATCH;
+            }
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlPosixBackendReqH::cancelXfer() {
+    if (!queue)
+        return NIXL_SUCCESS;
+    return queue->cancel();
 }
 
 nixl_status_t nixlPosixBackendReqH::postXfer() {
+    // A write makes any cached copy of the target ranges stale
+    if (blockCache_ && operation == NIXL_WRITE)
+        for (const auto &io : ios_)
+            blockCache_->invalidateRange(io.fd, io.offset, io.len);
+
+    // All reads were completed from the cache during preparation
+    if (!queue)
+        return NIXL_SUCCESS;
+
     return queue->submit (local, remote);
 }
 
@@ -200,7 +416,10 @@ nixl_status_t nixlPosixBackendReqH::postXfer() {
 
 nixlPosixEngine::nixlPosixEngine(const nixlBackendInitParams* init_params)
     : nixlBackendEngine(init_params)
-    , queue_type_(getQueueType(init_params->customParams)) {
+    , queue_type_(getQueueType(init_params->customParams))
+    , checksum_(getChecksumEnabled(init_params->customParams))
+    , block_cache_(init_params->blockCache)
+    , readahead_chunks_(getReadaheadChunks(init_params->customParams)) {
     if (queue_type_ == nixlPosixQueue::queue_t::UNSUPPORTED) {
         initErr = true;
         NIXL_ERROR << absl::StrFormat(
@@ -208,6 +427,11 @@ nixlPosixEngine::nixlPosixEngine(const nixlBackendInitParams* init_params)
             to_string(queue_type_));
         return;
     }
+
+    if (queue_type_ == nixlPosixQueue::queue_t::URING) {
+        ring_pool_ = QueueFactory::createUringRingPool(init_params->customParams);
+    }
+
     NIXL_INFO << absl::StrFormat("POSIX backend initialized using queue type: %s",
                                  to_string(queue_type_));
 }
@@ -222,6 +446,54 @@ nixl_status_t nixlPosixEngine::registerMem(const nixlBlobDesc &mem,
     return NIXL_ERR_NOT_SUPPORTED;
 }
 
+nixl_status_t nixlPosixEngine::registerMem(const nixlBlobDesc &mem,
+                                           const nixl_mem_t &nixl_mem,
+                                           const nixl_reg_hints_t &hints,
+                                           nixlBackendMD* &out) {
+    nixl_status_t ret = registerMem(mem, nixl_mem, out);
+    if (ret != NIXL_SUCCESS || nixl_mem != FILE_SEG)
+        return ret;
+
+    // File segments carry the fd in devId and the file offset in addr;
+    // len 0 means whole file, which matches posix_fadvise semantics.
+    // Advice is best effort and never fails the registration.
+    int advice = -1;
+    if (hints.pattern == NIXL_ACCESS_SEQUENTIAL)
+        advice = POSIX_FADV_SEQUENTIAL;
+    else if (hints.pattern == NIXL_ACCESS_RANDOM)
+        advice = POSIX_FADV_RANDOM;
+
+    int rc;
+    if (advice >= 0) {
+        rc = posix_fadvise(mem.devId, mem.addr, mem.len, advice);
+        if (rc)
+            NIXL_WARN << absl::StrFormat("posix_fadvise(%d) failed on fd %d: %s",
+                                         advice, (int)mem.devId, strerror(rc));
+    }
+
+    // Sequential files additionally feed the read-ahead window (see the
+    // "readahead_chunks" parameter): prepXfer marks reads on them for
+    // speculative staging through the shared block cache
+    {
+        const std::lock_guard<std::mutex> lock(seqLock_);
+        if (hints.pattern == NIXL_ACCESS_SEQUENTIAL)
+            seqFds_.insert(mem.devId);
+        else if (hints.pattern == NIXL_ACCESS_RANDOM)
+            seqFds_.erase(mem.devId);
+    }
+
+    // One-pass data (e.g. checkpoint files): ask the kernel not to keep
+    // the pages around once they have been read or written through
+    if (hints.lifetime == NIXL_LIFETIME_TRANSIENT) {
+        rc = posix_fadvise(mem.devId, mem.addr, mem.len, POSIX_FADV_NOREUSE);
+        if (rc)
+            NIXL_WARN << absl::StrFormat("posix_fadvise(NOREUSE) failed on fd %d: %s",
+                                         (int)mem.devId, strerror(rc));
+    }
+
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t nixlPosixEngine::deregisterMem(nixlBackendMD *) {
     return NIXL_SUCCESS;
 }
@@ -250,8 +522,32 @@ nixl_status_t nixlPosixEngine::prepXfer(const nixl_xfer_op_t &operation,
                 NIXL_ERROR << absl::StrFormat("Invalid queue type: %s", to_string(queue_type_));
                 return NIXL_ERR_INVALID_PARAM;
         }
+        if (checksum_)
+            params["checksum"] = "true";
+
+        // Reads touching sequential-hinted files get a speculative
+        // read-ahead window staged into the shared block cache for the
+        // requests that follow
+        if (operation == NIXL_READ && block_cache_ && readahead_chunks_ > 0) {
+            std::set<uint64_t> seq_fds;
+            {
+                const std::lock_guard<std::mutex> lock(seqLock_);
+                for (int i = 0; i < remote.descCount(); ++i)
+                    if (seqFds_.count(remote[i].devId) > 0)
+                        seq_fds.insert(remote[i].devId);
+            }
+            if (!seq_fds.empty()) {
+                std::string fds;
+                for (const auto fd : seq_fds)
+                    fds += (fds.empty() ? "" : ",") + std::to_string(fd);
+                params["readahead_fds"] = fds;
+                params["readahead_chunks"] = std::to_string(readahead_chunks_);
+            }
+        }
 
-        auto posix_handle = std::make_unique<nixlPosixBackendReqH>(operation, local, remote, opt_args, &params);
+        auto posix_handle = std::make_unique<nixlPosixBackendReqH>(operation, local, remote, opt_args,
+                                                                   &params, ring_pool_.get(),
+                                                                   block_cache_);
         nixl_status_t status = posix_handle->prepXfer();
         if (status != NIXL_SUCCESS) {
             return status;
@@ -277,7 +573,7 @@ nixl_status_t nixlPosixEngine::postXfer(const nixl_xfer_op_t &operation,
     try {
         auto& posix_handle = castPosixHandle(handle);
         nixl_status_t status = posix_handle.postXfer();
-        if (status != NIXL_IN_PROG) {
+        if (status != NIXL_IN_PROG && status != NIXL_SUCCESS) {
             NIXL_ERROR << "Error in submitting queue";
         }
         return status;
@@ -300,6 +596,18 @@ nixl_status_t nixlPosixEngine::checkXfer(nixlBackendReqH* handle) const {
     return NIXL_ERR_BACKEND;
 }
 
+nixl_status_t nixlPosixEngine::cancelXfer(nixlBackendReqH* handle) const {
+    try {
+        auto& posix_handle = castPosixHandle(handle);
+        return posix_handle.cancelXfer();
+    }
+    catch (const nixlPosixBackendReqH::exception& e) {
+        NIXL_ERROR << e.what();
+        return e.code();
+    }
+    return NIXL_ERR_BACKEND;
+}
+
 nixl_status_t nixlPosixEngine::releaseReqH(nixlBackendReqH* handle) const {
     try {
         auto& posix_handle = castPosixHandle(handle);
@@ -19,36 +19,87 @@
 #define POSIX_BACKEND_H
 
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 #include <absl/strings/str_format.h>
 #include "backend/backend_engine.h"
 #include "posix_queue.h"
 
+class nixlBlockCache;
+
 class nixlPosixBackendReqH : public nixlBackendReqH {
+public:
+    // One queue entry after submission-time coalescing (see coalesceIOs)
+    struct mergedIO {
+        int     fd;
+        void   *buf;
+        size_t  len;
+        off_t   offset;
+    };
+
 private:
     const nixl_xfer_op_t            &operation;      // The transfer operation (read/write)
     const nixl_meta_dlist_t         &local;          // Local memory descriptor list
     const nixl_meta_dlist_t         &remote;         // Remote memory descriptor list
     const nixl_opt_b_args_t         *opt_args;       // Optional backend-specific arguments
     const nixl_b_params_t           *custom_params_; // Custom backend parameters
+    const std::vector<mergedIO>     ios_;            // Coalesced queue entries
+    std::vector<std::unique_ptr<char[]>> raBufs_;    // Staging buffers backing raIos_
+    const std::vector<mergedIO>     raIos_;          // Speculative read-ahead entries
     const int                       queue_depth_;    // Queue depth for async I/O
     std::unique_ptr<nixlPosixQueue> queue;           // Async I/O queue instance
     const nixlPosixQueue::queue_t   queue_type_;     // Type of queue used
+    nixlPosixRingPool              *ring_pool_;      // Engine's shared ring pool, may be null
+    const bool                      checksum_;       // Inline CRC32C enabled (see "checksum" param)
+    bool                            checksumDone_ = false; // Checksum pass already ran
+    nixlBlockCache                 *blockCache_;     // Agent's shared read cache, may be null
+    bool                            cacheInserted_ = false; // Completed reads already cached
+
+    // Sort the per-descriptor operations by (fd, offset) and merge runs
+    // that are contiguous both in the file and in local memory into one
+    // larger entry, so a flush of adjacent pages submits one queue entry
+    // instead of one per descriptor
+    static std::vector<mergedIO> coalesceIOs(const nixl_meta_dlist_t &local,
+                                             const nixl_meta_dlist_t &remote);
+
+    // Complete read entries whose block is in the shared cache as local
+    // copies right away, returning only the misses for the I/O queue
+    static std::vector<mergedIO> serveCachedReads(std::vector<mergedIO> ios,
+                                                  const nixl_xfer_op_t &op,
+                                                  nixlBlockCache *cache);
+
+    // Read-ahead window for sequential-hinted files (see the
+    // "readahead_fds"/"readahead_chunks" parameters the engine passes):
+    // the next chunks past the furthest range this request touches are
+    // queued into staging buffers and become cache content on completion
+    static std::vector<mergedIO> buildReadahead(const std::vector<mergedIO> &ios,
+                                                const nixl_xfer_op_t &op,
+                                                const nixl_b_params_t *params,
+                                                nixlBlockCache *cache,
+                                                std::vector<std::unique_ptr<char[]>> &bufs);
 
     nixl_status_t initQueues();                      // Initialize async I/O queue
 
+    // Runs once over the local buffers after the queue drains: writes
+    // persist a CRC32C per queue entry, reads verify against it
+    nixl_status_t runChecksumPass();
+
 public:
     nixlPosixBackendReqH(const nixl_xfer_op_t &operation,
                          const nixl_meta_dlist_t &local,
                          const nixl_meta_dlist_t &remote,
                          const nixl_opt_b_args_t* opt_args,
-                         const nixl_b_params_t* custom_params);
+                         const nixl_b_params_t* custom_params,
+                         nixlPosixRingPool* ring_pool = nullptr,
+                         nixlBlockCache* block_cache = nullptr);
     ~nixlPosixBackendReqH() {};
 
     nixl_status_t postXfer();
     nixl_status_t prepXfer();
     nixl_status_t checkXfer();
+    nixl_status_t cancelXfer();
 
     // Exception classes
     class exception: public std::exception {
@@ -64,6 +115,22 @@ public:
 class nixlPosixEngine : public nixlBackendEngine {
 private:
     const nixlPosixQueue::queue_t queue_type_;
+    // Inline CRC32C over transferred buffers (see the "checksum" backend
+    // parameter), propagated to every request handle
+    const bool checksum_;
+    // Rings shared across requests so ring setup and the optional SQPOLL
+    // thread are paid once per engine
+    std::shared_ptr<nixlPosixRingPool> ring_pool_;
+    // Agent-owned read cache tier (block_cache_size param), may be null;
+    // propagated to every request handle
+    nixlBlockCache* block_cache_;
+    // Read-ahead depth in chunks for sequential-hinted files (see the
+    // "readahead_chunks" backend parameter); 0 disables
+    const size_t readahead_chunks_;
+    // Files registered with NIXL_ACCESS_SEQUENTIAL, keyed by fd; reads on
+    // them get speculative staging through the shared block cache
+    mutable std::mutex seqLock_;
+    std::set<uint64_t> seqFds_;
 
 public:
     nixlPosixEngine(const nixlBackendInitParams* init_params);
@@ -93,6 +160,11 @@ public:
                               const nixl_mem_t &nixl_mem,
                               nixlBackendMD* &out) override;
 
+    nixl_status_t registerMem(const nixlBlobDesc &mem,
+                              const nixl_mem_t &nixl_mem,
+                              const nixl_reg_hints_t &hints,
+                              nixlBackendMD* &out) override;
+
     nixl_status_t deregisterMem(nixlBackendMD* meta) override;
 
     nixl_status_t connect(const std::string &remote_agent) override {
@@ -122,6 +194,7 @@ public:
                            const nixl_opt_b_args_t* opt_args=nullptr) const override;
 
     nixl_status_t checkXfer(nixlBackendReqH* handle) const override;
+    nixl_status_t cancelXfer(nixlBackendReqH* handle) const override;
     nixl_status_t releaseReqH(nixlBackendReqH* handle) const override;
 
     nixl_status_t
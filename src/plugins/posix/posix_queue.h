@@ -22,6 +22,14 @@
 #include "backend/backend_aux.h"
 #include <sys/types.h>
 
+// Opaque base for a pool of kernel I/O rings shared across requests.
+// Owned by the engine so rings (and their SQPOLL threads, when enabled)
+// outlive individual transfers instead of being set up per request.
+class nixlPosixRingPool {
+    public:
+        virtual ~nixlPosixRingPool() = default;
+};
+
 // Abstract base class for async I/O operations
 class nixlPosixQueue {
     public:
@@ -30,6 +38,9 @@ class nixlPosixQueue {
         submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) = 0;
         virtual nixl_status_t checkCompleted() = 0;
         virtual nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) = 0;
+        // Abort submitted operations that the kernel has not started yet;
+        // queues without async cancel support keep the default
+        virtual nixl_status_t cancel() { return NIXL_ERR_NOT_SUPPORTED; }
 
     enum class queue_t {
         AIO,
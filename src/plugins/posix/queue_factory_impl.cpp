@@ -39,30 +39,50 @@ namespace {
     template <typename Mode, typename Enable = void>
     struct funcImpl;
 
+// The enabled specialization names UringQueue/UringRingPool, which only
+// exist when the liburing header is included; it is never selected
+// without them, so compile it out rather than relying on lazy
+// instantiation
+#ifdef HAVE_LIBURING
     template <typename Mode>
     struct funcImpl<Mode, std::enable_if_t<std::is_same<Mode, uringEnabled>::value>> {
-        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation) {
-            // Initialize io_uring parameters with basic configuration
-            // Start with basic parameters, no special flags
-            // We can add optimizations like SQPOLL later
-            struct io_uring_params params = {};
-            return std::make_unique<class UringQueue>(num_entries, params, operation);
+        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation,
+                                                                nixlPosixRingPool* ring_pool) {
+            return std::make_unique<class UringQueue>(num_entries, operation,
+                                                      static_cast<UringRingPool*>(ring_pool));
+        }
+
+        static std::shared_ptr<nixlPosixRingPool> createUringRingPool(const nixl_b_params_t* custom_params) {
+            bool sqpoll = false;
+            if (custom_params && custom_params->count("use_sqpoll") > 0) {
+                const auto& value = custom_params->at("use_sqpoll");
+                sqpoll = (value == "true" || value == "1");
+            }
+            return std::make_shared<UringRingPool>(sqpoll);
         }
 
         static bool isUringAvailable() {
             return true;
         }
     };
+#endif
 
     template <typename Mode>
     struct funcImpl<Mode, std::enable_if_t<std::is_same<Mode, uringDisabled>::value>> {
-        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation) {
+        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation,
+                                                                nixlPosixRingPool* ring_pool) {
             (void)num_entries;
             (void)operation;
+            (void)ring_pool;
             throw nixlPosixBackendReqH::exception("Attempting to create io_uring queue when support is not compiled in",
                                                   NIXL_ERR_NOT_SUPPORTED);
         }
 
+        static std::shared_ptr<nixlPosixRingPool> createUringRingPool(const nixl_b_params_t* custom_params) {
+            (void)custom_params;
+            return nullptr;
+        }
+
         static bool isUringAvailable() {
             return false;
         }
@@ -74,8 +94,13 @@ std::unique_ptr<nixlPosixQueue> QueueFactory::createAioQueue(int num_entries, ni
     return std::make_unique<aioQueue>(num_entries, operation);
 }
 
-std::unique_ptr<nixlPosixQueue> QueueFactory::createUringQueue(int num_entries, nixl_xfer_op_t operation) {
-    return funcImpl<uringMode>::createUringQueue(num_entries, operation);
+std::unique_ptr<nixlPosixQueue> QueueFactory::createUringQueue(int num_entries, nixl_xfer_op_t operation,
+                                                               nixlPosixRingPool* ring_pool) {
+    return funcImpl<uringMode>::createUringQueue(num_entries, operation, ring_pool);
+}
+
+std::shared_ptr<nixlPosixRingPool> QueueFactory::createUringRingPool(const nixl_b_params_t* custom_params) {
+    return funcImpl<uringMode>::createUringRingPool(custom_params);
 }
 
 bool QueueFactory::isUringAvailable() {
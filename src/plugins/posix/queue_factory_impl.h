@@ -23,7 +23,12 @@
 namespace QueueFactory {
     std::unique_ptr<nixlPosixQueue> createAioQueue(int num_entries, nixl_xfer_op_t operation);
 
-    std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation);
+    std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation,
+                                                     nixlPosixRingPool* ring_pool = nullptr);
+
+    // Engine-lifetime pool of rings that uring queues borrow from; honors the
+    // "use_sqpoll" custom parameter. Returns nullptr without liburing support.
+    std::shared_ptr<nixlPosixRingPool> createUringRingPool(const nixl_b_params_t* custom_params);
 
     bool isUringAvailable();
 };
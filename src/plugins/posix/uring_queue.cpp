@@ -17,6 +17,7 @@
 
 #include "uring_queue.h"
 #include <liburing.h>
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <cstring>
@@ -62,56 +63,145 @@ namespace {
     }
 }
 
-nixl_status_t UringQueue::init(int entries, const io_uring_params& params) {
-    // Initialize with basic setup - need a mutable copy since the API modifies the params
-    io_uring_params mutable_params = params;
-    if (io_uring_queue_init_params(entries, &uring, &mutable_params) < 0) {
+UringRingPool::UringRingPool(bool sqpoll) : sqpoll_(sqpoll) {}
+
+UringRingPool::~UringRingPool() {
+    for (auto &r : rings_) {
+        io_uring_queue_exit(&r->uring);
+    }
+}
+
+std::unique_ptr<UringRingPool::ring> UringRingPool::createRing(int num_entries, bool sqpoll) {
+    io_uring_params params = {};
+    if (sqpoll) {
+        // Kernel-side submission polling: submits become plain ring writes
+        // with no syscall as long as the poller thread is awake
+        params.flags |= IORING_SETUP_SQPOLL;
+        params.sq_thread_idle = 1000;
+    }
+
+    auto r = std::make_unique<ring>();
+    r->entries = num_entries;
+    if (io_uring_queue_init_params(num_entries, &r->uring, &params) < 0) {
         throw std::runtime_error(absl::StrFormat("Failed to initialize io_uring instance: %s", nixl_strerror(errno)));
     }
 
     // Log the features supported by this io_uring instance
-    NIXL_INFO << absl::StrFormat("io_uring features: %s", stringifyUringFeatures(mutable_params.features));
+    NIXL_INFO << absl::StrFormat("io_uring features: %s", stringifyUringFeatures(params.features));
 
-    return NIXL_SUCCESS;
+    return r;
+}
+
+std::unique_ptr<UringRingPool::ring> UringRingPool::acquire(int num_entries) {
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        for (auto it = rings_.begin(); it != rings_.end(); ++it) {
+            if ((*it)->entries >= num_entries) {
+                auto r = std::move(*it);
+                rings_.erase(it);
+                return r;
+            }
+        }
+    }
+    return createRing(num_entries, sqpoll_);
+}
+
+void UringRingPool::release(std::unique_ptr<ring> r) {
+    std::lock_guard<std::mutex> guard(lock_);
+    rings_.push_back(std::move(r));
 }
 
-UringQueue::UringQueue(int num_entries, const io_uring_params& params, nixl_xfer_op_t operation)
-    : num_entries(num_entries)
+UringQueue::UringQueue(int num_entries, nixl_xfer_op_t operation, UringRingPool* pool)
+    : pool(pool)
+    , num_entries(num_entries)
     , num_completed(0)
+    , is_read(operation == NIXL_READ)
     , prep_op(operation == NIXL_READ ?
         reinterpret_cast<io_uring_prep_func_t>(io_uring_prep_read) :
         reinterpret_cast<io_uring_prep_func_t>(io_uring_prep_write))
+    , resources_prepared(false)
+    , fixed_io(false)
 {
     if (num_entries <= 0) {
         throw std::invalid_argument("Invalid number of entries for UringQueue");
     }
 
-    init(num_entries, params);
+    ring_ = pool ? pool->acquire(num_entries) : UringRingPool::createRing(num_entries, false);
 }
 
 UringQueue::~UringQueue() {
-    io_uring_queue_exit(&uring);
+    if (fixed_io) {
+        // Pooled rings outlive this request, drop its registrations
+        io_uring_unregister_buffers(&ring_->uring);
+        io_uring_unregister_files(&ring_->uring);
+    }
+    if (pool) {
+        pool->release(std::move(ring_));
+    } else {
+        io_uring_queue_exit(&ring_->uring);
+    }
+}
+
+void UringQueue::registerResources() {
+    resources_prepared = true;
+
+    // prepIO must have collected every entry for fixed I/O to be usable
+    if (iovs.size() != static_cast<size_t>(num_entries)) {
+        return;
+    }
+
+    int ret = io_uring_register_buffers(&ring_->uring, iovs.data(), iovs.size());
+    if (ret < 0) {
+        NIXL_WARN << absl::StrFormat("io_uring buffer registration failed, "
+                                     "falling back to non-fixed I/O: %s", nixl_strerror(-ret));
+        return;
+    }
+
+    ret = io_uring_register_files(&ring_->uring, fds.data(), fds.size());
+    if (ret < 0) {
+        NIXL_WARN << absl::StrFormat("io_uring file registration failed, "
+                                     "falling back to non-fixed I/O: %s", nixl_strerror(-ret));
+        io_uring_unregister_buffers(&ring_->uring);
+        return;
+    }
+
+    fixed_io = true;
 }
 
 nixl_status_t
-UringQueue::submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) {
-    for (auto [local_it, remote_it] = std::make_pair (local.begin(), remote.begin());
-         local_it != local.end() && remote_it != remote.end();
-         ++local_it, ++remote_it) {
-        int fd = remote_it->devId;
-        void *buf = reinterpret_cast<void *> (local_it->addr);
-        size_t len = local_it->len;
-        off_t offset = remote_it->addr;
-
-        struct io_uring_sqe *sqe = io_uring_get_sqe (&uring);
+UringQueue::submit (const nixl_meta_dlist_t &, const nixl_meta_dlist_t &) {
+    if (!resources_prepared) {
+        registerResources();
+    }
+
+    // Entries were collected (and possibly coalesced) by prepIO, so the
+    // descriptor lists are not consulted again here
+    for (unsigned int index = 0; index < iovs.size(); ++index) {
+        int fd = fds[fd_indices[index]];
+        void *buf = iovs[index].iov_base;
+        size_t len = iovs[index].iov_len;
+        off_t offset = offsets[index];
+
+        struct io_uring_sqe *sqe = io_uring_get_sqe (&ring_->uring);
         if (!sqe) {
             NIXL_ERROR << "Failed to get io_uring submission queue entry";
             return NIXL_ERR_BACKEND;
         }
-        prep_op (sqe, fd, buf, len, offset);
+        if (fixed_io) {
+            // Registered buffers and files: the kernel skips per-I/O page
+            // pinning and fd lookup, buf_index is the entry's own iovec
+            if (is_read) {
+                io_uring_prep_read_fixed(sqe, fd_indices[index], buf, len, offset, index);
+            } else {
+                io_uring_prep_write_fixed(sqe, fd_indices[index], buf, len, offset, index);
+            }
+            sqe->flags |= IOSQE_FIXED_FILE;
+        } else {
+            prep_op (sqe, fd, buf, len, offset);
+        }
     }
 
-    int ret = io_uring_submit(&uring);
+    int ret = io_uring_submit(&ring_->uring);
     if (ret != num_entries) {
         if (ret < 0) {
             NIXL_ERROR << absl::StrFormat("io_uring submit failed: %s", nixl_strerror(-ret));
@@ -135,7 +225,7 @@ nixl_status_t UringQueue::checkCompleted() {
     unsigned count = 0;
 
     // Get completion events
-    io_uring_for_each_cqe(&uring, head, cqe) {
+    io_uring_for_each_cqe(&ring_->uring, head, cqe) {
         int res = cqe->res;
         if (res < 0) {
             NIXL_ERROR << absl::StrFormat("IO operation failed: %s", nixl_strerror(-res));
@@ -145,7 +235,7 @@ nixl_status_t UringQueue::checkCompleted() {
     }
 
     // Mark all seen
-    io_uring_cq_advance(&uring, count);
+    io_uring_cq_advance(&ring_->uring, count);
     num_completed += count;
 
     logOnPercentStep(num_completed, num_entries);
@@ -153,6 +243,65 @@ nixl_status_t UringQueue::checkCompleted() {
     return (num_completed == num_entries) ? NIXL_SUCCESS : NIXL_IN_PROG;
 }
 
+nixl_status_t UringQueue::cancel() {
+#ifdef IORING_ASYNC_CANCEL_ANY
+    int remaining = num_entries - num_completed;
+    if (remaining == 0) {
+        return NIXL_SUCCESS;
+    }
+
+    struct io_uring_sqe *sqe = io_uring_get_sqe(&ring_->uring);
+    if (!sqe) {
+        NIXL_ERROR << "Failed to get io_uring submission queue entry for cancel";
+        return NIXL_ERR_BACKEND;
+    }
+    // One SQE aborts every in-flight operation on the ring; operations the
+    // kernel already started complete normally
+    io_uring_prep_cancel(sqe, nullptr, IORING_ASYNC_CANCEL_ANY);
+
+    int ret = io_uring_submit(&ring_->uring);
+    if (ret != 1) {
+        NIXL_ERROR << absl::StrFormat("io_uring cancel submit failed: %s",
+                                      nixl_strerror(ret < 0 ? -ret : EIO));
+        return NIXL_ERR_BACKEND;
+    }
+
+    // Drain the outstanding completions plus the cancel op's own, so the
+    // ring goes back to the pool empty; aborted ops finish with -ECANCELED
+    for (int i = 0; i < remaining + 1; i++) {
+        struct io_uring_cqe *cqe;
+        ret = io_uring_wait_cqe(&ring_->uring, &cqe);
+        if (ret < 0) {
+            NIXL_ERROR << absl::StrFormat("io_uring cancel drain failed: %s",
+                                          nixl_strerror(-ret));
+            return NIXL_ERR_BACKEND;
+        }
+        io_uring_cqe_seen(&ring_->uring, cqe);
+    }
+
+    num_completed = num_entries;
+    return NIXL_SUCCESS;
+#else
+    // Pre-5.19 kernel headers: no IORING_ASYNC_CANCEL_ANY
+    return NIXL_ERR_NOT_SUPPORTED;
+#endif
+}
+
 nixl_status_t UringQueue::prepIO(int fd, void* buf, size_t len, off_t offset) {
+    if (resources_prepared) {
+        // Registration already happened, the entry set is frozen
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    iovs.push_back({buf, len});
+    offsets.push_back(offset);
+
+    auto it = std::find(fds.begin(), fds.end(), fd);
+    if (it == fds.end()) {
+        fd_indices.push_back(fds.size());
+        fds.push_back(fd);
+    } else {
+        fd_indices.push_back(it - fds.begin());
+    }
     return NIXL_SUCCESS;
 }
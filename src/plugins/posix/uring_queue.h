@@ -19,6 +19,9 @@
 #define URING_QUEUE_H
 
 #include <liburing.h>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include "posix_queue.h"
 #include <absl/strings/str_format.h>
 
@@ -28,15 +31,53 @@ class nixlPosixBackendReqH;
 // Type definition for io_uring prep functions
 typedef void (*io_uring_prep_func_t)(struct io_uring_sqe*, int, const void*, unsigned int, __u64);
 
+// Engine-lifetime pool of initialized rings. Queues borrow a ring for the
+// duration of a request and return it on destruction, so ring setup (and the
+// SQPOLL kernel thread, when enabled) is paid once per engine, not per
+// transfer. A borrowed ring is used exclusively by one queue at a time.
+class UringRingPool : public nixlPosixRingPool {
+    public:
+        struct ring {
+            struct io_uring uring;
+            int entries;  // Submission queue size the ring was created with
+        };
+
+        explicit UringRingPool(bool sqpoll);
+        ~UringRingPool() override;
+
+        // Borrow a ring with room for at least num_entries submissions,
+        // creating one on demand when no pooled ring is large enough
+        std::unique_ptr<ring> acquire(int num_entries);
+        void release(std::unique_ptr<ring> r);
+
+        // Create a standalone ring; throws std::runtime_error on failure
+        static std::unique_ptr<ring> createRing(int num_entries, bool sqpoll);
+
+    private:
+        const bool sqpoll_;
+        std::mutex lock_;
+        std::vector<std::unique_ptr<ring>> rings_;
+};
+
 class UringQueue : public nixlPosixQueue {
     private:
-        struct io_uring uring;         // The io_uring instance for async I/O operations
+        UringRingPool* const pool;     // Pool the ring is borrowed from, may be null
+        std::unique_ptr<UringRingPool::ring> ring_; // The ring backing this queue
         const int num_entries;         // Total number of entries expected in this ring
         int num_completed;             // Number of completed operations so far
-        io_uring_prep_func_t prep_op;  // Pointer to prep function
+        const bool is_read;            // Whether this queue performs reads or writes
+        io_uring_prep_func_t prep_op;  // Pointer to prep function (non-fixed fallback)
+
+        std::vector<struct iovec> iovs;  // Per-entry buffers collected by prepIO
+        std::vector<off_t> offsets;      // Per-entry file offsets collected by prepIO
+        std::vector<int> fds;            // Unique file descriptors collected by prepIO
+        std::vector<unsigned int> fd_indices; // Per-entry index into fds
+        bool resources_prepared;       // Registration was attempted
+        bool fixed_io;                 // Buffers/files are registered, use fixed opcodes
 
-        // Initialize the queue with the given parameters
-        nixl_status_t init(int num_entries, const struct io_uring_params& params);
+        // Register collected buffers and files with the ring; falls back to
+        // plain read/write SQEs if the kernel refuses (e.g. RLIMIT_MEMLOCK)
+        void registerResources();
 
         // Delete copy and move operations to prevent accidental copying of kernel resources
         UringQueue(const UringQueue&) = delete;
@@ -45,12 +86,13 @@ class UringQueue : public nixlPosixQueue {
         UringQueue& operator=(UringQueue&&) = delete;
 
     public:
-        UringQueue(int num_entries, const struct io_uring_params& params, nixl_xfer_op_t operation);
+        UringQueue(int num_entries, nixl_xfer_op_t operation, UringRingPool* pool = nullptr);
         ~UringQueue();
         nixl_status_t
         submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) override;
         nixl_status_t checkCompleted() override;
         nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) override;
+        nixl_status_t cancel() override;
 };
 
 #endif // URING_QUEUE_H
@@ -0,0 +1,508 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <fcntl.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <fstream>
+
+#include "shm_backend.h"
+#include "common/nixl_log.h"
+
+namespace {
+
+// Serialized public metadata of a registered region
+struct shmPublicMD {
+    uint32_t pid;
+    uint64_t addr;
+    uint64_t len;
+} __attribute__((packed));
+
+// Connection info announced to peers: host identity for the same-node
+// check, the owning pid, and the name of the notification ring
+struct shmConnInfo {
+    char     bootId[40];
+    uint32_t pid;
+    char     ringName[64];
+} __attribute__((packed));
+
+constexpr size_t SHM_NOTIF_RING_BYTES = 1 << 20;
+
+} // namespace
+
+// Notification ring shared between processes: a byte ring of
+// length-prefixed (agent, message) records, guarded by a robust
+// process-shared mutex. head/tail grow monotonically; positions are
+// taken modulo capacity on access.
+struct shmNotifRing {
+    pthread_mutex_t lock;
+    uint64_t        head;
+    uint64_t        tail;
+    uint64_t        capacity;
+    char            data[];
+};
+
+namespace {
+
+int
+ringLock(shmNotifRing *ring) {
+    int rc = pthread_mutex_lock(&ring->lock);
+    if (rc == EOWNERDEAD) {
+        // A peer died holding the lock; the ring stays structurally valid
+        // since records are written before head moves
+        pthread_mutex_consistent(&ring->lock);
+        rc = 0;
+    }
+    return rc;
+}
+
+void
+ringCopyIn(shmNotifRing *ring, uint64_t pos, const void *src, size_t len) {
+    size_t off   = pos % ring->capacity;
+    size_t first = std::min(len, (size_t)(ring->capacity - off));
+    memcpy(ring->data + off, src, first);
+    memcpy(ring->data, (const char *)src + first, len - first);
+}
+
+void
+ringCopyOut(shmNotifRing *ring, uint64_t pos, void *dst, size_t len) {
+    size_t off   = pos % ring->capacity;
+    size_t first = std::min(len, (size_t)(ring->capacity - off));
+    memcpy(dst, ring->data + off, first);
+    memcpy((char *)dst + first, ring->data, len - first);
+}
+
+bool
+ringPut(shmNotifRing *ring, const std::string &agent, const std::string &msg) {
+    uint32_t alen = agent.size();
+    uint32_t mlen = msg.size();
+    uint64_t need = sizeof(alen) + sizeof(mlen) + alen + mlen;
+
+    if (ring->capacity - (ring->head - ring->tail) < need)
+        return false;
+
+    uint64_t pos = ring->head;
+    ringCopyIn(ring, pos, &alen, sizeof(alen));
+    pos += sizeof(alen);
+    ringCopyIn(ring, pos, &mlen, sizeof(mlen));
+    pos += sizeof(mlen);
+    ringCopyIn(ring, pos, agent.data(), alen);
+    pos += alen;
+    ringCopyIn(ring, pos, msg.data(), mlen);
+    ring->head += need;
+    return true;
+}
+
+bool
+ringGet(shmNotifRing *ring, std::string &agent, std::string &msg) {
+    if (ring->head == ring->tail)
+        return false;
+
+    uint32_t alen, mlen;
+    uint64_t pos = ring->tail;
+    ringCopyOut(ring, pos, &alen, sizeof(alen));
+    pos += sizeof(alen);
+    ringCopyOut(ring, pos, &mlen, sizeof(mlen));
+    pos += sizeof(mlen);
+    agent.resize(alen);
+    msg.resize(mlen);
+    ringCopyOut(ring, pos, &agent[0], alen);
+    pos += alen;
+    ringCopyOut(ring, pos, &msg[0], mlen);
+    ring->tail += sizeof(alen) + sizeof(mlen) + alen + mlen;
+    return true;
+}
+
+std::string
+readBootId() {
+    std::ifstream f("/proc/sys/kernel/random/boot_id");
+    std::string id;
+    if (f.good())
+        std::getline(f, id);
+    if (id.empty()) {
+        // Fallback identity; weaker than the boot id but still catches
+        // the common cross-node case
+        char host[64] = {0};
+        gethostname(host, sizeof(host) - 1);
+        id = host;
+    }
+    return id;
+}
+
+} // namespace
+
+// Transfer handle: copies complete synchronously in postXfer, the
+// handle only carries the resulting status for checkXfer
+class nixlShmBackendReqH : public nixlBackendReqH {
+    public:
+        nixl_status_t status = NIXL_ERR_NOT_POSTED;
+};
+
+nixlShmEngine::nixlShmEngine(const nixlBackendInitParams* init_params)
+    : nixlBackendEngine(init_params) {
+
+    bootId_ = readBootId();
+
+    // Per-agent ring name; pid keeps restarted agents from colliding
+    // with a stale unlinked segment of the same name
+    ringName_ = "/nixl_shm_" + std::to_string(getpid()) + "_" +
+        std::to_string(std::hash<std::string>{}(localAgent) & 0xffffffffu);
+
+    int fd = shm_open(ringName_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        NIXL_ERROR << "Failed to create notification ring " << ringName_
+                   << ": " << strerror(errno);
+        initErr = true;
+        return;
+    }
+
+    size_t total = sizeof(shmNotifRing) + SHM_NOTIF_RING_BYTES;
+    if (ftruncate(fd, total) != 0) {
+        NIXL_ERROR << "Failed to size notification ring " << ringName_
+                   << ": " << strerror(errno);
+        close(fd);
+        shm_unlink(ringName_.c_str());
+        initErr = true;
+        return;
+    }
+
+    ring_ = (shmNotifRing *)mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                                 MAP_SHARED, fd, 0);
+    close(fd);
+    if (ring_ == MAP_FAILED) {
+        NIXL_ERROR << "Failed to map notification ring " << ringName_
+                   << ": " << strerror(errno);
+        ring_ = nullptr;
+        shm_unlink(ringName_.c_str());
+        initErr = true;
+        return;
+    }
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&ring_->lock, &attr);
+    pthread_mutexattr_destroy(&attr);
+
+    ring_->head     = 0;
+    ring_->tail     = 0;
+    ring_->capacity = SHM_NOTIF_RING_BYTES;
+}
+
+nixlShmEngine::~nixlShmEngine() {
+    for (auto &it : peers_) {
+        if (it.second.ring)
+            munmap(it.second.ring,
+                   sizeof(shmNotifRing) + it.second.ring->capacity);
+    }
+
+    if (ring_) {
+        munmap(ring_, sizeof(shmNotifRing) + SHM_NOTIF_RING_BYTES);
+        shm_unlink(ringName_.c_str());
+    }
+}
+
+nixl_status_t nixlShmEngine::registerMem(const nixlBlobDesc &mem,
+                                         const nixl_mem_t &nixl_mem,
+                                         nixlBackendMD* &out) {
+    if (nixl_mem != DRAM_SEG)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    nixlShmMetadata *md = new nixlShmMetadata(true);
+    md->pid  = getpid();
+    md->addr = mem.addr;
+    md->len  = mem.len;
+    out = md;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::deregisterMem(nixlBackendMD *meta) {
+    delete meta;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::getPublicData(const nixlBackendMD *meta,
+                                           std::string &str) const {
+    const nixlShmMetadata *md = (const nixlShmMetadata *)meta;
+    shmPublicMD pub;
+    pub.pid  = md->pid;
+    pub.addr = md->addr;
+    pub.len  = md->len;
+    str.assign((const char *)&pub, sizeof(pub));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::getConnInfo(std::string &str) const {
+    shmConnInfo info = {};
+    strncpy(info.bootId, bootId_.c_str(), sizeof(info.bootId) - 1);
+    info.pid = getpid();
+    strncpy(info.ringName, ringName_.c_str(), sizeof(info.ringName) - 1);
+    str.assign((const char *)&info, sizeof(info));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::loadRemoteConnInfo(const std::string &remote_agent,
+                                                const std::string &remote_conn_info) {
+    if (remote_conn_info.size() != sizeof(shmConnInfo))
+        return NIXL_ERR_INVALID_PARAM;
+
+    shmConnInfo info;
+    memcpy(&info, remote_conn_info.data(), sizeof(info));
+    info.bootId[sizeof(info.bootId) - 1]     = '\0';
+    info.ringName[sizeof(info.ringName) - 1] = '\0';
+
+    // Cross-node peers are rejected here; the agent skips this backend
+    // for them and keeps loading the rest of the metadata
+    if (bootId_ != info.bootId)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    std::lock_guard<std::mutex> lock(peerLock_);
+    peerInfo &peer = peers_[remote_agent];
+    peer.pid      = (pid_t)info.pid;
+    peer.sameNode = true;
+    peer.ringName = info.ringName;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::mapPeerRing(peerInfo &peer) const {
+    if (peer.ring)
+        return NIXL_SUCCESS;
+
+    int fd = shm_open(peer.ringName.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        NIXL_ERROR << "Failed to open peer notification ring "
+                   << peer.ringName << ": " << strerror(errno);
+        return NIXL_ERR_BACKEND;
+    }
+
+    size_t total = sizeof(shmNotifRing) + SHM_NOTIF_RING_BYTES;
+    peer.ring = (shmNotifRing *)mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                                     MAP_SHARED, fd, 0);
+    close(fd);
+    if (peer.ring == MAP_FAILED) {
+        peer.ring = nullptr;
+        NIXL_ERROR << "Failed to map peer notification ring "
+                   << peer.ringName << ": " << strerror(errno);
+        return NIXL_ERR_BACKEND;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::connect(const std::string &remote_agent) {
+    if (remote_agent == localAgent)
+        return NIXL_SUCCESS;
+
+    std::lock_guard<std::mutex> lock(peerLock_);
+    auto it = peers_.find(remote_agent);
+    if (it == peers_.end())
+        return NIXL_ERR_NOT_FOUND;
+    if (!it->second.sameNode)
+        return NIXL_ERR_NOT_SUPPORTED;
+    return mapPeerRing(it->second);
+}
+
+nixl_status_t nixlShmEngine::disconnect(const std::string &remote_agent) {
+    std::lock_guard<std::mutex> lock(peerLock_);
+    auto it = peers_.find(remote_agent);
+    if (it != peers_.end()) {
+        if (it->second.ring)
+            munmap(it->second.ring,
+                   sizeof(shmNotifRing) + SHM_NOTIF_RING_BYTES);
+        peers_.erase(it);
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::loadRemoteMD(const nixlBlobDesc &input,
+                                          const nixl_mem_t &nixl_mem,
+                                          const std::string &remote_agent,
+                                          nixlBackendMD* &output) {
+    if (nixl_mem != DRAM_SEG)
+        return NIXL_ERR_NOT_SUPPORTED;
+    if (input.metaInfo.size() != sizeof(shmPublicMD))
+        return NIXL_ERR_INVALID_PARAM;
+
+    shmPublicMD pub;
+    memcpy(&pub, input.metaInfo.data(), sizeof(pub));
+    if (pub.pid == 0)
+        return NIXL_ERR_INVALID_PARAM;
+
+    nixlShmMetadata *md = new nixlShmMetadata(false);
+    md->pid  = (pid_t)pub.pid;
+    md->addr = input.addr;
+    md->len  = input.len;
+    output = md;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::loadLocalMD(nixlBackendMD *input,
+                                         nixlBackendMD* &output) {
+    nixlShmMetadata *local = (nixlShmMetadata *)input;
+    nixlShmMetadata *md = new nixlShmMetadata(false);
+    md->pid  = local->pid;
+    md->addr = local->addr;
+    md->len  = local->len;
+    output = md;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::unloadMD(nixlBackendMD *input) {
+    delete input;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::prepXfer(const nixl_xfer_op_t &operation,
+                                      const nixl_meta_dlist_t &local,
+                                      const nixl_meta_dlist_t &remote,
+                                      const std::string &remote_agent,
+                                      nixlBackendReqH* &handle,
+                                      const nixl_opt_b_args_t* opt_args) const {
+    if (local.descCount() != remote.descCount() || local.descCount() == 0)
+        return NIXL_ERR_INVALID_PARAM;
+    if (local.getType() != DRAM_SEG || remote.getType() != DRAM_SEG)
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    // Cross-node sections can be loaded but never transferred against
+    if (remote_agent != localAgent) {
+        std::lock_guard<std::mutex> lock(peerLock_);
+        auto it = peers_.find(remote_agent);
+        if (it == peers_.end() || !it->second.sameNode)
+            return NIXL_ERR_NOT_SUPPORTED;
+    }
+
+    handle = new nixlShmBackendReqH();
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::postXfer(const nixl_xfer_op_t &operation,
+                                      const nixl_meta_dlist_t &local,
+                                      const nixl_meta_dlist_t &remote,
+                                      const std::string &remote_agent,
+                                      nixlBackendReqH* &handle,
+                                      const nixl_opt_b_args_t* opt_args) const {
+    nixlShmBackendReqH *req = (nixlShmBackendReqH *)handle;
+
+    if (local.descCount() != remote.descCount())
+        return NIXL_ERR_INVALID_PARAM;
+
+    const pid_t self = getpid();
+    for (int i = 0; i < local.descCount(); ++i) {
+        const nixlShmMetadata *rmd =
+            (const nixlShmMetadata *)remote[i].metadataP;
+        if (!rmd)
+            return NIXL_ERR_INVALID_PARAM;
+
+        char *laddr  = (char *)local[i].addr;
+        char *raddr  = (char *)remote[i].addr;
+        size_t left  = local[i].len;
+
+        if (rmd->pid == self) {
+            // Loopback or same-process peer: plain memcpy
+            if (operation == NIXL_READ)
+                memcpy(laddr, raddr, left);
+            else
+                memcpy(raddr, laddr, left);
+            continue;
+        }
+
+        while (left > 0) {
+            struct iovec liov = {laddr, left};
+            struct iovec riov = {raddr, left};
+            ssize_t n = (operation == NIXL_READ) ?
+                process_vm_readv(rmd->pid, &liov, 1, &riov, 1, 0) :
+                process_vm_writev(rmd->pid, &liov, 1, &riov, 1, 0);
+            if (n <= 0) {
+                NIXL_ERROR << "Cross-process copy to pid " << rmd->pid
+                           << " failed: " << strerror(errno);
+                req->status = NIXL_ERR_BACKEND;
+                return NIXL_ERR_BACKEND;
+            }
+            laddr += n;
+            raddr += n;
+            left  -= n;
+        }
+    }
+
+    req->status = NIXL_SUCCESS;
+
+    if (opt_args && opt_args->hasNotif) {
+        nixl_status_t ret = genNotif(remote_agent, opt_args->notifMsg);
+        if (ret != NIXL_SUCCESS)
+            return ret;
+    }
+
+    // Copies are synchronous; the transfer is complete on return
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::checkXfer(nixlBackendReqH *handle) const {
+    return ((nixlShmBackendReqH *)handle)->status;
+}
+
+nixl_status_t nixlShmEngine::releaseReqH(nixlBackendReqH *handle) const {
+    delete handle;
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::genNotif(const std::string &remote_agent,
+                                      const std::string &msg) const {
+    shmNotifRing *ring;
+
+    if (remote_agent == localAgent) {
+        ring = ring_;
+    } else {
+        std::lock_guard<std::mutex> lock(peerLock_);
+        auto it = peers_.find(remote_agent);
+        if (it == peers_.end() || !it->second.sameNode)
+            return NIXL_ERR_NOT_FOUND;
+        nixl_status_t ret = mapPeerRing(it->second);
+        if (ret != NIXL_SUCCESS)
+            return ret;
+        ring = it->second.ring;
+    }
+
+    if (ringLock(ring) != 0)
+        return NIXL_ERR_BACKEND;
+    bool ok = ringPut(ring, localAgent, msg);
+    pthread_mutex_unlock(&ring->lock);
+
+    if (!ok) {
+        NIXL_WARN << "Notification ring of " << remote_agent
+                  << " is full, dropping notification";
+        return NIXL_ERR_BACKEND;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlShmEngine::getNotifs(notif_list_t &notif_list) {
+    if (ringLock(ring_) != 0)
+        return NIXL_ERR_BACKEND;
+
+    std::string agent, msg;
+    while (ringGet(ring_, agent, msg))
+        notif_list.push_back(std::make_pair(agent, msg));
+
+    pthread_mutex_unlock(&ring_->lock);
+    return NIXL_SUCCESS;
+}
@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __SHM_BACKEND_H
+#define __SHM_BACKEND_H
+
+#include <sys/types.h>
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "backend/backend_engine.h"
+
+struct shmNotifRing;
+
+// Registered or remotely loaded DRAM region: the owning process and the
+// address in that process's address space. Transfers copy directly
+// between address spaces with process_vm_readv/writev, so registration
+// needs no shared mapping of the data itself.
+class nixlShmMetadata : public nixlBackendMD {
+    public:
+        pid_t     pid  = 0;
+        uintptr_t addr = 0;
+        size_t    len  = 0;
+
+        nixlShmMetadata(bool is_private) : nixlBackendMD(is_private) {}
+};
+
+// Same-node transport: DRAM transfers are direct cross-process copies
+// (memory-bandwidth-bound, no NIC involvement), notifications go through
+// a small shared-memory ring each agent creates and announces in its
+// connection info. Requires ptrace-level permission towards the peer
+// process (same user, or CAP_SYS_PTRACE).
+class nixlShmEngine : public nixlBackendEngine {
+    public:
+        nixlShmEngine(const nixlBackendInitParams* init_params);
+        ~nixlShmEngine();
+
+        bool supportsRemote() const override { return true; }
+        bool supportsLocal() const override { return true; }
+        bool supportsNotif() const override { return true; }
+        bool supportsProgTh() const override { return false; }
+
+        nixl_mem_list_t getSupportedMems() const override {
+            return {DRAM_SEG};
+        }
+
+        nixl_status_t registerMem(const nixlBlobDesc &mem,
+                                  const nixl_mem_t &nixl_mem,
+                                  nixlBackendMD* &out) override;
+
+        nixl_status_t deregisterMem(nixlBackendMD* meta) override;
+
+        nixl_status_t connect(const std::string &remote_agent) override;
+
+        nixl_status_t disconnect(const std::string &remote_agent) override;
+
+        nixl_status_t unloadMD(nixlBackendMD* input) override;
+
+        nixl_status_t prepXfer(const nixl_xfer_op_t &operation,
+                               const nixl_meta_dlist_t &local,
+                               const nixl_meta_dlist_t &remote,
+                               const std::string &remote_agent,
+                               nixlBackendReqH* &handle,
+                               const nixl_opt_b_args_t* opt_args=nullptr) const override;
+
+        nixl_status_t postXfer(const nixl_xfer_op_t &operation,
+                               const nixl_meta_dlist_t &local,
+                               const nixl_meta_dlist_t &remote,
+                               const std::string &remote_agent,
+                               nixlBackendReqH* &handle,
+                               const nixl_opt_b_args_t* opt_args=nullptr) const override;
+
+        nixl_status_t checkXfer(nixlBackendReqH* handle) const override;
+
+        nixl_status_t releaseReqH(nixlBackendReqH* handle) const override;
+
+        nixl_status_t getPublicData(const nixlBackendMD* meta,
+                                    std::string &str) const override;
+
+        nixl_status_t getConnInfo(std::string &str) const override;
+
+        nixl_status_t loadRemoteConnInfo(const std::string &remote_agent,
+                                         const std::string &remote_conn_info) override;
+
+        nixl_status_t loadRemoteMD(const nixlBlobDesc &input,
+                                   const nixl_mem_t &nixl_mem,
+                                   const std::string &remote_agent,
+                                   nixlBackendMD* &output) override;
+
+        nixl_status_t loadLocalMD(nixlBackendMD* input,
+                                  nixlBackendMD* &output) override;
+
+        nixl_status_t getNotifs(notif_list_t &notif_list) override;
+
+        nixl_status_t genNotif(const std::string &remote_agent,
+                               const std::string &msg) const override;
+
+    private:
+        struct peerInfo {
+            pid_t         pid      = 0;
+            bool          sameNode = false;
+            std::string   ringName;
+            shmNotifRing *ring     = nullptr; // mapped on first notif/connect
+        };
+
+        // Maps the peer's notification ring if not mapped yet; caller
+        // holds peerLock_
+        nixl_status_t mapPeerRing(peerInfo &peer) const;
+
+        // Host identity used to tell same-node peers from remote ones
+        std::string bootId_;
+
+        // Own notification ring, created at init and unlinked at teardown
+        std::string   ringName_;
+        shmNotifRing *ring_ = nullptr;
+
+        mutable std::mutex peerLock_;
+        mutable std::unordered_map<std::string, peerInfo> peers_;
+};
+
+#endif
@@ -30,6 +30,7 @@
 
 #include "nixl.h"
 #include "backend/backend_engine.h"
+#include "common/mpsc_queue.h"
 #include "common/str_tools.h"
 
 // Local includes
@@ -38,12 +39,69 @@
 #include "ucx/ucx_utils.h"
 #include "common/list_elem.h"
 
-enum ucx_cb_op_t { NOTIF_STR };
+enum ucx_cb_op_t { NOTIF_STR, NOTIF_MBOX, EAGER_XFER, CONN_PROBE, NOTIF_BATCH };
+
+/**
+ * Persistent RDMA-write notification mailbox shared with one peer.
+ *
+ * Each side allocates a ring of slots the peer writes notifications into
+ * with plain RDMA puts, plus an ack word the peer advances as it consumes
+ * our notifications; the addresses and rkey are sent in a NOTIF_MBOX
+ * active message when the connection is loaded. Small notifications then
+ * bypass the active-message path entirely: the sender writes a slot and
+ * the receiver picks it up by polling the ring from getNotifs, without
+ * waking the remote progress logic.
+ */
+class nixlUcxNotifMailbox {
+    private:
+        static constexpr size_t num_slots = 16;
+        static constexpr size_t slot_size = 4096;
+        // Slot layout: [seq][len][checksum][payload (padded to 8B)][seq again]
+        static constexpr size_t header_bytes = 3 * sizeof(uint64_t);
+        static constexpr size_t payload_capacity =
+            slot_size - header_bytes - 2 * sizeof(uint64_t);
+        static constexpr size_t ring_bytes = num_slots * slot_size;
+        // Local registered region: [recv ring][send staging ring][ack word]
+        static constexpr size_t ack_offset = 2 * ring_bytes;
+        static constexpr size_t region_bytes = ack_offset + sizeof(uint64_t);
+
+        // uint64_t elements keep the slot headers naturally aligned
+        std::vector<uint64_t> region;
+        nixlUcxMem mem;
+        bool registered = false;
+        uint64_t recvSeq = 0;   // Last sequence consumed from the recv ring
+        uint64_t ackToSend = 0; // Stable storage for the fire-and-forget ack put
+
+        // Peer side, filled in by the NOTIF_MBOX handler
+        std::atomic<bool> peerReady{false};
+        uint64_t peerRingAddr = 0;
+        uint64_t peerAckAddr = 0;
+        std::shared_ptr<const nixl::ucx::rkeyCache::rkeyList> peerRkeys;
+
+        std::mutex sendLock; // Serializes slot allocation among senders
+        uint64_t sendSeq = 0; // Last sequence posted to the peer's ring
+
+    friend class nixlUcxEngine;
+};
 
 class nixlUcxConnection : public nixlBackendConnMD {
     private:
         std::string remoteAgent;
         std::vector<std::unique_ptr<nixlUcxEp>> eps;
+        std::unique_ptr<nixlUcxNotifMailbox> mailbox;
+        // Peer runs on this node (host id from its conn info matched ours);
+        // enables the CUDA IPC fast path for its VRAM registrations
+        bool sameHost = false;
+        // Wire address the endpoints were created from (host-id trailer
+        // already stripped), kept so failed endpoints can be recreated in
+        // place (see recoverConnEps); epoch is bumped on every recovery
+        // and loaded metadata replays its rkeys when it falls behind
+        std::vector<char> remoteAddr;
+        uint64_t epoch = 0;
+        // Small-message round trip sampled on the first prewarm of this
+        // peer (see probeConnRtt); 0 until a probe has completed. Slow
+        // links stretch the eager WRITE cutoff, see eagerCutoff()
+        nixlTime::us_t probeRttUs = 0;
 
     public:
         [[nodiscard]] const std::unique_ptr<nixlUcxEp>& getEp(size_t ep_id) const noexcept {
@@ -79,20 +137,39 @@ public:
 
     [[nodiscard]] const nixl::ucx::rkey &
     getRkey(size_t id) const {
-        return *rkeys_[id];
+        return *(*rkeys_)[id];
     }
 
     void
-    addRkey(const nixlUcxEp &ep, const void *rkey_buffer) {
-        rkeys_.emplace_back(std::make_unique<nixl::ucx::rkey>(ep, rkey_buffer));
+    setRkeys(std::shared_ptr<const nixl::ucx::rkeyCache::rkeyList> rkeys) {
+        rkeys_ = std::move(rkeys);
     }
 
     ucx_connection_ptr_t conn;
 
+    // Same-host CUDA IPC fast path (see ucx_backend.cpp): when set, the
+    // peer's VRAM allocation is mapped into this process and transfers
+    // use device copies instead of RDMA loopback
+    uint64_t ipcMappedBase = 0;
+    uint64_t ipcRemoteBase = 0;
+    bool ipcMapped = false;
+    std::string ipcKey; // Mapping-cache key, empty for loopback metadata
+
+    // Packed rkey blob and the connection epoch rkeys_ were unpacked
+    // under, so a recovered connection can replay the rkeys on its new
+    // endpoints without reloading the peer's metadata
+    nixl_blob_t rkeyBlob;
+    uint64_t connEpoch = 0;
+
 private:
-    std::vector<std::unique_ptr<nixl::ucx::rkey>> rkeys_;
+    // Shared with the engine's rkey cache, so repeated metadata loads of
+    // the same range reuse one set of unpacked rkeys
+    std::shared_ptr<const nixl::ucx::rkeyCache::rkeyList> rkeys_;
 };
 
+class nixlUcxBackendH;
+class nixlUcxStripedBackendH;
+
 // Forward declaration of CUDA context
 // It is only visible in ucx_backend.cpp to ensure that
 // HAVE_CUDA works properly
@@ -101,6 +178,7 @@ private:
 // HAVE_CUDA in h-files
 class nixlUcxCudaCtx;
 class nixlUcxCudaDevicePrimaryCtx;
+class nixlUcxCudaIpcCtx;
 using nixlUcxCudaDevicePrimaryCtxPtr = std::shared_ptr<nixlUcxCudaDevicePrimaryCtx>;
 
 class nixlUcxEngine : public nixlBackendEngine {
@@ -130,6 +208,23 @@ public:
         return false;
     }
 
+    bool
+    supportsSignal() const override {
+        return true;
+    }
+
+    // postXfer reads the descriptor lists on every submission (see
+    // postXferPriv), so handles updated by updateXferReq repost correctly
+    bool
+    supportsXferUpdate() const override {
+        return true;
+    }
+
+    bool
+    supportsSharedInstance() const override {
+        return true;
+    }
+
     nixl_mem_list_t
     getSupportedMems() const override;
 
@@ -145,13 +240,31 @@ public:
     nixl_status_t
     connect(const std::string &remote_agent) override;
     nixl_status_t
+    prewarmConnection(const std::string &remote_agent, nixlBackendReqH *&handle) override;
+    nixl_status_t
     disconnect(const std::string &remote_agent) override;
+    nixl_status_t
+    addLocalAgent(const std::string &local_agent) override;
+    nixl_status_t
+    removeLocalAgent(const std::string &local_agent) override;
 
     nixl_status_t
     registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem, nixlBackendMD *&out) override;
     nixl_status_t
     deregisterMem(nixlBackendMD *meta) override;
 
+    // Registration sharing via UCX exported memory handles
+    // (ucp_memh_pack/ucp_mem_map); imports are torn down through the
+    // regular deregisterMem, which unmaps without unpinning the
+    // exporter's pages
+    nixl_status_t
+    exportMem(nixlBackendMD *meta, nixl_blob_t &handle) const override;
+    nixl_status_t
+    importMem(const nixlBlobDesc &mem,
+              const nixl_mem_t &nixl_mem,
+              const nixl_blob_t &handle,
+              nixlBackendMD *&out) override;
+
     nixl_status_t
     loadLocalMD(nixlBackendMD *input, nixlBackendMD *&output) override;
 
@@ -161,6 +274,11 @@ public:
                  const std::string &remote_agent,
                  nixlBackendMD *&output) override;
     nixl_status_t
+    loadRemoteMDBatch(const nixl_reg_dlist_t &input,
+                      const nixl_mem_t &nixl_mem,
+                      const std::string &remote_agent,
+                      std::vector<nixlBackendMD *> &output) override;
+    nixl_status_t
     unloadMD(nixlBackendMD *input) override;
 
     // Data transfer
@@ -194,6 +312,10 @@ public:
     nixl_status_t
     checkXfer(nixlBackendReqH *handle) const override;
     nixl_status_t
+    getXferProgress(nixlBackendReqH *handle, size_t &bytes_done) const override;
+    nixl_status_t
+    cancelXfer(nixlBackendReqH *handle) const override;
+    nixl_status_t
     releaseReqH(nixlBackendReqH *handle) const override;
 
     int
@@ -203,11 +325,38 @@ public:
     getNotifs(notif_list_t &notif_list) override;
     nixl_status_t
     genNotif(const std::string &remote_agent, const std::string &msg) const override;
+    nixl_status_t
+    genNotifBatch(const std::string &remote_agent,
+                  const std::vector<std::string> &msgs) const override;
+
+    nixl_status_t
+    getTunableParams(std::vector<nixl_tunable_param_t> &params) const override;
+    nixl_status_t
+    retune(const std::string &param, uint64_t value) override;
 
     // public function for UCX worker to mark connections as connected
     nixl_status_t
     checkConn(const std::string &remote_agent);
 
+    // Scoped endpoint recovery: recreate the failed rails of one
+    // connection from its cached wire address and bump its epoch; only
+    // requests already in flight on the dead endpoints fail
+    nixl_status_t
+    recoverConnEps(const ucx_connection_ptr_t &conn) const;
+
+    // Cpulist the progress threads pin themselves to on startup
+    const std::string &
+    progressThreadCpuSet() const {
+        return threadCpuSet_;
+    }
+
+    // Count of shared workers reserved as high-priority lanes (the last
+    // ones); progress loops sweep these ahead of the bulk lanes
+    size_t
+    numPriorityWorkers() const {
+        return numPriorityWorkers_;
+    }
+
 protected:
     const std::vector<std::unique_ptr<nixlUcxWorker>> &
     getWorkers() const {
@@ -222,6 +371,11 @@ protected:
     size_t
     getWorkerId() const;
 
+    // Picks one of the reserved high-priority workers round-robin; only
+    // valid when priority_workers > 0
+    size_t
+    getPriorityWorkerId() const;
+
     virtual size_t
     getSharedWorkersSize() const {
         return uws.size();
@@ -255,9 +409,49 @@ private:
     int
     vramUpdateCtx(void *address, uint64_t dev_id, bool &restart_reqd);
 
-    // Memory management helpers
+    // Memory management helpers, rkeys are cached per (agent, range) when a
+    // range is given (len != 0)
     nixl_status_t
-    internalMDHelper(const nixl_blob_t &blob, const std::string &agent, nixlBackendMD *&output);
+    internalMDHelper(const nixl_blob_t &blob,
+                     const std::string &agent,
+                     uint64_t addr,
+                     size_t len,
+                     nixlBackendMD *&output);
+
+    // Replay the metadata's rkeys on the connection's current endpoints
+    // when an endpoint recovery happened since they were unpacked
+    nixl_status_t
+    refreshMDRkeys(nixlUcxPublicMetadata *rmd) const;
+
+    // Same-host CUDA IPC fast path: maps the peer allocation advertised
+    // in a VRAM blob's IPC trailer into this process
+    void
+    cudaIpcAttach(nixlUcxPublicMetadata &md,
+                  const std::string &agent,
+                  const std::string &ipc_key,
+                  uint64_t remote_base);
+
+    // Posts a device copy into/from the peer's mapped allocation instead
+    // of an RDMA loopback; the caller falls back to the rkey path on error
+    nixl_status_t
+    postCudaIpcCopy(const nixl_xfer_op_t &operation,
+                    void *laddr,
+                    uint64_t raddr,
+                    size_t len,
+                    nixlUcxPublicMetadata *rmd,
+                    nixlUcxBackendH *handle) const;
+
+    // Self-transfer elision: both sides of the range belong to this very
+    // agent (loadLocalMD path), so the data moves with plain copies
+    // instead of an RMA loopback through the NIC; the caller falls back
+    // to the rkey path on error
+    nixl_status_t
+    postLoopbackXfer(const nixl_xfer_op_t &operation,
+                     const nixl_meta_dlist_t &local,
+                     const nixl_meta_dlist_t &remote,
+                     nixlUcxBackendH *handle,
+                     size_t start_idx,
+                     size_t end_idx) const;
 
     // Notifications
     static ucs_status_t
@@ -268,17 +462,220 @@ private:
               size_t length,
               const ucp_am_recv_param_t *param);
 
+    static ucs_status_t
+    notifBatchAmCb(void *arg,
+                   const void *header,
+                   size_t header_length,
+                   void *data,
+                   size_t length,
+                   const ucp_am_recv_param_t *param);
+
     nixl_status_t
     notifSendPriv(const std::string &remote_agent,
                   const std::string &msg,
                   nixlUcxReq &req,
                   size_t worker_id) const;
 
+    nixl_status_t
+    notifBatchSendPriv(const std::string &remote_agent,
+                       const std::vector<std::string> &msgs) const;
+
+    nixl_status_t
+    flushPendingNotifs(bool force) const;
+
+    // Eager small-transfer path: a WRITE whose whole payload fits under
+    // eagerThreshold_ rides the AM channel with its destination addresses
+    // and the receiver copies it into place, one message end to end
+    static ucs_status_t
+    eagerXferAmCb(void *arg,
+                  const void *header,
+                  size_t header_length,
+                  void *data,
+                  size_t length,
+                  const ucp_am_recv_param_t *param);
+
+    nixl_status_t
+    eagerXferSend(const nixl_meta_dlist_t &local,
+                  const nixl_meta_dlist_t &remote,
+                  nixlUcxBackendH *handle,
+                  const nixl_opt_b_args_t *opt_args) const;
+
+    // Per-peer eager cutoff: eagerThreshold_ stretched by the peer's
+    // measured probe RTT, so long links amortize their higher per-message
+    // cost over larger inline payloads (capped at 4x)
+    size_t
+    eagerCutoff(const nixlUcxConnection &conn) const;
+
+    // Synchronously measures a small-message round trip on rail 0 of a
+    // freshly wired connection and caches it in conn->probeRttUs
+    nixl_status_t
+    probeConnRtt(const ucx_connection_ptr_t &conn) const;
+
+    // Receiver side of the zero-byte wireup probe posted by
+    // prewarmConnection; the payload is empty and discarded
+    static ucs_status_t
+    connProbeAmCb(void *arg,
+                  const void *header,
+                  size_t header_length,
+                  void *data,
+                  size_t length,
+                  const ucp_am_recv_param_t *param);
+
+    // RDMA-write notification mailbox (see nixlUcxNotifMailbox)
+    static ucs_status_t
+    notifMboxAmCb(void *arg,
+                  const void *header,
+                  size_t header_length,
+                  void *data,
+                  size_t length,
+                  const ucp_am_recv_param_t *param);
+
+    struct nixlUcxMboxPeerInfo {
+        uint64_t ringAddr;
+        uint64_t ackAddr;
+        nixl_blob_t rkeyBlob;
+    };
+
+    nixl_status_t
+    notifMboxSetup(const ucx_connection_ptr_t &conn);
+
+    void
+    notifMboxApplyPeerInfo(const ucx_connection_ptr_t &conn, const nixlUcxMboxPeerInfo &info);
+
+    nixl_status_t
+    notifMboxSendPriv(const ucx_connection_ptr_t &conn,
+                      const std::string &msg,
+                      nixlUcxReq &req,
+                      size_t worker_id) const;
+
+    void
+    notifMboxPoll();
+
+    nixl_status_t
+    signalSendPriv(nixlUcxBackendH *handle) const;
+
+    nixl_status_t
+    sendXferStriped(const nixl_xfer_op_t &operation,
+                    const nixl_meta_dlist_t &local,
+                    const nixl_meta_dlist_t &remote,
+                    nixlUcxStripedBackendH *handle,
+                    size_t start_idx,
+                    size_t end_idx) const;
+
+    // Actual submission path behind the optional post-coalescing window
+    // (see "post_coalesce_us"); postXfer either calls it directly or
+    // parks the arguments in deferredPosts_ for a later batched flush
+    nixl_status_t
+    postXferPriv(const nixl_xfer_op_t &operation,
+                 const nixl_meta_dlist_t &local,
+                 const nixl_meta_dlist_t &remote,
+                 const std::string &remote_agent,
+                 nixlBackendReqH *handle,
+                 const nixl_opt_b_args_t *opt_args) const;
+
+    // One parked submission; the descriptor lists belong to the caller's
+    // request handle, which outlives the post
+    struct nixlUcxDeferredPost {
+        nixl_xfer_op_t operation;
+        const nixl_meta_dlist_t *local;
+        const nixl_meta_dlist_t *remote;
+        std::string remote_agent;
+        nixlUcxBackendH *handle;
+        nixl_opt_b_args_t opt_args;
+        bool has_opt_args;
+    };
+
+    // Submits every parked post and adapts the window to what the closing
+    // batch observed; caller holds postCoalesceLock_
+    void
+    flushDeferredPostsLocked() const;
+
+    // Settles the coalescing state touching one handle: flushes the queue
+    // once its window expires and reports NIXL_IN_PROG while the post is
+    // still parked
+    nixl_status_t
+    progressDeferredPosts(nixlUcxBackendH *handle) const;
+
+    // Unparks a handle's submission on cancel/release, before the
+    // descriptor lists it references go away
+    void
+    dropDeferredPost(nixlUcxBackendH *handle) const;
+
     /* UCX data */
     std::unique_ptr<nixlUcxContext> uc;
     std::vector<std::unique_ptr<nixlUcxWorker>> uws;
     std::string workerAddr;
+    // Hash of the kernel boot id, appended to the conn info so peers can
+    // tell whether we share a node
+    uint64_t hostId_ = 0;
     mutable std::atomic<size_t> sharedWorkerIndex_;
+    // Shared-nothing mode: each thread is pinned to its own serialized
+    // (lock-free) worker, valid only while threads don't outnumber workers
+    bool exclusiveWorkers_ = false;
+    // Descriptors at least this large are striped across all shared
+    // workers' endpoints (rails) instead of posted on one; 0 disables
+    size_t stripeThreshold_ = 0;
+    // DRAM WRITEs whose total payload is at most this many bytes go
+    // inline over the AM channel instead of the rkey path; 0 disables.
+    // Applied per peer after scaling by the connection's probe RTT, see
+    // eagerCutoff()
+    size_t eagerThreshold_ = 0;
+    // Probe RTT at/below which a peer counts as rack-local for the eager
+    // cutoff; slower links scale the cutoff proportionally
+    static constexpr nixlTime::us_t eagerRttRefUs = 50;
+    // Contiguous descriptors larger than this are posted as multiple RMA
+    // ops, so the handle's completion accounting (see getXferProgress)
+    // advances chunk by chunk instead of all-or-nothing; 0 disables
+    size_t chunkSize_ = 0;
+    // Self-transfer host copies at least this large are carved across
+    // loopbackParThreads_ helper threads (one core's memcpy tops out well
+    // short of socket memory bandwidth); 0 keeps them single-threaded
+    size_t loopbackParThreshold_ = 0;
+    size_t loopbackParThreads_ = 0;
+    // Loopback blocks at least this large copy with non-temporal stores
+    // (see nixl::ntMemcpy), so a defrag pass over a multi-GB pool does
+    // not evict the LLC behind it; 0 keeps plain memcpy throughout
+    size_t loopbackNtThreshold_ = 0;
+    // Cap on UCP events serviced per inline status/notif poll (see
+    // "progress_budget"), so latency-sensitive pollers bound the time
+    // they spend completing other requests' work; 0 drains fully
+    unsigned progressBudget_ = 0;
+    // QoS lanes: the last priority_workers shared workers are reserved
+    // for high-priority transfers (see nixl_opt_args_t::priority), so the
+    // endpoints bulk traffic queues on are never in their path; 0 disables
+    size_t numPriorityWorkers_ = 0;
+    mutable std::atomic<size_t> priorityWorkerIndex_{0};
+    // RDMA-write notification mailboxes; AM path remains the fallback for
+    // oversized payloads, full rings and peers without mailbox support
+    bool notifMailboxEnabled_ = true;
+    // Cpulist the progress threads pin themselves to; empty leaves them
+    // on the inherited affinity (see "thread_cpuset" backend parameter)
+    std::string threadCpuSet_;
+    // Auto-coalesce window for standalone notifications (see
+    // "notif_coalesce_us"): genNotif parks messages per peer and the first
+    // progress or notif poll past the window packs each peer's backlog
+    // into one NOTIF_BATCH AM; 0 sends every message immediately
+    nixlTime::us_t notifCoalesceUs_ = 0;
+    struct nixlUcxPendingNotifs {
+        nixlTime::us_t firstUs;
+        std::vector<std::string> msgs;
+    };
+    mutable std::mutex notifCoalesceLock_;
+    mutable std::unordered_map<std::string, nixlUcxPendingNotifs> pendingNotifs_;
+    // Micro-batching window for postXfer submissions ("post_coalesce_us"):
+    // posts park here briefly and hit the NIC in one flush, trading the
+    // window's added latency for doorbell and lock amortization under
+    // load; 0 (the default) submits every post immediately. The live
+    // window adapts between postCoalesceMaxUs_/4 and postCoalesceMaxUs_:
+    // batches nobody joined shrink it, multi-post batches grow it
+    nixlTime::us_t postCoalesceMaxUs_ = 0;
+    mutable nixlTime::us_t postCoalesceCurUs_ = 0;
+    mutable nixlTime::us_t postWindowStartUs_ = 0;
+    mutable std::mutex postCoalesceLock_;
+    mutable std::vector<nixlUcxDeferredPost> deferredPosts_;
+    // Peer mailbox info that arrived before our side loaded the connection
+    mutable std::mutex mboxInfoLock_;
+    std::unordered_map<std::string, nixlUcxMboxPeerInfo> pendingMboxInfo_;
 
     /* CUDA data*/
     std::unique_ptr<nixlUcxCudaCtx> cudaCtx; // Context matching specific device
@@ -287,12 +684,20 @@ private:
     // Context to use when current context is missing
     nixlUcxCudaDevicePrimaryCtxPtr m_cudaPrimaryCtx;
 
+    // Refcounted CUDA IPC mappings of same-host peers' VRAM
+    std::unique_ptr<nixlUcxCudaIpcCtx> cudaIpcCtx_;
+
     /* Notifications */
     notif_list_t notifMainList;
 
     // Map of agent name to saved nixlUcxConnection info
     std::unordered_map<std::string, ucx_connection_ptr_t, std::hash<std::string>, strEqual>
         remoteConnMap;
+
+    // Unpacked rkeys reused across repeated metadata loads from a peer,
+    // invalidated by generation on disconnect and on endpoint recovery
+    // (recovery runs inside const transfer paths, hence mutable)
+    mutable nixl::ucx::rkeyCache rkeyCache_;
 };
 
 class nixlUcxThread;
@@ -322,8 +727,9 @@ protected:
 
 private:
     std::unique_ptr<nixlUcxThread> thread_;
-    std::mutex notifMtx_;
-    notif_list_t notifPthr_;
+    // Lock-free MPSC queue so the progress thread never blocks on a
+    // consumer draining notifications in getNotifs
+    nixlMpscQueue<std::pair<std::string, std::string>> notifPthr_;
 };
 
 namespace asio {
@@ -377,8 +783,8 @@ private:
     std::unique_ptr<nixlUcxThread> sharedThread_;
     std::vector<std::unique_ptr<nixlUcxThread>> dedicatedThreads_;
     size_t numSharedWorkers_;
-    std::mutex notifMutex_;
-    notif_list_t notifThread_;
+    // Lock-free MPSC queue, see nixlUcxThreadEngine::notifPthr_
+    nixlMpscQueue<std::pair<std::string, std::string>> notifThread_;
     size_t splitBatchSize_;
 };
 
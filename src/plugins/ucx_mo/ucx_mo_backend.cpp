@@ -33,6 +33,10 @@ using namespace std;
 #ifdef HAVE_CUDA
 
 #include <cuda_runtime.h>
+#include <ctype.h>
+#include <dirent.h>
+#include <limits.h>
+#include <algorithm>
 
 static uint32_t _getNumVramDevices()
 {
@@ -46,6 +50,83 @@ static uint32_t _getNumVramDevices()
     }
 }
 
+// Resolve a PCI device to its canonical sysfs path, which encodes the
+// PCIe hierarchy (root complex, switches) as path components
+static string _pciSysfsPath(const string &bdf)
+{
+    char buf[PATH_MAX];
+    string link = "/sys/bus/pci/devices/" + bdf;
+    char *rp = realpath(link.c_str(), buf);
+    return rp ? string(rp) : string();
+}
+
+static size_t _commonPrefixLen(const string &a, const string &b)
+{
+    size_t n = 0;
+    while ((n < a.size()) && (n < b.size()) && (a[n] == b[n])) {
+        n++;
+    }
+    return n;
+}
+
+// Map each CUDA device to the engine index of its PCIe-closest RDMA NIC.
+// Two devices behind the same switch or root complex share a longer sysfs
+// path prefix than devices on different sockets, so the NIC with the
+// longest common prefix is the one that avoids the inter-socket link.
+// Returns an empty vector if the topology cannot be discovered, in which
+// case the caller keeps the identity mapping.
+static vector<uint32_t> _getVramNicAffinity(uint32_t n_gpu, uint32_t n_eng)
+{
+    vector<string> nic_paths;
+    DIR *dir = opendir("/sys/class/infiniband");
+
+    if (!dir) {
+        return {};
+    }
+    for (struct dirent *ent = readdir(dir); ent; ent = readdir(dir)) {
+        if (ent->d_name[0] == '.') {
+            continue;
+        }
+        char buf[PATH_MAX];
+        string link = string("/sys/class/infiniband/") + ent->d_name + "/device";
+        char *rp = realpath(link.c_str(), buf);
+        if (rp) {
+            nic_paths.push_back(rp);
+        }
+    }
+    closedir(dir);
+    if (nic_paths.empty()) {
+        return {};
+    }
+    // Deterministic NIC indexing independent of readdir order
+    std::sort(nic_paths.begin(), nic_paths.end());
+
+    vector<uint32_t> map;
+    for (uint32_t i = 0; i < n_gpu; i++) {
+        char bdf[32];
+        if (cudaDeviceGetPCIBusId(bdf, sizeof(bdf), i) != cudaSuccess) {
+            return {};
+        }
+        for (char *c = bdf; *c; c++) {
+            *c = tolower(*c);
+        }
+        string gpu_path = _pciSysfsPath(bdf);
+        if (gpu_path.empty()) {
+            return {};
+        }
+        size_t best_nic = 0;
+        size_t best_len = 0;
+        for (size_t n = 0; n < nic_paths.size(); n++) {
+            size_t len = _commonPrefixLen(gpu_path, nic_paths[n]);
+            if (len > best_len) {
+                best_len = len;
+                best_nic = n;
+            }
+        }
+        map.push_back(best_nic % n_eng);
+    }
+    return map;
+}
 
 #else
 
@@ -53,6 +134,11 @@ static uint32_t _getNumVramDevices(){
     return 0;
 }
 
+static vector<uint32_t> _getVramNicAffinity(uint32_t n_gpu, uint32_t n_eng)
+{
+    return {};
+}
+
 #endif
 
 /****************************************
@@ -138,6 +224,9 @@ nixlUcxMoEngine::getEngIdx(nixl_mem_t type, uint64_t devId)
         if (!(devId < _gpuCnt)) {
             return -1;
         }
+        if (devId < _vramEngMap.size()) {
+            return _vramEngMap[devId];
+        }
     case DRAM_SEG:
         break;
     default:
@@ -197,6 +286,59 @@ nixlUcxMoEngine::nixlUcxMoEngine(const nixlBackendInitParams* init_params):
         }
         engines.push_back(std::move(e));
     }
+
+    // Route each GPU through the engine serving its PCIe-closest NIC
+    // instead of plain index order, which crosses the inter-socket link
+    // on multi-socket nodes. "gpu_nic_map" (comma-separated engine index
+    // per GPU) overrides the discovered topology.
+    if (custom_params->count("gpu_nic_map")) {
+        const char *cptr = (*custom_params)["gpu_nic_map"].c_str();
+        while (*cptr) {
+            char *eptr;
+            uint32_t tmp = strtoul(cptr, &eptr, 0);
+            if ((eptr == cptr) || (tmp >= getEngCnt()) ||
+                ((*eptr != ',') && (*eptr != '\0'))) {
+                this->initErr = true;
+                // TODO: Log error
+                return;
+            }
+            _vramEngMap.push_back(tmp);
+            cptr = (*eptr == ',') ? (eptr + 1) : eptr;
+        }
+        if (_vramEngMap.size() != _gpuCnt) {
+            this->initErr = true;
+            // TODO: Log error
+            return;
+        }
+    } else {
+        _vramEngMap = _getVramNicAffinity(_gpuCnt, getEngCnt());
+    }
+
+    // Lanes to establish eagerly at connect() time, as comma-separated
+    // "lidx:ridx" pairs (e.g. "0:0,1:1"); all remaining lanes are
+    // created on first use in prepXfer
+    if (custom_params->count("prewarm_lanes")) {
+        const char *cptr = (*custom_params)["prewarm_lanes"].c_str();
+        while (*cptr) {
+            char *eptr;
+            uint32_t l = strtoul(cptr, &eptr, 0);
+            if ((eptr == cptr) || (*eptr != ':') || (l >= getEngCnt())) {
+                this->initErr = true;
+                // TODO: Log error
+                return;
+            }
+            cptr = eptr + 1;
+            uint32_t r = strtoul(cptr, &eptr, 0);
+            if ((eptr == cptr) ||
+                ((*eptr != ',') && (*eptr != '\0'))) {
+                this->initErr = true;
+                // TODO: Log error
+                return;
+            }
+            prewarmLanes.push_back({l, r});
+            cptr = (*eptr == ',') ? (eptr + 1) : eptr;
+        }
+    }
 }
 
 nixl_mem_list_t
@@ -283,6 +425,24 @@ nixlUcxMoEngine::loadRemoteConnInfo (const string  &remote_agent,
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+nixlUcxMoEngine::connectLane(const string &remote_agent,
+                             uint32_t lidx, uint32_t ridx) const
+{
+    nixl_status_t status;
+    std::lock_guard<std::mutex> guard(laneLock);
+
+    if (connectedLanes.count({remote_agent, lidx, ridx})) {
+        return NIXL_SUCCESS;
+    }
+
+    status = engines[lidx]->connect(getEngName(remote_agent, ridx));
+    if (status == NIXL_SUCCESS) {
+        connectedLanes.insert({remote_agent, lidx, ridx});
+    }
+    return status;
+}
+
 nixl_status_t
 nixlUcxMoEngine::connect(const string &remote_agent)
 {
@@ -295,12 +455,23 @@ nixlUcxMoEngine::connect(const string &remote_agent)
 
     nixlUcxMoConnection &conn = it->second;
 
-    for (auto &e : engines) {
-        for (uint32_t idx = 0; idx < conn.num_engines; idx++) {
-            status = e->connect(getEngName(remote_agent, idx));
-            if (status != NIXL_SUCCESS) {
-                return status;
-            }
+    // Only the notification lane and the requested pre-warm lanes are
+    // established here; the remaining engine matrix connects on first
+    // use (see connectLane), so a multi-GPU peer costs the lanes the
+    // traffic crosses instead of the full local x remote matrix
+    status = connectLane(remote_agent, 0, 0);
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    for (const auto &lane : prewarmLanes) {
+        if (lane.second >= conn.num_engines) {
+            // Peer exposes fewer engines than the pre-warm list assumed
+            continue;
+        }
+        status = connectLane(remote_agent, lane.first, lane.second);
+        if (status != NIXL_SUCCESS) {
+            return status;
         }
     }
 
@@ -317,14 +488,20 @@ nixlUcxMoEngine::disconnect(const string &remote_agent)
         return NIXL_ERR_NOT_FOUND;
     }
 
-    nixlUcxMoConnection &conn = it->second;
-
-    for (auto &e : engines) {
-        for (uint32_t idx = 0; idx < conn.num_engines; idx++) {
-            status = e->disconnect(getEngName(remote_agent, idx));
+    // Tear down only the lanes that were actually established
+    {
+        std::lock_guard<std::mutex> guard(laneLock);
+        for (auto lit = connectedLanes.begin(); lit != connectedLanes.end();) {
+            if (std::get<0>(*lit) != remote_agent) {
+                lit++;
+                continue;
+            }
+            status = engines[std::get<1>(*lit)]->disconnect(
+                        getEngName(remote_agent, std::get<2>(*lit)));
             if (status != NIXL_SUCCESS) {
                 return status;
             }
+            lit = connectedLanes.erase(lit);
         }
     }
 
@@ -572,6 +749,11 @@ nixlUcxMoEngine::prepXfer (const nixl_xfer_op_t &operation,
                 // Skip unused matrix elements
                 continue;
             }
+            /* Lanes are established on first use */
+            ret = connectLane(remote_agent, lidx, ridx);
+            if (NIXL_SUCCESS != ret) {
+                goto err_clean_sub_req;
+            }
             ret = engines[lidx]->prepXfer(operation,
                                           *req->dlMatrix[lidx][ridx].ldescs,
                                           *req->dlMatrix[lidx][ridx].rdescs,
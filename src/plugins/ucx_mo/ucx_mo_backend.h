@@ -24,6 +24,9 @@
 #include <mutex>
 #include <cassert>
 #include <memory>
+#include <set>
+#include <tuple>
+#include <utility>
 
 #include "nixl.h"
 #include "ucx_backend.h"
@@ -88,6 +91,9 @@ class nixlUcxMoEngine : public nixlBackendEngine {
 private:
     uint32_t _engineCnt;
     uint32_t _gpuCnt;
+    // Per-GPU engine index chosen by PCIe proximity to the RDMA NICs
+    // (or by the "gpu_nic_map" param); empty means identity mapping
+    std::vector<uint32_t> _vramEngMap;
     int setEngCnt(uint32_t host_engines);
     uint32_t getEngCnt();
     int32_t getEngIdx(nixl_mem_t type, uint64_t devId);
@@ -102,6 +108,18 @@ private:
     using remote_comm_it_t = remote_conn_map_t::iterator;
     remote_conn_map_t remoteConnMap;
 
+    // Lanes (local engine x remote engine endpoint pairs) are created on
+    // first use in prepXfer instead of as the full matrix at connect
+    // time, so a peer costs only the lanes the traffic actually crosses.
+    // Guarded by laneLock; mutable because lanes materialize inside the
+    // const transfer path.
+    mutable std::mutex laneLock;
+    mutable std::set<std::tuple<std::string, uint32_t, uint32_t>> connectedLanes;
+    // Lanes established eagerly at connect() time (see "prewarm_lanes")
+    std::vector<std::pair<uint32_t, uint32_t>> prewarmLanes;
+    nixl_status_t connectLane(const std::string &remote_agent,
+                              uint32_t lidx, uint32_t ridx) const;
+
     // Memory helper
     nixl_status_t internalMDHelper (const nixl_blob_t &blob,
                                     const nixl_mem_t &nixl_mem,
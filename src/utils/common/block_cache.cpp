@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "block_cache.h"
+
+#include <cstring>
+
+nixlBlockCache::nixlBlockCache(size_t capacity) : capacity_(capacity) {}
+
+size_t
+nixlBlockCache::size() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return used_;
+}
+
+bool
+nixlBlockCache::lookup(uint64_t dev_id, uint64_t offset, size_t len, void* dst) {
+    std::shared_ptr<char[]> data;
+    {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto it = entries_.find({dev_id, offset, len});
+        if (it == entries_.end()) {
+            misses_++;
+            return false;
+        }
+        lru_.splice(lru_.begin(), lru_, it->second.lruIt);
+        data = it->second.data;
+    }
+
+    // The copy runs outside the lock; the reference keeps the block alive
+    // even if a concurrent insert evicts the entry meanwhile
+    memcpy(dst, data.get(), len);
+    hits_++;
+    return true;
+}
+
+void
+nixlBlockCache::insert(uint64_t dev_id, uint64_t offset, size_t len, const void* src) {
+    if (len == 0 || len > capacity_) return;
+
+    std::shared_ptr<char[]> data(new char[len]);
+    memcpy(data.get(), src, len);
+
+    std::lock_guard<std::mutex> guard(lock_);
+    const cacheKey key{dev_id, offset, len};
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        // Same geometry: swap the payload in place and refresh recency
+        it->second.data = std::move(data);
+        lru_.splice(lru_.begin(), lru_, it->second.lruIt);
+        return;
+    }
+
+    evictLocked(len);
+    lru_.push_front(key);
+    entries_.emplace(key, cacheEntry{std::move(data), lru_.begin()});
+    used_ += len;
+}
+
+void
+nixlBlockCache::evictLocked(size_t needed) {
+    while (!lru_.empty() && used_ + needed > capacity_) {
+        const cacheKey &victim = lru_.back();
+        used_ -= victim.len;
+        entries_.erase(victim);
+        lru_.pop_back();
+    }
+}
+
+void
+nixlBlockCache::invalidateRange(uint64_t dev_id, uint64_t offset, size_t len) {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        const cacheKey &key = it->first;
+        if (key.devId == dev_id && key.offset < offset + len &&
+            offset < key.offset + key.len) {
+            used_ -= key.len;
+            lru_.erase(it->second.lruIt);
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+nixlBlockCache::invalidateDev(uint64_t dev_id) {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->first.devId == dev_id) {
+            used_ -= it->first.len;
+            lru_.erase(it->second.lruIt);
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __BLOCK_CACHE_H
+#define __BLOCK_CACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+// Shared read cache for storage backends that bypass the page cache
+// (O_DIRECT, GDS, hf3fs): hot blocks read once from the device are served
+// from host memory afterwards, with descriptor granularity. Entries are
+// keyed by (device/fd, offset, length) exactly as they appear in transfer
+// descriptors; a lookup hits only a block cached with the same geometry,
+// which matches the fixed-size page layout of KV and checkpoint reads.
+// Capacity-bounded with LRU eviction, and owned by the agent so the same
+// tier is shared across the storage backends that request it (see
+// nixlBackendInitParams::blockCache) - a controllable, accountable cache
+// instead of the kernel one the backends bypass.
+class nixlBlockCache {
+    public:
+        explicit nixlBlockCache(size_t capacity);
+
+        nixlBlockCache(const nixlBlockCache&) = delete;
+        nixlBlockCache& operator=(const nixlBlockCache&) = delete;
+
+        // Copy the cached block for (dev_id, offset, len) into dst and
+        // refresh its recency; returns false on miss
+        bool lookup(uint64_t dev_id, uint64_t offset, size_t len, void* dst);
+
+        // Cache a copy of src under (dev_id, offset, len), replacing a
+        // previous entry with the same key and evicting least recently
+        // used entries to stay within capacity. Blocks larger than the
+        // capacity are not cached.
+        void insert(uint64_t dev_id, uint64_t offset, size_t len,
+                    const void* src);
+
+        // Drop every entry overlapping [offset, offset + len) on dev_id;
+        // writers call this so readers never see stale blocks
+        void invalidateRange(uint64_t dev_id, uint64_t offset, size_t len);
+
+        // Drop every entry for dev_id (deregistration / file close)
+        void invalidateDev(uint64_t dev_id);
+
+        size_t capacity() const { return capacity_; }
+        size_t size() const;
+
+        uint64_t hits() const { return hits_.load(); }
+        uint64_t misses() const { return misses_.load(); }
+
+    private:
+        struct cacheKey {
+            uint64_t devId;
+            uint64_t offset;
+            size_t   len;
+
+            bool operator==(const cacheKey &other) const {
+                return devId == other.devId && offset == other.offset &&
+                       len == other.len;
+            }
+        };
+
+        struct cacheKeyHash {
+            size_t operator()(const cacheKey &key) const {
+                size_t h = std::hash<uint64_t>()(key.devId);
+                h ^= std::hash<uint64_t>()(key.offset) + 0x9e3779b9 +
+                     (h << 6) + (h >> 2);
+                h ^= std::hash<size_t>()(key.len) + 0x9e3779b9 +
+                     (h << 6) + (h >> 2);
+                return h;
+            }
+        };
+
+        // Block data is refcounted so a lookup copies outside the lock;
+        // a concurrent eviction only drops its own reference
+        struct cacheEntry {
+            std::shared_ptr<char[]>         data;
+            std::list<cacheKey>::iterator   lruIt;
+        };
+
+        void evictLocked(size_t needed);
+
+        const size_t capacity_;
+        size_t used_ = 0;
+        mutable std::mutex lock_;
+        std::list<cacheKey> lru_; // front = most recently used
+        std::unordered_map<cacheKey, cacheEntry, cacheKeyHash> entries_;
+        std::atomic<uint64_t> hits_{0};
+        std::atomic<uint64_t> misses_{0};
+};
+
+#endif // __BLOCK_CACHE_H
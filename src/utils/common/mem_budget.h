@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NIXL_MEM_BUDGET_H
+#define __NIXL_MEM_BUDGET_H
+
+#include <atomic>
+#include <cstddef>
+
+/*
+ * Agent-level accounting of backend-internal pool memory (batch pools,
+ * transfer rings, staging buffers), which is otherwise invisible to the
+ * application until the node runs out of memory. Backends report pool
+ * growth through reserve() and shrinkage through release() (see
+ * nixlBackendEngine::reserveBudget). Two watermarks configured in
+ * nixlAgentConfig bound the behavior: crossing the soft one only flags
+ * the agent for telemetry and log reporting, while reserve() refuses to
+ * cross the hard one so pool growth is back-pressured at the allocation
+ * site. A zero watermark disables the respective check. Owned by the
+ * agent, shared across its backends.
+ */
+class nixlMemBudget {
+    public:
+        nixlMemBudget(size_t soft_bytes, size_t hard_bytes)
+            : soft_(soft_bytes), hard_(hard_bytes) {}
+
+        nixlMemBudget(const nixlMemBudget&) = delete;
+        nixlMemBudget& operator=(const nixlMemBudget&) = delete;
+
+        // False when the allocation would cross the hard watermark; the
+        // caller must then not grow its pool
+        [[nodiscard]] bool reserve(size_t bytes) {
+            size_t cur = used_.load(std::memory_order_relaxed);
+            do {
+                if (hard_ && (cur + bytes > hard_))
+                    return false;
+            } while (!used_.compare_exchange_weak(cur, cur + bytes,
+                                                  std::memory_order_relaxed));
+            return true;
+        }
+
+        void release(size_t bytes) {
+            used_.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        size_t used() const { return used_.load(std::memory_order_relaxed); }
+        bool aboveSoft() const { return soft_ && (used() > soft_); }
+        size_t softWatermark() const { return soft_; }
+        size_t hardWatermark() const { return hard_; }
+
+    private:
+        std::atomic<size_t> used_{0};
+        const size_t        soft_;
+        const size_t        hard_;
+};
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_MPSC_QUEUE_H
+#define _NIXL_MPSC_QUEUE_H
+
+#include <atomic>
+#include <utility>
+
+/**
+ * Intrusive multi-producer single-consumer queue (Vyukov style).
+ *
+ * push() is lock-free from any thread: one allocation, one atomic exchange
+ * and one store, so a producer (e.g. a backend progress thread delivering
+ * notifications) never blocks on the consumer draining the queue.
+ * pop()/empty() must only be called from a single consumer thread; empty()
+ * is a single load, making the no-pending-items check wait-free.
+ */
+template<typename T> class nixlMpscQueue {
+public:
+    nixlMpscQueue() : head_(new node()), tail_(head_.load(std::memory_order_relaxed)) {}
+
+    nixlMpscQueue(const nixlMpscQueue &) = delete;
+    nixlMpscQueue &
+    operator=(const nixlMpscQueue &) = delete;
+
+    ~nixlMpscQueue() {
+        node *cur = tail_;
+        while (cur) {
+            node *next = cur->next.load(std::memory_order_relaxed);
+            delete cur;
+            cur = next;
+        }
+    }
+
+    void
+    push(T &&value) {
+        node *n = new node(std::move(value));
+        node *prev = head_.exchange(n, std::memory_order_acq_rel);
+        prev->next.store(n, std::memory_order_release);
+    }
+
+    bool
+    pop(T &value) {
+        node *next = tail_->next.load(std::memory_order_acquire);
+        if (next == nullptr) return false;
+        value = std::move(next->value);
+        delete tail_;
+        tail_ = next;
+        return true;
+    }
+
+    bool
+    empty() const {
+        return tail_->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+private:
+    struct node {
+        node() = default;
+        explicit node(T &&v) : value(std::move(v)) {}
+
+        std::atomic<node *> next{nullptr};
+        T value;
+    };
+
+    std::atomic<node *> head_; // producers exchange new nodes in here
+    node *tail_; // consumer-owned, points at the stub/consumed node
+};
+
+#endif // _NIXL_MPSC_QUEUE_H
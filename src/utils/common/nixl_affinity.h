@@ -0,0 +1,125 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NIXL_AFFINITY_H
+#define __NIXL_AFFINITY_H
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "nixl_log.h"
+
+/*
+ * CPU affinity for NIXL internal threads (comm worker, progress threads,
+ * telemetry, plugin pools), so they can be kept off latency-critical
+ * application cores. The spec uses the Linux cpulist format ("0-3,8").
+ * Everything is best effort: a bad spec or a failing syscall logs a
+ * warning and leaves the thread where it was.
+ */
+
+#ifdef __linux__
+// Parse a cpulist spec into a mask; false if the spec is malformed or
+// names no CPUs
+inline bool
+nixlParseCpuList(const std::string &spec, cpu_set_t &mask) {
+    CPU_ZERO(&mask);
+    size_t pos = 0;
+    while (pos < spec.size()) {
+        char *end = nullptr;
+        long first = strtol(spec.c_str() + pos, &end, 10);
+        long last = first;
+        if (end == spec.c_str() + pos || first < 0 || first >= CPU_SETSIZE)
+            return false;
+        pos = end - spec.c_str();
+        if (pos < spec.size() && spec[pos] == '-') {
+            last = strtol(spec.c_str() + pos + 1, &end, 10);
+            if (end == spec.c_str() + pos + 1 || last < first || last >= CPU_SETSIZE)
+                return false;
+            pos = end - spec.c_str();
+        }
+        for (long cpu = first; cpu <= last; cpu++)
+            CPU_SET(cpu, &mask);
+        if (pos < spec.size()) {
+            if (spec[pos] != ',')
+                return false;
+            pos++;
+        }
+    }
+    return CPU_COUNT(&mask) > 0;
+}
+#endif
+
+// Pin the calling thread to the CPUs in the spec; empty spec is a no-op
+inline void
+nixlApplyThreadAffinity(const std::string &spec) {
+#ifdef __linux__
+    if (spec.empty())
+        return;
+    cpu_set_t mask;
+    if (!nixlParseCpuList(spec, mask)) {
+        NIXL_WARN << "Invalid thread cpuset spec '" << spec << "', not pinning";
+        return;
+    }
+    int rc = pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask);
+    if (rc != 0)
+        NIXL_WARN << "Failed to pin thread to '" << spec << "': " << strerror(rc);
+#else
+    (void)spec;
+#endif
+}
+
+// Applies the spec to the calling thread for the lifetime of the object
+// and restores the previous mask after. Threads created in between (e.g.
+// by an asio or TaskFlow pool constructor) inherit the mask, which is the
+// only portable way to place threads those pools spawn internally.
+class nixlScopedThreadAffinity {
+public:
+    explicit nixlScopedThreadAffinity(const std::string &spec) {
+#ifdef __linux__
+        if (spec.empty())
+            return;
+        saved_valid_ =
+            pthread_getaffinity_np(pthread_self(), sizeof(saved_mask_), &saved_mask_) == 0;
+        nixlApplyThreadAffinity(spec);
+#else
+        (void)spec;
+#endif
+    }
+
+    ~nixlScopedThreadAffinity() {
+#ifdef __linux__
+        if (saved_valid_)
+            pthread_setaffinity_np(pthread_self(), sizeof(saved_mask_), &saved_mask_);
+#endif
+    }
+
+    nixlScopedThreadAffinity(const nixlScopedThreadAffinity &) = delete;
+    nixlScopedThreadAffinity &operator=(const nixlScopedThreadAffinity &) = delete;
+
+private:
+#ifdef __linux__
+    cpu_set_t saved_mask_;
+    bool saved_valid_ = false;
+#endif
+};
+
+#endif /* __NIXL_AFFINITY_H */
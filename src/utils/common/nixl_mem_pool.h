@@ -0,0 +1,221 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __NIXL_MEM_POOL_H
+#define __NIXL_MEM_POOL_H
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/*
+ * Isolated arena for NIXL-internal allocations. Under allocation-heavy
+ * phases (metadata load storms, large section rebuilds) the agent's
+ * bookkeeping containers otherwise contend with application mallocs on
+ * the global allocator; containers instantiated with nixlPoolAllocator
+ * draw from a pool that can be sized and monitored per agent instead.
+ *
+ * The pool serves power-of-two size classes up to 4 KiB from slabs
+ * carved out of larger chunks, with one free list per class; requests
+ * beyond the largest class fall through to the global allocator (they
+ * are rare in the containers this backs and not worth slab management).
+ * Freed blocks return to their class's free list and chunks are only
+ * released when the pool is destroyed, so a pool's footprint is the
+ * high-water mark of its containers. All entry points are mutexed; the
+ * containers this backs already serialize on the agent lock, so the
+ * mutex is uncontended in practice.
+ */
+class nixlMemPool {
+    private:
+        static constexpr size_t MIN_CLASS_SHIFT = 4;  // 16 B
+        static constexpr size_t MAX_CLASS_SHIFT = 12; // 4 KiB
+        static constexpr size_t NUM_CLASSES = MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1;
+        static constexpr size_t CHUNK_SIZE = 256 * 1024;
+
+        struct freeNode {
+            freeNode *next;
+        };
+
+        mutable std::mutex                  poolLock;
+        std::array<freeNode*, NUM_CLASSES>  freeLists = {};
+        std::vector<void*>                  chunks;
+        /** @var Carve frontier inside the newest chunk */
+        char                               *carveBase = nullptr;
+        size_t                              carveLeft = 0;
+        size_t                              reservedBytes = 0;
+        size_t                              inUseBytes = 0;
+
+        /** @brief Size class of a request, or -1 for oversize requests */
+        static int classOf(size_t bytes) {
+            size_t shift = MIN_CLASS_SHIFT;
+            while ((1UL << shift) < bytes) {
+                if (++shift > MAX_CLASS_SHIFT)
+                    return -1;
+            }
+            return (int)(shift - MIN_CLASS_SHIFT);
+        }
+
+        /** @brief Carve a block for class cls, growing by a chunk if needed */
+        void* carve(int cls) {
+            const size_t block = 1UL << (cls + MIN_CLASS_SHIFT);
+            if (carveLeft < block) {
+                // The leftover tail (< largest class) is abandoned; with
+                // 256 KiB chunks that is a <2% bound on carving waste
+                void *chunk = ::operator new(CHUNK_SIZE);
+                chunks.push_back(chunk);
+                carveBase = static_cast<char*>(chunk);
+                carveLeft = CHUNK_SIZE;
+                reservedBytes += CHUNK_SIZE;
+            }
+            void *ret = carveBase;
+            carveBase += block;
+            carveLeft -= block;
+            return ret;
+        }
+
+    public:
+        /**
+         * @brief Create a pool, optionally pre-reserving chunks so the
+         *        steady-state footprint is allocated upfront
+         *
+         * @param reserve_bytes Bytes to reserve at creation, rounded up
+         *                      to whole chunks (0 reserves lazily)
+         */
+        explicit nixlMemPool(size_t reserve_bytes = 0) {
+            std::lock_guard<std::mutex> guard(poolLock);
+            while (reservedBytes < reserve_bytes) {
+                void *chunk = ::operator new(CHUNK_SIZE);
+                chunks.push_back(chunk);
+                reservedBytes += CHUNK_SIZE;
+            }
+            if (!chunks.empty()) {
+                carveBase = static_cast<char*>(chunks.back());
+                carveLeft = CHUNK_SIZE;
+            }
+            // Pre-reserved chunks other than the carve target are seeded
+            // into the largest class's free list, so they are reachable
+            // without tracking a frontier per chunk
+            for (size_t i = 0; i + 1 < chunks.size(); ++i) {
+                const size_t block = 1UL << MAX_CLASS_SHIFT;
+                char *base = static_cast<char*>(chunks[i]);
+                for (size_t off = 0; off + block <= CHUNK_SIZE; off += block) {
+                    freeNode *node = reinterpret_cast<freeNode*>(base + off);
+                    node->next = freeLists[NUM_CLASSES - 1];
+                    freeLists[NUM_CLASSES - 1] = node;
+                }
+            }
+        }
+
+        ~nixlMemPool() {
+            for (void *chunk : chunks)
+                ::operator delete(chunk);
+        }
+
+        nixlMemPool(const nixlMemPool&) = delete;
+        nixlMemPool& operator=(const nixlMemPool&) = delete;
+
+        void* allocate(size_t bytes) {
+            const int cls = classOf(bytes);
+            if (cls < 0)
+                return ::operator new(bytes);
+
+            std::lock_guard<std::mutex> guard(poolLock);
+            inUseBytes += 1UL << (cls + MIN_CLASS_SHIFT);
+            freeNode *node = freeLists[cls];
+            if (node) {
+                freeLists[cls] = node->next;
+                return node;
+            }
+            return carve(cls);
+        }
+
+        void deallocate(void *ptr, size_t bytes) {
+            const int cls = classOf(bytes);
+            if (cls < 0) {
+                ::operator delete(ptr);
+                return;
+            }
+
+            std::lock_guard<std::mutex> guard(poolLock);
+            inUseBytes -= 1UL << (cls + MIN_CLASS_SHIFT);
+            freeNode *node = static_cast<freeNode*>(ptr);
+            node->next = freeLists[cls];
+            freeLists[cls] = node;
+        }
+
+        /** @brief Bytes held in chunks, the pool's footprint */
+        size_t bytesReserved() const {
+            std::lock_guard<std::mutex> guard(poolLock);
+            return reservedBytes;
+        }
+
+        /** @brief Bytes handed out and not yet returned (class-rounded) */
+        size_t bytesInUse() const {
+            std::lock_guard<std::mutex> guard(poolLock);
+            return inUseBytes;
+        }
+};
+
+/**
+ * @class nixlPoolAllocator
+ * @brief Standard allocator over a nixlMemPool, the template-parameter
+ *        hook threaded through NIXL's internal containers. With a null
+ *        pool (the default) it forwards to the global allocator, so a
+ *        container type carrying it behaves exactly like its
+ *        std::allocator counterpart until an agent wires in its pool.
+ */
+template<class T>
+class nixlPoolAllocator {
+    private:
+        nixlMemPool *pool;
+
+    public:
+        using value_type = T;
+
+        nixlPoolAllocator(nixlMemPool *pool = nullptr) noexcept : pool(pool) {}
+
+        template<class U>
+        nixlPoolAllocator(const nixlPoolAllocator<U> &other) noexcept
+            : pool(other.getPool()) {}
+
+        T* allocate(size_t n) {
+            if (pool)
+                return static_cast<T*>(pool->allocate(n * sizeof(T)));
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T *ptr, size_t n) noexcept {
+            if (pool)
+                pool->deallocate(ptr, n * sizeof(T));
+            else
+                ::operator delete(ptr);
+        }
+
+        nixlMemPool* getPool() const noexcept { return pool; }
+
+        template<class U>
+        bool operator==(const nixlPoolAllocator<U> &other) const noexcept {
+            return pool == other.getPool();
+        }
+        template<class U>
+        bool operator!=(const nixlPoolAllocator<U> &other) const noexcept {
+            return pool != other.getPool();
+        }
+};
+
+#endif
@@ -17,8 +17,16 @@
 #ifndef _NIXL_TIME_H
 #define _NIXL_TIME_H
 
+#include <atomic>
 #include <chrono>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define NIXL_HAVE_CYCLE_COUNTER 1
+#elif defined(__aarch64__)
+#define NIXL_HAVE_CYCLE_COUNTER 1
+#endif
+
 namespace nixlTime {
 
     using namespace std::chrono;
@@ -44,6 +52,102 @@ namespace nixlTime {
         return duration_cast<seconds>(steady_clock::now().time_since_epoch()).count();
     }
 
+#ifdef NIXL_HAVE_CYCLE_COUNTER
+    namespace detail {
+
+        static inline uint64_t readCycles() {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            uint64_t v;
+            asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+            return v;
+#endif
+        }
+
+        // Cycle-counter-backed wall clock for hot instrumentation paths:
+        // a stamp is one counter read plus a multiply (~5ns) instead of a
+        // vDSO clock call. The cycles-per-us rate is calibrated against
+        // system_clock once at first use; the residual ppm error of that
+        // short calibration window is corrected by re-anchoring the offset
+        // against the real clock about once per second of counter time
+        class cycleClock {
+        public:
+            static cycleClock& instance() {
+                static cycleClock clk;
+                return clk;
+            }
+
+            us_t nowUs() {
+                const uint64_t cycles = readCycles();
+                const us_t us = anchorUs_ +
+                    us_t(double(cycles - anchorCycles_) * usPerCycle_) +
+                    us_t(offsetUs_.load(std::memory_order_relaxed));
+                if (cycles - lastCalCycles_.load(std::memory_order_relaxed) >
+                    calPeriodCycles_)
+                    recalibrate(cycles, us);
+                return us;
+            }
+
+        private:
+            cycleClock() {
+                const uint64_t c0 = readCycles();
+                const us_t w0 = wallUs();
+                // ~1ms calibration spin, paid once per process
+                us_t w1;
+                do {
+                    w1 = wallUs();
+                } while (w1 - w0 < 1000);
+                const uint64_t c1 = readCycles();
+                usPerCycle_ = double(w1 - w0) / double(c1 - c0);
+                anchorCycles_ = c1;
+                anchorUs_ = w1;
+                calPeriodCycles_ = uint64_t(1e6 / usPerCycle_);
+                lastCalCycles_.store(c1, std::memory_order_relaxed);
+            }
+
+            static us_t wallUs() {
+                return duration_cast<microseconds>(
+                    system_clock::now().time_since_epoch()).count();
+            }
+
+            void recalibrate(uint64_t cycles, us_t fast_us) {
+                // One thread re-anchors; everyone else keeps stamping with
+                // the current parameters
+                if (calLock_.test_and_set(std::memory_order_acquire))
+                    return;
+                lastCalCycles_.store(cycles, std::memory_order_relaxed);
+                offsetUs_.fetch_add(int64_t(wallUs()) - int64_t(fast_us),
+                                    std::memory_order_relaxed);
+                calLock_.clear(std::memory_order_release);
+            }
+
+            double usPerCycle_;
+            uint64_t anchorCycles_;
+            us_t anchorUs_;
+            uint64_t calPeriodCycles_;
+            std::atomic<uint64_t> lastCalCycles_{0};
+            std::atomic<int64_t> offsetUs_{0};
+            std::atomic_flag calLock_ = ATOMIC_FLAG_INIT;
+        };
+
+    } // namespace detail
+#endif
+
+    // Wall-clock microseconds (system_clock epoch, like the telemetry
+    // timestamps) from the calibrated cycle counter where one exists;
+    // plain clock call otherwise. Meant for per-event stamping on hot
+    // paths — telemetry and the xfer timeline — where the vDSO call cost
+    // is measurable at high event rates
+    static inline us_t getUsFast() {
+#ifdef NIXL_HAVE_CYCLE_COUNTER
+        return detail::cycleClock::instance().nowUs();
+#else
+        return duration_cast<microseconds>(
+            system_clock::now().time_since_epoch()).count();
+#endif
+    }
+
 }
 
 #endif
@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _NIXL_NT_MEMCPY_H
+#define _NIXL_NT_MEMCPY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__SSE2__)
+#include <immintrin.h>
+#define NIXL_HAVE_NT_STORES 1
+#endif
+
+namespace nixl {
+
+/**
+ * Bulk copy with non-temporal (cache-bypassing) stores: a multi-GB
+ * compaction through plain memcpy write-allocates every destination line
+ * and evicts the whole LLC behind it, while streaming stores leave the
+ * cache to the tenants actually reusing it. A short head copy aligns the
+ * destination, the widest store the build targets (AVX-512 when compiled
+ * in, SSE2 otherwise on x86-64) streams the body, and a fence orders the
+ * stores before returning. Targets without non-temporal stores fall back
+ * to memcpy. Only worth it past cache-sized blocks; callers gate on a
+ * threshold.
+ */
+inline void
+ntMemcpy(void *dst, const void *src, size_t len) {
+#ifdef NIXL_HAVE_NT_STORES
+    char *d = static_cast<char *>(dst);
+    const char *s = static_cast<const char *>(src);
+
+    // Streaming stores need an aligned destination
+    const size_t head = (64 - (reinterpret_cast<uintptr_t>(d) & 63)) & 63;
+    if (head) {
+        const size_t n = head < len ? head : len;
+        std::memcpy(d, s, n);
+        d += n;
+        s += n;
+        len -= n;
+    }
+
+#if defined(__AVX512F__)
+    for (; len >= 64; d += 64, s += 64, len -= 64)
+        _mm512_stream_si512(reinterpret_cast<__m512i *>(d),
+                            _mm512_loadu_si512(reinterpret_cast<const void *>(s)));
+#else
+    for (; len >= 64; d += 64, s += 64, len -= 64) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(d),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(s)));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(d + 16),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 16)));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(d + 32),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 32)));
+        _mm_stream_si128(reinterpret_cast<__m128i *>(d + 48),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + 48)));
+    }
+#endif
+    // Make the streamed data globally visible before the copy is reported
+    // done; the tail goes through the cache like any small copy
+    _mm_sfence();
+    if (len)
+        std::memcpy(d, s, len);
+#else
+    std::memcpy(dst, src, len);
+#endif
+}
+
+} // namespace nixl
+
+#endif // _NIXL_NT_MEMCPY_H
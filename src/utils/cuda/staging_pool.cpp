@@ -0,0 +1,205 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "staging_pool.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#ifdef HAVE_CUDA
+#include <cuda_runtime.h>
+#endif
+
+#include "common/nixl_log.h"
+
+nixlStagingPool::nixlStagingPool(size_t buf_size, size_t buf_count)
+    : bufSize_(buf_size) {
+#ifdef HAVE_CUDA
+    cudaStream_t stream;
+    if (cudaStreamCreateWithFlags(&stream, cudaStreamNonBlocking)
+            != cudaSuccess) {
+        NIXL_ERROR << "Failed to create staging pool stream";
+        return;
+    }
+    stream_ = stream;
+#endif
+
+    for (size_t i = 0; i < buf_count; ++i) {
+        void* buf = nullptr;
+#ifdef HAVE_CUDA
+        if (cudaHostAlloc(&buf, bufSize_, cudaHostAllocPortable)
+                != cudaSuccess) {
+            NIXL_WARN << "Pinned allocation failed after " << i
+                      << " staging buffers of " << bufSize_ << " bytes";
+            break;
+        }
+#else
+        if (posix_memalign(&buf, sysconf(_SC_PAGESIZE), bufSize_) != 0) {
+            NIXL_WARN << "Allocation failed after " << i
+                      << " staging buffers of " << bufSize_ << " bytes";
+            break;
+        }
+#endif
+        bufs_.push_back(buf);
+        freeBufs_.push_back(buf);
+    }
+}
+
+nixlStagingPool::~nixlStagingPool() {
+    for (auto & buf : bufs_) {
+#ifdef HAVE_CUDA
+        cudaFreeHost(buf);
+#else
+        free(buf);
+#endif
+    }
+#ifdef HAVE_CUDA
+    if (stream_)
+        cudaStreamDestroy((cudaStream_t) stream_);
+#endif
+}
+
+void*
+nixlStagingPool::acquire() {
+    std::unique_lock<std::mutex> lock(lock_);
+    cv_.wait(lock, [this] { return !freeBufs_.empty(); });
+    void* buf = freeBufs_.back();
+    freeBufs_.pop_back();
+    return buf;
+}
+
+void
+nixlStagingPool::release(void* buf) {
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        freeBufs_.push_back(buf);
+    }
+    cv_.notify_one();
+}
+
+#ifdef HAVE_CUDA
+nixl_status_t
+nixlStagingPool::copyFromDev(void* host_dst, const void* dev_src,
+                             size_t len) {
+    void* bufs[2] = { acquire(), acquire() };
+    cudaEvent_t events[2];
+    size_t pending_off[2], pending_len[2];
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    cudaEventCreateWithFlags(&events[0], cudaEventDisableTiming);
+    cudaEventCreateWithFlags(&events[1], cudaEventDisableTiming);
+
+    // Chunk i lands in slot i%2; before reusing a slot, its previous
+    // chunk is synced and drained into the destination, so the device
+    // copy of one chunk overlaps the host copy of the one before it
+    size_t num_chunks = (len + bufSize_ - 1) / bufSize_;
+    for (size_t i = 0; i < num_chunks; ++i) {
+        int slot = i & 1;
+        if (i >= 2) {
+            cudaEventSynchronize(events[slot]);
+            memcpy((char*) host_dst + pending_off[slot], bufs[slot],
+                   pending_len[slot]);
+        }
+        size_t off = i * bufSize_;
+        size_t chunk = std::min(bufSize_, len - off);
+        if (cudaMemcpyAsync(bufs[slot], (const char*) dev_src + off, chunk,
+                            cudaMemcpyDeviceToHost,
+                            (cudaStream_t) stream_) != cudaSuccess) {
+            NIXL_ERROR << "Staging D2H copy failed at offset " << off;
+            ret = NIXL_ERR_BACKEND;
+            break;
+        }
+        cudaEventRecord(events[slot], (cudaStream_t) stream_);
+        pending_off[slot] = off;
+        pending_len[slot] = chunk;
+    }
+
+    if (ret == NIXL_SUCCESS) {
+        size_t first = (num_chunks >= 2) ? num_chunks - 2 : 0;
+        for (size_t i = first; i < num_chunks; ++i) {
+            int slot = i & 1;
+            cudaEventSynchronize(events[slot]);
+            memcpy((char*) host_dst + pending_off[slot], bufs[slot],
+                   pending_len[slot]);
+        }
+    }
+
+    cudaEventDestroy(events[0]);
+    cudaEventDestroy(events[1]);
+    release(bufs[0]);
+    release(bufs[1]);
+    return ret;
+}
+
+nixl_status_t
+nixlStagingPool::copyToDev(void* dev_dst, const void* host_src,
+                           size_t len) {
+    void* bufs[2] = { acquire(), acquire() };
+    cudaEvent_t events[2];
+    bool recorded[2] = { false, false };
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    cudaEventCreateWithFlags(&events[0], cudaEventDisableTiming);
+    cudaEventCreateWithFlags(&events[1], cudaEventDisableTiming);
+
+    size_t num_chunks = (len + bufSize_ - 1) / bufSize_;
+    for (size_t i = 0; i < num_chunks; ++i) {
+        int slot = i & 1;
+        // The slot's previous async upload must finish before its buffer
+        // is refilled from the source
+        if (recorded[slot])
+            cudaEventSynchronize(events[slot]);
+        size_t off = i * bufSize_;
+        size_t chunk = std::min(bufSize_, len - off);
+        memcpy(bufs[slot], (const char*) host_src + off, chunk);
+        if (cudaMemcpyAsync((char*) dev_dst + off, bufs[slot], chunk,
+                            cudaMemcpyHostToDevice,
+                            (cudaStream_t) stream_) != cudaSuccess) {
+            NIXL_ERROR << "Staging H2D copy failed at offset " << off;
+            ret = NIXL_ERR_BACKEND;
+            break;
+        }
+        cudaEventRecord(events[slot], (cudaStream_t) stream_);
+        recorded[slot] = true;
+    }
+
+    if (ret == NIXL_SUCCESS)
+        cudaStreamSynchronize((cudaStream_t) stream_);
+
+    cudaEventDestroy(events[0]);
+    cudaEventDestroy(events[1]);
+    release(bufs[0]);
+    release(bufs[1]);
+    return ret;
+}
+#else
+nixl_status_t
+nixlStagingPool::copyFromDev(void* host_dst, const void* dev_src,
+                             size_t len) {
+    // Without CUDA both pointers are host memory
+    memcpy(host_dst, dev_src, len);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+nixlStagingPool::copyToDev(void* dev_dst, const void* host_src,
+                           size_t len) {
+    memcpy(dev_dst, host_src, len);
+    return NIXL_SUCCESS;
+}
+#endif
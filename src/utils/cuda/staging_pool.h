@@ -0,0 +1,70 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __STAGING_POOL_H
+#define __STAGING_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "nixl_types.h"
+
+// Shared host staging-buffer pool for backends without a GPUDirect path
+// (object stores, non-GDS filesystems): VRAM transfers bounce through
+// reusable pinned buffers instead of pageable-memory copies at half
+// bandwidth. Buffers come from cudaHostAlloc when built with CUDA and
+// fall back to page-aligned pageable memory otherwise. The pool is owned
+// by the agent and shared across backends that request it through their
+// init params (see nixlBackendInitParams::stagingPool).
+class nixlStagingPool {
+    public:
+        nixlStagingPool(size_t buf_size, size_t buf_count);
+        ~nixlStagingPool();
+
+        nixlStagingPool(const nixlStagingPool&) = delete;
+        nixlStagingPool& operator=(const nixlStagingPool&) = delete;
+
+        // Hand out a bufSize() byte staging buffer, blocking until one is
+        // free; buffers must go back through release
+        void* acquire();
+        void release(void* buf);
+
+        // Drain device memory into a host destination (or fill device
+        // memory from a host source) in buffer-sized chunks, double
+        // buffered through two staging buffers so the async device copy
+        // of one chunk overlaps the host copy of the previous one.
+        // Plain memcpy when built without CUDA.
+        nixl_status_t copyFromDev(void* host_dst, const void* dev_src,
+                                  size_t len);
+        nixl_status_t copyToDev(void* dev_dst, const void* host_src,
+                                size_t len);
+
+        size_t bufSize() const { return bufSize_; }
+        size_t bufCount() const { return bufs_.size(); }
+
+    private:
+        size_t                  bufSize_;
+        std::vector<void*>      bufs_;
+        std::vector<void*>      freeBufs_;
+        std::mutex              lock_;
+        std::condition_variable cv_;
+        // cudaStream_t for the async chunk copies when built with CUDA
+        void*                   stream_ = nullptr;
+};
+
+#endif
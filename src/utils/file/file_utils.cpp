@@ -19,8 +19,11 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <errno.h>
+#include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
+#include <thread>
 
 namespace nixl {
 
@@ -56,4 +59,55 @@ queryFileInfoList(const std::vector<std::string> &filenames, std::vector<nixl_qu
     return NIXL_SUCCESS;
 }
 
+nixl_status_t
+openFileList(const std::vector<std::string> &filenames,
+             int open_flags,
+             std::vector<std::pair<int, size_t>> &fds) {
+    fds.assign(filenames.size(), {-1, 0});
+    if (filenames.empty()) {
+        return NIXL_SUCCESS;
+    }
+
+    // Each worker walks its own stride so no coordination is needed; the
+    // pool is sized to the host but never larger than the manifest
+    const size_t num_threads =
+        std::min<size_t>(std::max(1u, std::thread::hardware_concurrency() / 2),
+                         filenames.size());
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    for (size_t t = 0; t < num_threads; ++t) {
+        workers.emplace_back([&, t]() {
+            for (size_t i = t; i < filenames.size() && !failed; i += num_threads) {
+                int fd = open(filenames[i].c_str(), open_flags, 0644);
+                if (fd < 0) {
+                    failed = true;
+                    return;
+                }
+                struct stat stat_buf;
+                if (fstat(fd, &stat_buf) != 0) {
+                    close(fd);
+                    failed = true;
+                    return;
+                }
+                fds[i] = {fd, (size_t)stat_buf.st_size};
+            }
+        });
+    }
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    if (failed) {
+        for (auto &entry : fds) {
+            if (entry.first >= 0) {
+                close(entry.first);
+            }
+        }
+        fds.clear();
+        return NIXL_ERR_NOT_FOUND;
+    }
+    return NIXL_SUCCESS;
+}
+
 } // namespace nixl
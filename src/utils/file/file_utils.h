@@ -47,6 +47,21 @@ queryFileInfo(std::string_view filename);
 nixl_status_t
 queryFileInfoList(const std::vector<std::string> &filenames, std::vector<nixl_query_resp_t> &resp);
 
+/**
+ * @brief Open and stat a batch of files in parallel, striped across a small
+ *        thread pool so a manifest of thousands of files is not a serial
+ *        open+stat chain
+ * @param filenames Vector of file paths to open
+ * @param open_flags Flags passed to open(2); O_CREAT uses mode 0644
+ * @param fds Output (fd, size) per file, in filenames order
+ * @return NIXL_SUCCESS on success; on any failure every fd opened so far is
+ *         closed and an error code is returned
+ */
+nixl_status_t
+openFileList(const std::vector<std::string> &filenames,
+             int open_flags,
+             std::vector<std::pair<int, size_t>> &fds);
+
 } // namespace nixl
 
 #endif // __FILE_UTILS_H
@@ -42,27 +42,43 @@ nixl_status_t nixlSerDes::addStr(const std::string &tag, const std::string &str)
     workingStr.append(str);
     workingStr.append("|");
 
+    if (sink && workingStr.size() >= sinkChunk)
+        return flushToSink();
+
     return NIXL_SUCCESS;
 }
 
 std::string nixlSerDes::getStr(const std::string &tag){
+    return std::string(getStrView(tag));
+}
+
+std::string_view nixlSerDes::getStrView(const std::string &tag){
 
     if(workingStr.compare(des_offset, tag.size(), tag) != 0){
        //incorrect tag
-       return "";
+       return std::string_view();
     }
     ssize_t len;
 
     //skip tag
     des_offset += tag.size();
 
-    //get len
-    //_stringToBytes(&len, workingStr.data() + des_offset, sizeof(ssize_t));
-    _stringToBytes(&len, workingStr.substr(des_offset, sizeof(ssize_t)), sizeof(ssize_t));
+    //a truncated buffer may end inside the length field
+    if (workingStr.size() - des_offset < sizeof(ssize_t))
+        return std::string_view();
+
+    //get len, directly from the buffer to avoid a temporary
+    std::memcpy(&len, workingStr.data() + des_offset, sizeof(ssize_t));
     des_offset += sizeof(ssize_t);
 
-    //get string
-    std::string ret = workingStr.substr(des_offset, len);
+    //the length is untrusted: string plus | delimiter must fit in the
+    //remaining buffer
+    if (len < 0 ||
+        static_cast<size_t>(len) + 1 > workingStr.size() - des_offset)
+        return std::string_view();
+
+    //view into the working buffer, no copy
+    std::string_view ret(workingStr.data() + des_offset, len);
 
     //move past string plus | delimiter
     des_offset += len + 1;
@@ -70,6 +86,10 @@ std::string nixlSerDes::getStr(const std::string &tag){
     return ret;
 }
 
+void nixlSerDes::reserve(size_t len){
+    workingStr.reserve(workingStr.size() + len);
+}
+
 // Byte buffers serialization
 nixl_status_t nixlSerDes::addBuf(const std::string &tag, const void* buf, ssize_t len){
 
@@ -78,6 +98,9 @@ nixl_status_t nixlSerDes::addBuf(const std::string &tag, const void* buf, ssize_
     workingStr.append(_bytesToString(buf, len));
     workingStr.append("|");
 
+    if (sink && workingStr.size() >= sinkChunk)
+        return flushToSink();
+
     return NIXL_SUCCESS;
 }
 
@@ -89,9 +112,8 @@ ssize_t nixlSerDes::getBufLen(const std::string &tag) const{
 
     ssize_t len;
 
-    //get len
-    //_stringToBytes(&len, workingStr.data() + des_offset + tag.size(), sizeof(ssize_t));
-    _stringToBytes(&len, workingStr.substr(des_offset + tag.size(), sizeof(ssize_t)), sizeof(ssize_t));
+    //get len, directly from the buffer to avoid a temporary
+    std::memcpy(&len, workingStr.data() + des_offset + tag.size(), sizeof(ssize_t));
 
     return len;
 }
@@ -105,8 +127,8 @@ nixl_status_t nixlSerDes::getBuf(const std::string &tag, void *buf, ssize_t len)
     //skip over tag and size, which we assume has been read previously
     des_offset += tag.size() + sizeof(ssize_t);
 
-    //_stringToBytes(buf, workingStr.data() + des_offset, len);
-    _stringToBytes(buf, workingStr.substr(des_offset, len), len);
+    //copy out, directly from the buffer to avoid a temporary
+    std::memcpy(buf, workingStr.data() + des_offset, len);
 
     //bytes in string form are twice as long, skip those plus | delimiter
     des_offset += len + 1;
@@ -114,6 +136,29 @@ nixl_status_t nixlSerDes::getBuf(const std::string &tag, void *buf, ssize_t len)
     return NIXL_SUCCESS;
 }
 
+// Streaming serialization
+void nixlSerDes::setSink(sink_cb_t cb, size_t chunk_size) {
+    sink = std::move(cb);
+    sinkChunk = chunk_size;
+}
+
+nixl_status_t nixlSerDes::flushToSink() {
+    //the "nixlSerDes|" prefix rides in the first chunk only
+    nixl_status_t ret = sink(workingStr.data(), workingStr.size());
+    workingStr.clear();
+    return ret;
+}
+
+nixl_status_t nixlSerDes::finishSink() {
+    if (!sink)
+        return NIXL_ERR_INVALID_PARAM;
+
+    if (workingStr.empty())
+        return NIXL_SUCCESS;
+
+    return flushToSink();
+}
+
 // Buffer management serialization
 std::string nixlSerDes::exportStr() const {
     return workingStr;
@@ -132,3 +177,27 @@ nixl_status_t nixlSerDes::importStr(const std::string &sdbuf) {
 
     return NIXL_SUCCESS;
 }
+
+void nixlSerDes::resetSerialize() {
+    //clear() keeps the allocation, so capacity tracks the high-water mark
+    workingStr.clear();
+    workingStr.append("nixlSerDes|");
+    des_offset = 11;
+    mode = SERIALIZE;
+    sink = nullptr;
+    sinkChunk = 0;
+}
+
+nixl_status_t nixlSerDes::importBuf(const void *buf, size_t len) {
+
+    workingStr.assign(static_cast<const char*>(buf), len);
+    if(workingStr.compare(0, 11, "nixlSerDes|") != 0){
+       //incorrect tag
+       return NIXL_ERR_MISMATCH;
+    }
+
+    mode = DESERIALIZE;
+    des_offset = 11;
+
+    return NIXL_SUCCESS;
+}
@@ -18,12 +18,18 @@
 #define __SERDES_H
 
 #include <cstring>
+#include <functional>
 #include <string>
+#include <string_view>
 #include <cstdint>
 
 #include "nixl_types.h"
 
 class nixlSerDes {
+public:
+    /* Streaming serialization sink: receives the serialized bytes in order */
+    using sink_cb_t = std::function<nixl_status_t(const void *buf, size_t len)>;
+
 private:
     typedef enum { SERIALIZE, DESERIALIZE } ser_mode_t;
 
@@ -31,6 +37,11 @@ private:
     ssize_t des_offset;
     ser_mode_t mode;
 
+    sink_cb_t sink;
+    size_t sinkChunk = 0;
+
+    nixl_status_t flushToSink();
+
 public:
     nixlSerDes();
 
@@ -38,15 +49,50 @@ public:
     nixl_status_t addStr(const std::string &tag, const std::string &str);
     std::string getStr(const std::string &tag);
 
+    /* Zero-copy variant of getStr. The returned view points into the
+     * imported blob and is valid until this object is destroyed or a
+     * new blob is imported. Returns an empty view on tag mismatch. */
+    std::string_view getStrView(const std::string &tag);
+
+    /* Preallocate serialization buffer, e.g. from a size-calculation pass
+     * over the entries to be added, to avoid growth reallocations */
+    void reserve(size_t len);
+
+    /* Serialized size of one addStr/addBuf entry of payload size len */
+    static size_t entrySize(const std::string &tag, size_t len) {
+        return tag.size() + sizeof(size_t) + len + 1;
+    }
+
     /* Ser/Des for Byte buffers */
     nixl_status_t addBuf(const std::string &tag, const void* buf, ssize_t len);
     ssize_t getBufLen(const std::string &tag) const;
     nixl_status_t getBuf(const std::string &tag, void *buf, ssize_t len);
 
+    /* Streaming serialization: once a sink is set, serialized bytes are
+     * flushed to it in chunks of roughly chunk_size whenever the working
+     * buffer fills up, bounding peak memory to the chunk size instead of
+     * the full blob. Must be called before any addStr/addBuf; exportStr
+     * cannot be used on a sink-backed serializer. */
+    void setSink(sink_cb_t cb, size_t chunk_size);
+
+    /* Flush the remaining tail to the sink; call after the last add */
+    nixl_status_t finishSink();
+
     /* Ser/Des buffer management */
     std::string exportStr() const;
     nixl_status_t importStr(const std::string &sdbuf);
 
+    /* Like importStr, but from a raw buffer: reassigning into the working
+     * buffer reuses its capacity, so a deserializer recycled across
+     * messages does not allocate in steady state */
+    nixl_status_t importBuf(const void *buf, size_t len);
+
+    /* Re-arm a recycled serializer: drops the content and any sink but
+     * keeps the working buffer's capacity (high-water-mark sized), so a
+     * serializer reused across periodic publishes does not re-grow the
+     * buffer from scratch every cycle */
+    void resetSerialize();
+
     static std::string _bytesToString(const void *buf, ssize_t size);
     static void _stringToBytes(void* fill_buf, const std::string &s, ssize_t size);
 };
@@ -92,6 +92,10 @@ void nixlMDStreamListener::setupListener() {
                << port << "...";
 }
 
+int nixlMDStreamListener::getListenFd() const {
+    return socketFd;
+}
+
 int nixlMDStreamListener::acceptClient() {
         csock = accept(socketFd, NULL, NULL);
         if (csock < 0 && errno != EAGAIN) {
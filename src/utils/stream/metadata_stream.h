@@ -60,6 +60,7 @@ class nixlMDStreamListener: public nixlMetadataStream {
         ~nixlMDStreamListener();
 
         int         acceptClient();
+        int         getListenFd() const;
         void        setupListener();
         void        startListenerForClients();
         void        startListenerForClient();
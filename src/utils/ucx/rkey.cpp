@@ -34,4 +34,82 @@ rkey::unpackUcpRkey(const nixlUcxEp &ep, const void *rkey_buffer) {
     }
     return rkey;
 }
+
+std::shared_ptr<const rkeyCache::rkeyList>
+rkeyCache::lookup(const std::string &agent, uint64_t addr, size_t len, uint32_t fingerprint) {
+    const std::lock_guard<std::mutex> guard(lock_);
+
+    const auto it = entries_.find(rangeKey(agent, addr, len));
+    if (it == entries_.end()) {
+        return nullptr;
+    }
+
+    const auto gen = generations_.find(agent);
+    if (gen == generations_.end() || it->second.generation != gen->second ||
+        it->second.fingerprint != fingerprint) {
+        entries_.erase(it);
+        return nullptr;
+    }
+    return it->second.rkeys;
+}
+
+void
+rkeyCache::insert(const std::string &agent,
+                  uint64_t addr,
+                  size_t len,
+                  uint32_t fingerprint,
+                  std::shared_ptr<const rkeyList> rkeys) {
+    const std::lock_guard<std::mutex> guard(lock_);
+
+    const uint64_t gen = generations_.emplace(agent, 0).first->second;
+    entries_[rangeKey(agent, addr, len)] = entry{gen, fingerprint, std::move(rkeys)};
+}
+
+void
+rkeyCache::lookupBatch(const std::string &agent,
+                       const std::vector<std::tuple<uint64_t, size_t, uint32_t>> &ranges,
+                       std::vector<std::shared_ptr<const rkeyList>> &rkeys) {
+    const std::lock_guard<std::mutex> guard(lock_);
+
+    const auto gen = generations_.find(agent);
+    rkeys.reserve(ranges.size());
+    for (const auto &[addr, len, fingerprint] : ranges) {
+        const auto it = entries_.find(rangeKey(agent, addr, len));
+        if (it == entries_.end()) {
+            rkeys.push_back(nullptr);
+            continue;
+        }
+        if (gen == generations_.end() || it->second.generation != gen->second ||
+            it->second.fingerprint != fingerprint) {
+            entries_.erase(it);
+            rkeys.push_back(nullptr);
+            continue;
+        }
+        rkeys.push_back(it->second.rkeys);
+    }
+}
+
+void
+rkeyCache::insertBatch(
+    const std::string &agent,
+    const std::vector<std::tuple<uint64_t, size_t, uint32_t, std::shared_ptr<const rkeyList>>>
+        &ranges) {
+    const std::lock_guard<std::mutex> guard(lock_);
+
+    const uint64_t gen = generations_.emplace(agent, 0).first->second;
+    entries_.reserve(entries_.size() + ranges.size());
+    for (const auto &[addr, len, fingerprint, rkeys] : ranges) {
+        entries_[rangeKey(agent, addr, len)] = entry{gen, fingerprint, rkeys};
+    }
+}
+
+void
+rkeyCache::invalidate(const std::string &agent) {
+    const std::lock_guard<std::mutex> guard(lock_);
+
+    const auto gen = generations_.find(agent);
+    if (gen != generations_.end()) {
+        gen->second++;
+    }
+}
 } // namespace nixl::ucx
@@ -18,12 +18,20 @@
 #ifndef NIXL_SRC_UTILS_UCX_RKEY_H
 #define NIXL_SRC_UTILS_UCX_RKEY_H
 
+#include <cstdint>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 extern "C" {
 #include <ucp/api/ucp.h>
 }
 
+#include "absl/container/flat_hash_map.h"
+
 class nixlUcxEp;
 
 namespace nixl::ucx {
@@ -43,5 +51,70 @@ private:
 
     const std::unique_ptr<ucp_rkey, void (*)(ucp_rkey_h)> rkey_;
 };
+
+/**
+ * Cache of unpacked rkeys, keyed by (agent, address range).
+ *
+ * Re-loading a peer's metadata after a partial update presents mostly
+ * ranges that were already unpacked; the cache lets those loads reuse the
+ * existing rkeys instead of unpacking them again for every worker.
+ * Invalidation is generation based: invalidate() bumps the agent's
+ * generation and entries inserted under an older generation are dropped
+ * lazily on lookup.
+ *
+ * Each entry also records a fingerprint of the metadata blob it was
+ * unpacked from. A peer may deregister and re-register the same range
+ * with a new memh (and therefore a new rkey) without any endpoint ever
+ * failing; a lookup whose fingerprint differs from the stored one is
+ * treated as a miss and the entry is dropped, so a metadata re-load
+ * picks up the new rkeys instead of transferring with stale ones.
+ */
+class rkeyCache {
+public:
+    using rkeyList = std::vector<std::shared_ptr<const rkey>>;
+
+    [[nodiscard]] std::shared_ptr<const rkeyList>
+    lookup(const std::string &agent, uint64_t addr, size_t len, uint32_t fingerprint);
+
+    void
+    insert(const std::string &agent,
+           uint64_t addr,
+           size_t len,
+           uint32_t fingerprint,
+           std::shared_ptr<const rkeyList> rkeys);
+
+    /**
+     * Batched forms of lookup/insert for whole-metadata loads: one lock
+     * acquisition for the batch, and insertBatch reserves the hash table
+     * up front so the inserts don't rehash mid-batch. Range tuples are
+     * (addr, len, fingerprint).
+     */
+    void
+    lookupBatch(const std::string &agent,
+                const std::vector<std::tuple<uint64_t, size_t, uint32_t>> &ranges,
+                std::vector<std::shared_ptr<const rkeyList>> &rkeys);
+
+    void
+    insertBatch(
+        const std::string &agent,
+        const std::vector<
+            std::tuple<uint64_t, size_t, uint32_t, std::shared_ptr<const rkeyList>>> &ranges);
+
+    void
+    invalidate(const std::string &agent);
+
+private:
+    using rangeKey = std::tuple<std::string, uint64_t, size_t>;
+
+    struct entry {
+        uint64_t generation;
+        uint32_t fingerprint;
+        std::shared_ptr<const rkeyList> rkeys;
+    };
+
+    std::mutex lock_;
+    absl::flat_hash_map<std::string, uint64_t> generations_;
+    absl::flat_hash_map<rangeKey, entry> entries_;
+};
 } // namespace nixl::ucx
 #endif
@@ -309,6 +309,32 @@ nixlUcxEp::write(void *laddr,
     return ucx_status_to_nixl(UCS_PTR_STATUS(request));
 }
 
+nixl_status_t
+nixlUcxEp::writeFlag(const uint64_t &value,
+                     uint64_t raddr,
+                     const nixl::ucx::rkey &rkey,
+                     nixlUcxReq &req) {
+    nixl_status_t status = checkTxState();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    // No local memh: UCX copies or registers an 8-byte source internally.
+    // The caller keeps value alive until the request completes.
+    ucp_request_param_t param = {
+        .op_attr_mask = 0,
+    };
+
+    ucs_status_ptr_t request =
+        ucp_put_nbx(eph, &value, sizeof(value), raddr, rkey.get(), &param);
+    if (UCS_PTR_IS_PTR(request)) {
+        req = (void*)request;
+        return NIXL_IN_PROG;
+    }
+
+    return ucx_status_to_nixl(UCS_PTR_STATUS(request));
+}
+
 nixl_status_t nixlUcxEp::estimateCost(size_t size,
                                       std::chrono::microseconds &duration,
                                       std::chrono::microseconds &err_margin,
@@ -375,7 +401,8 @@ nixlUcxContext::nixlUcxContext(std::vector<std::string> devs,
                                nixlUcxContext::req_cb_t fini_cb,
                                bool prog_thread,
                                unsigned long num_workers,
-                               nixl_thread_sync_t sync_mode)
+                               nixl_thread_sync_t sync_mode,
+                               bool exclusive_workers)
 {
     ucp_params_t ucp_params;
 
@@ -383,7 +410,10 @@ nixlUcxContext::nixlUcxContext(std::vector<std::string> devs,
     // permissive models backends need to account for concurrent access and ensure their internal
     // state is properly protected. Progress thread creates internal concurrency in UCX backend
     // irrespective of nixlAgent synchronization model.
-    mt_type = (sync_mode == nixl_thread_sync_t::NIXL_THREAD_SYNC_RW || prog_thread) ?
+    // With exclusive workers every worker is driven by exactly one thread, so
+    // serialized worker mode is sufficient even for a concurrent agent.
+    mt_type = ((sync_mode == nixl_thread_sync_t::NIXL_THREAD_SYNC_RW && !exclusive_workers) ||
+               prog_thread) ?
         nixl_ucx_mt_t::WORKER : nixl_ucx_mt_t::SINGLE;
 
     ucp_params.field_mask = UCP_PARAM_FIELD_FEATURES | UCP_PARAM_FIELD_MT_WORKERS_SHARED;
@@ -586,6 +616,43 @@ void nixlUcxContext::memDereg(nixlUcxMem &mem)
     ucp_mem_unmap(ctx, mem.memh);
 }
 
+int nixlUcxContext::memPackExported(nixlUcxMem &mem, std::string &packed)
+{
+    ucp_memh_pack_params_t pack_params = {
+        .field_mask = UCP_MEMH_PACK_PARAM_FIELD_FLAGS,
+        .flags = UCP_MEMH_PACK_FLAG_EXPORT,
+    };
+
+    void* buf;
+    std::size_t size;
+    const ucs_status_t status = ucp_memh_pack(mem.memh, &pack_params,
+                                              &buf, &size);
+    if (status != UCS_OK) {
+        NIXL_ERROR << absl::StrFormat("Failed to ucp_memh_pack: %s",
+                                      ucs_status_string(status));
+        return -1;
+    }
+    packed = nixlSerDes::_bytesToString(buf, size);
+    ucp_memh_buffer_release(buf, nullptr);
+    return 0;
+}
+
+int nixlUcxContext::memImportExported(const std::string &packed, nixlUcxMem &mem)
+{
+    ucp_mem_map_params_t mem_params = {
+        .field_mask = UCP_MEM_MAP_PARAM_FIELD_EXPORTED_MEMH_BUFFER,
+        .exported_memh_buffer = const_cast<char*>(packed.data()),
+    };
+
+    const ucs_status_t status = ucp_mem_map(ctx, &mem_params, &mem.memh);
+    if (status != UCS_OK) {
+        NIXL_ERROR << absl::StrFormat("Failed to ucp_mem_map exported memh: %s",
+                                      ucs_status_string(status));
+        return -1;
+    }
+    return 0;
+}
+
 /* ===========================================
  * Active message handling
  * =========================================== */
@@ -620,6 +687,18 @@ int nixlUcxWorker::progress()
   return ucp_worker_progress(worker.get());
 }
 
+int nixlUcxWorker::drain()
+{
+    int total = 0;
+    int cnt;
+    while ((cnt = ucp_worker_progress(worker.get())) != 0) {
+        total += cnt;
+        if (progressBudget_ != 0 && (unsigned)total >= progressBudget_)
+            break;
+    }
+    return total;
+}
+
 nixl_status_t nixlUcxWorker::test(nixlUcxReq req)
 {
     if(req == nullptr) {
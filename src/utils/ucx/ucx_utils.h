@@ -142,6 +142,11 @@ public:
           const nixl::ucx::rkey &rkey,
           size_t size,
           nixlUcxReq &req);
+    [[nodiscard]] nixl_status_t
+    writeFlag(const uint64_t &value,
+              uint64_t raddr,
+              const nixl::ucx::rkey &rkey,
+              nixlUcxReq &req);
     nixl_status_t estimateCost(size_t size,
                                std::chrono::microseconds &duration,
                                std::chrono::microseconds &err_margin,
@@ -173,13 +178,17 @@ private:
 public:
 
     using req_cb_t = void(void *request);
+    // exclusive_workers promises that each worker is only ever driven by a
+    // single thread (shared-nothing mode), so workers can be created in
+    // serialized thread mode even when the agent itself is concurrent
     nixlUcxContext(std::vector<std::string> devices,
                    size_t req_size,
                    req_cb_t init_cb,
                    req_cb_t fini_cb,
                    bool prog_thread,
                    unsigned long num_workers,
-                   nixl_thread_sync_t sync_mode);
+                   nixl_thread_sync_t sync_mode,
+                   bool exclusive_workers = false);
     ~nixlUcxContext();
 
     /* Memory management */
@@ -187,6 +196,13 @@ public:
     [[nodiscard]] std::string packRkey(nixlUcxMem &mem);
     void memDereg(nixlUcxMem &mem);
 
+    /* Exported memory handles: pack a mapped region into a buffer another
+     * process on the same node can map without re-pinning, and the
+     * matching import. Requires UCX transports with exported memh
+     * support; both return non-zero otherwise. */
+    int memPackExported(nixlUcxMem &mem, std::string &packed);
+    int memImportExported(const std::string &packed, nixlUcxMem &mem);
+
     friend class nixlUcxWorker;
 };
 
@@ -212,6 +228,12 @@ public:
 
     /* Data access */
     int progress();
+    // Repeat progress() until a sweep services nothing or the worker's
+    // event budget is exhausted (0 = drain fully); returns the events
+    // serviced. Lets latency-sensitive status polls cap the time they
+    // spend completing other requests' work.
+    int drain();
+    void setProgressBudget(unsigned max_events) { progressBudget_ = max_events; }
     [[nodiscard]] nixl_status_t test(nixlUcxReq req);
 
     void reqRelease(nixlUcxReq req);
@@ -229,6 +251,8 @@ private:
 
     const std::unique_ptr<ucp_worker, void (*)(ucp_worker *)> worker;
     ucp_err_handling_mode_t err_handling_mode_;
+    // Event cap per drain() call, see setProgressBudget (0 = unbounded)
+    unsigned progressBudget_ = 0;
 };
 
 [[nodiscard]] nixl_b_params_t
@@ -34,6 +34,8 @@ private:
     std::shared_ptr<asioThreadPoolExecutor> executor_;
     std::vector<std::function<void()>> pendingCallbacks_;
     std::set<std::string> checkedKeys_;
+    size_t multipartUploadCount_ = 0;
+    size_t lastMultipartPartCount_ = 0;
 
 public:
     void
@@ -55,6 +57,18 @@ public:
         pendingCallbacks_.push_back([callback, this]() { callback(simulateSuccess_); });
     }
 
+    void
+    putObjectMultipartAsync(std::string_view key,
+                            uintptr_t data_ptr,
+                            size_t data_len,
+                            size_t part_size,
+                            size_t max_parallel,
+                            put_object_callback_t callback) override {
+        multipartUploadCount_++;
+        lastMultipartPartCount_ = part_size ? (data_len + part_size - 1) / part_size : 0;
+        pendingCallbacks_.push_back([callback, this]() { callback(simulateSuccess_); });
+    }
+
     void
     getObjectAsync(std::string_view key,
                    uintptr_t data_ptr,
@@ -78,6 +92,12 @@ public:
         return simulateSuccess_;
     }
 
+    void
+    checkObjectExistsAsync(std::string_view key, head_object_callback_t callback) override {
+        checkedKeys_.insert(std::string(key));
+        callback(NIXL_SUCCESS, simulateSuccess_);
+    }
+
     void
     execAsync() {
         for (auto &callback : pendingCallbacks_) {
@@ -101,6 +121,16 @@ public:
     hasExecutor() const {
         return executor_ != nullptr;
     }
+
+    size_t
+    getMultipartUploadCount() const {
+        return multipartUploadCount_;
+    }
+
+    size_t
+    getLastMultipartPartCount() const {
+        return lastMultipartPartCount_;
+    }
 };
 
 class objTestFixture : public testing::Test {
@@ -498,6 +528,154 @@ TEST_F(objTestFixture, AsyncWriteTransferFailureIsHandled) {
     testAsyncTransferFailureIsHandled(NIXL_WRITE);
 }
 
+TEST_F(objTestFixture, CoalescesAdjacentReadRanges) {
+    mockS3Client_->setSimulateSuccess(true);
+
+    std::vector<char> test_buffer(1024);
+
+    nixlBlobDesc local_desc;
+    local_desc.devId = 1;
+    nixlBackendMD *local_metadata = nullptr;
+    ASSERT_EQ(objEngine_->registerMem(local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+
+    nixlBlobDesc remote_desc;
+    remote_desc.devId = 2;
+    remote_desc.metaInfo = "test-coalesce-key";
+    nixlBackendMD *remote_metadata = nullptr;
+    ASSERT_EQ(objEngine_->registerMem(remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    nixl_meta_dlist_t local_descs(DRAM_SEG);
+    nixl_meta_dlist_t remote_descs(OBJ_SEG);
+
+    // Two descriptors covering adjacent object ranges backed by adjacent
+    // local memory; the backend should merge them into one ranged GET
+    const size_t half = test_buffer.size() / 2;
+    local_descs.addDesc(
+        nixlMetaDesc(reinterpret_cast<uintptr_t>(test_buffer.data()), half, local_desc.devId));
+    local_descs.addDesc(nixlMetaDesc(
+        reinterpret_cast<uintptr_t>(test_buffer.data()) + half, half, local_desc.devId));
+    remote_descs.addDesc(nixlMetaDesc(0, half, remote_desc.devId));
+    remote_descs.addDesc(nixlMetaDesc(half, half, remote_desc.devId));
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ(objEngine_->prepXfer(
+                  NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr),
+              NIXL_SUCCESS);
+    ASSERT_NE(handle, nullptr);
+
+    nixl_status_t status = objEngine_->postXfer(
+        NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr);
+    EXPECT_EQ(status, NIXL_IN_PROG);
+    EXPECT_EQ(mockS3Client_->getPendingCount(), 1);
+
+    mockS3Client_->execAsync();
+    status = objEngine_->checkXfer(handle);
+    EXPECT_EQ(status, NIXL_SUCCESS);
+    EXPECT_EQ(test_buffer[0], 'A');
+    EXPECT_EQ(test_buffer[half], 'A' + static_cast<char>(half % 26));
+
+    objEngine_->releaseReqH(handle);
+    objEngine_->deregisterMem(local_metadata);
+    objEngine_->deregisterMem(remote_metadata);
+}
+
+TEST_F(objTestFixture, MultipartWriteForLargeObject) {
+    nixl_b_params_t part_params = {{"obj_part_size", "256"}, {"obj_max_concurrent_parts", "2"}};
+    nixlBackendInitParams init_params = initParams_;
+    init_params.customParams = &part_params;
+    auto mock_client = std::make_shared<mockS3Client>();
+    auto engine = std::make_unique<nixlObjEngine>(&init_params, mock_client);
+
+    std::vector<char> test_buffer(1024, 'X');
+
+    nixlBlobDesc local_desc;
+    local_desc.devId = 1;
+    nixlBackendMD *local_metadata = nullptr;
+    ASSERT_EQ(engine->registerMem(local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+
+    nixlBlobDesc remote_desc;
+    remote_desc.devId = 2;
+    remote_desc.metaInfo = "test-multipart-key";
+    nixlBackendMD *remote_metadata = nullptr;
+    ASSERT_EQ(engine->registerMem(remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    nixl_meta_dlist_t local_descs(DRAM_SEG);
+    nixl_meta_dlist_t remote_descs(OBJ_SEG);
+    local_descs.addDesc(nixlMetaDesc(
+        reinterpret_cast<uintptr_t>(test_buffer.data()), test_buffer.size(), local_desc.devId));
+    remote_descs.addDesc(nixlMetaDesc(0, test_buffer.size(), remote_desc.devId));
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ(engine->prepXfer(
+                  NIXL_WRITE, local_descs, remote_descs, initParams_.localAgent, handle, nullptr),
+              NIXL_SUCCESS);
+    ASSERT_NE(handle, nullptr);
+
+    nixl_status_t status = engine->postXfer(
+        NIXL_WRITE, local_descs, remote_descs, initParams_.localAgent, handle, nullptr);
+    EXPECT_EQ(status, NIXL_IN_PROG);
+    EXPECT_EQ(mock_client->getMultipartUploadCount(), 1);
+    EXPECT_EQ(mock_client->getLastMultipartPartCount(), 4);
+
+    mock_client->execAsync();
+    status = engine->checkXfer(handle);
+    EXPECT_EQ(status, NIXL_SUCCESS);
+
+    engine->releaseReqH(handle);
+    engine->deregisterMem(local_metadata);
+    engine->deregisterMem(remote_metadata);
+}
+
+TEST_F(objTestFixture, LargeReadSplitsIntoRangedGets) {
+    nixl_b_params_t part_params = {{"obj_part_size", "256"}};
+    nixlBackendInitParams init_params = initParams_;
+    init_params.customParams = &part_params;
+    auto mock_client = std::make_shared<mockS3Client>();
+    auto engine = std::make_unique<nixlObjEngine>(&init_params, mock_client);
+
+    std::vector<char> test_buffer(1024);
+
+    nixlBlobDesc local_desc;
+    local_desc.devId = 1;
+    nixlBackendMD *local_metadata = nullptr;
+    ASSERT_EQ(engine->registerMem(local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+
+    nixlBlobDesc remote_desc;
+    remote_desc.devId = 2;
+    remote_desc.metaInfo = "test-split-read-key";
+    nixlBackendMD *remote_metadata = nullptr;
+    ASSERT_EQ(engine->registerMem(remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    nixl_meta_dlist_t local_descs(DRAM_SEG);
+    nixl_meta_dlist_t remote_descs(OBJ_SEG);
+    local_descs.addDesc(nixlMetaDesc(
+        reinterpret_cast<uintptr_t>(test_buffer.data()), test_buffer.size(), local_desc.devId));
+    remote_descs.addDesc(nixlMetaDesc(0, test_buffer.size(), remote_desc.devId));
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ(engine->prepXfer(
+                  NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr),
+              NIXL_SUCCESS);
+    ASSERT_NE(handle, nullptr);
+
+    nixl_status_t status = engine->postXfer(
+        NIXL_READ, local_descs, remote_descs, initParams_.localAgent, handle, nullptr);
+    EXPECT_EQ(status, NIXL_IN_PROG);
+    EXPECT_EQ(mock_client->getPendingCount(), 4);
+
+    mock_client->execAsync();
+    status = engine->checkXfer(handle);
+    EXPECT_EQ(status, NIXL_SUCCESS);
+    // Each chunk reads from its own object offset, so the pattern is seamless
+    for (size_t i = 0; i < test_buffer.size(); i += 256) {
+        EXPECT_EQ(test_buffer[i], 'A' + static_cast<char>(i % 26));
+    }
+
+    engine->releaseReqH(handle);
+    engine->deregisterMem(local_metadata);
+    engine->deregisterMem(remote_metadata);
+}
+
 TEST_F(objTestFixture, CheckObjectExists) {
     nixl_reg_dlist_t descs(OBJ_SEG);
     descs.addDesc(nixlBlobDesc(nixlBasicDesc(), "test-key-1"));
@@ -0,0 +1,162 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nixl_descriptors.h"
+#include "serdes/serdes.h"
+#include <cassert>
+#include <string>
+#include <vector>
+
+// Round-trip and malformed-input coverage for the compact descriptor-list
+// wire format (see encodeCompactDescs/decodeCompactDescs) and the legacy
+// struct forms older peers still send.
+
+namespace {
+    // Serialize through the public API and re-import into a fresh serdes,
+    // as the metadata exchange does
+    template <class T>
+    nixlSerDes reimport(const nixlDescList<T> &dlist) {
+        nixlSerDes sd;
+        assert(dlist.serialize(&sd) == NIXL_SUCCESS);
+        nixlSerDes sd2;
+        assert(sd2.importStr(sd.exportStr()) == NIXL_SUCCESS);
+        return sd2;
+    }
+
+    // Hand-build a serialized list with an arbitrary form tag, count and
+    // payload, to exercise the decode paths on inputs the current encoder
+    // never produces (legacy peers, truncation, corrupt headers)
+    nixlSerDes craft(const std::string &form, size_t n_desc,
+                     const std::vector<std::string> &payloads) {
+        nixlSerDes sd;
+        nixl_mem_t type = DRAM_SEG;
+        bool sorted = false;
+        assert(sd.addStr("nixlDList", form) == NIXL_SUCCESS);
+        assert(sd.addBuf("t", &type, sizeof(type)) == NIXL_SUCCESS);
+        assert(sd.addBuf("s", &sorted, sizeof(sorted)) == NIXL_SUCCESS);
+        assert(sd.addBuf("n", &n_desc, sizeof(n_desc)) == NIXL_SUCCESS);
+        for (const auto &p : payloads)
+            assert(sd.addStr("", p) == NIXL_SUCCESS);
+        nixlSerDes sd2;
+        assert(sd2.importStr(sd.exportStr()) == NIXL_SUCCESS);
+        return sd2;
+    }
+}
+
+int main() {
+
+    // Compact basic-desc form: uniform run plus breaks in len and devId,
+    // so both RLE streams carry more than one run
+    nixlDescList<nixlBasicDesc> bl(DRAM_SEG, false);
+    for (size_t i = 0; i < 8; ++i)
+        bl.addDesc(nixlBasicDesc(0x1000 + i * 0x100, 0x100, 0));
+    bl.addDesc(nixlBasicDesc(0x100, 0x40, 1));
+    bl.addDesc(nixlBasicDesc(0x10000, 0x2000, 1));
+
+    {
+        nixlSerDes sd = reimport(bl);
+        nixlDescList<nixlBasicDesc> out(&sd);
+        assert(out == bl);
+    }
+
+    // Compact blob-desc form, per-element meta blobs after the packed
+    // basic fields (empty metas allowed)
+    nixlDescList<nixlBlobDesc> sl(FILE_SEG, false);
+    sl.addDesc(nixlBlobDesc(0, 0x1000, 3, "meta-a"));
+    sl.addDesc(nixlBlobDesc(0x1000, 0x1000, 3, ""));
+    sl.addDesc(nixlBlobDesc(0x8000, 0x200, 4, "meta-c"));
+
+    {
+        nixlSerDes sd = reimport(sl);
+        nixlDescList<nixlBlobDesc> out(&sd);
+        assert(out == sl);
+    }
+
+    // Legacy contiguous struct form (nixlBDList)
+    {
+        std::string raw;
+        for (int i = 0; i < bl.descCount(); ++i)
+            raw += bl[i].serialize();
+        nixlSerDes sd = craft("nixlBDList", bl.descCount(), {raw});
+        nixlDescList<nixlBasicDesc> out(&sd);
+        assert(out.descCount() == bl.descCount());
+        for (int i = 0; i < bl.descCount(); ++i)
+            assert(out[i] == bl[i]);
+    }
+
+    // Legacy per-element struct-plus-meta form (nixlSDList)
+    {
+        std::vector<std::string> payloads;
+        for (int i = 0; i < sl.descCount(); ++i)
+            payloads.push_back(sl[i].serialize());
+        nixlSerDes sd = craft("nixlSDList", sl.descCount(), payloads);
+        nixlDescList<nixlBlobDesc> out(&sd);
+        assert(out.descCount() == sl.descCount());
+        for (int i = 0; i < sl.descCount(); ++i)
+            assert(out[i] == sl[i]);
+    }
+
+    // Recover the compact payload so it can be damaged deliberately
+    std::string compact;
+    {
+        nixlSerDes sd = reimport(bl);
+        assert(sd.getStr("nixlDList") == "nixlBVList");
+        nixl_mem_t t; bool s; size_t n;
+        assert(sd.getBuf("t", &t, sizeof(t)) == NIXL_SUCCESS);
+        assert(sd.getBuf("s", &s, sizeof(s)) == NIXL_SUCCESS);
+        assert(sd.getBuf("n", &n, sizeof(n)) == NIXL_SUCCESS);
+        compact = sd.getStr("");
+        assert(!compact.empty());
+    }
+
+    // Truncated compact payload: decode must fail into an empty list, not
+    // read past the view
+    for (size_t cut = 0; cut < compact.size(); cut += 3) {
+        nixlSerDes sd = craft("nixlBVList", bl.descCount(),
+                              {compact.substr(0, cut)});
+        nixlDescList<nixlBasicDesc> out(&sd);
+        assert(out.descCount() == 0);
+    }
+
+    // Corrupt count: a header claiming far more descriptors than payload
+    // bytes must be rejected before the resize can allocate
+    {
+        nixlSerDes sd = craft("nixlBVList", size_t(1) << 40, {compact});
+        nixlDescList<nixlBasicDesc> out(&sd);
+        assert(out.descCount() == 0);
+    }
+
+    // Trailing garbage after a valid payload is a framing error too
+    {
+        nixlSerDes sd = craft("nixlBVList", bl.descCount(),
+                              {compact + "\x01\x01"});
+        nixlDescList<nixlBasicDesc> out(&sd);
+        assert(out.descCount() == 0);
+    }
+
+    // Legacy struct form with a size/count mismatch must be rejected
+    {
+        std::string raw;
+        for (int i = 0; i < bl.descCount(); ++i)
+            raw += bl[i].serialize();
+        raw.resize(raw.size() - 1);
+        nixlSerDes sd = craft("nixlBDList", bl.descCount(), {raw});
+        nixlDescList<nixlBasicDesc> out(&sd);
+        assert(out.descCount() == 0);
+    }
+
+    return 0;
+}
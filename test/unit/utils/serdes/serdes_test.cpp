@@ -61,5 +61,47 @@ int main() {
 
     free(ptr);
 
+    // Zero-copy variant, view points into the imported blob
+    nixlSerDes sd3;
+    ret = sd3.importStr(sdbuf);
+    assert(ret == 0);
+
+    osize = sd3.getBufLen(t1);
+    assert(osize == sizeof(i));
+
+    int i2 = 0;
+    ret = sd3.getBuf(t1, &i2, sizeof(i2));
+    assert(ret == 0);
+    assert(i2 == 0xff);
+
+    std::string_view sv = sd3.getStrView(t2);
+    assert(sv.compare("testString") == 0);
+
+    // Recycled serializer: reset keeps the buffer usable for a fresh
+    // round of adds and the re-export matches a from-scratch one
+    sd.resetSerialize();
+    ret = sd.addBuf(t1, &i, sizeof(i));
+    assert(ret == 0);
+    ret = sd.addStr(t2, s);
+    assert(ret == 0);
+    assert(sd.exportStr() == sdbuf);
+
+    // Malformed input: a blob truncated inside the string body or inside
+    // the length field must yield an empty view, not an out-of-bounds
+    // read off an untrusted length
+    for (size_t cut : {sdbuf.size() - 4, sdbuf.size() - 12}) {
+        nixlSerDes sd4;
+        ret = sd4.importStr(sdbuf.substr(0, cut));
+        assert(ret == 0);
+
+        int i3 = 0;
+        ret = sd4.getBuf(t1, &i3, sizeof(i3));
+        assert(ret == 0);
+        assert(i3 == 0xff);
+
+        std::string_view bad = sd4.getStrView(t2);
+        assert(bad.empty());
+    }
+
     return 0;
 }